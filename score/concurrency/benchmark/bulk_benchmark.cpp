@@ -0,0 +1,147 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing score::cpp::execution::bulk() to posting tasks to the ThreadPool.
+///
+/// Every benchmark runs the same data-parallel loop over kItems elements with 1 to 8 workers:
+///   * PostPerItem  -> one Task per element is posted to a ThreadPool, i.e. one allocation and dispatch per element
+///   * PostPerChunk -> the elements are split by hand into four chunks per worker, each posted as one Task
+///   * Bulk         -> bulk() on the scheduler of a CpuContextExecutor, waited for by sync_wait()
+
+#include "score/concurrency/cpu_context_executor.h"
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <score/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::int32_t kItems{100000};
+
+/// Signals when all tasks of an iteration are done.
+class Completion
+{
+  public:
+    explicit Completion(const std::size_t tasks) : remaining_{tasks}, done_{}, future_{done_.get_future()} {}
+
+    void TaskDone()
+    {
+        if (remaining_.fetch_sub(1U) == 1U)
+        {
+            done_.set_value();
+        }
+    }
+
+    void Wait()
+    {
+        future_.wait();
+    }
+
+  private:
+    std::atomic<std::size_t> remaining_;
+    std::promise<void> done_;
+    std::future<void> future_;
+};
+
+/// The work done per element, small enough that dispatching dominates when every element is a Task.
+void Process(std::vector<double>& data, const std::int32_t index)
+{
+    auto& value = data[static_cast<std::size_t>(index)];
+    value = std::sqrt(value + static_cast<double>(index));
+}
+
+void PostPerItem(benchmark::State& state)
+{
+    ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+    std::vector<double> data(static_cast<std::size_t>(kItems), 1.0);
+    for (auto _ : state)
+    {
+        Completion completion{static_cast<std::size_t>(kItems)};
+        for (std::int32_t index = 0; index < kItems; ++index)
+        {
+            pool.Post([&data, &completion, index](const score::cpp::stop_token&) {
+                Process(data, index);
+                completion.TaskDone();
+            });
+        }
+        completion.Wait();
+    }
+    benchmark::DoNotOptimize(data.data());
+    state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+void PostPerChunk(benchmark::State& state)
+{
+    ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+    std::vector<double> data(static_cast<std::size_t>(kItems), 1.0);
+    const auto chunks = static_cast<std::int32_t>(state.range(0) * 4);
+    const std::int32_t chunk_size{(kItems + chunks - 1) / chunks};
+    for (auto _ : state)
+    {
+        Completion completion{static_cast<std::size_t>(chunks)};
+        for (std::int32_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            pool.Post([&data, &completion, chunk, chunk_size](const score::cpp::stop_token&) {
+                const std::int32_t end{std::min(kItems, (chunk + 1) * chunk_size)};
+                for (std::int32_t index = chunk * chunk_size; index < end; ++index)
+                {
+                    Process(data, index);
+                }
+                completion.TaskDone();
+            });
+        }
+        completion.Wait();
+    }
+    benchmark::DoNotOptimize(data.data());
+    state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+void Bulk(benchmark::State& state)
+{
+    CpuContextExecutor executor{static_cast<std::size_t>(state.range(0))};
+    auto scheduler = executor.GetScheduler();
+    std::vector<double> data(static_cast<std::size_t>(kItems), 1.0);
+    for (auto _ : state)
+    {
+        const bool completed = score::cpp::execution::sync_wait(
+            score::cpp::execution::schedule(scheduler) |
+            score::cpp::execution::bulk(scheduler, kItems, [&data](const std::int32_t index) {
+                Process(data, index);
+            }));
+        benchmark::DoNotOptimize(completed);
+    }
+    benchmark::DoNotOptimize(data.data());
+    state.SetItemsProcessed(state.iterations() * kItems);
+}
+
+BENCHMARK(PostPerItem)->ArgName("workers")->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(PostPerChunk)->ArgName("workers")->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(Bulk)->ArgName("workers")->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,207 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/// @file
+/// @brief Google Benchmark suite for the cost of posting small callables to an Executor.
+///
+///   * PostCallable       -> Executor::Post() of a small callable, whose Task memory is recycled by the Executor.
+///   * PostAllocatedTask  -> the same callable wrapped by SimpleTaskFactory::Make() into a Task that is allocated from
+///                           the memory resource of the Executor for every call, as Executor::Post() did before.
+///   * SubmitCallable     -> Executor::Submit() of a small callable and waiting for its result.
+///
+/// Every benchmark runs on an Executor that executes the Task within Enqueue() (inline) and on a ThreadPool with one
+/// worker. The counters report per Task the allocations from the memory resource of the Executor
+/// ("resource_allocations") and from the global operator new ("heap_allocations"), which is counted by replacing it.
+
+#include "score/concurrency/counting_memory_resource.h"
+#include "score/concurrency/executor.h"
+#include "score/concurrency/simple_task.h"
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <score/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace
+{
+std::atomic<std::size_t> g_allocations{0U};
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc) counting replacement of the global allocation functions
+void* operator new(const std::size_t size)
+{
+    g_allocations.fetch_add(1U, std::memory_order_relaxed);
+    void* const pointer = std::malloc((size == 0U) ? 1U : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return pointer;
+}
+
+void operator delete(void* const pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* const pointer, const std::size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc)
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::size_t kTasksPerIteration{200U};
+
+/// Executes every Task within Enqueue(), such that only the cost of creating and destroying Tasks is measured.
+class InlineExecutor final : public Executor
+{
+  public:
+    explicit InlineExecutor(score::cpp::pmr::memory_resource* memory_resource) : Executor{memory_resource} {}
+
+    std::size_t MaxConcurrencyLevel() const noexcept override
+    {
+        return 1U;
+    }
+
+    bool ShutdownRequested() const noexcept override
+    {
+        return false;
+    }
+
+    void Shutdown() noexcept override {}
+
+    void Enqueue(score::cpp::pmr::unique_ptr<Task> task) override
+    {
+        (*task)(task->GetStopSource().get_token());
+    }
+};
+
+enum class ExecutorKind : std::int64_t
+{
+    kInline,
+    kThreadPool,
+};
+
+std::unique_ptr<Executor> MakeExecutor(const ExecutorKind kind, score::cpp::pmr::memory_resource* memory_resource)
+{
+    if (kind == ExecutorKind::kThreadPool)
+    {
+        return std::make_unique<ThreadPool>(1U, memory_resource);
+    }
+    return std::make_unique<InlineExecutor>(memory_resource);
+}
+
+/// Signals when all tasks of an iteration are done.
+class Completion
+{
+  public:
+    explicit Completion(const std::size_t tasks) : remaining_{tasks}, done_{}, future_{done_.get_future()} {}
+
+    void TaskDone()
+    {
+        if (remaining_.fetch_sub(1U) == 1U)
+        {
+            done_.set_value();
+        }
+    }
+
+    void Wait()
+    {
+        future_.wait();
+    }
+
+  private:
+    std::atomic<std::size_t> remaining_;
+    std::promise<void> done_;
+    std::future<void> future_;
+};
+
+/// Runs kTasksPerIteration posts per iteration and reports the allocations per Task.
+template <typename PostFunction>
+void RunPosts(benchmark::State& state, PostFunction post)
+{
+    testing::CountingMemoryResource memory_resource{};
+    const std::unique_ptr<Executor> executor =
+        MakeExecutor(static_cast<ExecutorKind>(state.range(0)), &memory_resource);
+
+    const std::size_t resource_allocations_before = memory_resource.GetNumberOfAllocations();
+    const std::size_t heap_allocations_before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        Completion completion{kTasksPerIteration};
+        for (std::size_t task = 0U; task < kTasksPerIteration; ++task)
+        {
+            post(*executor, completion);
+        }
+        completion.Wait();
+    }
+    const std::size_t resource_allocations = memory_resource.GetNumberOfAllocations() - resource_allocations_before;
+    const std::size_t heap_allocations = g_allocations.load(std::memory_order_relaxed) - heap_allocations_before;
+
+    const auto tasks = static_cast<double>(state.iterations()) * static_cast<double>(kTasksPerIteration);
+    state.counters["resource_allocations"] = benchmark::Counter(static_cast<double>(resource_allocations) / tasks);
+    state.counters["heap_allocations"] = benchmark::Counter(static_cast<double>(heap_allocations) / tasks);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTasksPerIteration));
+}
+
+void PostCallable(benchmark::State& state)
+{
+    RunPosts(state, [](Executor& executor, Completion& completion) {
+        executor.Post([&completion](const score::cpp::stop_token&) {
+            completion.TaskDone();
+        });
+    });
+}
+
+void PostAllocatedTask(benchmark::State& state)
+{
+    RunPosts(state, [](Executor& executor, Completion& completion) {
+        auto task = SimpleTaskFactory::Make(executor.GetMemoryResource(), [&completion](const score::cpp::stop_token&) {
+            completion.TaskDone();
+        });
+        executor.Post(std::move(task));
+    });
+}
+
+void SubmitCallable(benchmark::State& state)
+{
+    RunPosts(state, [](Executor& executor, Completion& completion) {
+        auto result = executor.Submit([&completion](const score::cpp::stop_token&) {
+            completion.TaskDone();
+            return 42;
+        });
+        benchmark::DoNotOptimize(result.Get());
+    });
+}
+
+BENCHMARK(PostCallable)->ArgName("thread_pool")->DenseRange(0, 1)->UseRealTime();
+BENCHMARK(PostAllocatedTask)->ArgName("thread_pool")->DenseRange(0, 1)->UseRealTime();
+BENCHMARK(SubmitCallable)->ArgName("thread_pool")->DenseRange(0, 1)->UseRealTime();
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
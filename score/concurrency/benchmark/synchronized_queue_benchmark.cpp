@@ -0,0 +1,119 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing SynchronizedQueue with LockFreeSynchronizedQueue.
+///
+/// 1, 4 and 16 producer threads push small elements into a queue of 1024 elements, while the benchmark thread pops
+/// all of them. A producer that finds the queue full yields and retries. The reported items per second is the
+/// throughput of the whole pipeline, i.e. until the reader received every element.
+///
+/// PushPop measures the cost of one push and one pop on a single thread, without any contention or waiting.
+
+#include "score/concurrency/lock_free_synchronized_queue.h"
+#include "score/concurrency/synchronized_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+using namespace std::literals::chrono_literals;
+
+constexpr std::size_t kQueueLength{1024U};
+constexpr std::size_t kElementsPerIteration{64U * 1024U};
+
+template <typename Queue>
+void Producers(benchmark::State& state)
+{
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    const std::size_t elements_per_producer{kElementsPerIteration / producers};
+    Queue queue{kQueueLength};
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads{};
+        for (std::size_t producer = 0U; producer < producers; ++producer)
+        {
+            threads.emplace_back([&queue, elements_per_producer]() {
+                auto sender = queue.CreateSender();
+                for (std::size_t element = 0U; element < elements_per_producer; ++element)
+                {
+                    while (!sender.push(static_cast<std::uint64_t>(element)))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::size_t received = 0U; received < (producers * elements_per_producer);)
+        {
+            const auto element = queue.Pop(1s, score::cpp::stop_token{});
+            if (element.has_value())
+            {
+                benchmark::DoNotOptimize(element.value());
+                ++received;
+            }
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(producers * elements_per_producer));
+}
+
+template <typename Queue>
+void PushPop(benchmark::State& state)
+{
+    Queue queue{kQueueLength};
+    auto sender = queue.CreateSender();
+    std::uint64_t value{0U};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sender.push(value));
+        benchmark::DoNotOptimize(queue.Pop(1s, score::cpp::stop_token{}));
+        ++value;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(PushPop, SynchronizedQueue<std::uint64_t>);
+BENCHMARK_TEMPLATE(PushPop, LockFreeSynchronizedQueue<std::uint64_t>);
+
+BENCHMARK_TEMPLATE(Producers, SynchronizedQueue<std::uint64_t>)
+    ->ArgName("producers")
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(Producers, LockFreeSynchronizedQueue<std::uint64_t>)
+    ->ArgName("producers")
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
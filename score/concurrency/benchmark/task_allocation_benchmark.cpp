@@ -0,0 +1,185 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing memory resources for the Task allocations of Executor::Post().
+///
+/// Every benchmark runs with score::cpp::pmr::new_delete_resource(), synchronized_pool_resource and
+/// thread_caching_pool_resource:
+///   * Post  -> the benchmark thread posts short tasks to a ThreadPool with 1 to 8 workers. Every Task is allocated by
+///              the posting thread and deallocated by a worker.
+///   * Churn -> 1 to 8 threads allocate and deallocate blocks of the size of a Task as fast as possible.
+
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+#include <score/memory_resource.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::size_t kTasksPerIteration{10000U};
+constexpr std::size_t kMaxThreads{8U};
+
+enum class Resource : std::int64_t
+{
+    kNewDelete,
+    kSynchronizedPool,
+    kThreadCachingPool,
+};
+
+/// Creates the memory resource selected by the benchmark argument, or returns the new_delete_resource.
+class ResourceUnderTest
+{
+  public:
+    explicit ResourceUnderTest(const Resource resource) : owned_{}
+    {
+        switch (resource)
+        {
+            case Resource::kSynchronizedPool:
+                owned_ = std::make_unique<score::cpp::pmr::synchronized_pool_resource>(
+                    score::cpp::pmr::new_delete_resource());
+                break;
+            case Resource::kThreadCachingPool:
+                owned_ = std::make_unique<score::cpp::pmr::thread_caching_pool_resource>(
+                    score::cpp::pmr::pool_options{}, kMaxThreads + 1U, score::cpp::pmr::new_delete_resource());
+                break;
+            case Resource::kNewDelete:
+            default:
+                break;
+        }
+    }
+
+    score::cpp::pmr::memory_resource* Get() const noexcept
+    {
+        return (owned_ != nullptr) ? owned_.get() : score::cpp::pmr::new_delete_resource();
+    }
+
+  private:
+    std::unique_ptr<score::cpp::pmr::memory_resource> owned_;
+};
+
+/// Signals when all tasks of an iteration are done.
+class Completion
+{
+  public:
+    explicit Completion(const std::size_t tasks) : remaining_{tasks}, done_{}, future_{done_.get_future()} {}
+
+    void TaskDone()
+    {
+        if (remaining_.fetch_sub(1U) == 1U)
+        {
+            done_.set_value();
+        }
+    }
+
+    void Wait()
+    {
+        future_.wait();
+    }
+
+  private:
+    std::atomic<std::size_t> remaining_;
+    std::promise<void> done_;
+    std::future<void> future_;
+};
+
+void Post(benchmark::State& state)
+{
+    const ResourceUnderTest resource{static_cast<Resource>(state.range(0))};
+    ThreadPool pool{static_cast<std::size_t>(state.range(1)), resource.Get()};
+    for (auto _ : state)
+    {
+        Completion completion{kTasksPerIteration};
+        for (std::size_t task = 0U; task < kTasksPerIteration; ++task)
+        {
+            pool.Post([&completion](const score::cpp::stop_token&) {
+                completion.TaskDone();
+            });
+        }
+        completion.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTasksPerIteration));
+}
+
+score::cpp::pmr::memory_resource* SharedResource(const Resource resource)
+{
+    // Shared by all threads of a benchmark, thus created once for the whole run
+    static const ResourceUnderTest synchronized_pool{Resource::kSynchronizedPool};
+    static const ResourceUnderTest thread_caching_pool{Resource::kThreadCachingPool};
+    switch (resource)
+    {
+        case Resource::kSynchronizedPool:
+            return synchronized_pool.Get();
+        case Resource::kThreadCachingPool:
+            return thread_caching_pool.Get();
+        case Resource::kNewDelete:
+        default:
+            return score::cpp::pmr::new_delete_resource();
+    }
+}
+
+void Churn(benchmark::State& state)
+{
+    // Roughly the size of a Task that wraps a small callable
+    constexpr std::size_t kBlockSize{96U};
+    constexpr std::size_t kBlocksInFlight{16U};
+    score::cpp::pmr::memory_resource* const resource = SharedResource(static_cast<Resource>(state.range(0)));
+    std::array<void*, kBlocksInFlight> blocks{};
+    for (auto _ : state)
+    {
+        for (auto& block : blocks)
+        {
+            block = resource->allocate(kBlockSize, alignof(std::max_align_t));
+        }
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* const block : blocks)
+        {
+            resource->deallocate(block, kBlockSize, alignof(std::max_align_t));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kBlocksInFlight));
+}
+
+void ResourceArguments(benchmark::internal::Benchmark* const benchmark)
+{
+    benchmark->ArgNames({"resource", "workers"});
+    for (std::int64_t resource = 0; resource <= static_cast<std::int64_t>(Resource::kThreadCachingPool); ++resource)
+    {
+        for (std::int64_t workers = 1; workers <= static_cast<std::int64_t>(kMaxThreads); workers *= 2)
+        {
+            benchmark->Args({resource, workers});
+        }
+    }
+}
+
+BENCHMARK(Post)->Apply(ResourceArguments)->UseRealTime();
+BENCHMARK(Churn)
+    ->ArgName("resource")
+    ->DenseRange(0, static_cast<std::int64_t>(Resource::kThreadCachingPool))
+    ->ThreadRange(1, static_cast<int>(kMaxThreads));
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
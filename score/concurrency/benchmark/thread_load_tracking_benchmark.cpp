@@ -0,0 +1,119 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite measuring the overhead of one work token of the thread load tracking.
+///
+/// Every iteration starts and ends one work token. The benchmarks run with 1 to 8 threads on one shared instance:
+///   * Mutex     -> ThreadLoadTracking, which locks a mutex when a token ends
+///   * PerThread -> PerThreadLoadTracking, where every thread adds to counters on its own cache line
+///
+/// Both run with std::chrono::steady_clock and with GetHighResolutionTimePoint() as clock source.
+
+#include "score/concurrency/thread_load_tracking/high_resolution_time_point.h"
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+#include "score/concurrency/thread_load_tracking/thread_load_tracking.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::size_t kMaxThreads{8U};
+
+ThreadLoadTracking& MutexTracking()
+{
+    static ThreadLoadTracking tracking{};
+    return tracking;
+}
+
+ThreadLoadTracking& MutexTrackingHighResolution()
+{
+    static ThreadLoadTracking tracking{&GetHighResolutionTimePoint};
+    return tracking;
+}
+
+PerThreadLoadTracking& PerThreadTracking()
+{
+    static PerThreadLoadTracking tracking{kMaxThreads};
+    return tracking;
+}
+
+PerThreadLoadTracking& PerThreadTrackingHighResolution()
+{
+    static PerThreadLoadTracking tracking{kMaxThreads, &GetHighResolutionTimePoint};
+    return tracking;
+}
+
+void ClockSteady(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+    }
+}
+
+void ClockHighResolution(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(GetHighResolutionTimePoint());
+    }
+}
+
+template <ThreadLoadTracking& (*Tracking)()>
+void Mutex(benchmark::State& state)
+{
+    ThreadLoadTracking& tracking = Tracking();
+    for (auto _ : state)
+    {
+        auto token = tracking.StartWorking();
+    }
+    if (state.thread_index() == 0)
+    {
+        benchmark::DoNotOptimize(tracking.Calculate());
+    }
+}
+
+template <PerThreadLoadTracking& (*Tracking)()>
+void PerThread(benchmark::State& state)
+{
+    PerThreadLoadTracking& tracking = Tracking();
+    const auto thread_index = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state)
+    {
+        auto token = tracking.StartWorking(thread_index);
+    }
+    if (state.thread_index() == 0)
+    {
+        benchmark::DoNotOptimize(tracking.Calculate());
+    }
+}
+
+BENCHMARK(ClockSteady);
+BENCHMARK(ClockHighResolution);
+BENCHMARK_TEMPLATE(Mutex, MutexTracking)->ThreadRange(1, kMaxThreads);
+BENCHMARK_TEMPLATE(Mutex, MutexTrackingHighResolution)->ThreadRange(1, kMaxThreads);
+BENCHMARK_TEMPLATE(PerThread, PerThreadTracking)->ThreadRange(1, kMaxThreads);
+BENCHMARK_TEMPLATE(PerThread, PerThreadTrackingHighResolution)->ThreadRange(1, kMaxThreads);
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite measuring the task throughput of the ThreadPool under contention.
+///
+/// Every benchmark runs short tasks on pools with 1 to 16 workers and reports the executed tasks per second:
+///   * ExternalPost  -> the benchmark thread posts all tasks, i.e. they go through the inboxes of the workers
+///   * NestedPost    -> one root task per worker posts the tasks from within the pool, i.e. they go through the
+///                      work-stealing deques of the workers and idle workers have to steal
+///   * ManyProducers -> four external threads post tasks concurrently
+///
+/// Each task only increments a counter, so the numbers are dominated by the cost of queueing and dispatching.
+
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+constexpr std::size_t kTasksPerIteration{10000U};
+
+/// Counts the executed tasks and signals when all tasks of an iteration are done.
+class Completion
+{
+  public:
+    explicit Completion(const std::size_t tasks) : remaining_{tasks}, done_{}, future_{done_.get_future()} {}
+
+    void TaskDone()
+    {
+        if (remaining_.fetch_sub(1U) == 1U)
+        {
+            done_.set_value();
+        }
+    }
+
+    void Wait()
+    {
+        future_.wait();
+    }
+
+  private:
+    std::atomic<std::size_t> remaining_;
+    std::promise<void> done_;
+    std::future<void> future_;
+};
+
+void ExternalPost(benchmark::State& state)
+{
+    ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+    for (auto _ : state)
+    {
+        Completion completion{kTasksPerIteration};
+        for (std::size_t task = 0U; task < kTasksPerIteration; ++task)
+        {
+            pool.Post([&completion](const score::cpp::stop_token&) {
+                completion.TaskDone();
+            });
+        }
+        completion.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kTasksPerIteration));
+}
+
+void NestedPost(benchmark::State& state)
+{
+    const auto workers = static_cast<std::size_t>(state.range(0));
+    ThreadPool pool{workers};
+    const std::size_t tasks_per_root{kTasksPerIteration / workers};
+    for (auto _ : state)
+    {
+        Completion completion{workers * tasks_per_root};
+        for (std::size_t root = 0U; root < workers; ++root)
+        {
+            pool.Post([&pool, &completion, tasks_per_root](const score::cpp::stop_token&) {
+                for (std::size_t task = 0U; task < tasks_per_root; ++task)
+                {
+                    pool.Post([&completion](const score::cpp::stop_token&) {
+                        completion.TaskDone();
+                    });
+                }
+            });
+        }
+        completion.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(workers * tasks_per_root));
+}
+
+void ManyProducers(benchmark::State& state)
+{
+    constexpr std::size_t kProducers{4U};
+    ThreadPool pool{static_cast<std::size_t>(state.range(0))};
+    const std::size_t tasks_per_producer{kTasksPerIteration / kProducers};
+    for (auto _ : state)
+    {
+        Completion completion{kProducers * tasks_per_producer};
+        std::vector<std::thread> producers{};
+        for (std::size_t producer = 0U; producer < kProducers; ++producer)
+        {
+            producers.emplace_back([&pool, &completion, tasks_per_producer]() {
+                for (std::size_t task = 0U; task < tasks_per_producer; ++task)
+                {
+                    pool.Post([&completion](const score::cpp::stop_token&) {
+                        completion.TaskDone();
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        completion.Wait();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kProducers * tasks_per_producer));
+}
+
+BENCHMARK(ExternalPost)->ArgName("workers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(NestedPost)->ArgName("workers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK(ManyProducers)->ArgName("workers")->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,154 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing the scheduling structures of the ConcurrentTimedExecutor with many
+/// outstanding timers.
+///
+/// Every benchmark runs with 10k and 100k outstanding timers, spread over the next hour:
+///   * Insert -> cost of scheduling one more timer into the SortedTimerQueue resp. the TimerWheelQueue
+///   * Jitter -> a ConcurrentTimedExecutor on a single worker fires a probe timer 1 to 2 ms ahead, the benchmark
+///               reports the lateness of the probes as counters (p50, p99 and max in microseconds)
+
+#include "score/concurrency/thread_pool.h"
+#include "score/concurrency/timed_executor/concurrent_timed_executor.h"
+#include "score/concurrency/timed_executor/timer_queue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <random>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+/// Execution points of the outstanding timers, uniformly distributed over the next hour.
+std::vector<Clock::time_point> MakeExecutionPoints(const std::size_t count, const Clock::time_point now)
+{
+    std::mt19937_64 generator{42U};
+    std::uniform_int_distribution<std::int64_t> distribution{0, std::chrono::microseconds{1h}.count()};
+    std::vector<Clock::time_point> execution_points(count);
+    for (auto& execution_point : execution_points)
+    {
+        execution_point = now + std::chrono::microseconds{distribution(generator)};
+    }
+    return execution_points;
+}
+
+template <class TimerQueue>
+void Insert(benchmark::State& state)
+{
+    const auto outstanding = static_cast<std::size_t>(state.range(0));
+    auto* const memory_resource = score::cpp::pmr::new_delete_resource();
+    const auto execution_points = MakeExecutionPoints(2U * outstanding, Clock::now());
+
+    //  The queue is refilled to the number of outstanding timers after each round, so its size stays in between:
+    std::size_t next{outstanding};
+    TimerQueue queue{memory_resource};
+    for (auto _ : state)
+    {
+        if (next == execution_points.size())
+        {
+            state.PauseTiming();
+            queue = TimerQueue{memory_resource};
+            for (std::size_t index{0U}; index < outstanding; ++index)
+            {
+                queue.Insert(execution_points[index], nullptr);
+            }
+            next = outstanding;
+            state.ResumeTiming();
+        }
+        queue.Insert(execution_points[next], nullptr);
+        ++next;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <class TimerQueue>
+void Jitter(benchmark::State& state)
+{
+    constexpr std::size_t kProbesPerIteration{50U};
+    const auto outstanding = static_cast<std::size_t>(state.range(0));
+    auto* const memory_resource = score::cpp::pmr::new_delete_resource();
+    ConcurrentTimedExecutor<Clock, TimerQueue> executor{
+        memory_resource, score::cpp::pmr::make_unique<ThreadPool>(memory_resource, std::size_t{1U})};
+
+    //  Sorted ascending, the outstanding timers do not dominate the setup of the SortedTimerQueue:
+    auto execution_points = MakeExecutionPoints(outstanding, Clock::now() + 1h);
+    std::sort(execution_points.begin(), execution_points.end());
+    for (const auto execution_point : execution_points)
+    {
+        executor.Post(execution_point, [](auto, auto) noexcept {});
+    }
+
+    std::mt19937_64 generator{7U};
+    std::uniform_int_distribution<std::int64_t> delay{1000, 2000};
+    std::vector<double> lateness_us{};
+    for (auto _ : state)
+    {
+        for (std::size_t probe{0U}; probe < kProbesPerIteration; ++probe)
+        {
+            const auto execution_point = Clock::now() + std::chrono::microseconds{delay(generator)};
+            std::promise<Clock::time_point> fired{};
+            auto fired_at = fired.get_future();
+            executor.Post(execution_point, [&fired](auto, auto) noexcept {
+                fired.set_value(Clock::now());
+            });
+            const std::chrono::duration<double, std::micro> lateness{fired_at.get() - execution_point};
+            lateness_us.push_back(lateness.count());
+        }
+    }
+
+    std::sort(lateness_us.begin(), lateness_us.end());
+    const auto percentile = [&lateness_us](const std::size_t percent) {
+        return lateness_us[((lateness_us.size() - 1U) * percent) / 100U];
+    };
+    state.counters["p50_us"] = percentile(50U);
+    state.counters["p99_us"] = percentile(99U);
+    state.counters["max_us"] = lateness_us.back();
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kProbesPerIteration));
+}
+
+BENCHMARK_TEMPLATE(Insert, SortedTimerQueue<Clock>)->ArgName("outstanding")->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(Insert, TimerWheelQueue<Clock>)->ArgName("outstanding")->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(Jitter, SortedTimerQueue<Clock>)
+    ->ArgName("outstanding")
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(Jitter, TimerWheelQueue<Clock>)
+    ->ArgName("outstanding")
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
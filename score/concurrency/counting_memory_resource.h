@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_COUNTING_MEMORY_RESOURCE_H
+#define SCORE_LIB_CONCURRENCY_COUNTING_MEMORY_RESOURCE_H
+
+#include <score/memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace score
+{
+namespace concurrency
+{
+namespace testing
+{
+
+/// \brief Forwards to the new_delete_resource and counts the allocations.
+///
+/// \details The counters may be read while other threads allocate, e.g. the workers of a ThreadPool.
+class CountingMemoryResource final : public score::cpp::pmr::memory_resource
+{
+  public:
+    std::size_t GetNumberOfAllocations() const noexcept
+    {
+        return number_of_allocations_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t GetNumberOfOutstandingAllocations() const noexcept
+    {
+        return number_of_outstanding_allocations_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t GetLastAllocatedBytes() const noexcept
+    {
+        return last_allocated_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Lets every following allocation throw std::bad_alloc, as long as failing is set.
+    void FailAllocations(const bool fail) noexcept
+    {
+        fail_allocations_.store(fail, std::memory_order_relaxed);
+    }
+
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        if (fail_allocations_.load(std::memory_order_relaxed))
+        {
+            throw std::bad_alloc{};
+        }
+        void* const pointer = score::cpp::pmr::new_delete_resource()->allocate(bytes, alignment);
+        number_of_allocations_.fetch_add(1U, std::memory_order_relaxed);
+        number_of_outstanding_allocations_.fetch_add(1U, std::memory_order_relaxed);
+        last_allocated_bytes_.store(bytes, std::memory_order_relaxed);
+        return pointer;
+    }
+
+    void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment) override
+    {
+        number_of_outstanding_allocations_.fetch_sub(1U, std::memory_order_relaxed);
+        score::cpp::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::atomic<std::size_t> number_of_allocations_{0U};
+    std::atomic<std::size_t> number_of_outstanding_allocations_{0U};
+    std::atomic<std::size_t> last_allocated_bytes_{0U};
+    std::atomic<bool> fail_allocations_{false};
+};
+
+}  // namespace testing
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_COUNTING_MEMORY_RESOURCE_H
@@ -0,0 +1,156 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/cpu_context_executor.h"
+
+#include <score/utility.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief Keeps an enqueued task and the operation state that schedules it on the cpu_context alive until the task
+ * ran. It is allocated from the memory_resource of the executor and destroys itself once the task was taken out.
+ */
+class CpuContextExecutor::ScheduledTask
+{
+    class Receiver
+    {
+      public:
+        using receiver_concept = score::cpp::execution::receiver_t;
+
+        explicit Receiver(ScheduledTask& scheduled_task) noexcept : scheduled_task_{&scheduled_task} {}
+
+        void set_value() &&
+        {
+            scheduled_task_->Run();
+        }
+        // Invoked for tasks that are still queued when the context is destroyed. The shutdown was requested by then,
+        // so the task observes a stop request, as it would in a ThreadPool.
+        void set_stopped() &&
+        {
+            scheduled_task_->Run();
+        }
+
+      private:
+        ScheduledTask* scheduled_task_;
+    };
+
+  public:
+    static void Schedule(CpuContextExecutor& executor, score::cpp::pmr::unique_ptr<Task> task)
+    {
+        score::cpp::pmr::polymorphic_allocator<ScheduledTask> allocator{executor.GetMemoryResource()};
+        ScheduledTask* const scheduled_task = allocator.allocate(1U);
+        // The operation state must not move once connected, thus the task is constructed in place
+        ::new (static_cast<void*>(scheduled_task)) ScheduledTask{executor, std::move(task)};
+        score::cpp::execution::start(scheduled_task->operation_);
+    }
+
+    ScheduledTask(const ScheduledTask&) = delete;
+    ScheduledTask(ScheduledTask&&) = delete;
+    ScheduledTask& operator=(const ScheduledTask&) = delete;
+    ScheduledTask& operator=(ScheduledTask&&) = delete;
+    ~ScheduledTask() = default;
+
+  private:
+    using Operation = decltype(score::cpp::execution::connect(
+        score::cpp::execution::schedule(std::declval<score::cpp::execution::cpu_scheduler>()),
+        std::declval<Receiver>()));
+
+    ScheduledTask(CpuContextExecutor& executor, score::cpp::pmr::unique_ptr<Task> task)
+        : executor_{&executor},
+          task_{std::move(task)},
+          operation_{score::cpp::execution::connect(score::cpp::execution::schedule(executor.GetScheduler()),
+                                                    Receiver{*this})}
+    {
+    }
+
+    void Run()
+    {
+        // The bookkeeping is released before the task runs, the operation state is not accessed after set_value()
+        CpuContextExecutor& executor = *executor_;
+        score::cpp::pmr::unique_ptr<Task> task{std::move(task_)};
+        score::cpp::pmr::polymorphic_allocator<ScheduledTask> allocator{executor.GetMemoryResource()};
+        this->~ScheduledTask();
+        allocator.deallocate(this, 1U);
+        executor.Execute(std::move(task));
+    }
+
+    CpuContextExecutor* executor_;
+    score::cpp::pmr::unique_ptr<Task> task_;
+    Operation operation_;
+};
+
+CpuContextExecutor::CpuContextExecutor(const std::size_t number_of_threads,
+                                       score::cpp::pmr::memory_resource* memory_resource)
+    : Executor{memory_resource},
+      shutdown_requested_{false},
+      shutdown_source_{},
+      context_{score::cpp::pmr::polymorphic_allocator<>{memory_resource},
+               score::cpp::execution::cpu_context::worker_count{static_cast<std::int32_t>(number_of_threads)}}
+{
+}
+
+CpuContextExecutor::~CpuContextExecutor() noexcept
+{
+    Shutdown();
+}
+
+std::size_t CpuContextExecutor::MaxConcurrencyLevel() const noexcept
+{
+    return static_cast<std::size_t>(context_.max_concurrency());
+}
+
+bool CpuContextExecutor::ShutdownRequested() const noexcept
+{
+    return shutdown_requested_.load();
+}
+
+void CpuContextExecutor::Shutdown() noexcept
+{
+    shutdown_requested_.store(true);
+    score::cpp::ignore = shutdown_source_.request_stop();
+}
+
+void CpuContextExecutor::Enqueue(score::cpp::pmr::unique_ptr<Task> task)
+{
+    if (ShutdownRequested())
+    {
+        Execute(std::move(task));
+        return;
+    }
+    ScheduledTask::Schedule(*this, std::move(task));
+}
+
+score::cpp::execution::cpu_scheduler CpuContextExecutor::GetScheduler() noexcept
+{
+    return context_.get_scheduler();
+}
+
+void CpuContextExecutor::Execute(score::cpp::pmr::unique_ptr<Task> task)
+{
+    // Forwards a shutdown that is requested while the task runs, like the ThreadPool does for its active tasks
+    score::cpp::stop_callback forward_shutdown{shutdown_source_.get_token(), [&task]() noexcept {
+                                                   score::cpp::ignore = task->GetStopSource().request_stop();
+                                               }};
+    std::invoke(*task, task->GetStopSource().get_token());
+}
+
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,89 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_CPU_CONTEXT_EXECUTOR_H
+#define SCORE_LIB_CONCURRENCY_CPU_CONTEXT_EXECUTOR_H
+
+#include "score/concurrency/executor.h"
+#include "score/concurrency/task.h"
+
+#include <score/execution.hpp>
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+#include <score/stop_token.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief CpuContextExecutor is an execution policy for the Executor interface that runs its tasks on a
+ * score::cpp::execution::cpu_context.
+ *
+ * It allows code written against the Executor interface and sender based code to share one fixed set of worker
+ * threads. The scheduler of the underlying context is exposed by GetScheduler(), e.g. to split a loop into chunks with
+ * score::cpp::execution::bulk() while other parts of the application keep posting tasks.
+ *
+ * The bookkeeping of every enqueued task is allocated from the memory_resource of the Executor.
+ */
+class CpuContextExecutor final : public Executor
+{
+  public:
+    /**
+     * \brief Creates an executor backed by a cpu_context with a fixed number of threads.
+     *
+     * \param number_of_threads The number of threads that will be started
+     * \param memory_resource The resource to acquire memory for enqueuing tasks
+     */
+    explicit CpuContextExecutor(
+        const std::size_t number_of_threads,
+        score::cpp::pmr::memory_resource* memory_resource = score::cpp::pmr::get_default_resource());
+
+    ~CpuContextExecutor() noexcept override;
+
+    CpuContextExecutor(const CpuContextExecutor&) = delete;
+    CpuContextExecutor(CpuContextExecutor&&) noexcept = delete;
+    CpuContextExecutor& operator=(const CpuContextExecutor&) = delete;
+    CpuContextExecutor& operator=(CpuContextExecutor&&) noexcept = delete;
+
+    std::size_t MaxConcurrencyLevel() const noexcept override;
+    bool ShutdownRequested() const noexcept override;
+    void Shutdown() noexcept override;
+    void Enqueue(score::cpp::pmr::unique_ptr<Task> task) override;
+
+    /**
+     * \brief Returns the scheduler of the underlying cpu_context.
+     *
+     * Work that is scheduled on it runs on the same threads as the tasks of this executor. The scheduler must not be
+     * used after the executor was destroyed.
+     */
+    score::cpp::execution::cpu_scheduler GetScheduler() noexcept;
+
+  private:
+    class ScheduledTask;
+
+    void Execute(score::cpp::pmr::unique_ptr<Task> task);
+
+    std::atomic<bool> shutdown_requested_;
+    score::cpp::stop_source shutdown_source_;
+    // Declared last, so that the workers are joined before the members they use are destroyed
+    score::cpp::execution::cpu_context context_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_CPU_CONTEXT_EXECUTOR_H
@@ -0,0 +1,192 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/cpu_context_executor.h"
+#include "score/concurrency/notification.h"
+
+#include <score/execution.hpp>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+TEST(CpuContextExecutor, ConstructionAndDestructionOnStack)
+{
+    CpuContextExecutor unit{1U};
+}
+
+TEST(CpuContextExecutor, ExecutesSubmittedCallables)
+{
+    // Given a CpuContextExecutor with two threads
+    CpuContextExecutor unit{2U};
+
+    // When submitting two tasks
+    std::atomic<std::size_t> counter{0};
+    auto f = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+    auto f2 = unit.Submit([&counter](const score::cpp::stop_token&) noexcept {
+        counter++;
+    });
+
+    // Then both tasks are executed
+    EXPECT_TRUE(f.Get());
+    EXPECT_TRUE(f2.Get());
+    ASSERT_EQ(counter, 2U);
+}
+
+TEST(CpuContextExecutor, ExecutesPostedCallables)
+{
+    // Given a CpuContextExecutor with one thread
+    CpuContextExecutor unit{1U};
+
+    // When posting a task
+    concurrency::Notification done{};
+    unit.Post([&done](const score::cpp::stop_token&) noexcept {
+        done.notify();
+    });
+
+    // Then it is executed
+    EXPECT_TRUE(done.waitWithAbort({}));
+}
+
+TEST(CpuContextExecutor, CorrectMaxConcurrencyLevel)
+{
+    // Given a CpuContextExecutor with 3 threads
+    CpuContextExecutor unit{3U};
+
+    // When querying the maximum concurrency level
+    // Then 3 is returned
+    ASSERT_EQ(unit.MaxConcurrencyLevel(), 3U);
+}
+
+TEST(CpuContextExecutor, ShutdownStopsRunningTasks)
+{
+    // Given a CpuContextExecutor with one long running task
+    CpuContextExecutor unit{1U};
+    concurrency::Notification started{};
+    auto f = unit.Submit([&started](const score::cpp::stop_token& token) noexcept {
+        started.notify();
+        while (!token.stop_requested())
+        {
+            std::this_thread::yield();
+        }
+    });
+    ASSERT_TRUE(started.waitWithAbort({}));
+
+    // When calling the executor to shutdown
+    ASSERT_FALSE(unit.ShutdownRequested());
+    unit.Shutdown();
+
+    // Then the running task is requested to stop
+    ASSERT_TRUE(unit.ShutdownRequested());
+    EXPECT_TRUE(f.Get());
+}
+
+TEST(CpuContextExecutor, DestructionExecutesQueuedTasks)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a CpuContextExecutor with one thread
+    std::optional<CpuContextExecutor> unit{1U};
+
+    // When posting long running tasks and immediately destroying the executor afterwards
+    for (std::size_t i = 0U; i < 3U; ++i)
+    {
+        unit->Post([&counter](const score::cpp::stop_token& token) noexcept {
+            while (!token.stop_requested())
+            {
+                std::this_thread::yield();
+            }
+            ++counter;
+        });
+    }
+    unit.reset();
+
+    // Then all queued tasks were executed with a stop request
+    ASSERT_EQ(counter, 3U);
+}
+
+TEST(CpuContextExecutor, PostTaskWhileExecutorWasAlreadyRequestedToShutDown)
+{
+    std::atomic<std::size_t> counter{0};
+
+    // Given a CpuContextExecutor which got already shutdown
+    CpuContextExecutor unit{1U};
+    unit.Shutdown();
+
+    // When posting one task
+    bool stop_requested{false};
+    unit.Post([&counter, &stop_requested](const score::cpp::stop_token& token) noexcept {
+        stop_requested = token.stop_requested();
+        ++counter;
+    });
+
+    // Then the task was executed right away with a stop request
+    ASSERT_EQ(counter, 1U);
+    EXPECT_TRUE(stop_requested);
+}
+
+TEST(CpuContextExecutor, PostTaskFromWithinAnotherTask)
+{
+    concurrency::Notification done{};
+
+    // Given a CpuContextExecutor with one thread
+    CpuContextExecutor unit{1U};
+
+    // When posting a task which itself posts another task
+    unit.Post([&unit, &done](const score::cpp::stop_token&) {
+        unit.Post([&done](const score::cpp::stop_token&) {
+            done.notify();
+        });
+    });
+
+    // Then the second task is executed as well
+    EXPECT_TRUE(done.waitWithAbort({}));
+}
+
+TEST(CpuContextExecutor, BulkRunsOnTheSameThreads)
+{
+    // Given a CpuContextExecutor with two threads
+    CpuContextExecutor unit{2U};
+    auto scheduler = unit.GetScheduler();
+
+    // When a loop is split into chunks on its scheduler
+    std::vector<std::int32_t> values(100U, 0);
+    const bool completed = score::cpp::execution::sync_wait(
+        score::cpp::execution::schedule(scheduler) |
+        score::cpp::execution::bulk(scheduler, static_cast<std::int32_t>(values.size()), [&values](std::int32_t i) {
+            values[static_cast<std::size_t>(i)] = i;
+        }));
+
+    // Then every index was processed exactly once
+    ASSERT_TRUE(completed);
+    for (std::size_t i = 0U; i < values.size(); ++i)
+    {
+        EXPECT_EQ(values[i], static_cast<std::int32_t>(i));
+    }
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
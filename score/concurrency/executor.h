@@ -15,6 +15,7 @@
 
 #include "score/concurrency/simple_task.h"
 #include "score/concurrency/task.h"
+#include "score/concurrency/task_free_list.h"
 
 #include <score/memory.hpp>
 #include <score/memory_resource.hpp>
@@ -34,7 +35,11 @@ namespace concurrency
  * It enables to post or submit any Callable or Task to be asynchronously
  * scheduled by an explicit execution policy (e.g. a ThreadPool).
  *
- * The Executor is not copieable, but moveable.
+ * The Executor is neither copieable nor moveable.
+ *
+ * Tasks for posted or submitted callables are allocated from a TaskFreeList on top of the memory_resource of the
+ * Executor. Thus small callables reuse the memory of previous tasks instead of allocating for every call. The
+ * TaskFreeList itself is allocated from the memory_resource on construction of every Executor.
  */
 class Executor
 {
@@ -45,16 +50,14 @@ class Executor
 
   public:
     explicit Executor(score::cpp::pmr::memory_resource* memory_resource = score::cpp::pmr::get_default_resource())
-        : memory_resource_{memory_resource} {};
+        : memory_resource_{memory_resource}, task_free_list_{TaskFreeList::Make(memory_resource)} {};
     virtual ~Executor() noexcept = default;
     Executor(const Executor&) = delete;
     Executor& operator=(const Executor&) = delete;
+    // A moved-from Executor would lack the TaskFreeList that Post() and Submit() allocate from
+    Executor(Executor&&) noexcept = delete;
+    Executor& operator=(Executor&&) noexcept = delete;
 
-  protected:
-    Executor(Executor&&) noexcept = default;
-    Executor& operator=(Executor&&) noexcept = default;
-
-  public:
     /**
      * \return The maximumConcurrencyLevel of this Executor instantiation
      */
@@ -145,8 +148,9 @@ class Executor
     // coverity[autosar_cpp14_a7_1_8_violation] false-positive
     static void DoPost(ExecutorType& executor, CallableType&& callable, ArgumentTypes&&... arguments)
     {
-        auto task = SimpleTaskFactory::Make(
-            executor.memory_resource_, std::forward<CallableType>(callable), std::forward<ArgumentTypes>(arguments)...);
+        auto task = SimpleTaskFactory::MakeDetached(executor.task_free_list_.get(),
+                                                    std::forward<CallableType>(callable),
+                                                    std::forward<ArgumentTypes>(arguments)...);
         executor.Enqueue(std::move(task));
     }
 
@@ -157,14 +161,16 @@ class Executor
     // coverity[autosar_cpp14_a7_1_8_violation] false-positive
     static auto DoSubmit(ExecutorType& executor, CallableType&& callable, ArgumentTypes&&... arguments)
     {
-        auto task = SimpleTaskFactory::MakeWithTaskResult(
-            executor.memory_resource_, std::forward<CallableType>(callable), std::forward<ArgumentTypes>(arguments)...);
+        auto task = SimpleTaskFactory::MakeWithTaskResult(executor.task_free_list_.get(),
+                                                          std::forward<CallableType>(callable),
+                                                          std::forward<ArgumentTypes>(arguments)...);
         executor.Enqueue(std::move(task.second));
         return std::move(task.first);
     }
 
   private:
     score::cpp::pmr::memory_resource* memory_resource_;
+    TaskFreeList::Pointer task_free_list_;
 };
 
 }  // namespace concurrency
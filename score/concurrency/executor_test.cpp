@@ -11,9 +11,11 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/concurrency/executor.h"
+#include "score/concurrency/counting_memory_resource.h"
 
 #include "gtest/gtest.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace score
@@ -207,6 +209,92 @@ TEST_F(ExecutorTest, GetMemoryResource)
     EXPECT_EQ(custom_unit.GetMemoryResource(), &custom_memory_resource);
 }
 
+TEST_F(ExecutorTest, postCallableReturningValue)
+{
+    // Given an Executor
+
+    // When posting a callable that returns a value
+    bool isExecuted{false};
+    unit.Post([&isExecuted](const score::cpp::stop_token&) noexcept {
+        isExecuted = true;
+        return 42;
+    });
+
+    // That the callable is stored and can be executed, while its result is discarded
+    ASSERT_EQ(unit.enqueuedTasks.size(), 1);
+    (*(unit.enqueuedTasks.front()))(score::cpp::stop_token{});
+    ASSERT_TRUE(isExecuted);
+}
+
+TEST_F(ExecutorTest, PostedTasksReuseMemoryOfPreviousTasks)
+{
+    // Given an Executor that already ran a posted task
+    testing::CountingMemoryResource memory_resource{};
+    DummyExecutor custom_unit{&memory_resource};
+    std::size_t number_of_executions{0U};
+    const auto post_and_run = [&custom_unit, &number_of_executions]() {
+        custom_unit.Post([&number_of_executions](const score::cpp::stop_token&) noexcept {
+            ++number_of_executions;
+        });
+        (*(custom_unit.enqueuedTasks.front()))(score::cpp::stop_token{});
+        custom_unit.enqueuedTasks.clear();
+    };
+    post_and_run();
+    const auto number_of_allocations = memory_resource.GetNumberOfAllocations();
+
+    // When posting and running further small callables
+    for (std::size_t i{0U}; i < 10U; ++i)
+    {
+        post_and_run();
+    }
+
+    // Then no memory is allocated from the memory resource of the Executor
+    EXPECT_EQ(number_of_executions, 11U);
+    EXPECT_EQ(memory_resource.GetNumberOfAllocations(), number_of_allocations);
+}
+
+TEST_F(ExecutorTest, SubmittedTasksReuseMemoryOfPreviousTasks)
+{
+    // Given an Executor that already ran a submitted task
+    testing::CountingMemoryResource memory_resource{};
+    DummyExecutor custom_unit{&memory_resource};
+    const auto submit_and_run = [&custom_unit]() {
+        auto result = custom_unit.Submit([](const score::cpp::stop_token&) noexcept {
+            return 42;
+        });
+        (*(custom_unit.enqueuedTasks.front()))(score::cpp::stop_token{});
+        custom_unit.enqueuedTasks.clear();
+        return result.Get().value();
+    };
+    ASSERT_EQ(submit_and_run(), 42);
+    const auto number_of_allocations = memory_resource.GetNumberOfAllocations();
+
+    // When submitting another small callable
+    // Then its result is available and no memory is allocated from the memory resource of the Executor
+    EXPECT_EQ(submit_and_run(), 42);
+    EXPECT_EQ(memory_resource.GetNumberOfAllocations(), number_of_allocations);
+}
+
+TEST_F(ExecutorTest, PostedTaskMayOutliveExecutor)
+{
+    // Given a task that was posted to an Executor and taken out of it
+    testing::CountingMemoryResource memory_resource{};
+    score::cpp::pmr::unique_ptr<Task> task{};
+    {
+        DummyExecutor custom_unit{&memory_resource};
+        custom_unit.Post([](const score::cpp::stop_token&) noexcept {});
+        task = std::move(custom_unit.enqueuedTasks.front());
+
+        // When the Executor is destroyed
+    }
+
+    // Then the task can still be executed and all memory is returned once it is destroyed
+    (*task)(score::cpp::stop_token{});
+    EXPECT_GT(memory_resource.GetNumberOfOutstandingAllocations(), 0U);
+    task = nullptr;
+    EXPECT_EQ(memory_resource.GetNumberOfOutstandingAllocations(), 0U);
+}
+
 }  // namespace
 }  // namespace concurrency
 }  // namespace score
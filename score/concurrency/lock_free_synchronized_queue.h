@@ -0,0 +1,369 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_LOCK_FREE_SYNCHRONIZED_QUEUE_H
+#define SCORE_LIB_CONCURRENCY_LOCK_FREE_SYNCHRONIZED_QUEUE_H
+
+#include "score/concurrency/atomic_indirector.h"
+#include "score/concurrency/notification.h"
+
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace score::concurrency
+{
+namespace details
+{
+
+/// \brief Size that keeps data written by different threads on different cache lines
+constexpr std::size_t kCacheLineSize{64U};
+
+/// \brief The LockFreeSharedState class contains the ring buffer shared between LockFreeSynchronizedQueue and its
+/// senders
+///
+/// \details The ring buffer follows the bounded queue of Dmitry Vyukov: every slot carries a sequence number that
+/// tells whether the slot is free for the producer at a given position or filled for the consumer at that position.
+/// Producers claim a position with a CAS on the enqueue position, and publish the element by advancing the sequence
+/// number of its slot. Since there is a single consumer, the dequeue position is advanced without CAS.
+///
+/// The slot array is allocated from the given memory resource. Its size is the maximum queue length rounded up to a
+/// power of two, every slot is padded to a cache line so that producers writing neighbouring slots do not contend.
+///
+/// The positions read by producers go through AtomicIndirectorType, such that tests can inject interleavings.
+template <typename T, typename Notification, template <class> class AtomicIndirectorType = AtomicIndirectorReal>
+class LockFreeSharedState
+{
+  public:
+    explicit LockFreeSharedState(
+        std::size_t max_length,
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::new_delete_resource())
+        : max_queue_length_{max_length},
+          memory_resource_{memory_resource},
+          capacity_{RoundUpToPowerOfTwo(max_length)},
+          slots_{AllocateSlots(capacity_, memory_resource)},
+          enqueue_position_{0U},
+          dequeue_position_{0U},
+          consumer_parked_{false},
+          notification_{}
+    {
+    }
+
+    ~LockFreeSharedState() noexcept
+    {
+        while (TryPop().has_value())
+        {
+        }
+        // Slot only holds an atomic besides the raw storage, nothing to destroy
+        memory_resource_->deallocate(slots_, capacity_ * sizeof(Slot), alignof(Slot));
+    }
+
+    LockFreeSharedState(const LockFreeSharedState&) = delete;
+    LockFreeSharedState(LockFreeSharedState&&) = delete;
+    LockFreeSharedState& operator=(const LockFreeSharedState&) = delete;
+    LockFreeSharedState& operator=(LockFreeSharedState&&) = delete;
+
+    /// \brief Appends an element, may be called by any number of threads concurrently
+    /// \returns true on success or false if the queue is full
+    template <typename U>
+    bool TryPush(U&& item)
+    {
+        std::size_t position{LoadPosition(enqueue_position_, std::memory_order_relaxed)};
+        Slot* slot{nullptr};
+        while (true)
+        {
+            const std::size_t dequeue_position{LoadPosition(dequeue_position_, std::memory_order_acquire)};
+            if (dequeue_position > position)
+            {
+                // The position is stale, other producers pushed and the consumer popped since it was read
+                position = LoadPosition(enqueue_position_, std::memory_order_relaxed);
+                continue;
+            }
+            // A stale dequeue position only makes the check stricter, thus max_queue_length_ is never exceeded
+            if ((position - dequeue_position) >= max_queue_length_)
+            {
+                return false;
+            }
+            slot = &SlotAt(position);
+            const std::size_t sequence{slot->sequence.load(std::memory_order_acquire)};
+            if (sequence == position)
+            {
+                if (enqueue_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (sequence < position)
+            {
+                // The consumer did not yet release the slot of the previous round
+                return false;
+            }
+            else
+            {
+                position = LoadPosition(enqueue_position_, std::memory_order_relaxed);
+            }
+        }
+
+        score::cpp::ignore = new (&slot->storage) T(std::forward<U>(item));
+        slot->sequence.store(position + 1U, std::memory_order_release);
+
+        // Pairs with the fence in ParkConsumer(): either the consumer sees the element before it parks, or this
+        // producer sees the consumer parked and wakes it up.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumer_parked_.load(std::memory_order_relaxed))
+        {
+            notification_.notify();
+        }
+        return true;
+    }
+
+    /// \brief Removes the oldest element, must only be called by the single consumer
+    /// \returns the element or nullopt if the queue is empty
+    std::optional<T> TryPop()
+    {
+        const std::size_t position{dequeue_position_.load(std::memory_order_relaxed)};
+        Slot& slot{SlotAt(position)};
+        if (slot.sequence.load(std::memory_order_acquire) != (position + 1U))
+        {
+            return std::nullopt;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) storage holds a T constructed by TryPush()
+        T* const element{std::launder(reinterpret_cast<T*>(&slot.storage))};
+        std::optional<T> result{std::move(*element)};
+        element->~T();
+        slot.sequence.store(position + capacity_, std::memory_order_release);
+        dequeue_position_.store(position + 1U, std::memory_order_release);
+        return result;
+    }
+
+    /// \brief Announces that the consumer is about to wait for the notification
+    void ParkConsumer() noexcept
+    {
+        consumer_parked_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    /// \brief Announces that the consumer stopped waiting, producers no longer signal it
+    void UnparkConsumer() noexcept
+    {
+        consumer_parked_.store(false, std::memory_order_relaxed);
+    }
+
+  private:
+    struct alignas(kCacheLineSize) Slot
+    {
+        std::atomic<std::size_t> sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+    };
+
+    static std::size_t RoundUpToPowerOfTwo(const std::size_t value) noexcept
+    {
+        std::size_t result{1U};
+        while (result < value)
+        {
+            result *= 2U;
+        }
+        return result;
+    }
+
+    static Slot* AllocateSlots(const std::size_t capacity, score::cpp::pmr::memory_resource* const memory_resource)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(memory_resource != nullptr);
+        void* const memory{memory_resource->allocate(capacity * sizeof(Slot), alignof(Slot))};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) memory is suitably sized and aligned for Slot
+        Slot* const slots{reinterpret_cast<Slot*>(memory)};
+        for (std::size_t index{0U}; index < capacity; ++index)
+        {
+            // Slot i is free for the producer at position i
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is within the allocation
+            score::cpp::ignore = new (&slots[index]) Slot{};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is within the allocation
+            slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+        return slots;
+    }
+
+    static std::size_t LoadPosition(const std::atomic<std::size_t>& position, const std::memory_order order) noexcept
+    {
+        return AtomicIndirectorType<std::size_t>::load(position, order);
+    }
+
+    Slot& SlotAt(const std::size_t position) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) position is masked to the capacity
+        return slots_[position & (capacity_ - 1U)];
+    }
+
+    const std::size_t max_queue_length_;
+    score::cpp::pmr::memory_resource* const memory_resource_;
+    const std::size_t capacity_;
+    Slot* const slots_;
+    alignas(kCacheLineSize) std::atomic<std::size_t> enqueue_position_;
+    alignas(kCacheLineSize) std::atomic<std::size_t> dequeue_position_;
+    alignas(kCacheLineSize) std::atomic<bool> consumer_parked_;
+
+  public:
+    // Public like in SharedState, so that tests can set expectations on it
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Notification notification_;
+};
+
+}  // namespace details
+
+/// \brief Variant of SynchronizedQueue for producers that push at high rates from many threads
+///
+/// \details Offers the same interface as SynchronizedQueue: one reader that pops with timeout and stop_token, and
+/// any number of QueueSender instances. Instead of a mutex protected deque, the elements are stored in a bounded
+/// lock-free ring buffer (see details::LockFreeSharedState), so producers never block each other or the reader.
+/// The reader is signalled via the Notification only while it is actually waiting, a push to a queue whose reader
+/// is busy costs no more than a CAS and a store.
+///
+/// \tparam T The type of the queued elements, must be move constructible
+template <typename T, typename Notification = score::concurrency::Notification>
+class LockFreeSynchronizedQueue final
+{
+  public:
+    explicit LockFreeSynchronizedQueue(
+        std::size_t max_length,
+        score::cpp::pmr::memory_resource* const memory_resource = score::cpp::pmr::new_delete_resource())
+        : queue_shared_state_(
+              std::make_shared<details::LockFreeSharedState<T, Notification>>(max_length, memory_resource))
+    {
+    }
+
+    explicit LockFreeSynchronizedQueue(
+        std::shared_ptr<details::LockFreeSharedState<T, Notification>> shared_state) noexcept
+        : queue_shared_state_(std::move(shared_state))
+    {
+    }
+
+    LockFreeSynchronizedQueue(const LockFreeSynchronizedQueue&) = delete;
+    LockFreeSynchronizedQueue(LockFreeSynchronizedQueue&&) noexcept = default;
+    LockFreeSynchronizedQueue& operator=(const LockFreeSynchronizedQueue&) & = delete;
+    LockFreeSynchronizedQueue& operator=(LockFreeSynchronizedQueue&&) & noexcept = default;
+
+    ~LockFreeSynchronizedQueue() noexcept = default;
+
+    /// \brief Tries to get an element from the queue until specified timeout_duration has elapsed or
+    /// stop_token.request_stop() is called. Must only be called by one thread at a time.
+    ///
+    /// \param timeout The maximum time that shall be waited
+    /// \param token A stop_token that can abort any wait
+    /// \returns value on success read of queue or nullopt if:
+    /// - timeout was reached and queue was still empty
+    /// - stop_token.request_stop() was called and queue was still empty
+    template <class Rep, class Period>
+    std::optional<T> Pop(const std::chrono::duration<Rep, Period>& timeout, score::cpp::stop_token token)
+    {
+        auto& state = *queue_shared_state_;
+        std::optional<T> result{state.TryPop()};
+        if (result.has_value())
+        {
+            return result;
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!result.has_value())
+        {
+            state.notification_.reset();
+            state.ParkConsumer();
+            result = state.TryPop();
+            if (result.has_value())
+            {
+                state.UnparkConsumer();
+                break;
+            }
+
+            // A notification of a push that was already popped may wake the reader early, hence wait in a loop
+            const auto remaining = std::chrono::ceil<std::chrono::duration<Rep, Period>>(
+                deadline - std::chrono::steady_clock::now());
+            const bool notified{(remaining.count() > 0) && state.notification_.waitForWithAbort(remaining, token)};
+            state.UnparkConsumer();
+            result = state.TryPop();
+            if (!notified)
+            {
+                break;
+            }
+        }
+        return result;
+    }
+
+    class QueueSender
+    {
+      protected:
+        explicit QueueSender(std::shared_ptr<details::LockFreeSharedState<T, Notification>> queue) noexcept
+            : sync_queue_{std::move(queue)} {};
+
+      public:
+        ~QueueSender() noexcept = default;
+
+        QueueSender(QueueSender&& other) noexcept = default;
+        QueueSender& operator=(QueueSender&& other) noexcept = default;
+
+        QueueSender(const QueueSender& other) noexcept = default;
+        QueueSender& operator=(const QueueSender& other) noexcept = default;
+
+        // Suppres "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
+        // Force "QueueSender" to be created only with "LockFreeSynchronizedQueue"
+        // coverity[autosar_cpp14_a11_3_1_violation]
+        friend class LockFreeSynchronizedQueue;
+
+        /// \brief Tries to push new element into the queue
+        ///
+        /// \param item Element that should be placed into the queue
+        /// \returns true on success write or false if the queue is already full or does not exist anymore
+        bool push(const T& item)
+        {
+            // false positive: lock returns shared_ptr with automatic storage duration
+            // coverity[autosar_cpp14_a18_5_8_violation]
+            auto sync_queue_instance = sync_queue_.lock();
+            return (sync_queue_instance != nullptr) && sync_queue_instance->TryPush(item);
+        }
+
+        /// \brief Tries to push new element into the queue
+        ///
+        /// \param item Element that should be placed into the queue
+        /// \returns true on success write or false if the queue is already full or does not exist anymore
+        bool push(T&& item)
+        {
+            // false positive: lock returns shared_ptr with automatic storage duration
+            // coverity[autosar_cpp14_a18_5_8_violation]
+            auto sync_queue_instance = sync_queue_.lock();
+            return (sync_queue_instance != nullptr) && sync_queue_instance->TryPush(std::move(item));
+        }
+
+      private:
+        std::weak_ptr<details::LockFreeSharedState<T, Notification>> sync_queue_;
+    };
+
+    QueueSender CreateSender() const noexcept
+    {
+        return QueueSender(queue_shared_state_);
+    }
+
+  private:
+    std::shared_ptr<details::LockFreeSharedState<T, Notification>> queue_shared_state_;
+};
+
+}  // namespace score::concurrency
+
+#endif  // SCORE_LIB_CONCURRENCY_LOCK_FREE_SYNCHRONIZED_QUEUE_H
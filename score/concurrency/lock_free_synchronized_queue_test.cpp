@@ -0,0 +1,293 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/lock_free_synchronized_queue.h"
+
+#include "score/concurrency/atomic_mock.h"
+
+#include "score/memory_resource.hpp"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace score::concurrency
+{
+
+using namespace std::literals::chrono_literals;
+
+class MockNotification
+{
+  public:
+    virtual ~MockNotification() = default;
+    MOCK_METHOD(bool, waitForWithAbort, ((std::chrono::duration<int64_t, std::milli>), score::cpp::stop_token));
+    MOCK_METHOD(bool, waitWithAbort, (score::cpp::stop_token token));
+    MOCK_METHOD(void, notify, ());
+    MOCK_METHOD(void, reset, ());
+};
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using MockedSharedState = details::LockFreeSharedState<std::int32_t, NiceMock<MockNotification>>;
+using MockedQueue = LockFreeSynchronizedQueue<std::int32_t, NiceMock<MockNotification>>;
+
+TEST(LockFreeSynchronizedQueue, CheckFalseResponseOnPushWhenMaxQueueLengthReached)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description",
+                   "QueueSender::push() returns false once the maximum queue length is reached, even though the ring "
+                   "buffer is rounded up to a power of two");
+
+    // Given a queue with max queue length = 5
+    MockedQueue sync_queue(5U);
+    auto sender1 = sync_queue.CreateSender();
+    auto sender2 = sync_queue.CreateSender();
+
+    // When filling it up
+    EXPECT_TRUE(sender1.push(1));
+    EXPECT_TRUE(sender1.push(2));
+    EXPECT_TRUE(sender1.push(3));
+    EXPECT_TRUE(sender2.push(4));
+    EXPECT_TRUE(sender2.push(5));
+
+    // Then further pushes fail, by rvalue as well as by const reference
+    EXPECT_FALSE(sender2.push(6));
+    const std::int32_t push_value{6};
+    EXPECT_FALSE(sender2.push(push_value));
+
+    // And after popping one element there is space again
+    EXPECT_EQ(sync_queue.Pop(100ms, score::cpp::stop_token{}), 1);
+    EXPECT_TRUE(sender2.push(push_value));
+    EXPECT_FALSE(sender2.push(7));
+}
+
+TEST(LockFreeSynchronizedQueue, PushWithStaleEnqueuePositionSucceeds)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description",
+                   "TryPush() does not report a full queue if other producers pushed and the consumer popped between "
+                   "reading the enqueue and the dequeue position");
+
+    // Given a state whose positions are read through a mock, that already passed three elements
+    AtomicMock<std::size_t> atomic_mock{};
+    AtomicIndirectorMock<std::size_t>::SetMockObject(&atomic_mock);
+    details::LockFreeSharedState<std::int32_t, NiceMock<MockNotification>, AtomicIndirectorMock> unit{8U};
+    {
+        ::testing::InSequence sequence{};
+        for (std::size_t position{0U}; position < 3U; ++position)
+        {
+            EXPECT_CALL(atomic_mock, load(_)).WillOnce(Return(position)).WillOnce(Return(0U));
+        }
+        // When the enqueue position was read before these elements were pushed and popped
+        EXPECT_CALL(atomic_mock, load(_))
+            .WillOnce(Return(0U))
+            .WillOnce(Return(3U))
+            .WillOnce(Return(3U))
+            .WillOnce(Return(3U));
+    }
+    for (std::int32_t value{0}; value < 3; ++value)
+    {
+        ASSERT_TRUE(unit.TryPush(value));
+        ASSERT_EQ(unit.TryPop(), value);
+    }
+
+    // Then the push into the empty queue re-reads the enqueue position and succeeds
+    EXPECT_TRUE(unit.TryPush(3));
+    EXPECT_EQ(unit.TryPop(), 3);
+    AtomicIndirectorMock<std::size_t>::SetMockObject(nullptr);
+}
+
+TEST(LockFreeSynchronizedQueue, CheckFalseResponseOnPushWhenQueueObjectDoesNotExist)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description", "QueueSender::push() returns false if the queue does not exist anymore");
+
+    // Given a sender of a queue that was destroyed
+    MockedQueue sync_queue_long(5U);
+    auto sender = sync_queue_long.CreateSender();
+    {
+        MockedQueue sync_queue_short(5U);
+        sender = sync_queue_short.CreateSender();
+    }
+
+    // Then push() returns false
+    EXPECT_FALSE(sender.push(1));
+    const std::int32_t push_value{1};
+    EXPECT_FALSE(sender.push(push_value));
+}
+
+TEST(LockFreeSynchronizedQueue, CallPopForEmptyQueue)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description", "Pop() returns nullopt if the queue stays empty until the timeout");
+
+    auto shared_state = std::make_shared<MockedSharedState>(5U);
+    EXPECT_CALL(shared_state->notification_, waitForWithAbort(_, _)).WillOnce(Return(false));
+
+    // Given an empty queue
+    MockedQueue sync_queue(std::move(shared_state));
+
+    // When popping, then there is no value
+    EXPECT_FALSE(sync_queue.Pop(100ms, score::cpp::stop_token{}).has_value());
+}
+
+TEST(LockFreeSynchronizedQueue, PushNotifiesOnlyWhilePopIsWaiting)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description",
+                   "A push signals the reader while it waits in Pop(), but not while the reader is busy");
+
+    auto shared_state = std::make_shared<MockedSharedState>(5U);
+    auto& shared_state_ref = *shared_state;
+    MockedQueue sync_queue(std::move(shared_state));
+    auto sender = sync_queue.CreateSender();
+
+    // Given a reader that waits while the value is pushed
+    EXPECT_CALL(shared_state_ref.notification_, waitForWithAbort(_, _)).WillOnce([&sender]() {
+        EXPECT_TRUE(sender.push(1));
+        return true;
+    });
+    EXPECT_CALL(shared_state_ref.notification_, notify()).Times(1);
+
+    // Then Pop() returns the value
+    EXPECT_EQ(sync_queue.Pop(100ms, score::cpp::stop_token{}), 1);
+    ::testing::Mock::VerifyAndClearExpectations(&shared_state_ref.notification_);
+
+    // When pushing while nobody waits, then nobody is notified and Pop() returns without waiting
+    EXPECT_CALL(shared_state_ref.notification_, notify()).Times(0);
+    EXPECT_CALL(shared_state_ref.notification_, waitForWithAbort(_, _)).Times(0);
+    EXPECT_TRUE(sender.push(2));
+    EXPECT_TRUE(sender.push(3));
+    EXPECT_EQ(sync_queue.Pop(100ms, score::cpp::stop_token{}), 2);
+    EXPECT_EQ(sync_queue.Pop(100ms, score::cpp::stop_token{}), 3);
+}
+
+TEST(LockFreeSynchronizedQueue, KeepsOrderWhenWrappingAround)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description", "Elements are popped in push order across many rounds of the ring buffer");
+
+    // Given a queue that is allocated from a custom memory resource
+    score::cpp::pmr::monotonic_buffer_resource resource{};
+    MockedQueue sync_queue(3U, &resource);
+    auto sender = sync_queue.CreateSender();
+
+    // When pushing and popping many more elements than fit into the ring
+    std::int32_t next_pushed{0};
+    std::int32_t next_popped{0};
+    while (next_popped < 100)
+    {
+        while (sender.push(next_pushed))
+        {
+            ++next_pushed;
+        }
+        for (std::int32_t i = 0; i < 2; ++i)
+        {
+            // Then they come out in order
+            EXPECT_EQ(sync_queue.Pop(100ms, score::cpp::stop_token{}), next_popped);
+            ++next_popped;
+        }
+    }
+}
+
+TEST(LockFreeSynchronizedQueue, DestroysRemainingElements)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description", "Elements that were not popped are destroyed together with the queue");
+
+    auto element = std::make_shared<std::int32_t>(42);
+    {
+        // Given a queue with move-only elements left in it
+        LockFreeSynchronizedQueue<std::unique_ptr<std::shared_ptr<std::int32_t>>, NiceMock<MockNotification>>
+            sync_queue(4U);
+        auto sender = sync_queue.CreateSender();
+        EXPECT_TRUE(sender.push(std::make_unique<std::shared_ptr<std::int32_t>>(element)));
+        EXPECT_TRUE(sender.push(std::make_unique<std::shared_ptr<std::int32_t>>(element)));
+        EXPECT_EQ(element.use_count(), 3);
+    }
+    // When the queue is destroyed, then so are the elements
+    EXPECT_EQ(element.use_count(), 1);
+}
+
+TEST(LockFreeSynchronizedQueue, StopTokenAbortsPop)
+{
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description", "Pop() returns nullopt as soon as a stop is requested");
+
+    // Given an empty queue and a stop source that was already triggered
+    LockFreeSynchronizedQueue<std::int32_t> sync_queue(4U);
+    score::cpp::stop_source stop_source{};
+    stop_source.request_stop();
+
+    // When popping with a long timeout, then it returns immediately without value
+    EXPECT_FALSE(sync_queue.Pop(1h, stop_source.get_token()).has_value());
+}
+
+TEST(LockFreeSynchronizedQueue, MakeStressTestForPushingFromMultipleThreads)
+{
+    constexpr std::size_t num_threads = 4;
+    constexpr std::int32_t num_values_per_thread = 10000;
+
+    RecordProperty("Verifies", "::score::platform::aas::lib::concurrency::LockFreeSynchronizedQueue");
+    RecordProperty("Description",
+                   "Several threads push into a small queue while the reader pops. Every value arrives exactly once "
+                   "and the values of each thread arrive in push order.");
+
+    // Given a queue that is much smaller than the number of pushed values
+    LockFreeSynchronizedQueue<std::int32_t> sync_queue(16U);
+
+    // When several threads push until all their values are accepted
+    std::vector<std::thread> sender_threads;
+    for (std::size_t thread = 0; thread < num_threads; thread++)
+    {
+        sender_threads.emplace_back([&sync_queue, thread]() noexcept {
+            auto sender = sync_queue.CreateSender();
+            for (std::int32_t value = 0; value < num_values_per_thread; value++)
+            {
+                while (!sender.push((static_cast<std::int32_t>(thread) * num_values_per_thread) + value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Then the reader receives the values of every thread in order
+    std::vector<std::int32_t> next_expected(num_threads, 0);
+    for (std::size_t received = 0; received < (num_threads * num_values_per_thread);)
+    {
+        const auto result = sync_queue.Pop(1s, score::cpp::stop_token{});
+        ASSERT_TRUE(result.has_value());
+        const auto thread = static_cast<std::size_t>(result.value() / num_values_per_thread);
+        ASSERT_LT(thread, num_threads);
+        EXPECT_EQ(result.value() % num_values_per_thread, next_expected.at(thread));
+        ++next_expected.at(thread);
+        ++received;
+    }
+
+    for (auto& thr : sender_threads)
+    {
+        thr.join();
+    }
+    EXPECT_FALSE(sync_queue.Pop(1ms, score::cpp::stop_token{}).has_value());
+}
+
+}  // namespace score::concurrency
@@ -159,6 +159,40 @@ class SimpleTask<CallableType, void> final : public detail::SimpleTaskBase
     concurrency::InterruptiblePromise<void> promise_;
 };
 
+/**
+ * \brief This class wraps a callable whose result is not of interest, as done by Executor::Post(). In contrast to
+ * SimpleTask it has no promise, which saves the allocation of the shared state of the promise for every posted task.
+ */
+template <class CallableType>
+class DetachedSimpleTask final : public detail::SimpleTaskBase
+{
+  public:
+    // Suppres "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
+    // The "DetachedSimpleTask" instance must be created via "SimpleTaskFactory" factory instead of direct constructor
+    // call. Thus, access to ConstructionGuard requires.
+    // coverity[autosar_cpp14_a11_3_1_violation]
+    friend class SimpleTaskFactory;
+
+    template <class LocalCallableType>
+    DetachedSimpleTask(detail::SimpleTaskBase::ConstructionGuard construction_guard, LocalCallableType&& callable)
+        : detail::SimpleTaskBase(construction_guard), callable_{std::forward<decltype(callable)>(callable)}
+    {
+    }
+
+    void operator()(const score::cpp::stop_token token) override
+    {
+        // The result is discarded on purpose, nobody can observe it
+        static_cast<void>(this->callable_(token));
+    }
+
+  private:
+    // due to lambda usage number of template instantiation increases
+    // leading to slightly longer compilation time
+    // but doesnt affect the performance and keeps the code simple
+    // coverity[autosar_cpp14_a5_1_7_violation]
+    CallableType callable_;
+};
+
 class SimpleTaskFactory final
 {
   private:
@@ -188,6 +222,30 @@ class SimpleTaskFactory final
                             std::forward<decltype(arguments)>(arguments)...);
     }
 
+    /**
+     * \brief Helper function to construct a DetachedSimpleTask, i.e. a task without a result.
+     *
+     * \tparam CallableType The Callable type that shall be used
+     * \tparam ArgumentTypes The argument types of the callable
+     * \param callable The callable itself
+     * \param arguments The arguments with what the callable shall be invoked
+     * \return A DetachedSimpleTask constructed from the provided Callable
+     */
+    template <class CallableType, class... ArgumentTypes>
+    static auto MakeDetached(score::cpp::pmr::memory_resource* memory_resource,
+                             CallableType&& callable,
+                             ArgumentTypes&&... arguments)
+    {
+        auto wrapped_callable =
+            Wrap(std::forward<decltype(callable)>(callable), std::forward<decltype(arguments)>(arguments)...);
+        // coverity[autosar_cpp14_a5_1_7_violation] see InternalMake()
+        using detached_task_type = DetachedSimpleTask<decltype(wrapped_callable)>;
+        return score::cpp::pmr::make_unique<detached_task_type>(
+            memory_resource,
+            typename detached_task_type::ConstructionGuard{},
+            std::forward<decltype(wrapped_callable)>(wrapped_callable));
+    }
+
     /**
      * \brief Helper function to construct a SimpleTask with TaskResult.
      *
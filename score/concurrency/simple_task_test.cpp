@@ -128,6 +128,39 @@ TEST_F(SimpleTaskTest, MakerFunctionWithCustomTask)
     ASSERT_EQ(unit.first.Get().value(), 42);
 }
 
+TEST_F(SimpleTaskTest, DetachedTaskExecutesCallbackWithParameter)
+{
+    // Given a manually created DetachedSimpleTask<> with a parameter and a return value
+    std::int32_t observer{0};
+    auto unit = SimpleTaskFactory::MakeDetached(
+        score::cpp::pmr::get_default_resource(),
+        [&observer](const score::cpp::stop_token&, const std::int32_t a) noexcept {
+            observer = a;
+            return a;
+        },
+        42);
+
+    // When executing the function call operator
+    (*unit)(score::cpp::stop_token{});
+
+    // That the callback was executed
+    ASSERT_EQ(observer, 42);
+}
+
+TEST_F(SimpleTaskTest, DetachedTaskIsSmallerThanSimpleTask)
+{
+    // Given the same callback
+    const auto callback = [](const score::cpp::stop_token&) noexcept {};
+
+    // When creating a SimpleTask<> and a DetachedSimpleTask<> from it
+    auto simple_task = SimpleTaskFactory::Make(score::cpp::pmr::get_default_resource(), callback);
+    auto detached_task = SimpleTaskFactory::MakeDetached(score::cpp::pmr::get_default_resource(), callback);
+
+    // Then the DetachedSimpleTask<> has no promise, but still a stop source of its own
+    EXPECT_LT(sizeof(*detached_task), sizeof(*simple_task));
+    EXPECT_TRUE(detached_task->GetStopSource().stop_possible());
+}
+
 }  // namespace
 }  // namespace concurrency
 }  // namespace score
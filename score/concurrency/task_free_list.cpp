@@ -0,0 +1,192 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/task_free_list.h"
+
+#include <score/assert.hpp>
+
+#include <new>
+
+namespace score
+{
+namespace concurrency
+{
+
+namespace
+{
+
+bool IsServedByBlock(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    return (bytes <= TaskFreeList::kBlockSize) && (alignment <= TaskFreeList::kBlockAlignment);
+}
+
+}  // namespace
+
+TaskFreeList::Pointer TaskFreeList::Make(score::cpp::pmr::memory_resource* upstream)
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(upstream != nullptr);
+    void* const memory = upstream->allocate(sizeof(TaskFreeList), alignof(TaskFreeList));
+    return Pointer{::new (memory) TaskFreeList{upstream}};
+}
+
+TaskFreeList::TaskFreeList(score::cpp::pmr::memory_resource* upstream) noexcept
+    : score::cpp::pmr::memory_resource{},
+      upstream_{upstream},
+      slots_{},
+      push_position_{0U},
+      pop_position_{0U},
+      references_{1U}
+{
+    for (std::size_t index{0U}; index < kMaxFreeBlocks; ++index)
+    {
+        // Slot i is free for the deallocation at position i
+        slots_[index].sequence.store(index, std::memory_order_relaxed);
+        slots_[index].block = nullptr;
+    }
+}
+
+TaskFreeList::~TaskFreeList() noexcept
+{
+    for (void* block = TryPopFreeBlock(); block != nullptr; block = TryPopFreeBlock())
+    {
+        upstream_->deallocate(block, kBlockSize, kBlockAlignment);
+    }
+}
+
+score::cpp::pmr::memory_resource* TaskFreeList::GetUpstreamResource() const noexcept
+{
+    return upstream_;
+}
+
+std::size_t TaskFreeList::GetNumberOfFreeBlocks() const noexcept
+{
+    const std::size_t pop_position{pop_position_.load(std::memory_order_acquire)};
+    const std::size_t push_position{push_position_.load(std::memory_order_acquire)};
+    return (push_position > pop_position) ? (push_position - pop_position) : 0U;
+}
+
+void TaskFreeList::Close() noexcept
+{
+    Release();
+}
+
+void TaskFreeList::Release() noexcept
+{
+    // The last reference destroys the free list, acquire makes the accesses of all other references visible to it
+    if (references_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+    {
+        score::cpp::pmr::memory_resource* const upstream = upstream_;
+        this->~TaskFreeList();
+        upstream->deallocate(this, sizeof(TaskFreeList), alignof(TaskFreeList));
+    }
+}
+
+bool TaskFreeList::TryPushFreeBlock(void* const block) noexcept
+{
+    std::size_t position{push_position_.load(std::memory_order_relaxed)};
+    Slot* slot{nullptr};
+    while (true)
+    {
+        slot = &slots_[position & (kMaxFreeBlocks - 1U)];
+        const std::size_t sequence{slot->sequence.load(std::memory_order_acquire)};
+        if (sequence == position)
+        {
+            if (push_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            // The block of the previous round was not yet taken, i.e. kMaxFreeBlocks blocks are kept
+            return false;
+        }
+        else
+        {
+            position = push_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->block = block;
+    slot->sequence.store(position + 1U, std::memory_order_release);
+    return true;
+}
+
+void* TaskFreeList::TryPopFreeBlock() noexcept
+{
+    std::size_t position{pop_position_.load(std::memory_order_relaxed)};
+    Slot* slot{nullptr};
+    while (true)
+    {
+        slot = &slots_[position & (kMaxFreeBlocks - 1U)];
+        const std::size_t sequence{slot->sequence.load(std::memory_order_acquire)};
+        if (sequence == (position + 1U))
+        {
+            if (pop_position_.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < (position + 1U))
+        {
+            // No block was pushed at this position yet
+            return nullptr;
+        }
+        else
+        {
+            position = pop_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void* const block{slot->block};
+    // The slot is free for the deallocation one round later
+    slot->sequence.store(position + kMaxFreeBlocks, std::memory_order_release);
+    return block;
+}
+
+void* TaskFreeList::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    const bool served_by_block = IsServedByBlock(bytes, alignment);
+    void* pointer = served_by_block ? TryPopFreeBlock() : nullptr;
+    if (pointer == nullptr)
+    {
+        pointer = served_by_block ? upstream_->allocate(kBlockSize, kBlockAlignment)
+                                  : upstream_->allocate(bytes, alignment);
+    }
+
+    // Only taken once the allocation succeeded, thus an exception of the upstream resource does not keep the free list
+    // alive. The owner holds a reference while allocating, thus relaxed suffices like for a std::shared_ptr copy.
+    references_.fetch_add(1U, std::memory_order_relaxed);
+    return pointer;
+}
+
+void TaskFreeList::do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment)
+{
+    const bool served_by_block = IsServedByBlock(bytes, alignment);
+    if (!served_by_block)
+    {
+        upstream_->deallocate(pointer, bytes, alignment);
+    }
+    else if (!TryPushFreeBlock(pointer))
+    {
+        upstream_->deallocate(pointer, kBlockSize, kBlockAlignment);
+    }
+    Release();
+}
+
+bool TaskFreeList::do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+}  // namespace concurrency
+}  // namespace score
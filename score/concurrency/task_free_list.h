@@ -0,0 +1,118 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TASK_FREE_LIST_H
+#define SCORE_LIB_CONCURRENCY_TASK_FREE_LIST_H
+
+#include <score/memory_resource.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief Memory resource that recycles the memory of small tasks of an Executor.
+ *
+ * Every request of at most kBlockSize bytes is served with a block of kBlockSize bytes. Deallocated blocks are kept
+ * in a free list and handed out again, thus an Executor that posts small callables in a steady state does not
+ * allocate from its upstream resource. At most kMaxFreeBlocks blocks are kept, further blocks and requests for bigger
+ * blocks are forwarded to the upstream resource.
+ *
+ * Tasks are allocated by any thread that posts to the Executor and deallocated by the worker that ran them, thus
+ * the free blocks are kept in a lock-free bounded ring buffer (the bounded queue of Dmitry Vyukov): every slot carries
+ * a sequence number that tells whether it is free for a deallocation or holds a block for an allocation at a given
+ * position. Unlike a linked free list this is not prone to the ABA problem. If the ring buffer is full or empty, e.g.
+ * since a concurrent operation did not yet finish on a slot, the request is forwarded to the upstream resource.
+ *
+ * A task may outlive the Executor that created it, e.g. if an implementation of Executor::Enqueue() hands it to
+ * someone else. Thus the owner does not destroy the free list, but closes it. The owner and every outstanding
+ * allocation hold a reference, and the free list destroys itself once the last one is released.
+ */
+class TaskFreeList final : public score::cpp::pmr::memory_resource
+{
+  public:
+    static constexpr std::size_t kBlockSize{128U};
+    static constexpr std::size_t kBlockAlignment{alignof(std::max_align_t)};
+    static constexpr std::size_t kMaxFreeBlocks{256U};
+
+    /**
+     * \brief Deleter that closes the free list instead of destroying it.
+     */
+    class Closer
+    {
+      public:
+        void operator()(TaskFreeList* const free_list) const noexcept
+        {
+            free_list->Close();
+        }
+    };
+
+    using Pointer = std::unique_ptr<TaskFreeList, Closer>;
+
+    /**
+     * \brief Creates a free list that is allocated from, and allocates its blocks from the upstream resource.
+     */
+    static Pointer Make(score::cpp::pmr::memory_resource* upstream);
+
+    TaskFreeList(const TaskFreeList&) = delete;
+    TaskFreeList(TaskFreeList&&) = delete;
+    TaskFreeList& operator=(const TaskFreeList&) = delete;
+    TaskFreeList& operator=(TaskFreeList&&) = delete;
+
+    score::cpp::pmr::memory_resource* GetUpstreamResource() const noexcept;
+
+    /**
+     * \brief Returns the number of blocks that are ready to be handed out again.
+     *
+     * Only exact while no other thread allocates or deallocates.
+     */
+    std::size_t GetNumberOfFreeBlocks() const noexcept;
+
+  private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        void* block;
+    };
+
+    static_assert((kMaxFreeBlocks & (kMaxFreeBlocks - 1U)) == 0U, "Positions are mapped to slots by masking");
+
+    explicit TaskFreeList(score::cpp::pmr::memory_resource* upstream) noexcept;
+    ~TaskFreeList() noexcept override;
+
+    void Close() noexcept;
+    void Release() noexcept;
+
+    bool TryPushFreeBlock(void* const block) noexcept;
+    void* TryPopFreeBlock() noexcept;
+
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment) override;
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override;
+
+    score::cpp::pmr::memory_resource* const upstream_;
+    std::array<Slot, kMaxFreeBlocks> slots_;
+    alignas(64) std::atomic<std::size_t> push_position_;
+    alignas(64) std::atomic<std::size_t> pop_position_;
+    alignas(64) std::atomic<std::size_t> references_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_TASK_FREE_LIST_H
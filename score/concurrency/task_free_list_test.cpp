@@ -0,0 +1,232 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/task_free_list.h"
+#include "score/concurrency/counting_memory_resource.h"
+
+#include "gtest/gtest.h"
+
+#include <score/utility.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+class TaskFreeListTest : public ::testing::Test
+{
+  public:
+    testing::CountingMemoryResource upstream_{};
+};
+
+TEST_F(TaskFreeListTest, IsAllocatedFromUpstream)
+{
+    // Given an upstream resource
+
+    // When creating a free list
+    const auto unit = TaskFreeList::Make(&upstream_);
+
+    // Then the free list itself is allocated from the upstream resource
+    EXPECT_EQ(unit->GetUpstreamResource(), &upstream_);
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), 1U);
+    EXPECT_EQ(unit->GetNumberOfFreeBlocks(), 0U);
+}
+
+TEST_F(TaskFreeListTest, ReusesDeallocatedBlock)
+{
+    // Given a free list with a block that was deallocated
+    const auto unit = TaskFreeList::Make(&upstream_);
+    void* const first = unit->allocate(24U, alignof(std::max_align_t));
+    unit->deallocate(first, 24U, alignof(std::max_align_t));
+    ASSERT_EQ(unit->GetNumberOfFreeBlocks(), 1U);
+    const auto number_of_allocations = upstream_.GetNumberOfAllocations();
+
+    // When allocating a block of another small size
+    void* const second = unit->allocate(TaskFreeList::kBlockSize, alignof(std::uint32_t));
+
+    // Then the deallocated block is reused without allocating from upstream
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(upstream_.GetNumberOfAllocations(), number_of_allocations);
+    EXPECT_EQ(unit->GetNumberOfFreeBlocks(), 0U);
+    unit->deallocate(second, TaskFreeList::kBlockSize, alignof(std::uint32_t));
+}
+
+TEST_F(TaskFreeListTest, AllocatesWholeBlockFromUpstream)
+{
+    // Given an empty free list
+    const auto unit = TaskFreeList::Make(&upstream_);
+
+    // When allocating a small block
+    void* const pointer = unit->allocate(8U, alignof(std::uint64_t));
+
+    // Then a whole block is allocated from upstream, such that it can serve any small request later on
+    EXPECT_EQ(upstream_.GetLastAllocatedBytes(), TaskFreeList::kBlockSize);
+    unit->deallocate(pointer, 8U, alignof(std::uint64_t));
+}
+
+TEST_F(TaskFreeListTest, ForwardsBigAllocationsToUpstream)
+{
+    // Given a free list
+    const auto unit = TaskFreeList::Make(&upstream_);
+    const auto number_of_outstanding_allocations = upstream_.GetNumberOfOutstandingAllocations();
+
+    // When allocating and deallocating more than a block
+    constexpr std::size_t kBytes{TaskFreeList::kBlockSize + 1U};
+    void* const pointer = unit->allocate(kBytes, alignof(std::max_align_t));
+    EXPECT_EQ(upstream_.GetLastAllocatedBytes(), kBytes);
+    unit->deallocate(pointer, kBytes, alignof(std::max_align_t));
+
+    // Then the memory is returned to upstream instead of being kept
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), number_of_outstanding_allocations);
+    EXPECT_EQ(unit->GetNumberOfFreeBlocks(), 0U);
+}
+
+TEST_F(TaskFreeListTest, ForwardsOverAlignedAllocationsToUpstream)
+{
+    // Given a free list
+    const auto unit = TaskFreeList::Make(&upstream_);
+
+    // When allocating with an alignment stricter than the one of a block
+    constexpr std::size_t kAlignment{TaskFreeList::kBlockAlignment * 2U};
+    void* const pointer = unit->allocate(16U, kAlignment);
+    unit->deallocate(pointer, 16U, kAlignment);
+
+    // Then the memory is not kept as block
+    EXPECT_EQ(unit->GetNumberOfFreeBlocks(), 0U);
+}
+
+TEST_F(TaskFreeListTest, KeepsAtMostMaxFreeBlocks)
+{
+    // Given more allocated blocks than are kept
+    const auto unit = TaskFreeList::Make(&upstream_);
+    std::vector<void*> blocks{};
+    for (std::size_t i{0U}; i < TaskFreeList::kMaxFreeBlocks + 3U; ++i)
+    {
+        blocks.push_back(unit->allocate(32U, alignof(std::max_align_t)));
+    }
+
+    // When deallocating all of them
+    for (void* const block : blocks)
+    {
+        unit->deallocate(block, 32U, alignof(std::max_align_t));
+    }
+
+    // Then only kMaxFreeBlocks are kept, the others are returned upstream
+    EXPECT_EQ(unit->GetNumberOfFreeBlocks(), TaskFreeList::kMaxFreeBlocks);
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), TaskFreeList::kMaxFreeBlocks + 1U);
+}
+
+TEST_F(TaskFreeListTest, ReleasesAllMemoryOnClose)
+{
+    {
+        // Given a free list with free blocks
+        const auto unit = TaskFreeList::Make(&upstream_);
+        void* const pointer = unit->allocate(32U, alignof(std::max_align_t));
+        unit->deallocate(pointer, 32U, alignof(std::max_align_t));
+
+        // When the owner closes it
+    }
+
+    // Then all memory is returned upstream
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), 0U);
+}
+
+TEST_F(TaskFreeListTest, OutlivesOwnerUntilLastBlockIsReturned)
+{
+    // Given a free list with allocated small and big blocks
+    auto unit = TaskFreeList::Make(&upstream_);
+    score::cpp::pmr::memory_resource* const resource = unit.get();
+    void* const small = resource->allocate(32U, alignof(std::max_align_t));
+    void* const big = resource->allocate(1024U, alignof(std::max_align_t));
+    void* const free = resource->allocate(32U, alignof(std::max_align_t));
+    resource->deallocate(free, 32U, alignof(std::max_align_t));
+
+    // When the owner closes it
+    unit.reset();
+
+    // Then it is kept until the last block was returned
+    EXPECT_GT(upstream_.GetNumberOfOutstandingAllocations(), 2U);
+    resource->deallocate(small, 32U, alignof(std::max_align_t));
+    EXPECT_GT(upstream_.GetNumberOfOutstandingAllocations(), 0U);
+    resource->deallocate(big, 1024U, alignof(std::max_align_t));
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), 0U);
+}
+
+TEST_F(TaskFreeListTest, FailedAllocationDoesNotKeepFreeListAlive)
+{
+    {
+        // Given a free list whose upstream resource fails to allocate
+        const auto unit = TaskFreeList::Make(&upstream_);
+        upstream_.FailAllocations(true);
+
+        // When allocating a small and a big block
+        EXPECT_THROW(score::cpp::ignore = unit->allocate(32U, alignof(std::max_align_t)), std::bad_alloc);
+        EXPECT_THROW(score::cpp::ignore = unit->allocate(1024U, alignof(std::max_align_t)), std::bad_alloc);
+
+        // And the owner closes it
+    }
+
+    // Then the free list is destroyed, as the failed allocations are not outstanding
+    EXPECT_EQ(upstream_.GetNumberOfOutstandingAllocations(), 0U);
+}
+
+TEST_F(TaskFreeListTest, IsOnlyEqualToItself)
+{
+    // Given two free lists
+    const auto unit = TaskFreeList::Make(&upstream_);
+    const auto other = TaskFreeList::Make(&upstream_);
+
+    // Then a free list only compares equal to itself
+    EXPECT_TRUE(unit->is_equal(*unit));
+    EXPECT_FALSE(unit->is_equal(*other));
+}
+
+TEST_F(TaskFreeListTest, BlocksCanBeReturnedByOtherThreads)
+{
+    // Given a free list with blocks allocated on this thread
+    const auto unit = TaskFreeList::Make(score::cpp::pmr::new_delete_resource());
+    constexpr std::size_t kNumberOfBlocks{1000U};
+    std::vector<void*> blocks{};
+    for (std::size_t i{0U}; i < kNumberOfBlocks; ++i)
+    {
+        blocks.push_back(unit->allocate(64U, alignof(std::max_align_t)));
+    }
+
+    // When another thread returns them, while this thread keeps allocating and deallocating
+    std::thread other_thread{[&unit, &blocks]() {
+        for (void* const block : blocks)
+        {
+            unit->deallocate(block, 64U, alignof(std::max_align_t));
+        }
+    }};
+    for (std::size_t i{0U}; i < kNumberOfBlocks; ++i)
+    {
+        void* const pointer = unit->allocate(64U, alignof(std::max_align_t));
+        unit->deallocate(pointer, 64U, alignof(std::max_align_t));
+    }
+    other_thread.join();
+
+    // Then the free list stays consistent
+    EXPECT_LE(unit->GetNumberOfFreeBlocks(), TaskFreeList::kMaxFreeBlocks);
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_HIGH_RESOLUTION_TIME_POINT_H
+#define SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_HIGH_RESOLUTION_TIME_POINT_H
+
+#include "score/os/utils/high_resolution_steady_clock.h"
+
+#include <chrono>
+
+namespace score
+{
+namespace concurrency
+{
+
+/// \brief Clock source for ThreadLoadTracking and PerThreadLoadTracking based on score::os::HighResolutionSteadyClock.
+/// \details On QNX the clock is based on ClockCycles(), i.e. the TSC, which is cheaper to read and has a finer
+/// resolution than std::chrono::steady_clock. The time point is only meaningful relative to other time points of this
+/// function, which suffices since the tracking only uses differences.
+inline std::chrono::steady_clock::time_point GetHighResolutionTimePoint() noexcept
+{
+    return std::chrono::steady_clock::time_point{std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        score::os::HighResolutionSteadyClock::now().time_since_epoch())};
+}
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_HIGH_RESOLUTION_TIME_POINT_H
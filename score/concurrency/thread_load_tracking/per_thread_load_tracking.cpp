@@ -0,0 +1,97 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+
+#include <score/assert.hpp>
+
+namespace score
+{
+namespace concurrency
+{
+
+PerThreadLoadTracking::PerThreadLoadTracking(const std::size_t number_of_threads, GetTimePointFunction get_time_now)
+    : counters_(number_of_threads),
+      calculate_mutex_{},
+      observed_(number_of_threads),
+      get_time_now_{std::move(get_time_now)}
+{
+}
+
+PerThreadLoadTrackingToken PerThreadLoadTracking::StartWorking(const std::size_t thread_index) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(thread_index < counters_.size());
+    return {*this, thread_index, ThreadLoadTrackingState::kWorking};
+}
+
+PerThreadLoadTrackingToken PerThreadLoadTracking::StartWaiting(const std::size_t thread_index) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(thread_index < counters_.size());
+    return {*this, thread_index, ThreadLoadTrackingState::kWaiting};
+}
+
+std::size_t PerThreadLoadTracking::GetNumberOfThreads() const noexcept
+{
+    return counters_.size();
+}
+
+void PerThreadLoadTracking::OnTokenEnd(const std::size_t thread_index,
+                                       const TrackingResolution& duration,
+                                       const ThreadLoadTrackingState& state) noexcept
+{
+    Counters& counters = counters_[thread_index];
+    auto& counter = (state == ThreadLoadTrackingState::kWorking) ? counters.work_duration : counters.wait_duration;
+    // Only this thread writes the counter, hence no read-modify-write operation is required. The atomic store merely
+    // allows Calculate() to read the counter concurrently.
+    counter.store(counter.load(std::memory_order_relaxed) + duration.count(), std::memory_order_relaxed);
+}
+
+PerThreadLoadTracking::Observed PerThreadLoadTracking::TakeDelta(const std::size_t thread_index,
+                                                                 const std::lock_guard<std::mutex>&) noexcept
+{
+    const Counters& counters = counters_[thread_index];
+    Observed& observed = observed_[thread_index];
+
+    const auto work_duration = counters.work_duration.load(std::memory_order_relaxed);
+    const auto wait_duration = counters.wait_duration.load(std::memory_order_relaxed);
+    const Observed delta{work_duration - observed.work_duration, wait_duration - observed.wait_duration};
+    observed.work_duration = work_duration;
+    observed.wait_duration = wait_duration;
+    return delta;
+}
+
+WorkLoad PerThreadLoadTracking::Calculate() noexcept
+{
+    const std::lock_guard<std::mutex> lock{calculate_mutex_};
+
+    TrackingResolution work_duration{};
+    TrackingResolution wait_duration{};
+    for (std::size_t thread_index = 0U; thread_index < counters_.size(); ++thread_index)
+    {
+        const auto delta = TakeDelta(thread_index, lock);
+        work_duration += TrackingResolution{delta.work_duration};
+        wait_duration += TrackingResolution{delta.wait_duration};
+    }
+    return MakeWorkLoad(work_duration, wait_duration);
+}
+
+WorkLoad PerThreadLoadTracking::Calculate(const std::size_t thread_index) noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(thread_index < counters_.size());
+    const std::lock_guard<std::mutex> lock{calculate_mutex_};
+
+    const auto delta = TakeDelta(thread_index, lock);
+    return MakeWorkLoad(TrackingResolution{delta.work_duration}, TrackingResolution{delta.wait_duration});
+}
+
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,114 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
+#define SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
+
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking_token.h"
+#include "score/concurrency/thread_load_tracking/work_load.h"
+
+#include "score/callback.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+
+/// \brief Tracks the work load of a fixed set of threads, e.g. the workers of a pool, without any lock on the tracked
+/// threads.
+/// \details In contrast to ThreadLoadTracking, every thread is identified by an index and accumulates its work and wait
+/// durations in counters on a cache line of its own. Ending a token is a plain load and store of such a counter, thus
+/// tracking every task boundary is cheap and tracked threads never contend with each other or with Calculate().
+///
+/// The counters only grow, Calculate() remembers the values it observed last and returns the difference. A token that
+/// ends while Calculate() runs is either fully accounted to this or to the next calculation.
+/// \note A thread index must only be used by one thread at a time. Calculate() may be called from any thread.
+class PerThreadLoadTracking
+{
+    // Suppres "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
+    // Encapsultes the need to call "get_time_now_()" before creating and ending of "PerThreadLoadTrackingToken" to
+    // measure the processing duration.
+    // coverity[autosar_cpp14_a11_3_1_violation]
+    friend PerThreadLoadTrackingToken;
+
+  public:
+    using GetTimePointFunction = score::cpp::callback<std::chrono::steady_clock::time_point(void)>;
+    using TrackingResolution = std::chrono::steady_clock::duration;
+
+    /// \brief Creates counters for number_of_threads threads.
+    /// \param get_time_now Clock source, e.g. GetHighResolutionTimePoint() for a TSC based one.
+    explicit PerThreadLoadTracking(const std::size_t number_of_threads,
+                                   GetTimePointFunction get_time_now = &std::chrono::steady_clock::now);
+
+    ~PerThreadLoadTracking() = default;
+
+    // Class must not be moved or copied because the token stores a reference to the tracking instance.
+    PerThreadLoadTracking(const PerThreadLoadTracking&) = delete;
+    PerThreadLoadTracking(PerThreadLoadTracking&&) = delete;
+    PerThreadLoadTracking& operator=(const PerThreadLoadTracking&) = delete;
+    PerThreadLoadTracking& operator=(PerThreadLoadTracking&&) = delete;
+
+    /// \brief Returns a token to track working time of the thread with the given index.
+    PerThreadLoadTrackingToken StartWorking(const std::size_t thread_index) noexcept;
+
+    /// \brief Returns a token to track waiting time of the thread with the given index.
+    PerThreadLoadTrackingToken StartWaiting(const std::size_t thread_index) noexcept;
+
+    /// \brief Calculates the work load of all threads together since the last calculation.
+    WorkLoad Calculate() noexcept;
+
+    /// \brief Calculates the work load of the thread with the given index since the last calculation of it.
+    WorkLoad Calculate(const std::size_t thread_index) noexcept;
+
+    /// \brief Returns the number of tracked threads.
+    std::size_t GetNumberOfThreads() const noexcept;
+
+  private:
+    /// \brief Durations accumulated by one thread, written by that thread only.
+    struct alignas(64) Counters
+    {
+        std::atomic<TrackingResolution::rep> work_duration{0};
+        std::atomic<TrackingResolution::rep> wait_duration{0};
+    };
+
+    /// \brief Counter values observed by the last calculation, only accessed by Calculate().
+    struct Observed
+    {
+        TrackingResolution::rep work_duration{0};
+        TrackingResolution::rep wait_duration{0};
+    };
+
+    /// \brief Method to be called by PerThreadLoadTrackingToken.
+    void OnTokenEnd(const std::size_t thread_index,
+                    const TrackingResolution& duration,
+                    const ThreadLoadTrackingState& state) noexcept;
+
+    /// \brief Returns the durations of the thread with the given index since the last calculation. Requires the lock.
+    Observed TakeDelta(const std::size_t thread_index, const std::lock_guard<std::mutex>&) noexcept;
+
+    std::vector<Counters> counters_;
+    // Serializes concurrent calls of Calculate(), the tracked threads never take it
+    std::mutex calculate_mutex_;
+    std::vector<Observed> observed_;
+    GetTimePointFunction get_time_now_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_H
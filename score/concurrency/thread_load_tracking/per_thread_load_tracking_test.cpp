@@ -0,0 +1,181 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+#include "score/concurrency/thread_load_tracking/high_resolution_time_point.h"
+
+#include <score/utility.hpp>
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+const std::chrono::steady_clock::time_point kStartingPoint = std::chrono::steady_clock::now();
+
+/// Every call advances the time of the calling thread by one millisecond, thus every token lasts one millisecond.
+std::chrono::steady_clock::time_point PerThreadStepClock() noexcept
+{
+    thread_local std::chrono::steady_clock::time_point now{kStartingPoint};
+    now += std::chrono::milliseconds{1};
+    return now;
+}
+
+TEST(TestPerThreadLoadTracking, NoWorkNoWaitShallReturnEmptyOptional)
+{
+    PerThreadLoadTracking tracking{2U};
+    const auto result = tracking.Calculate();
+    EXPECT_FALSE(result.work_load_percent.has_value());
+    EXPECT_EQ(tracking.GetNumberOfThreads(), 2U);
+}
+
+TEST(TestPerThreadLoadTracking, WorkOnOneThreadAndWaitOnAnotherShallReturnFiftyPercentWorkLoad)
+{
+    // Given a tracking of two threads
+    PerThreadLoadTracking tracking{2U, &PerThreadStepClock};
+
+    // When the first thread works and the second one waits for the same duration
+    tracking.StartWorking(0U);
+    tracking.StartWaiting(1U);
+
+    // Then the work load of both threads together is fifty percent
+    const auto result = tracking.Calculate();
+    EXPECT_DOUBLE_EQ(result.work_load_percent.value(), 50.0);
+    EXPECT_EQ(result.work_duration, std::chrono::milliseconds{1});
+    EXPECT_EQ(result.wait_duration, std::chrono::milliseconds{1});
+}
+
+TEST(TestPerThreadLoadTracking, CalculateOfOneThreadShallOnlyReturnItsWorkLoad)
+{
+    // Given a tracking where the first thread worked and the second one waited
+    PerThreadLoadTracking tracking{2U, &PerThreadStepClock};
+    tracking.StartWorking(0U);
+    tracking.StartWaiting(1U);
+
+    // When calculating the work load of each thread
+    const auto first = tracking.Calculate(0U);
+    const auto second = tracking.Calculate(1U);
+
+    // Then each thread reports its own work load
+    EXPECT_DOUBLE_EQ(first.work_load_percent.value(), 100.0);
+    EXPECT_DOUBLE_EQ(second.work_load_percent.value(), 0.0);
+}
+
+TEST(TestPerThreadLoadTracking, CalculateShallOnlyReturnDurationsSinceTheLastCalculation)
+{
+    // Given a tracking where both threads worked
+    PerThreadLoadTracking tracking{2U, &PerThreadStepClock};
+    tracking.StartWorking(0U);
+    tracking.StartWorking(1U);
+
+    // When the first thread was calculated already and the second thread waits afterwards
+    score::cpp::ignore = tracking.Calculate(0U);
+    tracking.StartWaiting(1U);
+
+    // Then the next calculation does not contain the work of the first thread again
+    const auto result = tracking.Calculate();
+    EXPECT_EQ(result.work_duration, std::chrono::milliseconds{1});
+    EXPECT_EQ(result.wait_duration, std::chrono::milliseconds{1});
+
+    // And a further calculation is empty
+    EXPECT_FALSE(tracking.Calculate().work_load_percent.has_value());
+}
+
+TEST(TestPerThreadLoadTracking, MovedTokenShallOnlyBeTrackedOnce)
+{
+    // Given a running work token that is moved into another one
+    PerThreadLoadTracking tracking{1U, &PerThreadStepClock};
+    auto token = tracking.StartWorking(0U);
+    auto moved = std::move(token);
+
+    // When both tokens are ended
+    moved.End();
+    token.End();
+
+    // Then the work was tracked once
+    EXPECT_EQ(tracking.Calculate().work_duration, std::chrono::milliseconds{1});
+}
+
+TEST(TestPerThreadLoadTracking, ConcurrentTrackingAndCalculationShallNotLoseDurations)
+{
+    constexpr std::size_t kThreads{4U};
+    constexpr std::size_t kTokensPerThread{10000U};
+
+    // Given a tracking of four threads
+    PerThreadLoadTracking tracking{kThreads, &PerThreadStepClock};
+
+    // When all threads track work and wait durations while the load is calculated concurrently
+    std::atomic<std::size_t> running{kThreads};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kThreads; ++thread_index)
+    {
+        threads.emplace_back([&tracking, &running, thread_index]() {
+            for (std::size_t token = 0U; token < kTokensPerThread; ++token)
+            {
+                tracking.StartWorking(thread_index);
+                tracking.StartWaiting(thread_index);
+            }
+            --running;
+        });
+    }
+    std::chrono::nanoseconds work_duration{};
+    std::chrono::nanoseconds wait_duration{};
+    while (running != 0U)
+    {
+        const auto result = tracking.Calculate();
+        work_duration += result.work_duration;
+        wait_duration += result.wait_duration;
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const auto result = tracking.Calculate();
+    work_duration += result.work_duration;
+    wait_duration += result.wait_duration;
+
+    // Then the calculations sum up to all tracked durations
+    EXPECT_EQ(work_duration, kThreads * kTokensPerThread * std::chrono::milliseconds{1});
+    EXPECT_EQ(wait_duration, kThreads * kTokensPerThread * std::chrono::milliseconds{1});
+}
+
+TEST(TestPerThreadLoadTracking, HighResolutionTimePointShallBeUsableAsClockSource)
+{
+    // Given a tracking with the high resolution clock source
+    PerThreadLoadTracking tracking{1U, &GetHighResolutionTimePoint};
+
+    // When working for some time
+    {
+        auto token = tracking.StartWorking(0U);
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    // Then at least that time is tracked
+    const auto result = tracking.Calculate();
+    EXPECT_GE(result.work_duration, std::chrono::milliseconds{1});
+    EXPECT_DOUBLE_EQ(result.work_load_percent.value(), 100.0);
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
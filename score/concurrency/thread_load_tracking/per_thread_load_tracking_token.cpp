@@ -0,0 +1,78 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking_token.h"
+
+#include "score/concurrency/thread_load_tracking/per_thread_load_tracking.h"
+
+namespace score
+{
+namespace concurrency
+{
+
+PerThreadLoadTrackingToken::PerThreadLoadTrackingToken(PerThreadLoadTracking& tracking,
+                                                       const std::size_t thread_index,
+                                                       const ThreadLoadTrackingState& state) noexcept
+    : tracking_{&tracking},
+      thread_index_{thread_index},
+      state_{state},
+      start_time_{tracking.get_time_now_()},
+      end_called_{false}
+{
+}
+
+PerThreadLoadTrackingToken::PerThreadLoadTrackingToken(PerThreadLoadTrackingToken&& other) noexcept
+    : tracking_{other.tracking_},
+      thread_index_{other.thread_index_},
+      state_{other.state_},
+      start_time_{other.start_time_},
+      end_called_{other.end_called_}
+{
+    other.end_called_ = true;
+}
+
+PerThreadLoadTrackingToken& PerThreadLoadTrackingToken::operator=(PerThreadLoadTrackingToken&& other) noexcept
+{
+    if (this != &other)
+    {
+        End();
+        tracking_ = other.tracking_;
+        thread_index_ = other.thread_index_;
+        state_ = other.state_;
+        start_time_ = other.start_time_;
+        end_called_ = other.end_called_;
+        other.end_called_ = true;
+    }
+    return *this;
+}
+
+void PerThreadLoadTrackingToken::End() noexcept
+{
+    // Check if End() was already called before.
+    if (end_called_)
+    {
+        return;
+    }
+    end_called_ = true;
+
+    const auto now = tracking_->get_time_now_();
+    const auto duration = std::chrono::duration_cast<PerThreadLoadTracking::TrackingResolution>(now - start_time_);
+    tracking_->OnTokenEnd(thread_index_, duration, state_);
+}
+
+PerThreadLoadTrackingToken::~PerThreadLoadTrackingToken() noexcept
+{
+    End();
+}
+
+}  // namespace concurrency
+}  // namespace score
@@ -0,0 +1,64 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_TOKEN_H
+#define SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_TOKEN_H
+
+#include "score/concurrency/thread_load_tracking/thread_load_tracking_state.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace score
+{
+namespace concurrency
+{
+
+class PerThreadLoadTracking;
+
+/// \brief RAII work and wait tracking token of a single thread of PerThreadLoadTracking.
+class PerThreadLoadTrackingToken
+{
+    // Suppres "AUTOSAR C++14 A11-3-1" rule finding: "Friend declarations shall not be used.".
+    // Force "PerThreadLoadTrackingToken" to be created only with "PerThreadLoadTracking"
+    // coverity[autosar_cpp14_a11_3_1_violation]
+    friend PerThreadLoadTracking;
+
+  public:
+    /// \brief Method to early stopping the tracking before the destructor is called.
+    void End() noexcept;
+
+    /// \brief Stops the tracking if it is not already stopped by calling End().
+    ~PerThreadLoadTrackingToken() noexcept;
+
+    // RAII object shall be only movable not copyable. A moved-from token does not track anymore.
+    PerThreadLoadTrackingToken(const PerThreadLoadTrackingToken&) = delete;
+    PerThreadLoadTrackingToken(PerThreadLoadTrackingToken&&) noexcept;
+    PerThreadLoadTrackingToken& operator=(const PerThreadLoadTrackingToken&) = delete;
+    PerThreadLoadTrackingToken& operator=(PerThreadLoadTrackingToken&&) noexcept;
+
+  private:
+    PerThreadLoadTrackingToken(PerThreadLoadTracking&,
+                               const std::size_t thread_index,
+                               const ThreadLoadTrackingState&) noexcept;
+
+    PerThreadLoadTracking* tracking_;
+    std::size_t thread_index_;
+    ThreadLoadTrackingState state_;
+    std::chrono::steady_clock::time_point start_time_;
+    bool end_called_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_THREAD_LOAD_TRACKING_PER_THREAD_LOAD_TRACKING_TOKEN_H
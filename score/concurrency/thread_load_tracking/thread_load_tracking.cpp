@@ -61,20 +61,7 @@ WorkLoad ThreadLoadTracking::Calculate() noexcept
 {
     std::lock_guard<std::mutex> lock{mutex_};
 
-    // coverity[autosar_cpp14_m8_5_2_violation] kept for the sake of zero-initialization
-    WorkLoad result{};
-
-    const auto work_fp = work_duration_.count();
-    const auto wait_fp = wait_duration_.count();
-    const auto work_and_wait_duration = work_fp + wait_fp;
-
-    if (work_and_wait_duration != 0)
-    {
-        result.work_load_percent = 100.0 * static_cast<double>(work_fp) / static_cast<double>(work_and_wait_duration);
-    }
-
-    result.work_duration = work_duration_;
-    result.wait_duration = wait_duration_;
+    const WorkLoad result = MakeWorkLoad(work_duration_, wait_duration_);
 
     // Reset duration counters
     work_duration_ = TrackingResolution{};
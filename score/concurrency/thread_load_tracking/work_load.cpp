@@ -0,0 +1,41 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/thread_load_tracking/work_load.h"
+
+namespace score
+{
+namespace concurrency
+{
+
+WorkLoad MakeWorkLoad(const std::chrono::nanoseconds work_duration,
+                      const std::chrono::nanoseconds wait_duration) noexcept
+{
+    // coverity[autosar_cpp14_m8_5_2_violation] kept for the sake of zero-initialization
+    WorkLoad result{};
+
+    const auto work_fp = work_duration.count();
+    const auto wait_fp = wait_duration.count();
+    const auto work_and_wait_duration = work_fp + wait_fp;
+
+    if (work_and_wait_duration != 0)
+    {
+        result.work_load_percent = 100.0 * static_cast<double>(work_fp) / static_cast<double>(work_and_wait_duration);
+    }
+
+    result.work_duration = work_duration;
+    result.wait_duration = wait_duration;
+    return result;
+}
+
+}  // namespace concurrency
+}  // namespace score
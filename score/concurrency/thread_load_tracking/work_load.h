@@ -38,6 +38,9 @@ struct WorkLoad
     std::optional<double> work_load_percent{};
 };
 
+/// \brief Creates the work load of a thread that worked and waited for the given durations.
+WorkLoad MakeWorkLoad(std::chrono::nanoseconds work_duration, std::chrono::nanoseconds wait_duration) noexcept;
+
 }  // namespace concurrency
 }  // namespace score
 
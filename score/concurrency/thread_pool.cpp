@@ -20,6 +20,39 @@
 
 #include "score/utility.hpp"
 
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+/// \brief Identifies the pool and the worker the current thread belongs to, to push tasks enqueued from within a task
+/// to the deque of the current worker.
+struct CurrentWorker
+{
+    const score::concurrency::ThreadPool* pool;
+    std::size_t thread_number;
+};
+
+thread_local CurrentWorker current_worker{nullptr, 0U};
+
+}  // namespace
+
+score::concurrency::ThreadPool::Worker::Worker(score::cpp::pmr::memory_resource* memory_resource)
+    : local{memory_resource}, inbox_mutex{}, inbox{memory_resource}, active_mutex{}, active{}
+{
+}
+
+score::concurrency::ThreadPool::Worker::~Worker() noexcept
+{
+    // The deque does not own its elements. It is empty at this point, since workers execute all queued tasks before
+    // they exit, but ownership is restored anyway so that no task can leak.
+    for (auto entry = local.Pop(); entry.has_value(); entry = local.Pop())
+    {
+        score::cpp::pmr::unique_ptr<Task> task{entry->task, std::move(entry->deleter)};
+    }
+}
+
 score::concurrency::ThreadPool::ThreadPool(const std::size_t number_of_threads, const std::string& name)
     : ThreadPool(number_of_threads, score::cpp::pmr::get_default_resource(), name)
 {
@@ -36,7 +69,15 @@ score::concurrency::ThreadPool::ThreadPool(const std::size_t number_of_threads,
 void score::concurrency::ThreadPool::InitializeThreads(const std::size_t number_of_threads, const std::string& name)
 {
     pool_.reserve(number_of_threads);
-    active_.resize(number_of_threads);
+
+    // A pool without threads still needs an inbox to accept tasks until it is shut down
+    const std::size_t number_of_workers{std::max(number_of_threads, std::size_t{1U})};
+    workers_.reserve(number_of_workers);
+    for (std::size_t worker_number = 0U; worker_number < number_of_workers; worker_number++)
+    {
+        workers_.push_back(score::cpp::pmr::make_unique<Worker>(
+            score::cpp::pmr::polymorphic_allocator<Worker>{this->GetMemoryResource()}, this->GetMemoryResource()));
+    }
 
     std::unique_ptr<score::os::Pthread> pthread;
     // coverity[autosar_cpp14_a16_0_1_violation] must have implementation selection
@@ -64,32 +105,118 @@ void score::concurrency::ThreadPool::InitializeThreads(const std::size_t number_
 
 void score::concurrency::ThreadPool::Work(const std::size_t thread_number, const score::cpp::stop_token stop_token)
 {
-    std::unique_lock<std::mutex> lock{queue_mutex_};
+    current_worker = CurrentWorker{this, thread_number};
+    std::minstd_rand random{static_cast<std::minstd_rand::result_type>(thread_number + 1U)};
+    Worker& worker = *workers_.at(thread_number);
+
+    // Even after a stop was requested, all queued tasks are executed before the worker exits.
     // GCOV_EXCL_START : Decision coudn't be analyzed. Covered by ThreadPool
-    while ((!stop_token.stop_requested()) || (!queue_.empty()))
+    while ((!stop_token.stop_requested()) || (pending_.load() > 0U))
     // GCOV_EXCL_STOP
     {
+        score::cpp::ignore = searching_.fetch_add(1U);
+        score::cpp::pmr::unique_ptr<Task> task = FindTask(thread_number, random);
+        score::cpp::ignore = searching_.fetch_sub(1U);
+        if (task != nullptr)
+        {
+            // Producers do not wake anybody while this worker was searching, so hand over the remaining tasks
+            if (pending_.load() > 0U)
+            {
+                WakeOne();
+            }
+            // Be aware of the ABA-Problem :)
+            {
+                std::lock_guard<std::mutex> lock{worker.active_mutex};
+                worker.active = task->GetStopSource();
+            }
+            Execute(std::move(task));
+            {
+                std::lock_guard<std::mutex> lock{worker.active_mutex};
+                worker.active = score::cpp::stop_source{};
+            }
+            continue;
+        }
+
+        if (pending_.load() > 0U)
+        {
+            // A task is being published or sits in an inbox that is locked at the moment, look again shortly
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Producers increment pending_ before they read sleeping_, thus either they see this worker sleeping and
+        // notify it, or this worker sees their task in the predicate.
+        std::unique_lock<std::mutex> lock{sleep_mutex_};
+        score::cpp::ignore = sleeping_.fetch_add(1U);
         score::cpp::ignore = condition_.wait(lock, stop_token, [this]() noexcept -> bool {
-            return !queue_.empty();
+            return pending_.load() > 0U;
         });
+        score::cpp::ignore = sleeping_.fetch_sub(1U);
+    }
+
+    current_worker = CurrentWorker{nullptr, 0U};
+}
 
+score::cpp::pmr::unique_ptr<score::concurrency::Task> score::concurrency::ThreadPool::FindTask(
+    const std::size_t thread_number,
+    std::minstd_rand& random)
+{
+    const auto take = [this](TaskEntry& entry) {
+        score::cpp::ignore = pending_.fetch_sub(1U);
+        return score::cpp::pmr::unique_ptr<Task>{entry.task, std::move(entry.deleter)};
+    };
+    const auto take_from_inbox = [this](Worker& worker, std::unique_lock<std::mutex>& lock) {
         score::cpp::pmr::unique_ptr<Task> task{};
-        if (!queue_.empty())
+        if (lock.owns_lock() && (!worker.inbox.empty()))
         {
-            task = std::move(queue_.front());
-            queue_.pop_front();
+            task = std::move(worker.inbox.front());
+            worker.inbox.pop_front();
+            score::cpp::ignore = pending_.fetch_sub(1U);
         }
+        return task;
+    };
 
+    // Own tasks first: the most recently pushed one of the deque, then the oldest one of the inbox
+    Worker& self = *workers_.at(thread_number);
+    auto entry = self.local.Pop();
+    if (entry.has_value())
+    {
+        return take(entry.value());
+    }
+    {
+        std::unique_lock<std::mutex> lock{self.inbox_mutex};
+        auto task = take_from_inbox(self, lock);
         if (task != nullptr)
         {
-            // Be aware of the ABA-Problem :)
-            active_.at(thread_number) = task->GetStopSource();
-            lock.unlock();
-            Execute(std::move(task));
-            lock.lock();
-            active_.at(thread_number) = score::cpp::stop_source{};
+            return task;
         }
     }
+
+    // Then steal, starting at a random victim to spread the thieves over the workers
+    const std::size_t number_of_workers{workers_.size()};
+    const std::size_t first_victim{static_cast<std::size_t>(random()) % number_of_workers};
+    for (std::size_t offset = 0U; offset < number_of_workers; offset++)
+    {
+        const std::size_t victim_number{(first_victim + offset) % number_of_workers};
+        if (victim_number == thread_number)
+        {
+            continue;
+        }
+        Worker& victim = *workers_.at(victim_number);
+        entry = victim.local.Steal();
+        if (entry.has_value())
+        {
+            return take(entry.value());
+        }
+        // Skip inboxes that are in use, pending_ keeps this worker awake to look again
+        std::unique_lock<std::mutex> lock{victim.inbox_mutex, std::try_to_lock};
+        auto task = take_from_inbox(victim, lock);
+        if (task != nullptr)
+        {
+            return task;
+        }
+    }
+    return nullptr;
 }
 
 std::size_t score::concurrency::ThreadPool::MaxConcurrencyLevel() const noexcept
@@ -104,13 +231,20 @@ void score::concurrency::ThreadPool::Shutdown() noexcept
 
 void score::concurrency::ThreadPool::InternalShutdown() noexcept
 {
-    // we set this flag as first step so that no new tasks will get added to our queue
+    // we set this flag as first step so that no new tasks will get added to our queues
     shutdown_reqested_.store(true);
 
-    std::lock_guard<std::mutex> lock{queue_mutex_};
-    for (auto& task_stop_source : active_)
+    // Tasks that passed the check before have to be published before the workers are stopped. Otherwise, a worker
+    // could see no pending task, exit, and the task would never get executed.
+    while (enqueues_in_flight_.load() > 0U)
     {
-        score::cpp::ignore = task_stop_source.request_stop();
+        std::this_thread::yield();
+    }
+
+    for (auto& worker : workers_)
+    {
+        std::lock_guard<std::mutex> lock{worker->active_mutex};
+        score::cpp::ignore = worker->active.request_stop();
     }
     for (auto& worker_thread : pool_)
     {
@@ -125,20 +259,63 @@ bool score::concurrency::ThreadPool::ShutdownRequested() const noexcept
 
 void score::concurrency::ThreadPool::Enqueue(score::cpp::pmr::unique_ptr<Task> task)
 {
-    // NOTE: Even though ShutdownRequested() is an atomic operation, the lock must
-    //       be acquired already here since otherwise, tasks might get added to the
-    //       queue while InternalShutdown() is currently running. Then, in an unlucky
-    //       situation, it could happen that all workers already finished and the newly
-    //       added task gets never executed. Hence, we acquire the lock already here.
-    std::unique_lock<std::mutex> lock{queue_mutex_};
+    // NOTE: The counter is incremented before the shutdown flag is checked, while InternalShutdown() sets the flag
+    //       before it waits for the counter to drop to zero. Hence, either the task is executed right here, or it is
+    //       published before the workers are requested to stop and is thus still executed by them.
+    score::cpp::ignore = enqueues_in_flight_.fetch_add(1U);
     if (ShutdownRequested())
     {
-        lock.unlock();
+        score::cpp::ignore = enqueues_in_flight_.fetch_sub(1U);
         Execute(std::move(task));
+        return;
+    }
+
+    // Counted before the task is visible, so that a worker which takes it never observes an underflow
+    score::cpp::ignore = pending_.fetch_add(1U);
+    if (current_worker.pool == this)
+    {
+        // Enqueued from within a task of this pool: LIFO on the deque of the current worker, no lock involved
+        TaskEntry entry{nullptr, task.get_deleter()};
+        entry.task = task.release();
+        workers_.at(current_worker.thread_number)->local.Push(entry);
     }
     else
     {
-        score::cpp::ignore = queue_.emplace_back(std::move(task));
+        PushToInbox(std::move(task));
+    }
+    score::cpp::ignore = enqueues_in_flight_.fetch_sub(1U);
+    // A worker that is searching for a task will find this one, or wake another worker if it finds a different one
+    if (searching_.load() == 0U)
+    {
+        WakeOne();
+    }
+}
+
+void score::concurrency::ThreadPool::PushToInbox(score::cpp::pmr::unique_ptr<Task> task)
+{
+    // Round-robin over the inboxes, preferring one that is not locked at the moment
+    const std::size_t number_of_workers{workers_.size()};
+    const std::size_t first{next_inbox_.fetch_add(1U, std::memory_order_relaxed) % number_of_workers};
+    for (std::size_t offset = 0U; offset < number_of_workers; offset++)
+    {
+        Worker& worker = *workers_.at((first + offset) % number_of_workers);
+        std::unique_lock<std::mutex> lock{worker.inbox_mutex, std::try_to_lock};
+        if (lock.owns_lock())
+        {
+            score::cpp::ignore = worker.inbox.emplace_back(std::move(task));
+            return;
+        }
+    }
+    Worker& worker = *workers_.at(first);
+    std::lock_guard<std::mutex> lock{worker.inbox_mutex};
+    score::cpp::ignore = worker.inbox.emplace_back(std::move(task));
+}
+
+void score::concurrency::ThreadPool::WakeOne() noexcept
+{
+    if (sleeping_.load() > 0U)
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex_};
         condition_.notify_one();
     }
 }
@@ -16,6 +16,7 @@
 #include "score/concurrency/condition_variable.h"
 #include "score/concurrency/executor.h"
 #include "score/concurrency/task.h"
+#include "score/concurrency/work_stealing_deque.h"
 
 #include <score/deque.hpp>
 #include <score/jthread.hpp>
@@ -27,6 +28,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <mutex>
+#include <random>
 #include <unordered_map>
 #include <vector>
 
@@ -43,6 +46,12 @@ namespace concurrency
  * It has a dynamic size of Task queue, which requires dynamic memory allocation.
  * In order to be used in safety systems, a memory_resource can be injected
  * which will be used for the dynamic allocation.
+ *
+ * Every worker owns a lock-free work-stealing deque. Tasks enqueued from within a task of this pool are pushed to
+ * the deque of the current worker and are executed in LIFO order by it, which keeps their data hot in the cache.
+ * Tasks enqueued from other threads are distributed round-robin over small per-worker inboxes. An idle worker first
+ * takes from its own deque and inbox and then steals from the other workers, starting at a random victim. Thus
+ * there is no single lock that all producers and workers contend on.
  */
 class ThreadPool final : public Executor
 {
@@ -86,18 +95,59 @@ class ThreadPool final : public Executor
     void Enqueue(score::cpp::pmr::unique_ptr<Task> task) override;
 
   private:
+    /**
+     * \brief A task whose ownership was released to store it in a WorkStealingDeque.
+     */
+    struct TaskEntry
+    {
+        Task* task;
+        score::cpp::pmr::unique_ptr<Task>::deleter_type deleter;
+    };
+
+    /**
+     * \brief The queues and the currently executed task of one worker thread.
+     */
+    struct Worker
+    {
+        explicit Worker(score::cpp::pmr::memory_resource* memory_resource);
+        ~Worker() noexcept;
+        Worker(const Worker&) = delete;
+        Worker& operator=(const Worker&) = delete;
+        Worker(Worker&&) = delete;
+        Worker& operator=(Worker&&) = delete;
+
+        // Pushed and popped only by the worker thread, stolen by all others
+        WorkStealingDeque<TaskEntry> local;
+        // Tasks enqueued from outside of the pool
+        std::mutex inbox_mutex;
+        score::cpp::pmr::deque<score::cpp::pmr::unique_ptr<Task>> inbox;
+        // Stop source of the task that is currently executed, stopped on shutdown
+        std::mutex active_mutex;
+        score::cpp::stop_source active;
+    };
+
     void InitializeThreads(const std::size_t number_of_threads, const std::string& name);
     void Work(const std::size_t thread_number, const score::cpp::stop_token stop_token);
+    score::cpp::pmr::unique_ptr<Task> FindTask(const std::size_t thread_number, std::minstd_rand& random);
+    void PushToInbox(score::cpp::pmr::unique_ptr<Task> task);
+    void WakeOne() noexcept;
     void Execute(score::cpp::pmr::unique_ptr<Task> task);
     // Required since thread_pool needs to call shutdown within its destructor but that method is virtual.
     // See also MISRA.DTOR.DYNAMIC
     void InternalShutdown() noexcept;
 
     std::atomic_bool shutdown_reqested_{false};
+    // Number of Enqueue() calls that passed the shutdown check but did not yet publish their task
+    std::atomic<std::size_t> enqueues_in_flight_{0U};
+    // Number of tasks that are queued and not yet taken by a worker
+    std::atomic<std::size_t> pending_{0U};
+    // Number of workers that look for a task and number of workers that wait for one
+    std::atomic<std::size_t> searching_{0U};
+    std::atomic<std::size_t> sleeping_{0U};
+    std::atomic<std::size_t> next_inbox_{0U};
     InterruptibleConditionalVariable condition_{};
-    std::mutex queue_mutex_{};
-    score::cpp::pmr::vector<score::cpp::stop_source> active_{this->GetMemoryResource()};
-    score::cpp::pmr::deque<score::cpp::pmr::unique_ptr<Task>> queue_{this->GetMemoryResource()};
+    std::mutex sleep_mutex_{};
+    score::cpp::pmr::vector<score::cpp::pmr::unique_ptr<Worker>> workers_{this->GetMemoryResource()};
 
     // This is intentionally last, since this will ensure that on destruction we first wait for all threads to stop
     // before we destruct anything else.
@@ -17,9 +17,9 @@
 #include "score/concurrency/executor.h"
 #include "score/concurrency/timed_executor/timed_executor.h"
 #include "score/concurrency/timed_executor/timed_task.h"
+#include "score/concurrency/timed_executor/timer_queue.h"
 
 #include <score/assert.hpp>
-#include <score/deque.hpp>
 #include <score/jthread.hpp>
 #include <score/memory.hpp>
 #include <score/memory_resource.hpp>
@@ -43,7 +43,11 @@ namespace score::concurrency
 /// @noted Running tasks will _not_ get interrupted. If the concurrency level is to low, this means that tasks will
 /// not get executed according to their schedule. After all, this is only a best effort approach, since the OS is at
 /// the end the deciding factor, what gets scheduled when.
-template <class Clock>
+///
+/// @tparam TimerQueue The structure that keeps the scheduled tasks, see SortedTimerQueue for its interface. The default
+/// SortedTimerQueue suits a small number of tasks. For thousands of outstanding tasks, use TimerWheelQueue, whose
+/// insertion cost does not depend on the number of tasks.
+template <class Clock, class TimerQueue = SortedTimerQueue<Clock>>
 class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
 {
   public:
@@ -51,7 +55,19 @@ class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
 
     explicit ConcurrentTimedExecutor(score::cpp::pmr::memory_resource* memory_resource,
                                      score::cpp::pmr::unique_ptr<Executor> executor)
-        : TimedExecutor<Clock>{memory_resource}, executor_{std::move(executor)}, queue_{}, free_{}, waiting_{}, mutex_{}
+        : ConcurrentTimedExecutor{memory_resource, std::move(executor), TimerQueue{memory_resource}}
+    {
+    }
+
+    explicit ConcurrentTimedExecutor(score::cpp::pmr::memory_resource* memory_resource,
+                                     score::cpp::pmr::unique_ptr<Executor> executor,
+                                     TimerQueue queue)
+        : TimedExecutor<Clock>{memory_resource},
+          executor_{std::move(executor)},
+          queue_{std::move(queue)},
+          free_{},
+          waiting_{},
+          mutex_{}
     {
         SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(executor_ != nullptr);
         for (std::size_t counter{0U}; counter < executor_->MaxConcurrencyLevel(); counter++)
@@ -144,12 +160,12 @@ class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
             }
             score::cpp::ignore = free_.erase(conditional_variable);
 
-            auto time_task_pair = std::move(queue_.front());
+            const auto now = Clock::now();
+            auto time_task_pair = queue_.Pop(now);
             const auto next_execution_point = time_task_pair.first;
             task = std::move(time_task_pair.second);
-            queue_.pop_front();
 
-            if (Clock::now() < next_execution_point)
+            if (now < next_execution_point)
             {
                 // since we have no good way to figure out if a new task was added, we do not care about spurious
                 // wake-ups
@@ -159,7 +175,11 @@ class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
 
                 // we always add back to the queue, this handles spurious wake-ups and ensures that if a task
                 // with a shorter next_execution_point has been added while waiting, that this will be executed first
-                ScheduleAtInternal(std::move(lock), next_execution_point, std::move(task));
+                // a queue that returned no task only told us until when nothing has to be executed
+                if (task != nullptr)
+                {
+                    ScheduleAtInternal(std::move(lock), next_execution_point, std::move(task));
+                }
                 return;
             }
         }
@@ -188,13 +208,7 @@ class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
     {
         SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(lock.owns_lock());
 
-        const auto iterator = std::lower_bound(queue_.begin(),
-                                               queue_.end(),
-                                               std::make_pair(time_point, nullptr),
-                                               [](const auto& lhs, const auto& rhs) noexcept -> bool {
-                                                   return lhs.first < rhs.first;
-                                               });
-        score::cpp::ignore = queue_.insert(iterator, std::make_pair(time_point, std::move(task)));
+        queue_.Insert(time_point, std::move(task));
         score::cpp::ignore = WakeUp(std::move(lock), time_point);
     }
 
@@ -232,7 +246,7 @@ class ConcurrentTimedExecutor final : public TimedExecutor<Clock>
     }
 
     score::cpp::pmr::unique_ptr<Executor> executor_;
-    score::cpp::pmr::deque<std::pair<TimePoint, score::cpp::pmr::unique_ptr<TimedTask<Clock>>>> queue_;
+    TimerQueue queue_;
     score::cpp::pmr::set<std::shared_ptr<concurrency::InterruptibleConditionalVariable>> free_;
     score::cpp::pmr::set<std::pair<TimePoint, std::shared_ptr<concurrency::InterruptibleConditionalVariable>>> waiting_;
     std::mutex mutex_;
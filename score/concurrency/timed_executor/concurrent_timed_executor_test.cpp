@@ -54,6 +54,23 @@ class ConcurrentTimedExecutorFixture : public ::testing::Test
         return CreateConcurrentTimedExecutor();
     }
 
+    ConcurrentTimedExecutor<testing::SteadyClock, TimerWheelQueue<testing::SteadyClock>>
+    CreateConcurrentTimedExecutorWithTimerWheelAndTwoThreads()
+    {
+        WithThreads(2);
+        auto* const memory_resource = score::cpp::pmr::get_default_resource();
+        return ConcurrentTimedExecutor<testing::SteadyClock, TimerWheelQueue<testing::SteadyClock>>{
+            memory_resource, std::move(executor_mock_stealed_), TimerWheelQueue<testing::SteadyClock>{memory_resource}};
+    }
+
+    ConcurrentTimedExecutor<std::chrono::steady_clock, TimerWheelQueue<std::chrono::steady_clock>>
+    CreateConcurrentTimedExecutorWithTimerWheelAndRealThreadPool()
+    {
+        return ConcurrentTimedExecutor<std::chrono::steady_clock, TimerWheelQueue<std::chrono::steady_clock>>{
+            score::cpp::pmr::get_default_resource(),
+            score::cpp::pmr::make_unique<ThreadPool>(score::cpp::pmr::new_delete_resource(), 1)};
+    }
+
     ConcurrentTimedExecutor<std::chrono::steady_clock> CreateConcurrentTimedExecutorWithRealThreadPool()
     {
         return ConcurrentTimedExecutor<std::chrono::steady_clock>{
@@ -80,7 +97,9 @@ class ConcurrentTimedExecutorFixture : public ::testing::Test
                                                                });
     }
 
-    void Tick(ConcurrentTimedExecutor<concurrency::testing::SteadyClock>& unit, score::cpp::stop_token token = {})
+    template <class TimerQueue>
+    void Tick(ConcurrentTimedExecutor<concurrency::testing::SteadyClock, TimerQueue>& unit,
+              score::cpp::stop_token token = {})
     {
         unit.Work(token, conditional_variable);
     }
@@ -394,5 +413,73 @@ TEST_F(ConcurrentTimedExecutorFixture, EnsureWakeUpNotifiesWaitingWorker)
     ASSERT_TRUE(task_executed_future.valid());
 }
 
+TEST_F(ConcurrentTimedExecutorFixture, ExecutesTasksInRightOrderWithTimerWheel)
+{
+    using namespace std::chrono_literals;
+
+    // Given a ConcurrentTimedExecutor with a TimerWheelQueue and two threads
+    auto unit = CreateConcurrentTimedExecutorWithTimerWheelAndTwoThreads();
+
+    // When scheduling three tasks with different execution orders, two of them within the same tick
+    std::size_t order{0};
+    // to be executed at +5.2ms
+    unit.Post(testing::SteadyClock::now() + 5200us, [&order](auto, auto) noexcept {
+        order = 2U;
+    });
+    // to be executed at +5.7ms
+    unit.Post(testing::SteadyClock::now() + 5700us, [&order](auto, auto) noexcept {
+        order = 3U;
+    });
+    // to be executed at +0ms and then again after 999 hours
+    unit.Post(999h, [&order](auto, auto) noexcept {
+        order = 1U;
+    });
+
+    // Then this order is hold
+    Tick(unit);
+    ASSERT_EQ(order, 1U);
+
+    testing::SteadyClock::modify_time(5200us);
+    Tick(unit);
+    ASSERT_EQ(order, 2U);
+
+    testing::SteadyClock::modify_time(500us);
+    Tick(unit);
+    ASSERT_EQ(order, 3U);
+
+    testing::SteadyClock::modify_time(999h);
+    Tick(unit);
+    EXPECT_EQ(order, 1U);
+}
+
+TEST_F(ConcurrentTimedExecutorFixture, EnsureWaitingForTasksExecutionPointWithTimerWheel)
+{
+    using namespace std::chrono_literals;
+    std::atomic<std::chrono::steady_clock::time_point> slot_1{std::chrono::steady_clock::time_point::max()};
+    std::atomic<std::chrono::steady_clock::time_point> slot_2{std::chrono::steady_clock::time_point::max()};
+
+    // Given a ConcurrentTimedExecutor with a TimerWheelQueue and a real thread pool
+    auto unit = CreateConcurrentTimedExecutorWithTimerWheelAndRealThreadPool();
+
+    // When scheduling a task that will be executed after 10.5ms and one after 300ms, which cascades down the levels
+    auto time_of_post = std::chrono::steady_clock::now();
+    unit.Post(time_of_post + 300ms, [&slot_2](auto, auto) noexcept {
+        slot_2 = std::chrono::steady_clock::now();
+    });
+    unit.Post(time_of_post + 10500us, [&slot_1](auto, auto) noexcept {
+        slot_1 = std::chrono::steady_clock::now();
+    });
+
+    // Waiting until both tasks were executed
+    while (slot_2.load() == std::chrono::steady_clock::time_point::max())
+    {
+        std::this_thread::yield();
+    }
+
+    // Then we waited at least until the exact execution points, despite the wheel's granularity of one tick
+    ASSERT_LE(time_of_post + 10500us, slot_1.load());
+    EXPECT_LE(time_of_post + 300ms, slot_2.load());
+}
+
 }  // namespace
 }  // namespace score::concurrency
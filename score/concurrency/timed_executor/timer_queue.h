@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_QUEUE_H
+#define SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_QUEUE_H
+
+#include "score/concurrency/timed_executor/timed_task.h"
+#include "score/concurrency/timed_executor/timer_wheel.h"
+
+#include <score/assert.hpp>
+#include <score/deque.hpp>
+#include <score/memory.hpp>
+#include <score/memory_resource.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace score::concurrency
+{
+
+/// @brief Scheduling structure of the ConcurrentTimedExecutor, that keeps the tasks sorted by their execution point.
+///
+/// @details Insertion is O(n) in the number of scheduled tasks, retrieving the next task is O(1). Suited for a small
+/// number of tasks.
+///
+/// A scheduling structure provides:
+/// - `bool empty() const`
+/// - `void Insert(TimePoint, score::cpp::pmr::unique_ptr<TimedTask<Clock>>)`
+/// - `std::pair<TimePoint, score::cpp::pmr::unique_ptr<TimedTask<Clock>>> Pop(TimePoint now)`, that removes the task
+///   to execute next. The returned time point may be after now, then the caller waits until then and inserts the task
+///   again. If no task is returned, no task has to be executed before the returned time point.
+template <class Clock>
+class SortedTimerQueue final
+{
+  public:
+    using TimePoint = std::chrono::time_point<Clock>;
+    using TaskPointer = score::cpp::pmr::unique_ptr<TimedTask<Clock>>;
+
+    explicit SortedTimerQueue(score::cpp::pmr::memory_resource* memory_resource) : queue_{memory_resource} {}
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return queue_.empty();
+    }
+
+    void Insert(const TimePoint time_point, TaskPointer task)
+    {
+        const auto iterator = std::lower_bound(queue_.begin(),
+                                               queue_.end(),
+                                               std::make_pair(time_point, nullptr),
+                                               [](const auto& lhs, const auto& rhs) noexcept -> bool {
+                                                   return lhs.first < rhs.first;
+                                               });
+        score::cpp::ignore = queue_.insert(iterator, std::make_pair(time_point, std::move(task)));
+    }
+
+    std::pair<TimePoint, TaskPointer> Pop(const TimePoint /* now */)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(not queue_.empty());
+        auto time_task_pair = std::move(queue_.front());
+        queue_.pop_front();
+        return time_task_pair;
+    }
+
+  private:
+    score::cpp::pmr::deque<std::pair<TimePoint, TaskPointer>> queue_;
+};
+
+/// @brief Scheduling structure of the ConcurrentTimedExecutor, that keeps the tasks in a TimerWheel.
+///
+/// @details Insertion is O(1), independent of the number of scheduled tasks. Tasks are retrieved in the order of the
+/// ticks of their execution points, tasks within the same tick in the order of insertion. Since the executor waits for
+/// the exact execution point of a retrieved task, a task is never executed early. But a task may be executed up to one
+/// tick after another task of the same tick with a later execution point. See SortedTimerQueue for the interface.
+template <class Clock>
+class TimerWheelQueue final
+{
+  public:
+    using TimePoint = std::chrono::time_point<Clock>;
+    using TaskPointer = score::cpp::pmr::unique_ptr<TimedTask<Clock>>;
+
+    static constexpr std::chrono::milliseconds kDefaultTick{1};
+
+    explicit TimerWheelQueue(score::cpp::pmr::memory_resource* memory_resource,
+                             const typename Clock::duration tick = kDefaultTick)
+        : wheel_{memory_resource, tick, Clock::now()}
+    {
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return wheel_.empty();
+    }
+
+    void Insert(const TimePoint time_point, TaskPointer task)
+    {
+        score::cpp::ignore = wheel_.Insert(time_point, std::move(task));
+    }
+
+    std::pair<TimePoint, TaskPointer> Pop(const TimePoint now)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(not wheel_.empty());
+        auto expired = wheel_.PopExpired(now);
+        if (expired.has_value())
+        {
+            return std::move(expired).value();
+        }
+        return {wheel_.NextExpiry().value(), nullptr};
+    }
+
+  private:
+    TimerWheel<Clock, TaskPointer> wheel_;
+};
+
+}  // namespace score::concurrency
+
+#endif  // SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_QUEUE_H
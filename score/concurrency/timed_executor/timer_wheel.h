@@ -0,0 +1,421 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
+#define SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
+
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+#include <score/utility.hpp>
+#include <score/vector.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+
+namespace score::concurrency
+{
+
+/// @brief Hierarchical hashed timer wheel, that stores values together with their expiry time.
+///
+/// @details Time is divided into ticks of a configurable duration. The wheel has kLevels levels of kSlotsPerLevel
+/// slots each. A slot of level l spans kSlotsPerLevel^l ticks, thus the wheel covers kSlotsPerLevel^kLevels ticks
+/// ahead of its cursor (about 49 days for a tick of one millisecond). Entries further ahead are kept in an overflow
+/// list and sorted in once the cursor gets close enough.
+///
+/// An entry is stored in the slot of the highest tick digit in which its expiry differs from the cursor. Thus
+/// inserting and cancelling an entry is O(1): the entry is linked into or out of the list of one slot. When the cursor
+/// reaches a slot of a higher level, its entries cascade into the lower levels. Advancing the cursor skips ticks
+/// without entries by means of an occupancy bitmap per level, thus idle periods do not cost per tick.
+///
+/// Entries expire at tick granularity: once the cursor reaches the tick of the expiry, the entry is moved to the list
+/// of expired entries, from where PopExpired() returns them in the order they expired. Thus an expired entry may be
+/// up to one tick early. It is up to the user to wait for the exact expiry, if necessary.
+///
+/// The entries are kept in a node pool that grows on demand and is reused afterwards, thus in steady state no
+/// allocation happens. The wheel is not thread-safe.
+///
+/// @tparam Clock Any clock following the named requirements of `TrivialClock`, with time points not before its epoch
+/// @tparam T The type of the stored values, must be default constructible and movable
+template <typename Clock, typename T>
+class TimerWheel final
+{
+  public:
+    using TimePoint = std::chrono::time_point<Clock>;
+    using Duration = typename Clock::duration;
+
+    static constexpr std::size_t kLevels{4U};
+    static constexpr std::size_t kSlotsPerLevel{256U};
+
+    /// @brief Identifies an inserted entry to cancel it. Stays safe to use after the entry expired or was cancelled.
+    class Handle final
+    {
+      public:
+        Handle() noexcept = default;
+
+      private:
+        friend class TimerWheel;
+        Handle(const std::uint32_t index, const std::uint32_t generation) noexcept
+            : index_{index}, generation_{generation}
+        {
+        }
+
+        std::uint32_t index_{kNone};
+        std::uint32_t generation_{0U};
+    };
+
+    /// @param start The time point the cursor starts at, usually the current time. Entries before it expire
+    /// immediately.
+    TimerWheel(score::cpp::pmr::memory_resource* memory_resource, const Duration tick, const TimePoint start)
+        : tick_{tick}, cursor_{0U}, nodes_{memory_resource}, occupied_{}, size_{0U}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(tick > Duration::zero(), "The tick must be positive");
+        cursor_ = ToTick(start);
+    }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel(TimerWheel&&) noexcept = default;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+    TimerWheel& operator=(TimerWheel&&) noexcept = default;
+    ~TimerWheel() noexcept = default;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size_ == 0U;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /// @brief Inserts value to expire at time_point. A time point before the cursor expires immediately.
+    Handle Insert(const TimePoint time_point, T value)
+    {
+        const auto tick = ToTick(time_point);
+        const auto index = AllocateNode();
+        auto& node = nodes_[index];
+        node.time_point = time_point;
+        node.tick = tick;
+        node.value = std::move(value);
+        Place(index);
+        size_++;
+        return Handle{index, node.generation};
+    }
+
+    /// @brief Removes the entry of handle, if it is still contained.
+    /// @return true if the entry was removed, false if it already expired and was popped or was cancelled before
+    bool Cancel(const Handle handle) noexcept
+    {
+        if ((handle.index_ >= nodes_.size()) || (nodes_[handle.index_].generation != handle.generation_) ||
+            (nodes_[handle.index_].list == kNone))
+        {
+            return false;
+        }
+        Unlink(handle.index_);
+        ReleaseNode(handle.index_);
+        size_--;
+        return true;
+    }
+
+    /// @brief Advances the cursor to now and removes the entry that expired first.
+    /// @return The expiry and the value of the entry, no value if no entry expired until now
+    std::optional<std::pair<TimePoint, T>> PopExpired(const TimePoint now)
+    {
+        Advance(now);
+        const auto index = lists_[kExpiredList].head;
+        if (index == kNone)
+        {
+            return std::nullopt;
+        }
+        Unlink(index);
+        auto& node = nodes_[index];
+        std::pair<TimePoint, T> expired{node.time_point, std::move(node.value)};
+        ReleaseNode(index);
+        size_--;
+        return expired;
+    }
+
+    /// @brief Returns a time point until which no entry expires, that is not already expired.
+    /// @details The time point is the start of the tick of the earliest entry, if it is in the lowest level. Otherwise
+    /// it is the time at which the next slot of a higher level cascades.
+    /// @return no value if the wheel is empty
+    [[nodiscard]] std::optional<TimePoint> NextExpiry() const noexcept
+    {
+        if (empty())
+        {
+            return std::nullopt;
+        }
+        if (lists_[kExpiredList].head != kNone)
+        {
+            return ToTimePoint(cursor_);
+        }
+        return ToTimePoint(NextEvent());
+    }
+
+  private:
+    static constexpr std::uint32_t kNone{std::numeric_limits<std::uint32_t>::max()};
+    static constexpr std::uint32_t kDigitBits{8U};
+    static constexpr std::uint64_t kDigitMask{kSlotsPerLevel - 1U};
+    static constexpr std::size_t kBitsPerWord{64U};
+    static constexpr std::size_t kWordsPerLevel{kSlotsPerLevel / kBitsPerWord};
+    static constexpr std::uint32_t kExpiredList{static_cast<std::uint32_t>(kLevels * kSlotsPerLevel)};
+    static constexpr std::uint32_t kOverflowList{kExpiredList + 1U};
+    static constexpr std::size_t kNumberOfLists{static_cast<std::size_t>(kOverflowList) + 1U};
+
+    static_assert(kSlotsPerLevel == (std::uint64_t{1U} << kDigitBits), "A slot index is one digit of the tick");
+    static_assert((kLevels * kDigitBits) < 64U, "The overflow boundary must be representable");
+
+    struct Node
+    {
+        TimePoint time_point{};
+        std::uint64_t tick{0U};
+        T value{};
+        std::uint32_t previous{kNone};
+        std::uint32_t next{kNone};
+        /// The list the node is linked into, kNone if the node is free.
+        std::uint32_t list{kNone};
+        std::uint32_t generation{0U};
+    };
+
+    struct List
+    {
+        std::uint32_t head{kNone};
+        std::uint32_t tail{kNone};
+    };
+
+    static std::uint64_t Digit(const std::uint64_t tick, const std::size_t level) noexcept
+    {
+        return (tick >> (kDigitBits * level)) & kDigitMask;
+    }
+
+    std::uint64_t ToTick(const TimePoint time_point) const noexcept
+    {
+        const auto since_epoch = time_point.time_since_epoch();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(since_epoch >= Duration::zero(),
+                                                          "Time points before the epoch are not supported");
+        return static_cast<std::uint64_t>(since_epoch / tick_);
+    }
+
+    TimePoint ToTimePoint(const std::uint64_t tick) const noexcept
+    {
+        return TimePoint{tick_ * static_cast<typename Duration::rep>(tick)};
+    }
+
+    std::uint32_t AllocateNode()
+    {
+        if (free_ != kNone)
+        {
+            const auto index = free_;
+            free_ = nodes_[index].next;
+            return index;
+        }
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(nodes_.size() < kNone, "Too many entries");
+        score::cpp::ignore = nodes_.emplace_back();
+        return static_cast<std::uint32_t>(nodes_.size() - 1U);
+    }
+
+    void ReleaseNode(const std::uint32_t index) noexcept
+    {
+        auto& node = nodes_[index];
+        node.value = T{};
+        node.list = kNone;
+        node.generation++;
+        node.next = free_;
+        free_ = index;
+    }
+
+    /// @brief Links the node into the slot that matches its tick relative to the cursor.
+    void Place(const std::uint32_t index) noexcept
+    {
+        const auto tick = nodes_[index].tick;
+        if (tick <= cursor_)
+        {
+            Link(index, kExpiredList);
+            return;
+        }
+        //  The highest digit in which tick and cursor differ determines the level:
+        std::size_t level{kLevels};
+        for (std::size_t candidate{kLevels}; candidate > 0U; candidate--)
+        {
+            if (Digit(tick, candidate - 1U) != Digit(cursor_, candidate - 1U))
+            {
+                level = candidate - 1U;
+                break;
+            }
+        }
+        if ((tick >> (kDigitBits * kLevels)) != (cursor_ >> (kDigitBits * kLevels)))
+        {
+            Link(index, kOverflowList);
+            return;
+        }
+        const auto slot = Digit(tick, level);
+        Link(index, static_cast<std::uint32_t>((level * kSlotsPerLevel) + slot));
+        occupied_[level][slot / kBitsPerWord] |= (std::uint64_t{1U} << (slot % kBitsPerWord));
+    }
+
+    void Link(const std::uint32_t index, const std::uint32_t list_index) noexcept
+    {
+        auto& node = nodes_[index];
+        auto& list = lists_[list_index];
+        node.list = list_index;
+        node.next = kNone;
+        node.previous = list.tail;
+        if (list.tail == kNone)
+        {
+            list.head = index;
+        }
+        else
+        {
+            nodes_[list.tail].next = index;
+        }
+        list.tail = index;
+    }
+
+    void Unlink(const std::uint32_t index) noexcept
+    {
+        auto& node = nodes_[index];
+        auto& list = lists_[node.list];
+        if (node.previous == kNone)
+        {
+            list.head = node.next;
+        }
+        else
+        {
+            nodes_[node.previous].next = node.next;
+        }
+        if (node.next == kNone)
+        {
+            list.tail = node.previous;
+        }
+        else
+        {
+            nodes_[node.next].previous = node.previous;
+        }
+        if ((list.head == kNone) && (node.list < kExpiredList))
+        {
+            const auto level = node.list / kSlotsPerLevel;
+            const auto slot = node.list % kSlotsPerLevel;
+            occupied_[level][slot / kBitsPerWord] &= ~(std::uint64_t{1U} << (slot % kBitsPerWord));
+        }
+        node.list = kNone;
+    }
+
+    /// @brief Returns the first occupied slot of the level after the given one, if any.
+    std::optional<std::uint64_t> NextOccupiedSlot(const std::size_t level, const std::uint64_t after) const noexcept
+    {
+        for (auto slot = after + 1U; slot < kSlotsPerLevel;)
+        {
+            const auto word = occupied_[level][slot / kBitsPerWord] >> (slot % kBitsPerWord);
+            if (word != 0U)
+            {
+                return slot + static_cast<std::uint64_t>(__builtin_ctzll(word));
+            }
+            slot = ((slot / kBitsPerWord) + 1U) * kBitsPerWord;
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Returns the next tick at which an entry expires or a slot of a higher level cascades.
+    /// @pre The wheel holds entries that did not expire yet.
+    std::uint64_t NextEvent() const noexcept
+    {
+        //  Entries of lower levels always expire before the next slot of a higher level cascades:
+        for (std::size_t level{0U}; level < kLevels; level++)
+        {
+            const auto slot = NextOccupiedSlot(level, Digit(cursor_, level));
+            if (slot.has_value())
+            {
+                const auto level_shift = kDigitBits * level;
+                const auto upper_digits = (cursor_ >> (level_shift + kDigitBits)) << (level_shift + kDigitBits);
+                return upper_digits | (slot.value() << level_shift);
+            }
+        }
+        //  Only the overflow list holds entries, they are sorted in when the cursor leaves the range of the wheel:
+        const auto overflow_shift = kDigitBits * kLevels;
+        return ((cursor_ >> overflow_shift) + 1U) << overflow_shift;
+    }
+
+    void Advance(const TimePoint now) noexcept
+    {
+        const auto target = ToTick(now);
+        while ((cursor_ < target) && (size_ > 0U) && (lists_[kExpiredList].head == kNone))
+        {
+            const auto next_event = NextEvent();
+            if (next_event > target)
+            {
+                break;
+            }
+            cursor_ = next_event;
+            Cascade();
+        }
+        if (cursor_ < target)
+        {
+            //  Nothing happens until target, or there are expired entries already. Moving the cursor is only fine
+            //  without pending events in between:
+            if ((size_ == 0U) || (NextEvent() > target))
+            {
+                cursor_ = target;
+            }
+        }
+    }
+
+    /// @brief Moves the entries of the slots the cursor just reached down the levels, or to the expired list.
+    void Cascade() noexcept
+    {
+        //  The overflow list is sorted in when the cursor enters a new range of the wheel:
+        if ((cursor_ & ((std::uint64_t{1U} << (kDigitBits * kLevels)) - 1U)) == 0U)
+        {
+            Redistribute(kOverflowList);
+        }
+        for (std::size_t level{kLevels}; level > 0U; level--)
+        {
+            const auto slot = Digit(cursor_, level - 1U);
+            Redistribute(static_cast<std::uint32_t>(((level - 1U) * kSlotsPerLevel) + slot));
+        }
+    }
+
+    void Redistribute(const std::uint32_t list_index) noexcept
+    {
+        //  Detach the whole list first, since entries may be placed into the same list again (overflow):
+        auto index = lists_[list_index].head;
+        lists_[list_index] = List{};
+        if (list_index < kExpiredList)
+        {
+            const auto level = list_index / kSlotsPerLevel;
+            const auto slot = list_index % kSlotsPerLevel;
+            occupied_[level][slot / kBitsPerWord] &= ~(std::uint64_t{1U} << (slot % kBitsPerWord));
+        }
+        while (index != kNone)
+        {
+            const auto next = nodes_[index].next;
+            Place(index);
+            index = next;
+        }
+    }
+
+    Duration tick_;
+    std::uint64_t cursor_;
+    score::cpp::pmr::vector<Node> nodes_;
+    std::uint32_t free_{kNone};
+    std::array<List, kNumberOfLists> lists_{};
+    std::array<std::array<std::uint64_t, kWordsPerLevel>, kLevels> occupied_;
+    std::size_t size_;
+};
+
+}  // namespace score::concurrency
+
+#endif  // SCORE_LIB_CONCURRENCY_TIMED_EXECUTOR_TIMER_WHEEL_H
@@ -0,0 +1,285 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/timed_executor/timer_wheel.h"
+
+#include "score/concurrency/clock.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace score::concurrency
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+using Clock = testing::SteadyClock;
+using Wheel = TimerWheel<Clock, std::uint32_t>;
+
+class TimerWheelTest : public ::testing::Test
+{
+  protected:
+    static Clock::time_point At(const Clock::duration since_epoch)
+    {
+        return Clock::time_point{since_epoch};
+    }
+
+    std::vector<std::uint32_t> PopAll(const Clock::time_point now)
+    {
+        std::vector<std::uint32_t> values{};
+        for (auto expired = unit_.PopExpired(now); expired.has_value(); expired = unit_.PopExpired(now))
+        {
+            values.push_back(expired->second);
+        }
+        return values;
+    }
+
+    Wheel unit_{score::cpp::pmr::get_default_resource(), 1ms, At(0ms)};
+};
+
+TEST_F(TimerWheelTest, IsEmptyAfterConstruction)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "A new TimerWheel holds no entries and has no next expiry.");
+
+    // Given a new TimerWheel
+    // Then it is empty
+    EXPECT_TRUE(unit_.empty());
+    EXPECT_EQ(unit_.size(), 0U);
+    EXPECT_FALSE(unit_.NextExpiry().has_value());
+    EXPECT_FALSE(unit_.PopExpired(At(1h)).has_value());
+}
+
+TEST_F(TimerWheelTest, EntryExpiresNotBeforeItsTick)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "An entry is returned once the time reached the tick of its expiry.");
+
+    // Given a TimerWheel with an entry expiring at 10.5 ms
+    unit_.Insert(At(10500us), 42U);
+
+    // When popping before its tick
+    const auto too_early = unit_.PopExpired(At(9999us));
+
+    // Then nothing expired
+    EXPECT_FALSE(too_early.has_value());
+
+    // When popping within its tick
+    const auto expired = unit_.PopExpired(At(10ms));
+
+    // Then the entry is returned together with its exact expiry
+    ASSERT_TRUE(expired.has_value());
+    EXPECT_EQ(expired->first, At(10500us));
+    EXPECT_EQ(expired->second, 42U);
+    EXPECT_TRUE(unit_.empty());
+}
+
+TEST_F(TimerWheelTest, EntriesExpireInOrderOfTheirTicks)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "Entries on all levels expire in the order of their ticks.");
+
+    // Given a TimerWheel with entries on all levels, inserted in random order
+    std::vector<Clock::duration> expiries{
+        0ms, 1ms, 2ms, 255ms, 256ms, 257ms, 65535ms, 65536ms, 70000ms, 16777215ms, 16777216ms, 20000000ms};
+    std::vector<std::uint32_t> order(expiries.size());
+    for (std::uint32_t index{0U}; index < order.size(); index++)
+    {
+        order[index] = index;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937{42U});
+    for (const auto index : order)
+    {
+        unit_.Insert(At(expiries[index]), index);
+    }
+
+    // When popping step by step until all expired
+    std::vector<std::uint32_t> popped{};
+    for (std::size_t index{0U}; index < expiries.size(); index++)
+    {
+        const auto values = PopAll(At(expiries[index]));
+        popped.insert(popped.end(), values.begin(), values.end());
+        // Then each entry expires exactly at its tick
+        EXPECT_EQ(popped.size(), index + 1U);
+    }
+
+    // Then all entries expired in order
+    ASSERT_EQ(popped.size(), expiries.size());
+    for (std::uint32_t index{0U}; index < popped.size(); index++)
+    {
+        EXPECT_EQ(popped[index], index);
+    }
+    EXPECT_TRUE(unit_.empty());
+}
+
+TEST_F(TimerWheelTest, EntriesOfTheSameTickExpireInOrderOfInsertion)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "Entries within the same tick expire in the order they were inserted.");
+
+    // Given a TimerWheel with three entries within the same tick of a higher level
+    unit_.Insert(At(100000ms), 1U);
+    unit_.Insert(At(100000ms), 2U);
+    unit_.Insert(At(100000ms), 3U);
+
+    // When the time passed far beyond their expiry
+    const auto popped = PopAll(At(200000ms));
+
+    // Then they expired in the order of insertion
+    EXPECT_EQ(popped, (std::vector<std::uint32_t>{1U, 2U, 3U}));
+}
+
+TEST_F(TimerWheelTest, EntryBeyondTheRangeOfTheWheelExpires)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "Entries beyond the range of all levels are kept until they expire.");
+
+    // Given a TimerWheel with an entry beyond the range of all levels and one close to it
+    unit_.Insert(At(999h), 2U);
+    unit_.Insert(At(998h), 1U);
+
+    // When the time passed until shortly before the expiry
+    // Then nothing expired
+    EXPECT_TRUE(PopAll(At(998h - 1ms)).empty());
+
+    // When the time reaches the expiries
+    // Then they expire one after the other
+    EXPECT_EQ(PopAll(At(998h)), (std::vector<std::uint32_t>{1U}));
+    EXPECT_TRUE(PopAll(At(999h - 1ms)).empty());
+    EXPECT_EQ(PopAll(At(999h)), (std::vector<std::uint32_t>{2U}));
+}
+
+TEST_F(TimerWheelTest, CancelledEntryDoesNotExpire)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "A cancelled entry is removed and its handle gets invalid.");
+
+    // Given a TimerWheel with two entries
+    const auto first = unit_.Insert(At(70000ms), 1U);
+    const auto second = unit_.Insert(At(70000ms), 2U);
+
+    // When cancelling the first one
+    const auto cancelled = unit_.Cancel(first);
+
+    // Then it is removed
+    EXPECT_TRUE(cancelled);
+    EXPECT_EQ(unit_.size(), 1U);
+    EXPECT_EQ(PopAll(At(80000ms)), (std::vector<std::uint32_t>{2U}));
+
+    // Then cancelling removed entries fails, even after their nodes are reused
+    unit_.Insert(At(90000ms), 3U);
+    EXPECT_FALSE(unit_.Cancel(first));
+    EXPECT_FALSE(unit_.Cancel(second));
+    EXPECT_FALSE(unit_.Cancel(Wheel::Handle{}));
+    EXPECT_EQ(unit_.size(), 1U);
+}
+
+TEST_F(TimerWheelTest, EntryInThePastExpiresImmediately)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "An entry inserted with an expiry before the cursor expires with the next pop.");
+
+    // Given a TimerWheel whose cursor advanced to 5 s
+    ASSERT_TRUE(PopAll(At(5s)).empty());
+
+    // When inserting an entry that expired already
+    unit_.Insert(At(1s), 1U);
+
+    // Then it is returned with the next pop
+    const auto expired = unit_.PopExpired(At(5s));
+    ASSERT_TRUE(expired.has_value());
+    EXPECT_EQ(expired->first, At(1s));
+    EXPECT_EQ(unit_.NextExpiry(), std::nullopt);
+}
+
+TEST_F(TimerWheelTest, NextExpiryIsNotAfterTheEarliestEntry)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "Waiting until NextExpiry() and popping eventually returns the earliest entry.");
+
+    // Given a TimerWheel with an entry on a higher level
+    unit_.Insert(At(3h), 1U);
+
+    // When repeatedly waiting until the next expiry and popping
+    std::size_t wake_ups{0U};
+    std::optional<std::pair<Clock::time_point, std::uint32_t>> expired{};
+    while (not expired.has_value())
+    {
+        const auto next_expiry = unit_.NextExpiry();
+        ASSERT_TRUE(next_expiry.has_value());
+        ASSERT_LE(next_expiry.value(), At(3h));
+        expired = unit_.PopExpired(next_expiry.value());
+        wake_ups++;
+    }
+
+    // Then the entry expired after at most one wake up per level
+    EXPECT_EQ(expired->second, 1U);
+    EXPECT_LE(wake_ups, Wheel::kLevels);
+}
+
+TEST_F(TimerWheelTest, RandomEntriesExpireInOrder)
+{
+    RecordProperty("Verifies", "::score::concurrency::TimerWheel");
+    RecordProperty("Description", "Random entries expire sorted by their tick, none early and none late.");
+
+    // Given a TimerWheel with many random entries, some cancelled
+    std::mt19937 generator{7U};
+    std::uniform_int_distribution<std::int64_t> distribution{0, 100000000};
+    std::vector<Clock::time_point> expiries{};
+    std::vector<Wheel::Handle> handles{};
+    for (std::uint32_t index{0U}; index < 10000U; index++)
+    {
+        expiries.push_back(At(std::chrono::microseconds{distribution(generator)}));
+        handles.push_back(unit_.Insert(expiries.back(), index));
+    }
+    for (std::uint32_t index{0U}; index < handles.size(); index += 3U)
+    {
+        ASSERT_TRUE(unit_.Cancel(handles[index]));
+    }
+
+    // When advancing the time in random steps
+    std::size_t popped{0U};
+    auto now = At(0ms);
+    auto last_tick = 0ms;
+    while (not unit_.empty())
+    {
+        now += std::chrono::microseconds{distribution(generator) / 1000};
+        for (auto expired = unit_.PopExpired(now); expired.has_value(); expired = unit_.PopExpired(now))
+        {
+            // Then each entry expires not before its tick, sorted by tick and is no cancelled one
+            const auto tick = std::chrono::floor<std::chrono::milliseconds>(expired->first.time_since_epoch());
+            EXPECT_LT(expired->first, now + 1ms);
+            EXPECT_GE(tick, last_tick);
+            EXPECT_NE(expired->second % 3U, 0U);
+            last_tick = tick;
+            popped++;
+        }
+        // Then no entry remains that should have expired
+        const auto next_expiry = unit_.NextExpiry();
+        if (next_expiry.has_value())
+        {
+            EXPECT_GT(next_expiry.value(), now);
+        }
+    }
+    EXPECT_EQ(popped, 10000U - 3334U);
+}
+
+}  // namespace
+}  // namespace score::concurrency
@@ -0,0 +1,261 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
+#define SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
+
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+#include <score/optional.hpp>
+#include <score/utility.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace score
+{
+namespace concurrency
+{
+
+/**
+ * \brief Lock-free work-stealing deque after Chase and Lev.
+ *
+ * One thread, the owner, pushes and pops at the bottom (LIFO), any number of other threads steal from the top (FIFO).
+ * The owner never blocks, thieves only race with each other and with the owner for the last element.
+ *
+ * The implementation follows "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+ * A thief reads an element before it claims it, so the owner may concurrently overwrite that slot after the ring
+ * wrapped around. The claim fails in this case and the read value is discarded. To keep these reads free of data
+ * races, every slot stores the bytes of T in relaxed atomic words, which requires T to be trivially copyable.
+ *
+ * The ring grows by doubling when it is full. Rings are allocated from the given memory resource; replaced rings are
+ * kept until destruction, since thieves may still read from them.
+ *
+ * \tparam T Trivially copyable and default constructible element type, e.g. a pointer
+ */
+template <typename T>
+class WorkStealingDeque final
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Elements are copied bytewise between threads");
+    static_assert(std::is_default_constructible<T>::value, "Elements are read into a default constructed value");
+
+  public:
+    /**
+     * \param memory_resource The resource to acquire the rings from
+     * \param initial_capacity The number of elements that fit into the first ring, rounded up to a power of two
+     */
+    explicit WorkStealingDeque(score::cpp::pmr::memory_resource* const memory_resource,
+                               const std::size_t initial_capacity = 64U)
+        : memory_resource_{memory_resource}, top_{0}, bottom_{0}, ring_{nullptr}
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(memory_resource_ != nullptr);
+        std::size_t capacity{1U};
+        while (capacity < initial_capacity)
+        {
+            capacity *= 2U;
+        }
+        ring_.store(AllocateRing(capacity, nullptr), std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Releases all rings. Remaining elements are dropped without any further action.
+     */
+    ~WorkStealingDeque() noexcept
+    {
+        Ring* ring{ring_.load(std::memory_order_relaxed)};
+        while (ring != nullptr)
+        {
+            Ring* const retired{ring->retired};
+            DeallocateRing(ring);
+            ring = retired;
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /**
+     * \brief Pushes an element at the bottom. Must only be called by the owner.
+     */
+    void Push(const T& value)
+    {
+        const std::int64_t bottom{bottom_.load(std::memory_order_relaxed)};
+        const std::int64_t top{top_.load(std::memory_order_acquire)};
+        Ring* ring{ring_.load(std::memory_order_relaxed)};
+        if ((bottom - top) >= static_cast<std::int64_t>(ring->capacity))
+        {
+            ring = Grow(ring, top, bottom);
+        }
+        Store(*ring, bottom, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Pops the most recently pushed element. Must only be called by the owner.
+     * \return The element, or an empty optional if the deque is empty.
+     */
+    score::cpp::optional<T> Pop() noexcept
+    {
+        const std::int64_t bottom{bottom_.load(std::memory_order_relaxed) - 1};
+        Ring* const ring{ring_.load(std::memory_order_relaxed)};
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top{top_.load(std::memory_order_relaxed)};
+
+        if (top > bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return {};
+        }
+
+        const T value{Load(*ring, bottom)};
+        if (top == bottom)
+        {
+            // Last element, race with the thieves for it.
+            const bool won{
+                top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)};
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+            {
+                return {};
+            }
+        }
+        return value;
+    }
+
+    /**
+     * \brief Steals the least recently pushed element. May be called by any thread.
+     * \return The element, or an empty optional if the deque is empty or another thread took the element first.
+     */
+    score::cpp::optional<T> Steal() noexcept
+    {
+        std::int64_t top{top_.load(std::memory_order_acquire)};
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom{bottom_.load(std::memory_order_acquire)};
+        if (top >= bottom)
+        {
+            return {};
+        }
+
+        Ring* const ring{ring_.load(std::memory_order_acquire)};
+        const T value{Load(*ring, top)};
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return {};
+        }
+        return value;
+    }
+
+    /**
+     * \brief Returns whether the deque looked empty at the time of the call.
+     */
+    bool Empty() const noexcept
+    {
+        return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr std::size_t kWords{(sizeof(T) + sizeof(std::uintptr_t) - 1U) / sizeof(std::uintptr_t)};
+    using Word = std::atomic<std::uintptr_t>;
+    using Bytes = std::array<std::uintptr_t, kWords>;
+
+    struct Ring
+    {
+        std::size_t capacity;
+        Ring* retired;
+        Word* words;
+    };
+
+    Ring* AllocateRing(const std::size_t capacity, Ring* const retired)
+    {
+        void* const ring_memory{memory_resource_->allocate(sizeof(Ring), alignof(Ring))};
+        void* const words_memory{memory_resource_->allocate(capacity * kWords * sizeof(Word), alignof(Word))};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) memory is suitably sized and aligned for Word
+        Word* const words{reinterpret_cast<Word*>(words_memory)};
+        for (std::size_t index{0U}; index < (capacity * kWords); ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is within the allocation
+            score::cpp::ignore = new (&words[index]) Word{0U};
+        }
+        return new (ring_memory) Ring{capacity, retired, words};
+    }
+
+    void DeallocateRing(Ring* const ring) noexcept
+    {
+        // Word and Ring are trivially destructible
+        memory_resource_->deallocate(ring->words, ring->capacity * kWords * sizeof(Word), alignof(Word));
+        memory_resource_->deallocate(ring, sizeof(Ring), alignof(Ring));
+    }
+
+    Ring* Grow(Ring* const ring, const std::int64_t top, const std::int64_t bottom)
+    {
+        Ring* const grown{AllocateRing(ring->capacity * 2U, ring)};
+        for (std::int64_t index{top}; index < bottom; ++index)
+        {
+            Store(*grown, index, Load(*ring, index));
+        }
+        ring_.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    static Word* Slot(const Ring& ring, const std::int64_t index) noexcept
+    {
+        const std::size_t slot{static_cast<std::size_t>(index) & (ring.capacity - 1U)};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) slot is masked to the ring capacity
+        return &ring.words[slot * kWords];
+    }
+
+    static void Store(const Ring& ring, const std::int64_t index, const T& value) noexcept
+    {
+        Bytes bytes{};
+        score::cpp::ignore = std::memcpy(bytes.data(), &value, sizeof(T));
+        Word* const words{Slot(ring, index)};
+        for (std::size_t word{0U}; word < kWords; ++word)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) word is within the slot
+            words[word].store(bytes.at(word), std::memory_order_relaxed);
+        }
+    }
+
+    static T Load(const Ring& ring, const std::int64_t index) noexcept
+    {
+        Bytes bytes{};
+        const Word* const words{Slot(ring, index)};
+        for (std::size_t word{0U}; word < kWords; ++word)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) word is within the slot
+            bytes.at(word) = words[word].load(std::memory_order_relaxed);
+        }
+        T value{};
+        // The cast only silences -Wclass-memaccess, T is trivially copyable but may have a non-trivial constructor
+        score::cpp::ignore = std::memcpy(static_cast<void*>(&value), bytes.data(), sizeof(T));
+        return value;
+    }
+
+    score::cpp::pmr::memory_resource* memory_resource_;
+    alignas(64) std::atomic<std::int64_t> top_;
+    alignas(64) std::atomic<std::int64_t> bottom_;
+    std::atomic<Ring*> ring_;
+};
+
+}  // namespace concurrency
+}  // namespace score
+
+#endif  // SCORE_LIB_CONCURRENCY_WORK_STEALING_DEQUE_H
@@ -0,0 +1,165 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/concurrency/work_stealing_deque.h"
+
+#include "score/memory_resource.hpp"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace concurrency
+{
+namespace
+{
+
+struct Pair
+{
+    std::uint64_t first;
+    std::uint64_t second;
+    std::uint64_t third;
+};
+
+TEST(WorkStealingDeque, IsEmptyAfterConstruction)
+{
+    WorkStealingDeque<int> unit{score::cpp::pmr::get_default_resource()};
+
+    EXPECT_TRUE(unit.Empty());
+    EXPECT_FALSE(unit.Pop().has_value());
+    EXPECT_FALSE(unit.Steal().has_value());
+}
+
+TEST(WorkStealingDeque, PopReturnsElementsInReverseOrder)
+{
+    // Given a deque with three elements
+    WorkStealingDeque<int> unit{score::cpp::pmr::get_default_resource()};
+    unit.Push(1);
+    unit.Push(2);
+    unit.Push(3);
+
+    // When popping them, then the most recently pushed element comes first
+    EXPECT_EQ(unit.Pop().value(), 3);
+    EXPECT_EQ(unit.Pop().value(), 2);
+    EXPECT_EQ(unit.Pop().value(), 1);
+    EXPECT_FALSE(unit.Pop().has_value());
+    EXPECT_TRUE(unit.Empty());
+}
+
+TEST(WorkStealingDeque, StealReturnsElementsInOrder)
+{
+    // Given a deque with three elements
+    WorkStealingDeque<int> unit{score::cpp::pmr::get_default_resource()};
+    unit.Push(1);
+    unit.Push(2);
+    unit.Push(3);
+
+    // When stealing them, then the least recently pushed element comes first
+    EXPECT_EQ(unit.Steal().value(), 1);
+    EXPECT_EQ(unit.Steal().value(), 2);
+    EXPECT_EQ(unit.Steal().value(), 3);
+    EXPECT_FALSE(unit.Steal().has_value());
+}
+
+TEST(WorkStealingDeque, GrowsBeyondInitialCapacity)
+{
+    // Given a deque with a small capacity, from which some elements were already stolen
+    score::cpp::pmr::monotonic_buffer_resource resource{};
+    WorkStealingDeque<Pair> unit{&resource, 2U};
+    for (std::uint64_t i = 0U; i < 3U; ++i)
+    {
+        unit.Push(Pair{i, i + 1U, i + 2U});
+    }
+    EXPECT_EQ(unit.Steal().value().first, 0U);
+
+    // When pushing many more elements than fit into the ring
+    for (std::uint64_t i = 3U; i < 100U; ++i)
+    {
+        unit.Push(Pair{i, i + 1U, i + 2U});
+    }
+
+    // Then no element is lost and all are intact
+    for (std::uint64_t i = 99U; i > 0U; --i)
+    {
+        const auto element = unit.Pop();
+        ASSERT_TRUE(element.has_value());
+        EXPECT_EQ(element.value().first, i);
+        EXPECT_EQ(element.value().second, i + 1U);
+        EXPECT_EQ(element.value().third, i + 2U);
+    }
+    EXPECT_TRUE(unit.Empty());
+}
+
+TEST(WorkStealingDeque, EveryElementIsTakenExactlyOnceUnderContention)
+{
+    constexpr std::size_t kElements{100000U};
+    constexpr std::size_t kThieves{3U};
+
+    // Given a deque that the owner fills and pops while other threads steal from it
+    WorkStealingDeque<std::size_t> unit{score::cpp::pmr::get_default_resource(), 4U};
+    std::vector<std::atomic<std::uint32_t>> taken(kElements);
+    std::atomic_bool done{false};
+
+    std::vector<std::thread> thieves{};
+    for (std::size_t thief = 0U; thief < kThieves; ++thief)
+    {
+        thieves.emplace_back([&unit, &taken, &done]() {
+            while (!done.load())
+            {
+                const auto element = unit.Steal();
+                if (element.has_value())
+                {
+                    taken.at(element.value()).fetch_add(1U);
+                }
+            }
+        });
+    }
+
+    // When the owner pushes all elements and pops every third one
+    for (std::size_t i = 0U; i < kElements; ++i)
+    {
+        unit.Push(i);
+        if ((i % 3U) == 0U)
+        {
+            const auto element = unit.Pop();
+            if (element.has_value())
+            {
+                taken.at(element.value()).fetch_add(1U);
+            }
+        }
+    }
+    for (auto element = unit.Pop(); element.has_value(); element = unit.Pop())
+    {
+        taken.at(element.value()).fetch_add(1U);
+    }
+    done.store(true);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+
+    // Then every element was taken by exactly one thread
+    for (std::size_t i = 0U; i < kElements; ++i)
+    {
+        EXPECT_EQ(taken.at(i).load(), 1U) << "element " << i;
+    }
+}
+
+}  // namespace
+}  // namespace concurrency
+}  // namespace score
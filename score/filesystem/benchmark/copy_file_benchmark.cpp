@@ -0,0 +1,187 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for score::filesystem::IStandardFilesystem::CopyFile.
+///
+/// Three copy paths are measured on identical content:
+///   * StandardFilesystem      -> kernel side copy (reflink / copy_file_range / sendfile)
+///   * plain stream copy       -> the user space `*dst << src->rdbuf()` path that is used as fallback
+///   * StandardFilesystemFake  -> in-memory fake, used as reference for unit tests built on top of the fake
+///
+/// All benchmarks scale the file size via state.range(0) and report bytes/s.
+/// The files of the first two benchmarks are placed in TMPDIR (or /tmp), thus the result depends on whether that
+/// filesystem supports reflinks.
+
+#include "score/filesystem/details/standard_filesystem.h"
+#include "score/filesystem/filestream/file_factory.h"
+#include "score/filesystem/filestream/file_factory_fake.h"
+#include "score/filesystem/standard_filesystem_fake.h"
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <string>
+
+namespace score
+{
+namespace filesystem
+{
+namespace
+{
+
+constexpr std::int64_t kMinFileSize{4 * 1024};
+constexpr std::int64_t kMaxFileSize{256 * 1024 * 1024};
+
+std::string MakeContent(const std::size_t size)
+{
+    std::string content(size, '\0');
+    for (std::size_t i = 0U; i < size; ++i)
+    {
+        content[i] = static_cast<char>('a' + (i % 26U));
+    }
+    return content;
+}
+
+class TemporaryFiles
+{
+  public:
+    explicit TemporaryFiles(const std::size_t size)
+    {
+        const auto directory = StandardFilesystem{}.TempDirectoryPath().value();
+        const std::string prefix = "copy_file_benchmark_" + std::to_string(::getpid()) + "_" + std::to_string(size);
+        source_ = directory / (prefix + "_source");
+        destination_ = directory / (prefix + "_destination");
+
+        const std::string content = MakeContent(size);
+        std::ofstream stream{source_.CStr(), std::ios::binary | std::ios::trunc};
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    TemporaryFiles(const TemporaryFiles&) = delete;
+    TemporaryFiles& operator=(const TemporaryFiles&) = delete;
+    TemporaryFiles(TemporaryFiles&&) = delete;
+    TemporaryFiles& operator=(TemporaryFiles&&) = delete;
+
+    ~TemporaryFiles()
+    {
+        static_cast<void>(std::remove(source_.CStr()));
+        static_cast<void>(std::remove(destination_.CStr()));
+    }
+
+    const Path& Source() const noexcept
+    {
+        return source_;
+    }
+
+    const Path& Destination() const noexcept
+    {
+        return destination_;
+    }
+
+  private:
+    Path source_{};
+    Path destination_{};
+};
+
+void BM_StandardFilesystem_CopyFile(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const TemporaryFiles files{size};
+    const StandardFilesystem filesystem{};
+
+    for (auto _ : state)
+    {
+        auto result = filesystem.CopyFile(files.Source(), files.Destination(), CopyOptions::kOverwriteExisting);
+        benchmark::DoNotOptimize(result);
+        if (!result.has_value())
+        {
+            state.SkipWithError("CopyFile failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// The user space fallback that CopyFile used exclusively before the kernel side copy was introduced.
+void BM_StreamCopy(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const TemporaryFiles files{size};
+    FileFactory factory{};
+
+    for (auto _ : state)
+    {
+        auto source = factory.Open(files.Source(), std::ios::binary | std::ios::in);
+        auto destination = factory.Open(files.Destination(), std::ios::binary | std::ios::out);
+        if (!source.has_value() || !destination.has_value())
+        {
+            state.SkipWithError("Opening the files failed");
+            break;
+        }
+        *destination.value() << source.value()->rdbuf();
+        if (destination.value()->bad())
+        {
+            state.SkipWithError("Stream copy failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_StandardFilesystemFake_CopyFile(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    // StandardFilesystemFake is a gmock based fake, only warn about unexpected calls in case of errors.
+    GMOCK_FLAG_SET(verbose, "error");
+    StandardFilesystemFake filesystem{};
+    score::os::MockGuard<FileFactoryFake> file_factory{filesystem};
+
+    const Path source{"/tmp/source"};
+    const Path destination{"/tmp/destination"};
+    if (!filesystem.CreateDirectories("/tmp").has_value() ||
+        !filesystem.CreateRegularFile(source, Perms::kReadWriteExecUser).has_value())
+    {
+        state.SkipWithError("Preparing the fake filesystem failed");
+        return;
+    }
+    *IFileFactory::instance().Open(source, std::ios_base::in | std::ios_base::out).value() << MakeContent(size);
+
+    for (auto _ : state)
+    {
+        // The fake copies by streaming the source buffer, which consumes its read position.
+        file_factory->Get(source).seekg(0);
+        auto result = filesystem.CopyFile(source, destination, CopyOptions::kOverwriteExisting);
+        benchmark::DoNotOptimize(result);
+        if (!result.has_value())
+        {
+            state.SkipWithError("CopyFile failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_StandardFilesystem_CopyFile)->RangeMultiplier(16)->Range(kMinFileSize, kMaxFileSize);
+BENCHMARK(BM_StreamCopy)->RangeMultiplier(16)->Range(kMinFileSize, kMaxFileSize);
+BENCHMARK(BM_StandardFilesystemFake_CopyFile)->RangeMultiplier(16)->Range(kMinFileSize, 16 * 1024 * 1024);
+
+}  // namespace
+}  // namespace filesystem
+}  // namespace score
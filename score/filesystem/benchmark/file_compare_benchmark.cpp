@@ -0,0 +1,144 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for score::filesystem::IFileUtils::FileContentsAreIdentical.
+///
+/// Two identical files (the worst case, every byte has to be compared) are compared with:
+///   * default options         -> block-wise read of both streams
+///   * use_memory_mapping      -> block-wise memcmp() of both files mapped into memory
+///   * max_threads = 4         -> like above, but split across up to four threads for files of at least 64 MiB
+///
+/// All benchmarks scale the file size via state.range(0) and report bytes/s per compared file.
+/// The files are placed in TMPDIR (or /tmp) and are expected to stay in the page cache during the measurement.
+
+#include "score/filesystem/details/standard_filesystem.h"
+#include "score/filesystem/file_utils/file_utils.h"
+#include "score/filesystem/filestream/file_factory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <string>
+
+namespace score
+{
+namespace filesystem
+{
+namespace
+{
+
+constexpr std::int64_t kMinFileSize{4 * 1024};
+constexpr std::int64_t kMaxFileSize{256 * 1024 * 1024};
+
+class IdenticalTemporaryFiles
+{
+  public:
+    explicit IdenticalTemporaryFiles(const std::size_t size)
+    {
+        const auto directory = StandardFilesystem{}.TempDirectoryPath().value();
+        const std::string prefix = "file_compare_benchmark_" + std::to_string(::getpid()) + "_" + std::to_string(size);
+        first_ = directory / (prefix + "_first");
+        second_ = directory / (prefix + "_second");
+
+        std::string content(size, '\0');
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            content[i] = static_cast<char>('a' + (i % 26U));
+        }
+        for (const auto& path : {first_, second_})
+        {
+            std::ofstream stream{path.CStr(), std::ios::binary | std::ios::trunc};
+            stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+    }
+
+    IdenticalTemporaryFiles(const IdenticalTemporaryFiles&) = delete;
+    IdenticalTemporaryFiles& operator=(const IdenticalTemporaryFiles&) = delete;
+    IdenticalTemporaryFiles(IdenticalTemporaryFiles&&) = delete;
+    IdenticalTemporaryFiles& operator=(IdenticalTemporaryFiles&&) = delete;
+
+    ~IdenticalTemporaryFiles()
+    {
+        static_cast<void>(std::remove(first_.CStr()));
+        static_cast<void>(std::remove(second_.CStr()));
+    }
+
+    const Path& First() const noexcept
+    {
+        return first_;
+    }
+
+    const Path& Second() const noexcept
+    {
+        return second_;
+    }
+
+  private:
+    Path first_{};
+    Path second_{};
+};
+
+void CompareFiles(benchmark::State& state, const FileComparisonOptions& options)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const IdenticalTemporaryFiles files{size};
+    StandardFilesystem filesystem{};
+    FileFactory file_factory{};
+    const FileUtils file_utils{filesystem, file_factory};
+
+    for (auto _ : state)
+    {
+        auto result = file_utils.FileContentsAreIdentical(files.First(), files.Second(), options);
+        benchmark::DoNotOptimize(result);
+        if (!result.has_value() || !result.value())
+        {
+            state.SkipWithError("FileContentsAreIdentical failed");
+            break;
+        }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_FileContentsAreIdentical_Stream(benchmark::State& state)
+{
+    CompareFiles(state, FileComparisonOptions{});
+}
+
+void BM_FileContentsAreIdentical_MemoryMapped(benchmark::State& state)
+{
+    FileComparisonOptions options{};
+    options.use_memory_mapping = true;
+    CompareFiles(state, options);
+}
+
+void BM_FileContentsAreIdentical_MemoryMappedParallel(benchmark::State& state)
+{
+    FileComparisonOptions options{};
+    options.use_memory_mapping = true;
+    options.max_threads = 4U;
+    CompareFiles(state, options);
+}
+
+BENCHMARK(BM_FileContentsAreIdentical_Stream)->RangeMultiplier(16)->Range(kMinFileSize, kMaxFileSize);
+BENCHMARK(BM_FileContentsAreIdentical_MemoryMapped)->RangeMultiplier(16)->Range(kMinFileSize, kMaxFileSize);
+BENCHMARK(BM_FileContentsAreIdentical_MemoryMappedParallel)->RangeMultiplier(16)->Range(kMinFileSize, kMaxFileSize);
+
+}  // namespace
+}  // namespace filesystem
+}  // namespace score
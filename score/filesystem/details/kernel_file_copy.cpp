@@ -0,0 +1,169 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/filesystem/details/kernel_file_copy.h"
+
+#include "score/os/ioctl.h"
+
+#include <score/utility.hpp>
+
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/sendfile.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif  // __linux__
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace filesystem
+{
+namespace details
+{
+
+namespace
+{
+
+#if defined(__linux__)
+
+// Linux never transfers more than MAX_RW_COUNT bytes with a single read/write-like call.
+constexpr std::size_t kMaxTransferChunk{0x7FFFF000U};
+
+enum class TransferStatus : std::uint8_t
+{
+    kDone,
+    kUnsupported,
+    kFailed,
+};
+
+// Errors that only tell that the mechanism cannot be used for this pair of files. The file offsets are left
+// untouched in these cases, so the next mechanism can take over.
+bool IsUnsupportedError(const std::int32_t error_number) noexcept
+{
+    switch (error_number)
+    {
+        case ENOSYS:
+        case EXDEV:
+        case EINVAL:
+        case EOPNOTSUPP:
+        case EBADF:
+        case ETXTBSY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Repeats `transfer` until the end of the source file is reached.
+// A zero-sized first transfer is reported as unsupported: some pseudo filesystems report a size of zero and
+// only deliver content on read(), which is left to the user space copy. For truly empty files this costs nothing.
+template <typename Transfer>
+TransferStatus TransferUntilEndOfFile(const Transfer& transfer) noexcept
+{
+    bool transferred_any{false};
+    while (true)
+    {
+        const ssize_t transferred = transfer();
+        if (transferred > 0)
+        {
+            transferred_any = true;
+            continue;
+        }
+        if (transferred == 0)
+        {
+            return transferred_any ? TransferStatus::kDone : TransferStatus::kUnsupported;
+        }
+        const std::int32_t error_number = errno;
+        if (error_number == EINTR)
+        {
+            continue;
+        }
+        return IsUnsupportedError(error_number) ? TransferStatus::kUnsupported : TransferStatus::kFailed;
+    }
+}
+
+bool TryReflink(const std::int32_t source_fd, const std::int32_t destination_fd) noexcept
+{
+#if defined(FICLONE)
+    // FICLONE takes the source file descriptor by value in the variadic argument of ioctl().
+    // NOLINTNEXTLINE(performance-no-int-to-ptr): required by the ioctl() calling convention, see above
+    void* const argument = reinterpret_cast<void*>(static_cast<std::intptr_t>(source_fd));
+    return os::Ioctl::instance().ioctl(destination_fd, static_cast<std::int32_t>(FICLONE), argument).has_value();
+#else
+    score::cpp::ignore = source_fd;
+    score::cpp::ignore = destination_fd;
+    return false;
+#endif  // FICLONE
+}
+
+TransferStatus CopyWithCopyFileRange(const std::int32_t source_fd, const std::int32_t destination_fd) noexcept
+{
+    return TransferUntilEndOfFile([source_fd, destination_fd]() noexcept {
+        // NOLINTNEXTLINE(score-banned-function): Kernel side copy of an already opened file descriptor pair.
+        return ::copy_file_range(source_fd, nullptr, destination_fd, nullptr, kMaxTransferChunk, 0U);
+    });
+}
+
+TransferStatus CopyWithSendfile(const std::int32_t source_fd, const std::int32_t destination_fd) noexcept
+{
+    return TransferUntilEndOfFile([source_fd, destination_fd]() noexcept {
+        // NOLINTNEXTLINE(score-banned-function): Kernel side copy of an already opened file descriptor pair.
+        return ::sendfile(destination_fd, source_fd, nullptr, kMaxTransferChunk);
+    });
+}
+
+#endif  // __linux__
+
+}  // namespace
+
+Result<KernelCopyMethod> KernelFileCopy(const std::int32_t source_fd, const std::int32_t destination_fd) noexcept
+{
+#if defined(__linux__)
+    if (TryReflink(source_fd, destination_fd))
+    {
+        return KernelCopyMethod::kReflink;
+    }
+
+    const auto copy_file_range_status = CopyWithCopyFileRange(source_fd, destination_fd);
+    if (copy_file_range_status == TransferStatus::kDone)
+    {
+        return KernelCopyMethod::kCopyFileRange;
+    }
+    if (copy_file_range_status == TransferStatus::kFailed)
+    {
+        return MakeUnexpected(ErrorCode::kCopyFailed, "copy_file_range() failed");
+    }
+
+    // Since both mechanisms use the file offsets, sendfile() continues wherever copy_file_range() stopped.
+    const auto sendfile_status = CopyWithSendfile(source_fd, destination_fd);
+    if (sendfile_status == TransferStatus::kDone)
+    {
+        return KernelCopyMethod::kSendfile;
+    }
+    if (sendfile_status == TransferStatus::kFailed)
+    {
+        return MakeUnexpected(ErrorCode::kCopyFailed, "sendfile() failed");
+    }
+#else
+    score::cpp::ignore = source_fd;
+    score::cpp::ignore = destination_fd;
+#endif  // __linux__
+    return KernelCopyMethod::kNone;
+}
+
+}  // namespace details
+}  // namespace filesystem
+}  // namespace score
@@ -0,0 +1,55 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_FILESYSTEM_DETAILS_KERNEL_FILE_COPY_H
+#define SCORE_LIB_FILESYSTEM_DETAILS_KERNEL_FILE_COPY_H
+
+#include "score/filesystem/error.h"
+
+#include <cstdint>
+
+namespace score
+{
+namespace filesystem
+{
+namespace details
+{
+
+/// @brief Mechanism that was used by KernelFileCopy() to transfer the file content.
+enum class KernelCopyMethod : std::uint8_t
+{
+    kNone,           ///< No kernel mechanism applicable, the caller has to copy the (remaining) content itself
+    kReflink,        ///< Extents were shared with the source (FICLONE), no data was copied at all
+    kCopyFileRange,  ///< Data was copied inside the kernel (or offloaded to the filesystem) via copy_file_range()
+    kSendfile,       ///< Data was copied inside the kernel via sendfile()
+};
+
+/// @brief Copies the content of one regular file into another without moving the data through user space.
+///
+/// @details The mechanisms are tried from the cheapest to the most generic one: a reflink clone, copy_file_range()
+/// and sendfile(). A mechanism that is not supported for the given pair of files (e.g. cross-filesystem clone, old
+/// kernel, unsupported filesystem) is skipped silently. Both file descriptors have to be freshly opened, i.e. their
+/// file offsets have to be at the beginning of the files. The transfer uses and advances the file offsets, so if
+/// kNone is returned the caller can continue with a user space copy from the current offsets.
+/// On operating systems without such mechanisms (e.g. QNX) kNone is returned right away.
+///
+/// @param source_fd File descriptor opened for reading.
+/// @param destination_fd File descriptor opened for writing and truncated.
+/// @return The mechanism that transferred the content, kNone if the caller has to copy the remaining content, or
+///         ErrorCode::kCopyFailed if a transfer failed with an I/O error.
+Result<KernelCopyMethod> KernelFileCopy(const std::int32_t source_fd, const std::int32_t destination_fd) noexcept;
+
+}  // namespace details
+}  // namespace filesystem
+}  // namespace score
+
+#endif  // SCORE_LIB_FILESYSTEM_DETAILS_KERNEL_FILE_COPY_H
@@ -0,0 +1,193 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/filesystem/details/kernel_file_copy.h"
+
+#include "score/filesystem/details/test_helper.h"
+#include "score/os/mocklib/ioctl_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace score
+{
+namespace filesystem
+{
+namespace details
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::Return;
+
+class KernelFileCopyFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        temp_folder_ = test::InitTempDirectoryFor("KernelFileCopyFixture");
+        source_path_ = temp_folder_ / "source";
+        destination_path_ = temp_folder_ / "destination";
+    }
+
+    void TearDown() override
+    {
+        CloseFileDescriptors();
+        ::unlink(source_path_.CStr());
+        ::unlink(destination_path_.CStr());
+        ::rmdir(temp_folder_.CStr());
+    }
+
+    void PrepareSource(const std::string& content)
+    {
+        std::ofstream file{source_path_.CStr(), std::ios::binary};
+        file << content;
+    }
+
+    void OpenFileDescriptors()
+    {
+        source_fd_ = ::open(source_path_.CStr(), O_RDONLY);
+        destination_fd_ = ::open(destination_path_.CStr(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+        ASSERT_GE(source_fd_, 0);
+        ASSERT_GE(destination_fd_, 0);
+    }
+
+    void CloseFileDescriptors()
+    {
+        if (source_fd_ >= 0)
+        {
+            ::close(source_fd_);
+            source_fd_ = -1;
+        }
+        if (destination_fd_ >= 0)
+        {
+            ::close(destination_fd_);
+            destination_fd_ = -1;
+        }
+    }
+
+    std::string ReadDestination()
+    {
+        std::ifstream file{destination_path_.CStr(), std::ios::binary};
+        std::stringstream content{};
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static std::string MakeContent(const std::size_t size)
+    {
+        std::string content(size, '\0');
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            content[i] = static_cast<char>('a' + (i % 26U));
+        }
+        return content;
+    }
+
+    Path temp_folder_{};
+    Path source_path_{};
+    Path destination_path_{};
+    std::int32_t source_fd_{-1};
+    std::int32_t destination_fd_{-1};
+};
+
+TEST_F(KernelFileCopyFixture, CopiesWholeContent)
+{
+    // Given a source file that is larger than a single page
+    const auto content = MakeContent(1024U * 1024U + 17U);
+    PrepareSource(content);
+    OpenFileDescriptors();
+
+    // When copying it inside the kernel
+    const auto result = KernelFileCopy(source_fd_, destination_fd_);
+    CloseFileDescriptors();
+
+    // Then the content is transferred by one of the kernel mechanisms
+    ASSERT_TRUE(result.has_value());
+#if defined(__linux__)
+    EXPECT_NE(result.value(), KernelCopyMethod::kNone);
+    EXPECT_EQ(ReadDestination(), content);
+#else
+    EXPECT_EQ(result.value(), KernelCopyMethod::kNone);
+#endif
+}
+
+TEST_F(KernelFileCopyFixture, FallsBackToCopyWhenReflinkIsNotSupported)
+{
+    // Given a source file
+    const auto content = MakeContent(4096U * 3U + 1U);
+    PrepareSource(content);
+    OpenFileDescriptors();
+
+    // Expecting that the filesystem does not support reflinks
+    os::MockGuard<os::IoctlMock> ioctl_mock{};
+    EXPECT_CALL(*ioctl_mock, ioctl(destination_fd_, _, _))
+        .WillRepeatedly(Return(score::cpp::make_unexpected(os::Error::createFromErrno(EOPNOTSUPP))));
+
+    // When copying it inside the kernel
+    const auto result = KernelFileCopy(source_fd_, destination_fd_);
+    CloseFileDescriptors();
+
+    // Then the content is copied instead of cloned
+    ASSERT_TRUE(result.has_value());
+    EXPECT_NE(result.value(), KernelCopyMethod::kReflink);
+#if defined(__linux__)
+    EXPECT_NE(result.value(), KernelCopyMethod::kNone);
+    EXPECT_EQ(ReadDestination(), content);
+#endif
+}
+
+TEST_F(KernelFileCopyFixture, EmptyFileIsLeftToUserSpaceCopy)
+{
+    // Given an empty source file on a filesystem without reflink support
+    PrepareSource("");
+    OpenFileDescriptors();
+    os::MockGuard<os::IoctlMock> ioctl_mock{};
+    EXPECT_CALL(*ioctl_mock, ioctl(_, _, _))
+        .WillRepeatedly(Return(score::cpp::make_unexpected(os::Error::createFromErrno(EOPNOTSUPP))));
+
+    // When copying it inside the kernel
+    const auto result = KernelFileCopy(source_fd_, destination_fd_);
+    CloseFileDescriptors();
+
+    // Then nothing was transferred and the caller is asked to copy in user space
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), KernelCopyMethod::kNone);
+    EXPECT_EQ(ReadDestination(), "");
+}
+
+TEST_F(KernelFileCopyFixture, InvalidFileDescriptorsAreLeftToUserSpaceCopy)
+{
+    // Given file descriptors that are not open
+    os::MockGuard<os::IoctlMock> ioctl_mock{};
+    EXPECT_CALL(*ioctl_mock, ioctl(_, _, _))
+        .WillRepeatedly(Return(score::cpp::make_unexpected(os::Error::createFromErrno(EBADF))));
+
+    // When copying inside the kernel
+    const auto result = KernelFileCopy(-1, -1);
+
+    // Then no mechanism is applicable
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), KernelCopyMethod::kNone);
+}
+
+}  // namespace
+}  // namespace details
+}  // namespace filesystem
+}  // namespace score
@@ -12,7 +12,9 @@
  ********************************************************************************/
 #include "score/filesystem/details/standard_filesystem.h"
 
+#include "score/filesystem/details/kernel_file_copy.h"
 #include "score/filesystem/error.h"
+#include "score/filesystem/filestream/file_buf.h"
 #include "score/filesystem/filestream/i_file_factory.h"
 #include "score/filesystem/iterator/directory_iterator.h"
 #include "score/filesystem/iterator/recursive_directory_iterator.h"
@@ -24,6 +26,7 @@
 
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <optional>
 #include <stack>
 
 #include <score/assert.hpp>
@@ -39,6 +42,49 @@ namespace filesystem
 namespace
 {
 
+// Returns the file descriptor behind a stream created by the FileFactory. Any other stream (e.g. the string streams
+// handed out by FileFactoryFake) has no file descriptor, thus the content can only be copied in user space.
+std::optional<std::int32_t> GetFileDescriptor(const std::iostream& stream) noexcept
+{
+    auto* const file_buf = dynamic_cast<details::StdioFileBuf*>(stream.rdbuf());
+    if (file_buf == nullptr)
+    {
+        return std::nullopt;
+    }
+    return file_buf->fd();
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
+// not be called implicitly". Since source_fd/destination_fd.has_value() is checked before calling value(),
+// std::bad_optional_access should never be thrown. This is false positive.
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+score::Result<void> CopyFileContent(std::iostream& source, std::iostream& destination) noexcept
+{
+    const auto source_fd = GetFileDescriptor(source);
+    const auto destination_fd = GetFileDescriptor(destination);
+    if (source_fd.has_value() && destination_fd.has_value())
+    {
+        const auto kernel_copy = details::KernelFileCopy(source_fd.value(), destination_fd.value());
+        if (!kernel_copy.has_value())
+        {
+            return MakeUnexpected(filesystem::ErrorCode::kCopyFailed);
+        }
+        if (kernel_copy.value() != details::KernelCopyMethod::kNone)
+        {
+            return {};
+        }
+        // No kernel mechanism applicable, copy the remaining content starting at the current file offsets.
+    }
+
+    destination << source.rdbuf();
+
+    if (destination.bad() || source.bad())
+    {
+        return MakeUnexpected(filesystem::ErrorCode::kCopyFailed);
+    }
+    return {};
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
 // not be called implicitly". Since path_.has_value() is checked before calling path_.value(),
 // std::bad_optional_access should never be thrown. This is false positive.
@@ -58,11 +104,10 @@ score::Result<void> CopyFileInternal(const Path& source, const Path& destination
         return MakeUnexpected(filesystem::ErrorCode::kCouldNotAccessFileDuringCopy, "Dest");
     }
 
-    *destination_file.value() << source_file.value()->rdbuf();
-
-    if (destination_file.value()->bad() || source_file.value()->bad())
+    const auto copy_result = CopyFileContent(*source_file.value(), *destination_file.value());
+    if (!copy_result.has_value())
     {
-        return MakeUnexpected(filesystem::ErrorCode::kCopyFailed);
+        return copy_result;
     }
 
     os::StatBuffer buffer{};
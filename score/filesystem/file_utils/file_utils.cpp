@@ -12,18 +12,28 @@
  ********************************************************************************/
 #include "score/filesystem/file_utils/file_utils.h"
 
+#include "score/filesystem/filestream/file_buf.h"
 #include "score/filesystem/filestream/i_file_factory.h"
 #include "score/filesystem/i_standard_filesystem.h"
 #include "score/os/fcntl.h"
 #include "score/os/grp.h"
+#include "score/os/mman.h"
 #include "score/os/stdlib.h"
 #include "score/os/unistd.h"
 
 #include <score/assert.hpp>
+#include <score/jthread.hpp>
+#include <score/utility.hpp>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
 #include <sstream>
+#include <vector>
 
 namespace score
 {
@@ -32,35 +42,228 @@ namespace filesystem
 
 namespace
 {
-// Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
-// not be called implicitly". Since path_.has_value() is checked before calling path_.value(),
-// std::bad_optional_access should never be thrown. This is false positive.
-// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+
+// Large enough to amortize the per-call overhead of memcmp() and of the reads (which bypass the stream buffer for
+// requests of that size), small enough to stay cache friendly.
+constexpr std::size_t kComparisonBlockSize{64U * 1024U};
+
+// Ranges of memory mapped files handed to one thread are never smaller than this.
+constexpr std::size_t kMinParallelChunkSize{4U * 1024U * 1024U};
+
+bool AreBlocksIdentical(const char* const block1, const char* const block2, const std::size_t size) noexcept
+{
+    // memcmp() of the C library is vectorized for the target (SSE/AVX on x86-64, NEON on aarch64).
+    return std::memcmp(block1, block2, size) == 0;
+}
+
+// Compares the streams block-wise. Used for every stream, if the files are neither memory mapped nor
+// known to differ by their metadata.
 bool IsFileContentIdentical(std::iostream& file1, std::iostream& file2) noexcept
 {
-    std::istreambuf_iterator<char> it1{file1.rdbuf()};
-    std::istreambuf_iterator<char> it2{file2.rdbuf()};
-    constexpr std::istreambuf_iterator<char> end{};
+    std::vector<char> buffer(2U * kComparisonBlockSize);
+    char* const block1 = buffer.data();
+    char* const block2 = &buffer.at(kComparisonBlockSize);
+    constexpr auto kBlockSize = static_cast<std::streamsize>(kComparisonBlockSize);
 
-    while (it1 != end)
+    while (true)
     {
-        if (it2 == end)
+        const std::streamsize read1 = file1.rdbuf()->sgetn(block1, kBlockSize);
+        const std::streamsize read2 = file2.rdbuf()->sgetn(block2, kBlockSize);
+        // sgetn() only returns less than requested at the end of the stream, so a size mismatch is a content mismatch
+        if (read1 != read2)
+        {
+            return false;
+        }
+        if (read1 <= 0)
         {
-            break;
+            return true;
         }
-        // LCOV_EXCL_BR_START both branches are covered by unit tests:
-        // true: FileUtilsTest_FileContentsAreIdentical.ContentAreNotEqual
-        // false: FileUtilsTest_FileContentsAreIdentical.FilesAreEqual
-        if (!(*it1 == *it2))
-        // LCOV_EXCL_BR_STOP
+        if (!AreBlocksIdentical(block1, block2, static_cast<std::size_t>(read1)))
         {
             return false;
         }
-        ++it1;
-        ++it2;
     }
-    return (it1 == end) && (it2 == end);
 }
+
+// Compares [begin, end) of both mappings block-wise, giving up as soon as any comparing thread found a mismatch.
+void CompareMappedRange(const char* const data1,
+                        const char* const data2,
+                        const std::size_t begin,
+                        const std::size_t end,
+                        std::atomic<bool>& mismatch) noexcept
+{
+    for (std::size_t offset = begin; offset < end; offset += kComparisonBlockSize)
+    {
+        if (mismatch.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const std::size_t size = std::min(kComparisonBlockSize, end - offset);
+        if (!AreBlocksIdentical(&data1[offset], &data2[offset], size))
+        {
+            mismatch.store(true, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
+// not be called implicitly". Thread creation failure is treated as fatal, like any other allocation failure.
+// coverity[autosar_cpp14_a15_5_3_violation]
+bool IsMappedContentIdentical(const char* const data1,
+                              const char* const data2,
+                              const std::size_t size,
+                              const FileComparisonOptions& options) noexcept
+{
+    std::atomic<bool> mismatch{false};
+
+    std::size_t thread_count{1U};
+    if ((options.max_threads > 1U) && (static_cast<std::uint64_t>(size) >= options.parallel_threshold))
+    {
+        thread_count = std::max(std::size_t{1U}, std::min(std::size_t{options.max_threads}, size / kMinParallelChunkSize));
+    }
+
+    // Chunk boundaries are aligned to the block size, so every thread touches whole pages only.
+    const std::size_t blocks = (size + kComparisonBlockSize - 1U) / kComparisonBlockSize;
+    const std::size_t chunk_size = ((blocks + thread_count - 1U) / thread_count) * kComparisonBlockSize;
+
+    std::vector<score::cpp::jthread> workers{};
+    workers.reserve(thread_count - 1U);
+    for (std::size_t begin = chunk_size; begin < size; begin += chunk_size)
+    {
+        const std::size_t end = std::min(size, begin + chunk_size);
+        workers.emplace_back([data1, data2, begin, end, &mismatch]() noexcept {
+            CompareMappedRange(data1, data2, begin, end, mismatch);
+        });
+    }
+    CompareMappedRange(data1, data2, 0U, std::min(size, chunk_size), mismatch);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    return !mismatch.load(std::memory_order_relaxed);
+}
+
+/// Read-only private mapping of a whole file, unmapped on destruction.
+class MappedFile
+{
+  public:
+    MappedFile(const std::int32_t file_descriptor, const std::size_t size) noexcept : data_{nullptr}, size_{size}
+    {
+        const auto result = os::Mman::instance().mmap(
+            nullptr, size_, os::Mman::Protection::kRead, os::Mman::Map::kPrivate, file_descriptor, 0);
+        if (result.has_value())
+        {
+            data_ = result.value();
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    ~MappedFile() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            score::cpp::ignore = os::Mman::instance().munmap(data_, size_);
+        }
+    }
+
+    bool IsValid() const noexcept
+    {
+        return data_ != nullptr;
+    }
+
+    const char* Data() const noexcept
+    {
+        return static_cast<const char*>(data_);
+    }
+
+  private:
+    void* data_;
+    std::size_t size_;
+};
+
+// Returns the file descriptor behind a stream created by the FileFactory. Any other stream (e.g. the string streams
+// handed out by FileFactoryFake) has no file descriptor, thus its content can only be read through the stream.
+std::optional<std::int32_t> GetFileDescriptor(const std::iostream& stream) noexcept
+{
+    auto* const file_buf = dynamic_cast<details::StdioFileBuf*>(stream.rdbuf());
+    if (file_buf == nullptr)
+    {
+        return std::nullopt;
+    }
+    return file_buf->fd();
+}
+
+// The size reported by fstat() is only the size of the content for regular files that occupy storage. Pipes and
+// character devices report no meaningful size, and the pseudo files of /proc and /sys are regular files that report
+// a size of 0 or of a page, but occupy no blocks. Such files can only be compared by reading them.
+bool HasContentSize(const os::StatBuffer& stat) noexcept
+{
+    // coverity[autosar_cpp14_m5_0_4_violation] caused by macros
+    // coverity[autosar_cpp14_m5_0_21_violation] caused by macros
+    // coverity[autosar_cpp14_m2_13_3_violation] caused by macros
+    return S_ISREG(stat.st_mode) && (stat.st_blocks > 0U);
+}
+
+// Decides by the metadata of both files, or by comparing the memory mapped files if requested.
+// Returns an empty optional if the content has to be compared by reading the streams.
+// Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall
+// not be called implicitly". Since the optionals are checked before calling value(),
+// std::bad_optional_access should never be thrown. This is false positive.
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+std::optional<bool> CompareByFileDescriptors(const std::iostream& file1,
+                                             const std::iostream& file2,
+                                             const FileComparisonOptions& options) noexcept
+{
+    const auto fd1 = GetFileDescriptor(file1);
+    const auto fd2 = GetFileDescriptor(file2);
+    if ((!fd1.has_value()) || (!fd2.has_value()))
+    {
+        return std::nullopt;
+    }
+
+    os::StatBuffer stat1{};
+    os::StatBuffer stat2{};
+    if ((!os::Stat::instance().fstat(fd1.value(), stat1).has_value()) ||
+        (!os::Stat::instance().fstat(fd2.value(), stat2).has_value()))
+    {
+        return std::nullopt;
+    }
+    if ((stat1.st_dev == stat2.st_dev) && (stat1.st_ino == stat2.st_ino))
+    {
+        return true;
+    }
+    if ((!HasContentSize(stat1)) || (!HasContentSize(stat2)))
+    {
+        return std::nullopt;
+    }
+    if (stat1.st_size != stat2.st_size)
+    {
+        return false;
+    }
+    if (stat1.st_size == 0)
+    {
+        return true;
+    }
+
+    const auto size = static_cast<std::uint64_t>(stat1.st_size);
+    if ((!options.use_memory_mapping) || (size > static_cast<std::uint64_t>(std::numeric_limits<std::size_t>::max())))
+    {
+        return std::nullopt;
+    }
+    const MappedFile mapping1{fd1.value(), static_cast<std::size_t>(size)};
+    const MappedFile mapping2{fd2.value(), static_cast<std::size_t>(size)};
+    if ((!mapping1.IsValid()) || (!mapping2.IsValid()))
+    {
+        return std::nullopt;
+    }
+    return IsMappedContentIdentical(mapping1.Data(), mapping2.Data(), static_cast<std::size_t>(size), options);
+}
+
 }  // namespace
 
 FileUtils::FileUtils(IStandardFilesystem& standard_filesystem, IFileFactory& file_factory) noexcept
@@ -341,9 +544,16 @@ Result<bool> FileUtils::FilesExist(const score::filesystem::Path& path1,
     return true;
 }
 
+Result<bool> FileUtils::FileContentsAreIdentical(const Path& path1, const Path& path2) const noexcept
+{
+    return FileContentsAreIdentical(path1, path2, FileComparisonOptions{});
+}
+
 // Refer on top for suppression justification
 // coverity[autosar_cpp14_a15_5_3_violation : FALSE]
-Result<bool> FileUtils::FileContentsAreIdentical(const Path& path1, const Path& path2) const noexcept
+Result<bool> FileUtils::FileContentsAreIdentical(const Path& path1,
+                                                 const Path& path2,
+                                                 const FileComparisonOptions& options) const noexcept
 {
     // check file existence
     const auto check_exist_result = FilesExist(path1, path2);
@@ -366,6 +576,11 @@ Result<bool> FileUtils::FileContentsAreIdentical(const Path& path1, const Path&
     }
 
     // compare
+    const auto metadata_or_mapped_result = CompareByFileDescriptors(**file1, **file2, options);
+    if (metadata_or_mapped_result.has_value())
+    {
+        return metadata_or_mapped_result.value();
+    }
     return IsFileContentIdentical(**file1, **file2);
 }
 
@@ -37,6 +37,9 @@ class FileUtils final : public IFileUtils
     Result<std::pair<std::unique_ptr<std::iostream>, Path>> OpenUniqueFile(const Path& path,
                                                                            std::ios_base::openmode mode) const override;
     Result<bool> FileContentsAreIdentical(const Path& path1, const Path& path2) const noexcept override;
+    Result<bool> FileContentsAreIdentical(const Path& path1,
+                                          const Path& path2,
+                                          const FileComparisonOptions& options) const noexcept override;
     Result<void> SyncDirectory(const Path& dirname) const noexcept override;
     Result<bool> ValidateGroup(const Path& path, const std::string& group_name) const noexcept override;
 
@@ -0,0 +1,202 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/filesystem/file_utils/file_utils.h"
+
+#include "score/filesystem/details/standard_filesystem.h"
+#include "score/filesystem/filestream/file_factory.h"
+#include "score/os/mocklib/mman_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace score
+{
+namespace filesystem
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::Return;
+
+// Compares real files, since the shortcuts (inode, size, memory mapping) only apply to streams backed by a file.
+class FileUtilsTest_FileContentsAreIdenticalOnDisk : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        temp_folder_ = filesystem_.TempDirectoryPath().value() /
+                       ("FileContentsAreIdenticalOnDisk_" + std::to_string(::getpid()));
+        ASSERT_TRUE(filesystem_.CreateDirectories(temp_folder_).has_value());
+        path1_ = temp_folder_ / "file1";
+        path2_ = temp_folder_ / "file2";
+    }
+
+    void TearDown() override
+    {
+        score::cpp::ignore = filesystem_.RemoveAll(temp_folder_);
+    }
+
+    static void WriteFile(const Path& path, const std::string& content)
+    {
+        std::ofstream file{path.CStr(), std::ios::binary | std::ios::trunc};
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    static std::string MakeContent(const std::size_t size)
+    {
+        std::string content(size, '\0');
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            content[i] = static_cast<char>('a' + (i % 26U));
+        }
+        return content;
+    }
+
+    static FileComparisonOptions Parallel()
+    {
+        FileComparisonOptions options{};
+        options.use_memory_mapping = true;
+        options.max_threads = 4U;
+        options.parallel_threshold = 0U;
+        return options;
+    }
+
+    static FileComparisonOptions Mapped()
+    {
+        FileComparisonOptions options{};
+        options.use_memory_mapping = true;
+        return options;
+    }
+
+    StandardFilesystem filesystem_{};
+    FileFactory file_factory_{};
+    FileUtils unit_{filesystem_, file_factory_};
+    Path temp_folder_{};
+    Path path1_{};
+    Path path2_{};
+};
+
+// Spans several comparison blocks and several parallel chunks, and does not end on a block boundary.
+constexpr std::size_t kLargeFileSize{17U * 1024U * 1024U + 13U};
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, IdenticalLargeFiles)
+{
+    const auto content = MakeContent(kLargeFileSize);
+    WriteFile(path1_, content);
+    WriteFile(path2_, content);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Parallel()), Result<bool>{true});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, LastByteDiffers)
+{
+    auto content = MakeContent(kLargeFileSize);
+    WriteFile(path1_, content);
+    content.back() = '#';
+    WriteFile(path2_, content);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_), Result<bool>{false});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{false});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Parallel()), Result<bool>{false});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, FirstByteDiffers)
+{
+    auto content = MakeContent(kLargeFileSize);
+    WriteFile(path1_, content);
+    content.front() = '#';
+    WriteFile(path2_, content);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_), Result<bool>{false});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Parallel()), Result<bool>{false});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, SizesDiffer)
+{
+    const auto content = MakeContent(4096U);
+    WriteFile(path1_, content);
+    WriteFile(path2_, content + "x");
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_), Result<bool>{false});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path2_, path1_, Mapped()), Result<bool>{false});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, EmptyFiles)
+{
+    WriteFile(path1_, "");
+    WriteFile(path2_, "");
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{true});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, SameFileIsNotMapped)
+{
+    WriteFile(path1_, MakeContent(kLargeFileSize));
+    ASSERT_TRUE(filesystem_.CreateHardLink(path1_, path2_).has_value());
+
+    // Expecting that neither the file nor its hard link is mapped, since both refer to the same inode
+    os::MockGuard<os::MmanMock> mman_mock{};
+    EXPECT_CALL(*mman_mock, mmap(_, _, _, _, _, _)).Times(0);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path1_, Mapped()), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{true});
+}
+
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, FallsBackToStreamsIfMappingFails)
+{
+    auto content = MakeContent(1024U * 1024U);
+    WriteFile(path1_, content);
+    content[content.size() / 2U] = '#';
+    WriteFile(path2_, content);
+
+    // Expecting that the files cannot be mapped
+    os::MockGuard<os::MmanMock> mman_mock{};
+    EXPECT_CALL(*mman_mock, mmap(_, _, _, _, _, _))
+        .WillRepeatedly(Return(score::cpp::make_unexpected(os::Error::createFromErrno(ENOMEM))));
+    EXPECT_CALL(*mman_mock, munmap(_, _)).Times(0);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{false});
+    WriteFile(path2_, MakeContent(1024U * 1024U));
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, path2_, Mapped()), Result<bool>{true});
+}
+
+#if defined(__linux__)
+// The pseudo files of /proc are regular files that report a size of 0, thus their size must not be trusted.
+TEST_F(FileUtilsTest_FileContentsAreIdenticalOnDisk, ProcFileIsComparedByContent)
+{
+    const Path proc_file{"/proc/self/cmdline"};
+    std::ifstream proc_stream{proc_file.CStr(), std::ios::binary};
+    const std::string content{std::istreambuf_iterator<char>{proc_stream}, std::istreambuf_iterator<char>{}};
+    ASSERT_FALSE(content.empty());
+    WriteFile(path1_, content);
+
+    EXPECT_EQ(unit_.FileContentsAreIdentical(proc_file, path1_), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(path1_, proc_file, Mapped()), Result<bool>{true});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(proc_file, Path{"/proc/self/comm"}), Result<bool>{false});
+    EXPECT_EQ(unit_.FileContentsAreIdentical(proc_file, Path{"/proc/self/comm"}, Mapped()), Result<bool>{false});
+}
+#endif
+
+}  // namespace
+}  // namespace filesystem
+}  // namespace score
@@ -39,8 +39,13 @@ FileUtilsFake::FileUtilsFake(IStandardFilesystem& standard_filesystem, IFileFact
     ON_CALL(*this, CreateDirectory(_, _)).WillByDefault(Invoke(&file_utils_, &FileUtils::CreateDirectory));
     ON_CALL(*this, CreateDirectories(_, _)).WillByDefault(Invoke(&file_utils_, &FileUtils::CreateDirectories));
     ON_CALL(*this, OpenUniqueFile(_, _)).WillByDefault(Return(ByMove(error)));
-    ON_CALL(*this, FileContentsAreIdentical(_, _))
-        .WillByDefault(Invoke(&file_utils_, &FileUtils::FileContentsAreIdentical));
+    ON_CALL(*this, FileContentsAreIdentical(_, _)).WillByDefault(Invoke([this](const Path& path1, const Path& path2) {
+        return file_utils_.FileContentsAreIdentical(path1, path2);
+    }));
+    ON_CALL(*this, FileContentsAreIdentical(_, _, _))
+        .WillByDefault(Invoke([this](const Path& path1, const Path& path2, const FileComparisonOptions& options) {
+            return file_utils_.FileContentsAreIdentical(path1, path2, options);
+        }));
     ON_CALL(*this, SyncDirectory(_)).WillByDefault(Return(error));
     ON_CALL(*this, ValidateGroup(_, _)).WillByDefault(Return(error));
 }
@@ -37,6 +37,10 @@ class FileUtilsMock : public IFileUtils
                 (const Path&, std::ios_base::openmode),
                 (const, noexcept, override));
     MOCK_METHOD(Result<bool>, FileContentsAreIdentical, (const Path&, const Path&), (const, noexcept, override));
+    MOCK_METHOD(Result<bool>,
+                FileContentsAreIdentical,
+                (const Path&, const Path&, const FileComparisonOptions&),
+                (const, noexcept, override));
     MOCK_METHOD(Result<void>, SyncDirectory, (const Path&), (const, noexcept, override));
     MOCK_METHOD(Result<bool>, ValidateGroup, (const Path&, const std::string&), (const, noexcept, override));
 };
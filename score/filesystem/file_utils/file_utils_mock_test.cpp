@@ -30,6 +30,7 @@ TEST(FileUtilsMock, CheckReturnValues)
     EXPECT_EQ(Result<void>{}, unit.CreateDirectory({}, {}));
     EXPECT_EQ(Result<void>{}, unit.CreateDirectories({}, {}));
     EXPECT_EQ(Result<bool>{}, unit.FileContentsAreIdentical({}, {}));
+    EXPECT_EQ(Result<bool>{}, unit.FileContentsAreIdentical({}, {}, FileComparisonOptions{}));
     EXPECT_EQ(Result<void>{}, unit.SyncDirectory({}));
     EXPECT_EQ(Result<bool>{}, unit.ValidateGroup({}, {}));
 }
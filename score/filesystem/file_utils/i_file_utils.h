@@ -18,11 +18,29 @@
 #include "score/os/ObjectSeam.h"
 #include "score/os/stat.h"
 
+#include <cstdint>
+
 namespace score
 {
 namespace filesystem
 {
 
+/// @brief Tuning of IFileUtils::FileContentsAreIdentical() for large files.
+struct FileComparisonOptions
+{
+    /// \brief Compares the memory mapped files instead of reading them into intermediate buffers.
+    /// \note The files must not be truncated by anybody else during the comparison, since accessing the truncated
+    /// part of a mapping raises SIGBUS.
+    bool use_memory_mapping{false};
+
+    /// \brief Maximum number of threads that compare disjoint ranges of memory mapped files.
+    /// The value 1 keeps the comparison on the calling thread.
+    std::uint32_t max_threads{1U};
+
+    /// \brief Memory mapped files smaller than this (in bytes) are always compared on the calling thread.
+    std::uint64_t parallel_threshold{64U * 1024U * 1024U};
+};
+
 /// @brief Contains helper functions.
 class IFileUtils : public os::ObjectSeam<IFileUtils>
 {
@@ -66,6 +84,14 @@ class IFileUtils : public os::ObjectSeam<IFileUtils>
     /// \note Returns an error if the file does not exist or cannot be opened.
     virtual Result<bool> FileContentsAreIdentical(const Path& path1, const Path& path2) const noexcept = 0;
 
+    /// \brief Compares two files by content using the given comparison mode.
+    /// Files that share the same inode are identical, files of different size are not, without reading any content.
+    /// The content is compared in large blocks, optionally memory mapped and split across threads.
+    /// \note Returns an error if the file does not exist or cannot be opened.
+    virtual Result<bool> FileContentsAreIdentical(const Path& path1,
+                                                  const Path& path2,
+                                                  const FileComparisonOptions& options) const noexcept = 0;
+
     /// \brief Synchronizes directory entries (filenames, inodes, etc.).
     /// Can be used to ensure that a newly created file entry is fully synchronized with disk
     /// \note Does not synchronize file contents. Use other ways to synchronize file content.
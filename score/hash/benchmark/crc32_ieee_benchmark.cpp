@@ -0,0 +1,116 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for the CRC32 (IEEE 802.3) engines.
+///
+/// Every engine checksums buffers from 64 B to 64 MiB:
+///   * Bytewise    -> one table lookup per byte, the former implementation
+///   * SlicingBy8  -> eight table lookups per eight bytes
+///   * Hardware    -> PCLMULQDQ folding on x86-64, CRC32 instructions on aarch64 (skipped if not supported)
+///   * Calculator  -> Crc32IeeeHashCalculator::Update() with the engine selected at runtime
+///   * Combine     -> Crc32IeeeHashCalculator::Combine() for the same sizes of the second block
+
+#include "score/hash/code/crc/crc32_ieee.h"
+#include "score/hash/code/crc/crc32_ieee_engine.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+namespace
+{
+
+constexpr std::int64_t kMinimumSize{64};
+constexpr std::int64_t kMaximumSize{64 * 1024 * 1024};
+constexpr std::uint32_t kAllOnes{0xFFFFFFFFU};
+
+std::vector<std::uint8_t> RandomBuffer(const std::int64_t size)
+{
+    std::mt19937 generator{42U};
+    std::vector<std::uint8_t> buffer(static_cast<std::size_t>(size));
+    for (auto& value : buffer)
+    {
+        value = static_cast<std::uint8_t>(generator());
+    }
+    return buffer;
+}
+
+void RunEngine(benchmark::State& state, const internal::Crc32IeeeEngine engine)
+{
+    const auto buffer = RandomBuffer(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(engine(kAllOnes, buffer));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Bytewise(benchmark::State& state)
+{
+    RunEngine(state, &internal::UpdateCrc32IeeeBytewise);
+}
+
+void BM_SlicingBy8(benchmark::State& state)
+{
+    RunEngine(state, &internal::UpdateCrc32IeeeSlicingBy8);
+}
+
+void BM_Hardware(benchmark::State& state)
+{
+    if (!internal::IsCrc32IeeeHardwareSupported())
+    {
+        state.SkipWithError("No CRC32 hardware support on this CPU");
+        return;
+    }
+    RunEngine(state, &internal::UpdateCrc32IeeeHardware);
+}
+
+void BM_Calculator(benchmark::State& state)
+{
+    const auto buffer = RandomBuffer(state.range(0));
+    for (auto _ : state)
+    {
+        Crc32IeeeHashCalculator calculator{};
+        benchmark::DoNotOptimize(calculator.Update(buffer));
+        benchmark::DoNotOptimize(calculator.GetChecksum());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Combine(benchmark::State& state)
+{
+    const auto second_size = static_cast<std::uint64_t>(state.range(0));
+    std::uint_fast32_t checksum{0x414fa339U};
+    for (auto _ : state)
+    {
+        checksum = Crc32IeeeHashCalculator::Combine(checksum, 0xCBF43926U, second_size);
+        benchmark::DoNotOptimize(checksum);
+    }
+}
+
+BENCHMARK(BM_Bytewise)->RangeMultiplier(8)->Range(kMinimumSize, kMaximumSize);
+BENCHMARK(BM_SlicingBy8)->RangeMultiplier(8)->Range(kMinimumSize, kMaximumSize);
+BENCHMARK(BM_Hardware)->RangeMultiplier(8)->Range(kMinimumSize, kMaximumSize);
+BENCHMARK(BM_Calculator)->RangeMultiplier(8)->Range(kMinimumSize, kMaximumSize);
+BENCHMARK(BM_Combine)->RangeMultiplier(8)->Range(kMinimumSize, kMaximumSize);
+
+}  // namespace
+}  // namespace hash
+}  // namespace score
@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing the ways to hash a large file.
+///
+/// A 64 MiB file in the temporary directory is hashed with SHA-256 and CRC32:
+///   * Sequential        -> IHashCalculator::UpdateFromStream(), reading and hashing 4 KiB at a time on one thread
+///   * DoubleBuffered    -> DoubleBufferedReader, hashing one 64 KiB buffer on a worker while the next one is read
+///   * TreeFromStream    -> TreeHashCalculator over the file stream, 1 MiB chunks hashed on the thread pool
+///   * TreeFromMemory    -> TreeHashCalculator over the file contents already in memory, e.g. a memory mapped file
+///
+/// The thread pool has as many workers as the machine has cores. The tree results differ from the sequential
+/// digests, they are compared only in terms of throughput.
+
+#include "score/hash/code/core/factory/i_hash_calculator_factory.h"
+#include "score/hash/code/crc/crc32_ieee.h"
+#include "score/hash/code/parallel/double_buffered_reader.h"
+#include "score/hash/code/parallel/tree_hash_calculator.h"
+#include "score/hash/code/sha256digest/sha256digest.h"
+
+#include "score/concurrency/thread_pool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+namespace
+{
+
+constexpr std::size_t kFileSize{64U * 1024U * 1024U};
+
+class BenchmarkFactory final : public IHashCalculatorFactory
+{
+  public:
+    Result<std::unique_ptr<IHashCalculator>> CreateHashCalculator(const HashAlgorithm algorithm) const noexcept override
+    {
+        if (algorithm == HashAlgorithm::kCrc32)
+        {
+            return std::make_unique<Crc32IeeeHashCalculator>();
+        }
+        return std::make_unique<Sha256Digest>();
+    }
+};
+
+/// Random file that is shared by all benchmarks and removed at exit.
+class TestFile
+{
+  public:
+    TestFile() : path_{"/tmp/score_hash_large_input_benchmark.bin"}, contents_(kFileSize)
+    {
+        std::mt19937 generator{42U};
+        std::generate(contents_.begin(), contents_.end(), [&generator]() {
+            return static_cast<std::uint8_t>(generator());
+        });
+        std::ofstream file{path_, std::ios::binary};
+        file.write(reinterpret_cast<const char*>(contents_.data()), static_cast<std::streamsize>(contents_.size()));
+    }
+    ~TestFile()
+    {
+        static_cast<void>(std::remove(path_.c_str()));
+    }
+
+    const std::string& Path() const
+    {
+        return path_;
+    }
+    const std::vector<std::uint8_t>& Contents() const
+    {
+        return contents_;
+    }
+
+  private:
+    std::string path_;
+    std::vector<std::uint8_t> contents_;
+};
+
+const TestFile& GetTestFile()
+{
+    static const TestFile file{};
+    return file;
+}
+
+concurrency::ThreadPool& GetThreadPool()
+{
+    static concurrency::ThreadPool pool{std::max(1U, std::thread::hardware_concurrency()), "hash_benchmark"};
+    return pool;
+}
+
+const BenchmarkFactory kFactory{};
+
+void BM_Sequential(benchmark::State& state, const HashAlgorithm algorithm)
+{
+    const auto& file = GetTestFile();
+    for (auto _ : state)
+    {
+        std::ifstream input{file.Path(), std::ios::binary};
+        auto calculator = kFactory.CreateHashCalculator(algorithm).value();
+        benchmark::DoNotOptimize(calculator->UpdateFromStream(input));
+        benchmark::DoNotOptimize(calculator->Finalize());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileSize));
+}
+
+void BM_DoubleBuffered(benchmark::State& state, const HashAlgorithm algorithm)
+{
+    const auto& file = GetTestFile();
+    DoubleBufferedReader reader{GetThreadPool()};
+    for (auto _ : state)
+    {
+        std::ifstream input{file.Path(), std::ios::binary};
+        auto calculator = kFactory.CreateHashCalculator(algorithm).value();
+        benchmark::DoNotOptimize(reader.UpdateFromStream(*calculator, input));
+        benchmark::DoNotOptimize(calculator->Finalize());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileSize));
+}
+
+void BM_TreeFromStream(benchmark::State& state, const HashAlgorithm algorithm)
+{
+    const auto& file = GetTestFile();
+    const TreeHashCalculator calculator{kFactory, GetThreadPool()};
+    for (auto _ : state)
+    {
+        std::ifstream input{file.Path(), std::ios::binary};
+        benchmark::DoNotOptimize(calculator.CalculateHash(algorithm, input));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileSize));
+}
+
+void BM_TreeFromMemory(benchmark::State& state, const HashAlgorithm algorithm)
+{
+    const auto& file = GetTestFile();
+    const TreeHashCalculator calculator{kFactory, GetThreadPool()};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(calculator.CalculateHash(algorithm, file.Contents()));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(kFileSize));
+}
+
+BENCHMARK_CAPTURE(BM_Sequential, sha256, HashAlgorithm::kSha256)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Sequential, crc32, HashAlgorithm::kCrc32)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DoubleBuffered, sha256, HashAlgorithm::kSha256)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_DoubleBuffered, crc32, HashAlgorithm::kCrc32)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TreeFromStream, sha256, HashAlgorithm::kSha256)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TreeFromStream, crc32, HashAlgorithm::kCrc32)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TreeFromMemory, sha256, HashAlgorithm::kSha256)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TreeFromMemory, crc32, HashAlgorithm::kCrc32)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace hash
+}  // namespace score
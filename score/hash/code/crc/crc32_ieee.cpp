@@ -12,10 +12,9 @@
  ********************************************************************************/
 
 #include "score/hash/code/crc/crc32_ieee.h"
-#include "score/hash/code/crc/lookup_table.h"
+#include "score/hash/code/crc/crc32_ieee_engine.h"
 
 #include <cstdint>
-#include <numeric>
 
 namespace score
 {
@@ -26,17 +25,71 @@ namespace
 {
 
 constexpr std::uint_fast32_t kAllOnes{0xFFFFFFFFU};
+constexpr std::uint32_t kIeeeReversePolynomial{0xEDB88320U};
 
-constexpr internal::LookupTable<0xEDB88320U> kIeeeCrc32LookupTable{};
+/// x^0 in the reflected bit order used by the CRC, i.e. the most significant bit is the lowest power.
+constexpr std::uint32_t kOne{0x80000000U};
 
-template <typename InputIterator>
-constexpr std::uint_fast32_t CalculateIeeeCrc32(std::uint_fast32_t start, InputIterator first, InputIterator last)
+/// Multiplies two polynomials modulo the IEEE polynomial, both in reflected bit order.
+constexpr std::uint32_t MultiplyModPolynomial(const std::uint32_t lhs, std::uint32_t rhs) noexcept
 {
-    return static_cast<std::uint_fast32_t>(0xFFFFFFFFU) &
-           std::accumulate(
-               first, last, start & kAllOnes, [](auto checksum, const std::uint_fast8_t value) -> std::uint_fast32_t {
-                   return kIeeeCrc32LookupTable[(checksum ^ value) & 0xFFU] ^ (checksum >> 8U);
-               });
+    std::uint32_t product{0U};
+    for (std::uint32_t bit{kOne}; bit != 0U; bit >>= 1U)
+    {
+        if ((lhs & bit) != 0U)
+        {
+            product ^= rhs;
+        }
+        rhs = ((rhs & 1U) != 0U) ? ((rhs >> 1U) ^ kIeeeReversePolynomial) : (rhs >> 1U);
+    }
+    return product;
+}
+
+/// Table of x^(2^n) modulo the IEEE polynomial for n in [0, 32).
+class PowersOfTwoTable final
+{
+  public:
+    constexpr PowersOfTwoTable() : table_{}
+    {
+        // x^1
+        std::uint32_t power{kOne >> 1U};
+        for (std::size_t n = 0U; n < kTableSize; ++n)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) can't use .at() in constexpr fn
+            table_[n] = power;
+            power = MultiplyModPolynomial(power, power);
+        }
+    }
+
+    constexpr std::uint32_t operator[](const std::size_t n) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) can't use .at() in constexpr fn
+        return table_[n % kTableSize];
+    }
+
+  private:
+    // x^(2^n) mod P is periodic with a period dividing 32 for n >= 1, so 32 entries cover every exponent.
+    static constexpr std::size_t kTableSize{32U};
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays) Using C-style array for filling array constexpr function
+    std::uint32_t table_[kTableSize];
+};
+
+constexpr PowersOfTwoTable kPowersOfTwo{};
+
+/// Returns x^(8 * size) modulo the IEEE polynomial, which shifts a checksum over size zero bytes.
+std::uint32_t ShiftOperator(std::uint64_t size) noexcept
+{
+    std::uint32_t result{kOne};
+    // Start with x^(2^3) = x^8 since every byte shifts by eight bits.
+    for (std::size_t n = 3U; size != 0U; size >>= 1U, ++n)
+    {
+        if ((size & 1U) != 0U)
+        {
+            result = MultiplyModPolynomial(kPowersOfTwo[n], result);
+        }
+    }
+    return result;
 }
 
 }  // namespace
@@ -50,10 +103,20 @@ std::uint_fast32_t Crc32IeeeHashCalculator::GetChecksum() const noexcept
 
 Result<void> Crc32IeeeHashCalculator::Update(const score::cpp::span<const std::uint8_t> data) noexcept
 {
-    checksum_ = CalculateIeeeCrc32(checksum_, data.begin(), data.end());
+    static const internal::Crc32IeeeEngine engine{internal::SelectCrc32IeeeEngine()};
+    checksum_ = engine(static_cast<std::uint32_t>(checksum_ & kAllOnes), data);
     return {};
 }
 
+std::uint_fast32_t Crc32IeeeHashCalculator::Combine(const std::uint_fast32_t first,
+                                                    const std::uint_fast32_t second,
+                                                    const std::uint64_t second_size) noexcept
+{
+    // crc(A || B) = crc(A) * x^(8 * |B|) + crc(B), the pre- and post-conditioning with all ones cancels out.
+    return (MultiplyModPolynomial(ShiftOperator(second_size), static_cast<std::uint32_t>(first & kAllOnes)) ^ second) &
+           kAllOnes;
+}
+
 Hash Crc32IeeeHashCalculator::Finalize() noexcept
 {
     const auto checksum = ~checksum_;
@@ -32,6 +32,18 @@ class Crc32IeeeHashCalculator final : public ICrc32HashCalculator
     Hash Finalize() noexcept override;
     std::uint_fast32_t GetChecksum() const noexcept override;
 
+    /// @brief Returns the checksum of the concatenation of two data blocks from the checksums of the blocks.
+    ///
+    /// This allows to calculate the checksums of the chunks of a large buffer in parallel and to merge them
+    /// afterwards. The runtime is logarithmic in second_size.
+    /// @param first Checksum of the first block, as returned by GetChecksum().
+    /// @param second Checksum of the second block, as returned by GetChecksum().
+    /// @param second_size Size of the second block in bytes.
+    /// @return Checksum of the first block followed by the second block.
+    static std::uint_fast32_t Combine(std::uint_fast32_t first,
+                                      std::uint_fast32_t second,
+                                      std::uint64_t second_size) noexcept;
+
   private:
     std::uint_fast32_t checksum_;
 };
@@ -0,0 +1,270 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/crc/crc32_ieee_engine.h"
+#include "score/hash/code/crc/lookup_table.h"
+
+#include "score/os/cpuid.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace score
+{
+namespace hash
+{
+namespace internal
+{
+
+namespace
+{
+
+constexpr std::uint_fast32_t kIeeeReversePolynomial{0xEDB88320U};
+constexpr std::size_t kSlices{8U};
+
+constexpr SlicingLookupTable<kIeeeReversePolynomial, kSlices> kIeeeCrc32SlicingTable{};
+
+/// Assembles four bytes in little endian order, independent of the byte order of the CPU.
+inline std::uint32_t LoadLittleEndian32(const std::uint8_t* const data) noexcept
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) caller guarantees four readable bytes
+    return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8U) |
+           (static_cast<std::uint32_t>(data[2]) << 16U) | (static_cast<std::uint32_t>(data[3]) << 24U);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+#if defined(__x86_64__)
+
+constexpr std::uint32_t kCpuIdFeatureLeaf{1U};
+constexpr std::uint32_t kCpuIdEcxPclmulqdq{1U << 1U};
+constexpr std::uint32_t kCpuIdEcxSse41{1U << 19U};
+
+/// Minimum size for the folding path: it starts by loading four 128 bit blocks.
+constexpr std::size_t kFoldingMinimumSize{64U};
+constexpr std::size_t kFoldingBlockSize{16U};
+
+/// Multiplies both halves of the accumulator with the folding constants and adds the next block.
+__attribute__((target("pclmul"))) inline __m128i Fold128(const __m128i accumulator,
+                                                         const __m128i next,
+                                                         const __m128i constants) noexcept
+{
+    const __m128i low = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+    const __m128i high = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(high, next), low);
+}
+
+/// Folds 64 bytes at a time with carry-less multiplication and reduces the result with a Barrett reduction.
+///
+/// This is the algorithm described in "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+/// (Intel, 2009) with the folding constants for the reflected IEEE 802.3 polynomial.
+///
+/// @pre size is at least kFoldingMinimumSize and a multiple of kFoldingBlockSize
+__attribute__((target("pclmul,sse4.1"))) std::uint32_t FoldCrc32Ieee(std::uint32_t state,
+                                                                     const std::uint8_t* data,
+                                                                     std::size_t size) noexcept
+{
+    // x^(4*128+32) mod P, x^(4*128-32) mod P
+    const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596LL, 0x0154442BD4LL);
+    // x^(128+32) mod P, x^(128-32) mod P
+    const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009ELL, 0x01751997D0LL);
+    // x^64 mod P
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163CD6124LL);
+    // P' and mu for the Barrett reduction
+    const __m128i poly = _mm_set_epi64x(0x01F7011641LL, 0x01DB710641LL);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    // unaligned loads of 128 bit blocks within the bounds checked by the caller
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00U));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10U));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20U));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30U));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<std::int32_t>(state)));
+    data += kFoldingMinimumSize;
+    size -= kFoldingMinimumSize;
+
+    // Fold four independent 128 bit lanes by 512 bits.
+    while (size >= kFoldingMinimumSize)
+    {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00U)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10U)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20U)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30U)));
+        data += kFoldingMinimumSize;
+        size -= kFoldingMinimumSize;
+    }
+
+    // Fold the four lanes into one.
+    x1 = Fold128(x1, x2, k3k4);
+    x1 = Fold128(x1, x3, k3k4);
+    x1 = Fold128(x1, x4, k3k4);
+
+    // Fold the remaining 128 bit blocks one at a time.
+    while (size >= kFoldingBlockSize)
+    {
+        x1 = Fold128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), k3k4);
+        data += kFoldingBlockSize;
+        size -= kFoldingBlockSize;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // Fold 128 bits to 64 bits.
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#endif
+
+}  // namespace
+
+std::uint32_t UpdateCrc32IeeeBytewise(std::uint32_t state, const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    for (const std::uint8_t value : data)
+    {
+        state = kIeeeCrc32SlicingTable(0U, (state ^ value) & 0xFFU) ^ (state >> 8U);
+    }
+    return state;
+}
+
+std::uint32_t UpdateCrc32IeeeSlicingBy8(std::uint32_t state, const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    const std::uint8_t* current = data.data();
+    std::size_t size = data.size();
+
+    while (size >= kSlices)
+    {
+        const std::uint32_t low = state ^ LoadLittleEndian32(current);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) at least eight bytes are left
+        const std::uint32_t high = LoadLittleEndian32(current + 4U);
+        state = kIeeeCrc32SlicingTable(7U, low & 0xFFU) ^ kIeeeCrc32SlicingTable(6U, (low >> 8U) & 0xFFU) ^
+                kIeeeCrc32SlicingTable(5U, (low >> 16U) & 0xFFU) ^ kIeeeCrc32SlicingTable(4U, low >> 24U) ^
+                kIeeeCrc32SlicingTable(3U, high & 0xFFU) ^ kIeeeCrc32SlicingTable(2U, (high >> 8U) & 0xFFU) ^
+                kIeeeCrc32SlicingTable(1U, (high >> 16U) & 0xFFU) ^ kIeeeCrc32SlicingTable(0U, high >> 24U);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) at least eight bytes are left
+        current += kSlices;
+        size -= kSlices;
+    }
+
+    return UpdateCrc32IeeeBytewise(state, {current, size});
+}
+
+#if defined(__x86_64__)
+
+std::uint32_t UpdateCrc32IeeeHardware(std::uint32_t state, const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    std::size_t folded{0U};
+    if (data.size() >= kFoldingMinimumSize)
+    {
+        folded = data.size() - (data.size() % kFoldingBlockSize);
+        state = FoldCrc32Ieee(state, data.data(), folded);
+    }
+    return UpdateCrc32IeeeSlicingBy8(state, data.subspan(folded));
+}
+
+bool IsCrc32IeeeHardwareSupported() noexcept
+{
+    std::uint32_t eax{0U};
+    std::uint32_t ebx{0U};
+    std::uint32_t ecx{0U};
+    std::uint32_t edx{0U};
+    score::os::CpuId::instance().cpuid(0U, eax, ebx, ecx, edx);
+    if (eax < kCpuIdFeatureLeaf)
+    {
+        return false;
+    }
+    score::os::CpuId::instance().cpuid(kCpuIdFeatureLeaf, eax, ebx, ecx, edx);
+    const std::uint32_t required{kCpuIdEcxPclmulqdq | kCpuIdEcxSse41};
+    return (ecx & required) == required;
+}
+
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+
+std::uint32_t UpdateCrc32IeeeHardware(std::uint32_t state, const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    const std::uint8_t* current = data.data();
+    std::size_t size = data.size();
+
+    while (size >= sizeof(std::uint64_t))
+    {
+        std::uint64_t value{};
+        // aarch64 is little endian on all supported platforms, which is the byte order the instruction expects
+        static_cast<void>(std::memcpy(&value, current, sizeof(value)));
+        state = __crc32d(state, value);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) at least eight bytes are left
+        current += sizeof(value);
+        size -= sizeof(value);
+    }
+    for (; size > 0U; --size)
+    {
+        state = __crc32b(state, *current);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) at least one byte is left
+        ++current;
+    }
+    return state;
+}
+
+bool IsCrc32IeeeHardwareSupported() noexcept
+{
+    return true;
+}
+
+#else
+
+std::uint32_t UpdateCrc32IeeeHardware(const std::uint32_t state, const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    return UpdateCrc32IeeeSlicingBy8(state, data);
+}
+
+bool IsCrc32IeeeHardwareSupported() noexcept
+{
+    return false;
+}
+
+#endif
+
+Crc32IeeeEngine SelectCrc32IeeeEngine() noexcept
+{
+    return IsCrc32IeeeHardwareSupported() ? &UpdateCrc32IeeeHardware : &UpdateCrc32IeeeSlicingBy8;
+}
+
+}  // namespace internal
+}  // namespace hash
+}  // namespace score
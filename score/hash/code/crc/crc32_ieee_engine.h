@@ -0,0 +1,57 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_HASH_CODE_CRC_CRC32_IEEE_ENGINE_H
+#define SCORE_LIB_HASH_CODE_CRC_CRC32_IEEE_ENGINE_H
+
+#include <score/span.hpp>
+
+#include <cstdint>
+
+namespace score
+{
+namespace hash
+{
+namespace internal
+{
+
+/// @brief Function that advances the (not inverted) CRC32 state over the given data.
+///
+/// All engines compute the same result, they only differ in speed and in the CPU features they require.
+using Crc32IeeeEngine = std::uint32_t (*)(std::uint32_t state, score::cpp::span<const std::uint8_t> data) noexcept;
+
+/// @brief Reference implementation processing one byte per table lookup.
+std::uint32_t UpdateCrc32IeeeBytewise(std::uint32_t state, score::cpp::span<const std::uint8_t> data) noexcept;
+
+/// @brief Portable implementation processing eight bytes per step using eight lookup tables.
+std::uint32_t UpdateCrc32IeeeSlicingBy8(std::uint32_t state, score::cpp::span<const std::uint8_t> data) noexcept;
+
+/// @brief Implementation using carry-less multiplication (x86 PCLMULQDQ) or the CRC32 instructions (aarch64).
+///
+/// @pre IsCrc32IeeeHardwareSupported() returns true.
+std::uint32_t UpdateCrc32IeeeHardware(std::uint32_t state, score::cpp::span<const std::uint8_t> data) noexcept;
+
+/// @brief Returns whether UpdateCrc32IeeeHardware() can be used on this CPU.
+///
+/// On x86 this is determined at runtime via score::os::CpuId. On aarch64 the CRC32 instructions are optional before
+/// ARMv8.1, and score::os::CpuId cannot report them, therefore the decision is taken at compile time based on
+/// `__ARM_FEATURE_CRC32`.
+bool IsCrc32IeeeHardwareSupported() noexcept;
+
+/// @brief Returns the fastest engine that is supported on this CPU.
+Crc32IeeeEngine SelectCrc32IeeeEngine() noexcept;
+
+}  // namespace internal
+}  // namespace hash
+}  // namespace score
+
+#endif  // SCORE_LIB_HASH_CODE_CRC_CRC32_IEEE_ENGINE_H
@@ -0,0 +1,163 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/crc/crc32_ieee_engine.h"
+
+#include "score/os/mocklib/cpuidmock.h"
+
+#include <score/span.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+namespace internal
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::SetArgReferee;
+
+constexpr std::uint32_t kAllOnes{0xFFFFFFFFU};
+
+class Crc32IeeeEngineTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 generator{42U};
+        for (auto& value : buffer_)
+        {
+            value = static_cast<std::uint8_t>(generator());
+        }
+    }
+
+    void ExpectSameAsBytewise(const Crc32IeeeEngine engine) const
+    {
+        // Cover every remainder of the block sizes of all engines, at different alignments.
+        for (std::size_t offset = 0U; offset < 16U; ++offset)
+        {
+            for (std::size_t size = 0U; size < 300U; ++size)
+            {
+                const score::cpp::span<const std::uint8_t> input{&buffer_.at(offset), size};
+                ASSERT_EQ(engine(kAllOnes, input), UpdateCrc32IeeeBytewise(kAllOnes, input))
+                    << "offset " << offset << ", size " << size;
+            }
+        }
+    }
+
+    std::vector<std::uint8_t> buffer_ = std::vector<std::uint8_t>(4096U);
+};
+
+TEST_F(Crc32IeeeEngineTest, BytewiseMatchesKnownChecksum)
+{
+    // Given an input text with a known checksum
+    constexpr std::uint8_t kTest[]{"The quick brown fox jumps over the lazy dog"};
+
+    // When calculating the checksum byte by byte
+    const auto state = UpdateCrc32IeeeBytewise(kAllOnes, {kTest, sizeof(kTest) - 1});
+
+    // Then we get the expected value
+    EXPECT_EQ(~state, 0x414fa339U);
+}
+
+TEST_F(Crc32IeeeEngineTest, SlicingBy8MatchesBytewise)
+{
+    ExpectSameAsBytewise(&UpdateCrc32IeeeSlicingBy8);
+}
+
+TEST_F(Crc32IeeeEngineTest, HardwareMatchesBytewise)
+{
+    if (!IsCrc32IeeeHardwareSupported())
+    {
+        GTEST_SKIP() << "No CRC32 hardware support on this CPU";
+    }
+    ExpectSameAsBytewise(&UpdateCrc32IeeeHardware);
+
+    // And a large input that runs through the main folding loop many times
+    const score::cpp::span<const std::uint8_t> input{&buffer_.at(3U), buffer_.size() - 3U};
+    EXPECT_EQ(UpdateCrc32IeeeHardware(kAllOnes, input), UpdateCrc32IeeeBytewise(kAllOnes, input));
+}
+
+TEST_F(Crc32IeeeEngineTest, SelectedEngineMatchesBytewise)
+{
+    ExpectSameAsBytewise(SelectCrc32IeeeEngine());
+}
+
+#if defined(__x86_64__)
+
+class Crc32IeeeEngineSelectionTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        score::os::CpuId::set_testing_instance(cpuid_mock_);
+    }
+
+    void TearDown() override
+    {
+        score::os::CpuId::restore_instance();
+    }
+
+    void ExpectFeatures(const std::uint32_t max_leaf, const std::uint32_t ecx)
+    {
+        EXPECT_CALL(cpuid_mock_, cpuid(0U, _, _, _, _)).WillRepeatedly(SetArgReferee<1>(max_leaf));
+        EXPECT_CALL(cpuid_mock_, cpuid(1U, _, _, _, _)).WillRepeatedly(SetArgReferee<3>(ecx));
+    }
+
+    ::testing::NiceMock<score::os::CpuIdMock> cpuid_mock_{};
+};
+
+TEST_F(Crc32IeeeEngineSelectionTest, SelectsHardwareWithPclmulqdqAndSse41)
+{
+    // Given a CPU that supports PCLMULQDQ and SSE4.1
+    ExpectFeatures(1U, (1U << 1U) | (1U << 19U));
+
+    // Then the hardware engine is selected
+    EXPECT_TRUE(IsCrc32IeeeHardwareSupported());
+    EXPECT_EQ(SelectCrc32IeeeEngine(), &UpdateCrc32IeeeHardware);
+}
+
+TEST_F(Crc32IeeeEngineSelectionTest, FallsBackToSlicingWithoutPclmulqdq)
+{
+    // Given a CPU that only supports SSE4.1
+    ExpectFeatures(1U, 1U << 19U);
+
+    // Then the portable engine is selected
+    EXPECT_FALSE(IsCrc32IeeeHardwareSupported());
+    EXPECT_EQ(SelectCrc32IeeeEngine(), &UpdateCrc32IeeeSlicingBy8);
+}
+
+TEST_F(Crc32IeeeEngineSelectionTest, FallsBackToSlicingWithoutFeatureLeaf)
+{
+    // Given a CPU that does not report the feature leaf
+    ExpectFeatures(0U, (1U << 1U) | (1U << 19U));
+
+    // Then the portable engine is selected
+    EXPECT_FALSE(IsCrc32IeeeHardwareSupported());
+    EXPECT_EQ(SelectCrc32IeeeEngine(), &UpdateCrc32IeeeSlicingBy8);
+}
+
+#endif
+
+}  // namespace
+}  // namespace internal
+}  // namespace hash
+}  // namespace score
@@ -16,7 +16,9 @@
 #include <score/span.hpp>
 
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <random>
+#include <vector>
 
 namespace score
 {
@@ -74,6 +76,66 @@ TEST_F(Crc32IeeeTest, TwoUpdates)
     ASSERT_EQ(HashFromConstant(std::begin(kExpectedBytes), std::end(kExpectedBytes)), unit_.Finalize());
 }
 
+TEST_F(Crc32IeeeTest, LargeUnalignedInput)
+{
+    // Given a large random input that is not aligned and whose size is no multiple of any block size
+    std::mt19937 generator{42U};
+    std::vector<std::uint8_t> buffer(100003U);
+    for (auto& value : buffer)
+    {
+        value = static_cast<std::uint8_t>(generator());
+    }
+    const score::cpp::span<const std::uint8_t> input{&buffer[1], buffer.size() - 1U};
+
+    // When calculating the checksum at once and byte by byte
+    EXPECT_TRUE(unit_.Update(input));
+    Crc32IeeeHashCalculator bytewise{};
+    for (const auto value : input)
+    {
+        EXPECT_TRUE(bytewise.Update(score::cpp::span<const std::uint8_t>{&value, 1U}));
+    }
+
+    // Then both checksums are the same
+    ASSERT_EQ(unit_.GetChecksum(), bytewise.GetChecksum());
+}
+
+TEST_F(Crc32IeeeTest, Combine)
+{
+    // Given an input text split at every possible position
+    for (std::size_t pivot = 0U; pivot < sizeof(kTest); ++pivot)
+    {
+        const score::cpp::span<const std::uint8_t> input1{kTest, pivot};
+        const score::cpp::span<const std::uint8_t> input2{&kTest[pivot], sizeof(kTest) - pivot - 1};
+
+        // When calculating the checksums of both parts separately and combining them
+        Crc32IeeeHashCalculator first{};
+        Crc32IeeeHashCalculator second{};
+        EXPECT_TRUE(first.Update(input1));
+        EXPECT_TRUE(second.Update(input2));
+
+        // Then we get the checksum of the whole text
+        EXPECT_EQ(Crc32IeeeHashCalculator::Combine(first.GetChecksum(), second.GetChecksum(), input2.size()),
+                  kExpected);
+    }
+}
+
+TEST_F(Crc32IeeeTest, CombineLargeSecondBlock)
+{
+    // Given a first block and a second block of 64 MiB zeros
+    const std::vector<std::uint8_t> zeros(64U * 1024U * 1024U);
+    const score::cpp::span<const std::uint8_t> input1{kTest, sizeof(kTest) - 1};
+
+    // When combining the checksums of both blocks
+    Crc32IeeeHashCalculator second{};
+    EXPECT_TRUE(second.Update(zeros));
+    EXPECT_TRUE(unit_.Update(input1));
+    const auto combined = Crc32IeeeHashCalculator::Combine(unit_.GetChecksum(), second.GetChecksum(), zeros.size());
+
+    // Then we get the checksum of the concatenation
+    EXPECT_TRUE(unit_.Update(zeros));
+    ASSERT_EQ(combined, unit_.GetChecksum());
+}
+
 }  // namespace
 }  // namespace hash
 }  // namespace score
@@ -69,6 +69,49 @@ class LookupTable final
     std::uint_fast32_t table_[kTableSize];
 };
 
+/// @brief Compile-time CRC32 lookup tables for slicing-by-N, parameterised by a reflected polynomial.
+///
+/// Table 0 equals LookupTable. Table k holds the checksum contribution of a byte that is followed by k zero bytes,
+/// which allows to process N bytes per step by combining N independent lookups.
+/// The entries are stored as 32 bit values to keep the tables small enough for the L1 cache.
+template <std::uint_fast32_t ReversePolynomial, std::size_t Slices>
+class SlicingLookupTable final
+{
+  public:
+    constexpr SlicingLookupTable() : table_{}
+    {
+        const LookupTable<ReversePolynomial> base{};
+        for (std::size_t table_index = 0U; table_index < kTableSize; ++table_index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) can't use .at() in constexpr fn
+            table_[0U][table_index] = static_cast<std::uint32_t>(base[table_index]);
+        }
+        for (std::size_t slice = 1U; slice < Slices; ++slice)
+        {
+            for (std::size_t table_index = 0U; table_index < kTableSize; ++table_index)
+            {
+                // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index) can't use .at() in constexpr fn
+                const std::uint32_t previous = table_[slice - 1U][table_index];
+                table_[slice][table_index] = (previous >> 8U) ^ table_[0U][previous & 0xFFU];
+                // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+        }
+    }
+
+    /// @brief Returns entry i of table slice.
+    constexpr std::uint32_t operator()(std::size_t slice, std::size_t i) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) can't use .at() in constexpr fn
+        return table_[slice][i];
+    }
+
+  private:
+    static constexpr auto kTableSize = 256U;
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays) Using C-style array for filling array constexpr function
+    std::uint32_t table_[Slices][kTableSize];
+};
+
 }  // namespace internal
 }  // namespace hash
 }  // namespace score
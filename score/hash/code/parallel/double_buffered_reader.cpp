@@ -0,0 +1,148 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/parallel/double_buffered_reader.h"
+#include "score/hash/code/common/error.h"
+
+#include "score/concurrency/task_result.h"
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+#include <score/optional.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+
+namespace score
+{
+namespace hash
+{
+
+namespace
+{
+
+/// @brief Unlimited reading.
+constexpr std::int64_t kReadEndlessFromStream{-1};
+
+/// @brief Waits until a pending update finished and returns its result.
+Result<void> WaitForUpdate(concurrency::TaskResult<Result<void>>& pending) noexcept
+{
+    auto result = pending.Get();
+    if (result.has_value() == false)
+    {
+        mw::log::LogError() << "DoubleBufferedReader::Update was not executed " << __func__;
+        return MakeUnexpected(ErrorCode::kCouldNotUpdateDigestFromStream);
+    }
+    return result.value();
+}
+
+}  // namespace
+
+DoubleBufferedReader::DoubleBufferedReader(concurrency::Executor& executor, const std::size_t buffer_size) noexcept
+    : executor_{executor}, buffers_{}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(buffer_size > 0U);
+    for (auto& buffer : buffers_)
+    {
+        buffer.resize(buffer_size);
+    }
+}
+
+Result<void> DoubleBufferedReader::UpdateFromStream(IHashCalculator& calculator,
+                                                    std::istream& input,
+                                                    const std::int64_t max_read)
+{
+    if (input.good() == false)
+    {
+        mw::log::LogError() << "DoubleBufferedReader::Stream error state flag set " << __func__;
+        return MakeUnexpected(ErrorCode::kStreamError);
+    }
+
+    score::cpp::optional<concurrency::TaskResult<Result<void>>> pending{};
+    std::int64_t total_size{0};
+    std::size_t current{0U};
+
+    const auto has_read_enough = [&total_size, max_read]() noexcept {
+        return (max_read != kReadEndlessFromStream) && (total_size >= max_read);
+    };
+
+    while ((input.good() == true) && (has_read_enough() == false))
+    {
+        auto& buffer = buffers_.at(current);
+        auto number_bytes_to_read = static_cast<std::streamsize>(buffer.size());
+        if (max_read != kReadEndlessFromStream)
+        {
+            number_bytes_to_read = static_cast<std::streamsize>(
+                std::min(max_read - total_size, static_cast<std::int64_t>(buffer.size())));
+        }
+
+        // The previous buffer is still being hashed while this one is filled.
+        score::cpp::ignore = input.read(buffer.data(), number_bytes_to_read);
+        const auto block_size = input.gcount();
+        if (block_size == 0)
+        {
+            break;
+        }
+        total_size += block_size;
+
+        // Calls to Update() have to happen in order, thus wait for the previous one before starting the next one.
+        if (pending.has_value())
+        {
+            auto update_result = WaitForUpdate(pending.value());
+            pending.reset();
+            if (update_result.has_value() == false)
+            {
+                mw::log::LogError() << "DoubleBufferedReader::Input data might be invalid " << __func__;
+                return update_result;
+            }
+        }
+
+        // Suppress "UNUSED C++14 A5-2-4" rule finding: "Reinterpret_cast shall not be used":
+        // The stream is read into chars, while Update() requires a span of bytes of the same size.
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) See above
+        // coverity[autosar_cpp14_a5_2_4_violation] See above
+        const score::cpp::span<const std::uint8_t> data{reinterpret_cast<const std::uint8_t*>(buffer.data()),
+                                                        static_cast<std::size_t>(block_size)};
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        pending = executor_.Submit([&calculator, data](const score::cpp::stop_token&) {
+            return calculator.Update(data);
+        });
+        current = (current + 1U) % buffers_.size();
+    }
+
+    if (pending.has_value())
+    {
+        auto update_result = WaitForUpdate(pending.value());
+        if (update_result.has_value() == false)
+        {
+            mw::log::LogError() << "DoubleBufferedReader::Input data might be invalid " << __func__;
+            return update_result;
+        }
+    }
+
+    if (has_read_enough() == true)
+    {
+        return {};
+    }
+
+    if ((input.eof() == false) || (input.bad() == true))
+    {
+        mw::log::LogError() << "DoubleBufferedReader::" << __func__ << " unable to read to end, digest incomplete";
+        return MakeUnexpected(ErrorCode::kCouldNotUpdateDigestFromStream);
+    }
+
+    return {};
+}
+
+}  // namespace hash
+}  // namespace score
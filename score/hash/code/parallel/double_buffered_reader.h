@@ -0,0 +1,68 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_HASH_CODE_PARALLEL_DOUBLE_BUFFERED_READER_H
+#define SCORE_LIB_HASH_CODE_PARALLEL_DOUBLE_BUFFERED_READER_H
+
+#include "score/concurrency/executor.h"
+#include "score/hash/code/core/i_hash_calculator.h"
+#include "score/result/result.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+
+/// @brief Feeds a stream into a hash calculator while the next block is already being read.
+///
+/// Drop-in alternative to IHashCalculator::UpdateFromStream() for sequential digests: the calling thread reads into
+/// one buffer while the executor feeds the other buffer into the calculator, so I/O and hashing overlap. The digest
+/// is identical to the one of IHashCalculator::UpdateFromStream().
+///
+/// An instance owns its two buffers and must not be used by several threads at the same time.
+class DoubleBufferedReader final
+{
+  public:
+    /// @brief Default size of each of the two buffers.
+    static constexpr std::size_t kDefaultBufferSize{64U * 1024U};
+
+    /// @brief Creates a reader that updates the calculator on the given executor.
+    ///
+    /// @param[in] executor runs the updates of the calculator, has to outlive this instance
+    /// @param[in] buffer_size size of each of the two buffers in bytes, has to be greater than zero
+    explicit DoubleBufferedReader(concurrency::Executor& executor,
+                                  const std::size_t buffer_size = kDefaultBufferSize) noexcept;
+
+    /// @brief Update the hash calculation with the data of the input stream.
+    ///
+    /// @param[in] calculator the calculator to update, calls to Update() never overlap
+    /// @param[in] input istream whose data should be used for update
+    /// @param[in] max_read the number of bytes that shall be read from the stream, -1 to read until its end
+    ///
+    /// @return void upon successful update, error otherwise
+    Result<void> UpdateFromStream(IHashCalculator& calculator, std::istream& input, const std::int64_t max_read = -1);
+
+  private:
+    concurrency::Executor& executor_;
+    std::array<std::vector<char>, 2U> buffers_;
+};
+
+}  // namespace hash
+}  // namespace score
+
+#endif  // SCORE_LIB_HASH_CODE_PARALLEL_DOUBLE_BUFFERED_READER_H
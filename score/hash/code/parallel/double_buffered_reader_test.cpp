@@ -0,0 +1,133 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/parallel/double_buffered_reader.h"
+#include "score/hash/code/common/error.h"
+#include "score/hash/code/core/hash_calculator_mock.h"
+#include "score/hash/code/sha256digest/sha256digest.h"
+
+#include "score/concurrency/thread_pool.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace score
+{
+namespace hash
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::Return;
+
+constexpr std::size_t kBufferSize{64U};
+
+class DoubleBufferedReaderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 generator{42U};
+        for (auto& value : data_)
+        {
+            value = static_cast<char>(generator());
+        }
+    }
+
+    Hash Sequential(const std::size_t size, const std::int64_t max_read = -1)
+    {
+        std::istringstream stream{data_.substr(0U, size)};
+        Sha256Digest digest{};
+        EXPECT_TRUE(digest.UpdateFromStream(stream, max_read));
+        return digest.Finalize();
+    }
+
+    std::string data_ = std::string(10U * kBufferSize, '\0');
+    concurrency::ThreadPool executor_{1U};
+    DoubleBufferedReader unit_{executor_, kBufferSize};
+};
+
+TEST_F(DoubleBufferedReaderTest, MatchesSequentialDigest)
+{
+    // Given inputs that end before, at and after a buffer boundary
+    for (const std::size_t size : {0U, 1U, 63U, 64U, 65U, 128U, 640U})
+    {
+        std::istringstream stream{data_.substr(0U, size)};
+        Sha256Digest digest{};
+
+        // When updating the digest through the reader
+        const auto result = unit_.UpdateFromStream(digest, stream);
+
+        // Then the digest is the same as the one of IHashCalculator::UpdateFromStream()
+        ASSERT_TRUE(result.has_value()) << "size " << size;
+        EXPECT_EQ(digest.Finalize(), Sequential(size)) << "size " << size;
+    }
+}
+
+TEST_F(DoubleBufferedReaderTest, StopsAfterMaxRead)
+{
+    // Given limits before, at and after a buffer boundary
+    for (const std::int64_t max_read : {0, 1, 64, 100, 128})
+    {
+        std::istringstream stream{data_};
+        Sha256Digest digest{};
+
+        // When updating the digest with at most max_read bytes
+        const auto result = unit_.UpdateFromStream(digest, stream, max_read);
+
+        // Then only max_read bytes were hashed and the rest of the stream was not consumed
+        ASSERT_TRUE(result.has_value()) << "max_read " << max_read;
+        EXPECT_EQ(digest.Finalize(), Sequential(data_.size(), max_read)) << "max_read " << max_read;
+        EXPECT_EQ(stream.tellg(), max_read);
+    }
+}
+
+TEST_F(DoubleBufferedReaderTest, FailsOnBadStream)
+{
+    // Given a stream in error state
+    std::istringstream stream{data_};
+    stream.setstate(std::ios_base::badbit);
+    Sha256Digest digest{};
+
+    // When updating the digest
+    const auto result = unit_.UpdateFromStream(digest, stream);
+
+    // Then a stream error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ErrorCode::kStreamError);
+}
+
+TEST_F(DoubleBufferedReaderTest, ForwardsUpdateError)
+{
+    // Given a calculator that fails to update
+    std::istringstream stream{data_};
+    HashCalculatorMock calculator{};
+    EXPECT_CALL(calculator, Update(_)).WillOnce(Return(MakeUnexpected(ErrorCode::kCouldNotUpdateDigest)));
+
+    // When updating the digest
+    const auto result = unit_.UpdateFromStream(calculator, stream);
+
+    // Then the error of the calculator is returned and reading stops
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ErrorCode::kCouldNotUpdateDigest);
+}
+
+}  // namespace
+}  // namespace hash
+}  // namespace score
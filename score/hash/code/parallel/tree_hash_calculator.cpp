@@ -0,0 +1,241 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/parallel/tree_hash_calculator.h"
+#include "score/hash/code/common/error.h"
+
+#include "score/concurrency/task_result.h"
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+
+namespace
+{
+
+/// @brief Domain separation of leaves and inner nodes, so that no leaf can be mistaken for an inner node.
+constexpr std::uint8_t kLeafPrefix{0x00U};
+constexpr std::uint8_t kNodePrefix{0x01U};
+
+using LeafTask = concurrency::TaskResult<Result<Hash>>;
+
+/// @brief Hashes the prefix followed by all non empty parts.
+Result<Hash> HashWithPrefix(const IHashCalculatorFactory& factory,
+                            const HashAlgorithm algorithm,
+                            const std::uint8_t prefix,
+                            const std::initializer_list<score::cpp::span<const std::uint8_t>> parts) noexcept
+{
+    auto calculator = factory.CreateHashCalculator(algorithm);
+    if (calculator.has_value() == false)
+    {
+        return MakeUnexpected<Hash>(calculator.error());
+    }
+
+    auto update_result = calculator.value()->Update({&prefix, 1U});
+    for (const auto part : parts)
+    {
+        if ((update_result.has_value() == true) && (part.empty() == false))
+        {
+            update_result = calculator.value()->Update(part);
+        }
+    }
+    if (update_result.has_value() == false)
+    {
+        mw::log::LogError() << "TreeHashCalculator::Could not update digest";
+        return MakeUnexpected<Hash>(update_result.error());
+    }
+    return calculator.value()->Finalize();
+}
+
+LeafTask SubmitLeaf(concurrency::Executor& executor,
+                    const IHashCalculatorFactory& factory,
+                    const HashAlgorithm algorithm,
+                    const score::cpp::span<const std::uint8_t> chunk)
+{
+    return executor.Submit([&factory, algorithm, chunk](const score::cpp::stop_token&) {
+        return HashWithPrefix(factory, algorithm, kLeafPrefix, {chunk});
+    });
+}
+
+Result<Hash> WaitForLeaf(LeafTask& leaf) noexcept
+{
+    auto result = leaf.Get();
+    if (result.has_value() == false)
+    {
+        mw::log::LogError() << "TreeHashCalculator::Chunk was not hashed " << __func__;
+        return MakeUnexpected(ErrorCode::kCouldNotUpdateDigest);
+    }
+    return std::move(result).value();
+}
+
+/// @brief Combines the digests level by level until only the root is left.
+Result<Hash> CombineLevels(const IHashCalculatorFactory& factory,
+                           const HashAlgorithm algorithm,
+                           std::vector<Hash> level) noexcept
+{
+    // The caller always provides at least one leaf
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(level.empty() == false);
+    while (level.size() > 1U)
+    {
+        std::vector<Hash> next_level{};
+        next_level.reserve((level.size() + 1U) / 2U);
+        for (std::size_t index{0U}; index < level.size(); index += 2U)
+        {
+            if ((index + 1U) == level.size())
+            {
+                next_level.push_back(std::move(level.at(index)));
+                continue;
+            }
+            auto node = HashWithPrefix(
+                factory, algorithm, kNodePrefix, {level.at(index).GetBytes(), level.at(index + 1U).GetBytes()});
+            if (node.has_value() == false)
+            {
+                return node;
+            }
+            next_level.push_back(std::move(node).value());
+        }
+        level = std::move(next_level);
+    }
+    return std::move(level.front());
+}
+
+}  // namespace
+
+TreeHashCalculator::TreeHashCalculator(const IHashCalculatorFactory& factory,
+                                       concurrency::Executor& executor,
+                                       const std::size_t chunk_size) noexcept
+    : factory_{factory}, executor_{executor}, chunk_size_{chunk_size}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(chunk_size > 0U);
+}
+
+Result<Hash> TreeHashCalculator::CalculateHash(const HashAlgorithm algorithm,
+                                               const score::cpp::span<const std::uint8_t> data) const
+{
+    std::vector<LeafTask> pending{};
+    pending.reserve(std::max(std::size_t{1U}, (data.size() + chunk_size_ - 1U) / chunk_size_));
+    std::size_t offset{0U};
+    do
+    {
+        const auto size = std::min(chunk_size_, data.size() - offset);
+        pending.push_back(SubmitLeaf(executor_, factory_, algorithm, data.subspan(offset, size)));
+        offset += size;
+    } while (offset < data.size());
+
+    // Wait for all leaves, even after an error, since they reference the data.
+    std::vector<Hash> leaves{};
+    leaves.reserve(pending.size());
+    Result<void> result{};
+    for (auto& leaf : pending)
+    {
+        auto leaf_hash = WaitForLeaf(leaf);
+        if (leaf_hash.has_value() == false)
+        {
+            result = MakeUnexpected<void>(leaf_hash.error());
+        }
+        else if (result.has_value() == true)
+        {
+            leaves.push_back(std::move(leaf_hash).value());
+        }
+    }
+    if (result.has_value() == false)
+    {
+        return MakeUnexpected<Hash>(result.error());
+    }
+
+    return CombineLevels(factory_, algorithm, std::move(leaves));
+}
+
+Result<Hash> TreeHashCalculator::CalculateHash(const HashAlgorithm algorithm, std::istream& input) const
+{
+    if (input.good() == false)
+    {
+        mw::log::LogError() << "TreeHashCalculator::Stream error state flag set " << __func__;
+        return MakeUnexpected(ErrorCode::kStreamError);
+    }
+
+    // One buffer per worker plus the one that is currently read. A buffer is reused only after its leaf is done.
+    const std::size_t window{executor_.MaxConcurrencyLevel() + 1U};
+    std::vector<std::vector<std::uint8_t>> buffers(window);
+    std::deque<LeafTask> pending{};
+    std::vector<Hash> leaves{};
+    Result<void> result{};
+
+    const auto collect_oldest = [&pending, &leaves, &result]() noexcept {
+        auto leaf_hash = WaitForLeaf(pending.front());
+        pending.pop_front();
+        if (leaf_hash.has_value() == false)
+        {
+            result = MakeUnexpected<void>(leaf_hash.error());
+        }
+        else if (result.has_value() == true)
+        {
+            leaves.push_back(std::move(leaf_hash).value());
+        }
+    };
+
+    std::size_t chunk_index{0U};
+    while ((input.good() == true) && (result.has_value() == true))
+    {
+        if (pending.size() == window)
+        {
+            collect_oldest();
+        }
+
+        auto& buffer = buffers.at(chunk_index % window);
+        buffer.resize(chunk_size_);
+        // Suppress "UNUSED C++14 A5-2-4" rule finding: "Reinterpret_cast shall not be used":
+        // std::istream::read() requires chars, the chunk is hashed as bytes of the same size.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) See above
+        score::cpp::ignore = input.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(chunk_size_));
+        const auto block_size = static_cast<std::size_t>(input.gcount());
+        // An empty input still results in one leaf, a stream ending at a chunk boundary does not.
+        if ((block_size == 0U) && (chunk_index > 0U))
+        {
+            break;
+        }
+        buffer.resize(block_size);
+        pending.push_back(SubmitLeaf(executor_, factory_, algorithm, buffer));
+        ++chunk_index;
+    }
+
+    while (pending.empty() == false)
+    {
+        collect_oldest();
+    }
+    if (result.has_value() == false)
+    {
+        return MakeUnexpected<Hash>(result.error());
+    }
+
+    if ((input.eof() == false) || (input.bad() == true))
+    {
+        mw::log::LogError() << "TreeHashCalculator::" << __func__ << " unable to read to end, digest incomplete";
+        return MakeUnexpected(ErrorCode::kCouldNotUpdateDigestFromStream);
+    }
+
+    return CombineLevels(factory_, algorithm, std::move(leaves));
+}
+
+}  // namespace hash
+}  // namespace score
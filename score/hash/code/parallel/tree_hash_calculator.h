@@ -0,0 +1,82 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_HASH_CODE_PARALLEL_TREE_HASH_CALCULATOR_H
+#define SCORE_LIB_HASH_CODE_PARALLEL_TREE_HASH_CALCULATOR_H
+
+#include "score/concurrency/executor.h"
+#include "score/hash/code/core/factory/i_hash_calculator_factory.h"
+#include "score/hash/code/core/hash.h"
+#include "score/result/result.h"
+
+#include <score/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+
+namespace score
+{
+namespace hash
+{
+
+/// @brief Calculates a hash tree (Merkle tree) over large inputs, hashing fixed size chunks in parallel.
+///
+/// The input is split into chunks of chunk_size bytes, the last chunk may be shorter. Every chunk is hashed on the
+/// executor into a leaf digest H(0x00 || chunk). Afterwards, pairs of adjacent digests are combined into
+/// H(0x01 || left || right) level by level until only the root is left; an odd digest at the end of a level is moved
+/// up unchanged. An empty input is treated as a single empty chunk.
+///
+/// The root differs from the sequential digest of the same algorithm. Producer and consumer of a tree hash therefore
+/// have to agree on the algorithm and the chunk size.
+class TreeHashCalculator final
+{
+  public:
+    /// @brief Default size of a chunk, large enough to amortize scheduling a task per chunk.
+    static constexpr std::size_t kDefaultChunkSize{1024U * 1024U};
+
+    /// @brief Creates a calculator that hashes chunks on the given executor.
+    ///
+    /// @param[in] factory creates a hash calculator per chunk, has to be callable from the threads of the executor
+    /// @param[in] executor runs the chunk hashing, both references have to outlive this instance
+    /// @param[in] chunk_size size of a leaf chunk in bytes, has to be greater than zero
+    TreeHashCalculator(const IHashCalculatorFactory& factory,
+                       concurrency::Executor& executor,
+                       const std::size_t chunk_size = kDefaultChunkSize) noexcept;
+
+    /// @brief Calculates the tree hash of a memory region, e.g. a memory mapped file.
+    ///
+    /// @param[in] algorithm algorithm to use for all nodes of the tree
+    /// @param[in] data the region to hash, has to stay valid until this method returns
+    /// @return root of the tree, otherwise error.
+    Result<Hash> CalculateHash(const HashAlgorithm algorithm, const score::cpp::span<const std::uint8_t> data) const;
+
+    /// @brief Calculates the tree hash of a stream, e.g. a file.
+    ///
+    /// The stream is read chunk by chunk on the calling thread, while previously read chunks are hashed on the
+    /// executor. At most MaxConcurrencyLevel() + 1 chunks are kept in memory.
+    ///
+    /// @param[in] algorithm algorithm to use for all nodes of the tree
+    /// @param[in] input istream that is read until its end
+    /// @return root of the tree, otherwise error.
+    Result<Hash> CalculateHash(const HashAlgorithm algorithm, std::istream& input) const;
+
+  private:
+    const IHashCalculatorFactory& factory_;
+    concurrency::Executor& executor_;
+    std::size_t chunk_size_;
+};
+
+}  // namespace hash
+}  // namespace score
+
+#endif  // SCORE_LIB_HASH_CODE_PARALLEL_TREE_HASH_CALCULATOR_H
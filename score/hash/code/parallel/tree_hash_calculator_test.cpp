@@ -0,0 +1,214 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "score/hash/code/parallel/tree_hash_calculator.h"
+#include "score/hash/code/common/error.h"
+#include "score/hash/code/core/factory/hash_calculator_factory_mock.h"
+#include "score/hash/code/sha256digest/sha256digest.h"
+
+#include "score/concurrency/thread_pool.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace hash
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+
+constexpr std::size_t kChunkSize{100U};
+
+class Sha256Factory final : public IHashCalculatorFactory
+{
+  public:
+    Result<std::unique_ptr<IHashCalculator>> CreateHashCalculator(const HashAlgorithm algorithm) const noexcept override
+    {
+        if (algorithm != HashAlgorithm::kSha256)
+        {
+            return MakeUnexpected(ErrorCode::kInvalidParameters);
+        }
+        return std::make_unique<Sha256Digest>();
+    }
+};
+
+Hash Sha256(const std::uint8_t prefix, const std::vector<std::uint8_t>& data)
+{
+    Sha256Digest digest{};
+    EXPECT_TRUE(digest.Update({&prefix, 1U}));
+    if (data.empty() == false)
+    {
+        EXPECT_TRUE(digest.Update(data));
+    }
+    return digest.Finalize();
+}
+
+Hash Leaf(const std::vector<std::uint8_t>& data, const std::size_t offset, const std::size_t size)
+{
+    return Sha256(0x00U, {data.begin() + static_cast<std::ptrdiff_t>(offset),
+                          data.begin() + static_cast<std::ptrdiff_t>(offset + size)});
+}
+
+Hash Node(const Hash& left, const Hash& right)
+{
+    std::vector<std::uint8_t> data{left.GetBytes().begin(), left.GetBytes().end()};
+    data.insert(data.end(), right.GetBytes().begin(), right.GetBytes().end());
+    return Sha256(0x01U, data);
+}
+
+class TreeHashCalculatorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 generator{42U};
+        for (auto& value : data_)
+        {
+            value = static_cast<std::uint8_t>(generator());
+        }
+    }
+
+    std::vector<std::uint8_t> data_ = std::vector<std::uint8_t>(5U * kChunkSize);
+    Sha256Factory factory_{};
+    concurrency::ThreadPool executor_{2U};
+    TreeHashCalculator unit_{factory_, executor_, kChunkSize};
+};
+
+TEST_F(TreeHashCalculatorTest, SingleChunkIsOneLeaf)
+{
+    // Given an input that fits into one chunk
+    const score::cpp::span<const std::uint8_t> input{data_.data(), kChunkSize};
+
+    // When calculating the tree hash
+    const auto result = unit_.CalculateHash(HashAlgorithm::kSha256, input);
+
+    // Then the root is the leaf digest
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), Leaf(data_, 0U, kChunkSize));
+    EXPECT_EQ(result.value().GetAlgorithm(), HashAlgorithm::kSha256);
+}
+
+TEST_F(TreeHashCalculatorTest, EmptyInputIsOneEmptyLeaf)
+{
+    // Given an empty input
+    const score::cpp::span<const std::uint8_t> input{};
+
+    // When calculating the tree hash
+    const auto result = unit_.CalculateHash(HashAlgorithm::kSha256, input);
+
+    // Then the root is the digest of an empty leaf
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), Sha256(0x00U, {}));
+}
+
+TEST_F(TreeHashCalculatorTest, CombinesLeavesPairwise)
+{
+    // Given an input of five chunks, the last one being shorter
+    const score::cpp::span<const std::uint8_t> input{data_.data(), data_.size() - 1U};
+
+    // When calculating the tree hash
+    const auto result = unit_.CalculateHash(HashAlgorithm::kSha256, input);
+
+    // Then the leaves are combined level by level and the odd leaf is moved up unchanged
+    const auto expected = Node(Node(Node(Leaf(data_, 0U, kChunkSize), Leaf(data_, kChunkSize, kChunkSize)),
+                                    Node(Leaf(data_, 2U * kChunkSize, kChunkSize),
+                                         Leaf(data_, 3U * kChunkSize, kChunkSize))),
+                               Leaf(data_, 4U * kChunkSize, kChunkSize - 1U));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value(), expected);
+}
+
+TEST_F(TreeHashCalculatorTest, StreamMatchesMemoryRegion)
+{
+    // Given inputs that end before, at and after a chunk boundary
+    for (const std::size_t size : {0U, 1U, 99U, 100U, 101U, 300U, 499U, 500U})
+    {
+        const score::cpp::span<const std::uint8_t> input{data_.data(), size};
+        std::istringstream stream{std::string{data_.begin(), data_.begin() + static_cast<std::ptrdiff_t>(size)}};
+
+        // When calculating the tree hash of the stream
+        const auto result = unit_.CalculateHash(HashAlgorithm::kSha256, stream);
+
+        // Then it is the same as the one of the memory region
+        ASSERT_TRUE(result.has_value()) << "size " << size;
+        EXPECT_EQ(result.value(), unit_.CalculateHash(HashAlgorithm::kSha256, input).value()) << "size " << size;
+    }
+}
+
+TEST_F(TreeHashCalculatorTest, FailsIfCalculatorCannotBeCreated)
+{
+    // Given an algorithm the factory does not support
+    std::istringstream stream{std::string(data_.begin(), data_.end())};
+
+    // When calculating the tree hash
+    const auto result = unit_.CalculateHash(HashAlgorithm::kCrc32, data_);
+    const auto stream_result = unit_.CalculateHash(HashAlgorithm::kCrc32, stream);
+
+    // Then the error of the factory is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ErrorCode::kInvalidParameters);
+    ASSERT_FALSE(stream_result.has_value());
+    EXPECT_EQ(stream_result.error(), ErrorCode::kInvalidParameters);
+}
+
+TEST_F(TreeHashCalculatorTest, FailsIfInnerNodeCannotBeHashed)
+{
+    // Given a factory that fails after the leaves were hashed
+    HashCalculatorFactoryMock factory{};
+    std::atomic<std::size_t> calls{0U};
+    EXPECT_CALL(factory, CreateHashCalculator(_))
+        .WillRepeatedly(Invoke([this, &calls](const HashAlgorithm algorithm) -> Result<std::unique_ptr<IHashCalculator>> {
+            if (calls++ >= 2U)
+            {
+                return MakeUnexpected(ErrorCode::kCouldNotCreateDigest);
+            }
+            return factory_.CreateHashCalculator(algorithm);
+        }));
+    TreeHashCalculator unit{factory, executor_, kChunkSize};
+
+    // When calculating the tree hash of two chunks
+    const auto result = unit.CalculateHash(HashAlgorithm::kSha256, {data_.data(), 2U * kChunkSize});
+
+    // Then the error of the factory is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ErrorCode::kCouldNotCreateDigest);
+}
+
+TEST_F(TreeHashCalculatorTest, FailsOnBadStream)
+{
+    // Given a stream in error state
+    std::istringstream stream{"data"};
+    stream.setstate(std::ios_base::badbit);
+
+    // When calculating the tree hash
+    const auto result = unit_.CalculateHash(HashAlgorithm::kSha256, stream);
+
+    // Then a stream error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ErrorCode::kStreamError);
+}
+
+}  // namespace
+}  // namespace hash
+}  // namespace score
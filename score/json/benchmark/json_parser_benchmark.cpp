@@ -33,6 +33,11 @@
 ///
 /// The realistic-config workload is additionally parsed both from a buffer and
 /// from a file, so file-IO overhead can be separated from pure parsing cost.
+///
+/// Every workload is also parsed into a FlatDocument (BM_ParseBufferFlat), which
+/// stores all values in a single arena instead of a tree of Any. All parse
+/// benchmarks report the number of heap allocations per parse ("allocations"),
+/// counted by replacing the global operator new.
 
 #include "score/json/json_parser.h"
 
@@ -40,13 +45,44 @@
 
 #include <unistd.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <ios>
+#include <new>
 #include <string>
 #include <string_view>
 
+namespace
+{
+std::atomic<std::size_t> g_allocations{0U};
+}  // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc) counting replacement of the global allocation functions
+void* operator new(const std::size_t size)
+{
+    g_allocations.fetch_add(1U, std::memory_order_relaxed);
+    void* const pointer = std::malloc((size == 0U) ? 1U : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+    return pointer;
+}
+
+void operator delete(void* const pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* const pointer, const std::size_t /* size */) noexcept
+{
+    std::free(pointer);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc)
+
 namespace score
 {
 namespace json
@@ -242,6 +278,13 @@ std::string MakeRealisticConfig(const std::size_t count)
 
 using Generator = std::string (*)(std::size_t);
 
+void SetAllocationCounter(benchmark::State& state, const std::size_t allocations_before)
+{
+    const std::size_t allocations = g_allocations.load(std::memory_order_relaxed) - allocations_before;
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
 template <Generator generate>
 void BM_ParseBuffer(benchmark::State& state)
 {
@@ -249,6 +292,7 @@ void BM_ParseBuffer(benchmark::State& state)
     const std::string payload = generate(count);
     const JsonParser parser{};
 
+    const std::size_t allocations_before = g_allocations.load(std::memory_order_relaxed);
     for (auto _ : state)
     {
         auto result = parser.FromBuffer(std::string_view{payload});
@@ -259,6 +303,32 @@ void BM_ParseBuffer(benchmark::State& state)
             break;
         }
     }
+    SetAllocationCounter(state, allocations_before);
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(payload.size()));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+    state.counters["document_bytes"] = benchmark::Counter(static_cast<double>(payload.size()));
+}
+
+template <Generator generate>
+void BM_ParseBufferFlat(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::string payload = generate(count);
+    const JsonParser parser{};
+
+    const std::size_t allocations_before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        auto result = parser.FlatDocumentFromBuffer(std::string_view{payload});
+        benchmark::DoNotOptimize(result);
+        if (!result.has_value())
+        {
+            state.SkipWithError("JSON parsing failed");
+            break;
+        }
+    }
+    SetAllocationCounter(state, allocations_before);
 
     state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(payload.size()));
     state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
@@ -314,6 +384,35 @@ void BM_RealisticConfig_FromFile(benchmark::State& state)
     static_cast<void>(std::remove(path.c_str()));
 }
 
+void BM_RealisticConfig_FlatDocumentFromFile(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::string payload = MakeRealisticConfig(count);
+    const std::string path =
+        "/tmp/json_parser_benchmark_flat_" + std::to_string(::getpid()) + "_" + std::to_string(count) + ".json";
+    {
+        std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+        stream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    }
+
+    const JsonParser parser{};
+    const std::size_t allocations_before = g_allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+    {
+        auto result = parser.FlatDocumentFromFile(path);
+        benchmark::DoNotOptimize(result);
+        if (!result.has_value())
+        {
+            state.SkipWithError("FlatDocumentFromFile parsing failed");
+            break;
+        }
+    }
+    SetAllocationCounter(state, allocations_before);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(payload.size()));
+
+    static_cast<void>(std::remove(path.c_str()));
+}
+
 BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeIntegerArray)->RangeMultiplier(8)->Range(8, kMaxRange);
 BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeDoubleArray)->RangeMultiplier(8)->Range(8, kMaxRange);
 BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeStringArray)->RangeMultiplier(8)->Range(8, kMaxRange);
@@ -324,8 +423,19 @@ BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeFlatObject)->RangeMultiplier(8)->Range(8,
 BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeNestedObject)->RangeMultiplier(8)->Range(8, 512);
 BENCHMARK_TEMPLATE(BM_ParseBuffer, MakeRealisticConfig)->RangeMultiplier(8)->Range(8, 4096);
 
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeIntegerArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeDoubleArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeStringArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeEscapedStringArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeBoolArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeNullArray)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeFlatObject)->RangeMultiplier(8)->Range(8, kMaxRange);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeNestedObject)->RangeMultiplier(8)->Range(8, 512);
+BENCHMARK_TEMPLATE(BM_ParseBufferFlat, MakeRealisticConfig)->RangeMultiplier(8)->Range(8, 4096);
+
 BENCHMARK(BM_RealisticConfig_FromBuffer)->RangeMultiplier(8)->Range(8, 4096);
 BENCHMARK(BM_RealisticConfig_FromFile)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_RealisticConfig_FlatDocumentFromFile)->RangeMultiplier(8)->Range(8, 4096);
 
 }  // namespace
 }  // namespace json
@@ -15,6 +15,7 @@
 #define SCORE_LIB_JSON_I_JSON_PARSER_H
 
 #include "score/json/internal/model/any.h"
+#include "score/json/internal/model/flat_document.h"
 #include "score/json/internal/model/object.h"
 #include "score/result/result.h"
 
@@ -30,6 +31,8 @@ class IJsonParser
   public:
     virtual score::Result<Any> FromFile(const std::string_view file_path) const noexcept = 0;
     virtual score::Result<Any> FromBuffer(const std::string_view buffer) const noexcept = 0;
+    virtual score::Result<FlatDocument> FlatDocumentFromFile(const std::string_view file_path) const noexcept = 0;
+    virtual score::Result<FlatDocument> FlatDocumentFromBuffer(const std::string_view buffer) const noexcept = 0;
     IJsonParser() noexcept = default;
     IJsonParser(const IJsonParser&) = delete;
     IJsonParser(IJsonParser&&) noexcept = delete;
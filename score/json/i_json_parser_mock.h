@@ -27,6 +27,14 @@ class IJsonParserMock : public IJsonParser
   public:
     MOCK_METHOD(score::Result<Any>, FromFile, (const std::string_view file_path), (const, noexcept, override));
     MOCK_METHOD(score::Result<Any>, FromBuffer, (const std::string_view buffer), (const, noexcept, override));
+    MOCK_METHOD(score::Result<FlatDocument>,
+                FlatDocumentFromFile,
+                (const std::string_view file_path),
+                (const, noexcept, override));
+    MOCK_METHOD(score::Result<FlatDocument>,
+                FlatDocumentFromBuffer,
+                (const std::string_view buffer),
+                (const, noexcept, override));
 };
 
 }  // namespace json
@@ -0,0 +1,39 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/model/flat_document.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace json
+{
+
+score::Result<FlatValue> FlatObject::Find(const std::string_view key) const noexcept
+{
+    const detail::FlatNode* const first = node_->children;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) children are stored contiguously
+    const detail::FlatNode* const last = node_->children + node_->size;
+    const auto* const member =
+        std::lower_bound(first, last, key, [](const detail::FlatNode& node, const std::string_view& searched) noexcept {
+            return node.key < searched;
+        });
+    if ((member == last) || (member->key != key))
+    {
+        return score::MakeUnexpected(score::json::Error::kKeyNotFound, "Key was not found on the object");
+    }
+    return FlatValue{*member};
+}
+
+}  // namespace json
+}  // namespace score
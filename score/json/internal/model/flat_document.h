@@ -0,0 +1,350 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
+#define SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
+
+#include "score/json/internal/model/error.h"
+#include "score/json/internal/model/number.h"
+#include "score/result/result.h"
+
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+#include <score/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace score
+{
+namespace json
+{
+
+class FlatDocument;
+class FlatList;
+class FlatObject;
+class FlatParser;
+
+namespace detail
+{
+
+enum class FlatNodeType : std::uint8_t
+{
+    kNull,
+    kBool,
+    kNumber,
+    kString,
+    kList,
+    kObject,
+};
+
+/// \brief Storage of a single JSON value of a FlatDocument
+///
+/// \details Keys and strings refer to the parsed buffer, or to the arena of the document if they contained escape
+/// sequences. The children of a list or object are stored next to each other in the arena, the members of an object
+/// are sorted by key.
+struct FlatNode
+{
+    std::string_view key;
+    std::string_view string;
+    Number number;
+    const FlatNode* children;
+    std::uint32_t size;
+    FlatNodeType type;
+    bool boolean;
+};
+
+// The arena never runs destructors, it is released as a whole.
+static_assert(std::is_trivially_destructible<FlatNode>::value, "FlatNode must not own any resources");
+
+}  // namespace detail
+
+/// \brief Read-only view on a JSON value of a FlatDocument
+///
+/// \details The view is cheap to copy and valid as long as the document exists. If the document was parsed from a
+/// caller provided buffer, that buffer has to outlive the view as well.
+class FlatValue
+{
+  public:
+    explicit FlatValue(const detail::FlatNode& node) noexcept : node_{&node} {}
+
+    bool IsNull() const noexcept
+    {
+        return node_->type == detail::FlatNodeType::kNull;
+    }
+
+    /// \brief Convenience method to directly convert a JSON number or boolean into arithmetic type.
+    template <typename T, std::enable_if_t<std::is_arithmetic<T>::value, bool> = true>
+    score::Result<T> As() const noexcept
+    {
+        if (node_->type == detail::FlatNodeType::kNumber)
+        {
+            return node_->number.As<T>();
+        }
+        if (node_->type == detail::FlatNodeType::kBool)
+        {
+            // The cast from a bool to every arithmetic type is well-defined.
+            return static_cast<T>(node_->boolean);
+        }
+        return score::MakeUnexpected(score::json::Error::kWrongType);
+    }
+
+    /// \brief Interpret the value as string, list or object
+    /// \tparam T One of std::string_view, FlatList or FlatObject
+    /// \return A result containing the value if the JSON value is of the requested type, an kWrongType Error otherwise
+    template <typename T,
+              std::enable_if_t<std::is_same<T, std::string_view>::value || std::is_same<T, FlatList>::value ||
+                                   std::is_same<T, FlatObject>::value,
+                               bool> = true>
+    score::Result<T> As() const noexcept;
+
+  private:
+    const detail::FlatNode* node_;
+};
+
+namespace detail
+{
+
+/// \brief Iterator over the children of a list (yielding FlatValue) or an object (yielding key and FlatValue)
+template <typename Value>
+class FlatIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = Value;
+
+    explicit FlatIterator(const FlatNode* const node) noexcept : node_{node} {}
+
+    Value operator*() const noexcept
+    {
+        if constexpr (std::is_same<Value, FlatValue>::value)
+        {
+            return FlatValue{*node_};
+        }
+        else
+        {
+            return Value{node_->key, FlatValue{*node_}};
+        }
+    }
+
+    FlatIterator& operator++() noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) children are stored contiguously
+        ++node_;
+        return *this;
+    }
+
+    FlatIterator operator++(int) noexcept
+    {
+        FlatIterator previous{*this};
+        ++(*this);
+        return previous;
+    }
+
+    friend bool operator==(const FlatIterator& lhs, const FlatIterator& rhs) noexcept
+    {
+        return lhs.node_ == rhs.node_;
+    }
+
+    friend bool operator!=(const FlatIterator& lhs, const FlatIterator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+  private:
+    const FlatNode* node_;
+};
+
+}  // namespace detail
+
+/// \brief Read-only view on a JSON array of a FlatDocument
+class FlatList
+{
+  public:
+    using const_iterator = detail::FlatIterator<FlatValue>;
+
+    explicit FlatList(const detail::FlatNode& node) noexcept : node_{&node} {}
+
+    std::size_t size() const noexcept
+    {
+        return node_->size;
+    }
+
+    bool empty() const noexcept
+    {
+        return node_->size == 0U;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{node_->children};
+    }
+
+    const_iterator end() const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) children are stored contiguously
+        return const_iterator{node_->children + node_->size};
+    }
+
+    /// \brief Access to the element at the given position, which has to be less than size()
+    FlatValue operator[](const std::size_t index) const noexcept
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(index < size());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+        return FlatValue{node_->children[index]};
+    }
+
+  private:
+    const detail::FlatNode* node_;
+};
+
+/// \brief Read-only view on a JSON object of a FlatDocument
+///
+/// \details The members are stored sorted by key, so a lookup is a binary search over a contiguous array. If a key
+/// occurs more than once, the first occurrence is found. Iteration yields the members in key order.
+class FlatObject
+{
+  public:
+    using const_iterator = detail::FlatIterator<std::pair<std::string_view, FlatValue>>;
+
+    explicit FlatObject(const detail::FlatNode& node) noexcept : node_{&node} {}
+
+    std::size_t size() const noexcept
+    {
+        return node_->size;
+    }
+
+    bool empty() const noexcept
+    {
+        return node_->size == 0U;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{node_->children};
+    }
+
+    const_iterator end() const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) children are stored contiguously
+        return const_iterator{node_->children + node_->size};
+    }
+
+    /// \brief Looks up the value of the given key
+    /// \return The value, kKeyNotFound if the object has no such member
+    score::Result<FlatValue> Find(const std::string_view key) const noexcept;
+
+    /// \brief Convenience method to look up a member and interpret it as type T, see FlatValue::As()
+    template <typename T>
+    score::Result<T> Get(const std::string_view key) const noexcept
+    {
+        const auto value = Find(key);
+        if (!value.has_value())
+        {
+            return score::MakeUnexpected<T>(value.error());
+        }
+        return value->As<T>();
+    }
+
+  private:
+    const detail::FlatNode* node_;
+};
+
+template <typename T,
+          std::enable_if_t<std::is_same<T, std::string_view>::value || std::is_same<T, FlatList>::value ||
+                               std::is_same<T, FlatObject>::value,
+                           bool>>
+score::Result<T> FlatValue::As() const noexcept
+{
+    if constexpr (std::is_same<T, std::string_view>::value)
+    {
+        if (node_->type == detail::FlatNodeType::kString)
+        {
+            return node_->string;
+        }
+    }
+    else if constexpr (std::is_same<T, FlatList>::value)
+    {
+        if (node_->type == detail::FlatNodeType::kList)
+        {
+            return FlatList{*node_};
+        }
+    }
+    else
+    {
+        if (node_->type == detail::FlatNodeType::kObject)
+        {
+            return FlatObject{*node_};
+        }
+    }
+    return score::MakeUnexpected(score::json::Error::kWrongType);
+}
+
+/// \brief Read-only JSON document whose values are stored in a single arena
+///
+/// \details In contrast to Any, which allocates every key and every nested value separately, a FlatDocument stores
+/// all values in one contiguous array. Keys and strings are not copied but refer to the parsed buffer, objects are
+/// sorted arrays instead of trees. This makes parsing a matter of a handful of allocations and keeps lookups cache
+/// friendly, at the price that the document cannot be modified.
+///
+/// Documents are created by IJsonParser::FlatDocumentFromBuffer() and IJsonParser::FlatDocumentFromFile().
+class FlatDocument
+{
+  public:
+    FlatDocument(FlatDocument&&) noexcept = default;
+    FlatDocument& operator=(FlatDocument&&) noexcept = default;
+    FlatDocument(const FlatDocument&) = delete;
+    FlatDocument& operator=(const FlatDocument&) = delete;
+    ~FlatDocument() = default;
+
+    /// \brief The top-level value of the document
+    FlatValue Root() const noexcept
+    {
+        return FlatValue{*root_};
+    }
+
+    /// \brief Number of JSON values (including the root and all nested values) in the document
+    std::size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+  private:
+    friend class FlatParser;
+
+    FlatDocument(score::cpp::pmr::vector<char> source,
+                 std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> arena,
+                 const detail::FlatNode* const root,
+                 const std::size_t size) noexcept
+        : source_{std::move(source)}, arena_{std::move(arena)}, root_{root}, size_{size}
+    {
+    }
+
+    // Content of the parsed file, empty if the document refers to a caller provided buffer.
+    score::cpp::pmr::vector<char> source_;
+    std::unique_ptr<score::cpp::pmr::monotonic_buffer_resource> arena_;
+    const detail::FlatNode* root_;
+    std::size_t size_;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_MODEL_FLAT_DOCUMENT_H
@@ -0,0 +1,755 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/flat/flat_parser.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace json
+{
+
+namespace
+{
+
+using detail::FlatNode;
+using detail::FlatNodeType;
+
+constexpr std::string_view kUtf8ByteOrderMark{"\xEF\xBB\xBF"};
+
+// Numbers up to this length are converted from a copy on the stack, since strtod() requires a terminated string.
+constexpr std::size_t kMaxStackNumberLength{64U};
+
+// Nesting depth up to which the stack of open containers does not need to grow.
+constexpr std::size_t kExpectedNestingDepth{32U};
+
+struct BufferStatistics
+{
+    std::size_t max_values;
+    bool has_escapes;
+};
+
+// Every value except the root is either followed by a comma or is the last value of a non-empty container. Thus the
+// number of commas and opening brackets plus one is an upper bound for the number of values. Commas and brackets in
+// strings only make the bound less tight.
+BufferStatistics AnalyzeBuffer(const std::string_view buffer) noexcept
+{
+    BufferStatistics statistics{1U, false};
+    for (const char character : buffer)
+    {
+        switch (character)
+        {
+            case ',':
+            case '[':
+            case '{':
+                ++statistics.max_values;
+                break;
+            case '\\':
+                statistics.has_escapes = true;
+                break;
+            default:
+                break;
+        }
+    }
+    return statistics;
+}
+
+FlatNode MakeNode(const FlatNodeType type, const std::string_view key) noexcept
+{
+    return FlatNode{key, std::string_view{}, Number{std::uint8_t{0U}}, nullptr, 0U, type, false};
+}
+
+// Same type selection as the tree based parsers: the smallest unsigned type, then the smallest signed type.
+Number MakeUnsignedNumber(const std::uint64_t value) noexcept
+{
+    if (value <= std::numeric_limits<std::uint8_t>::max())
+    {
+        return Number{static_cast<std::uint8_t>(value)};
+    }
+    if (value <= std::numeric_limits<std::uint16_t>::max())
+    {
+        return Number{static_cast<std::uint16_t>(value)};
+    }
+    if (value <= std::numeric_limits<std::uint32_t>::max())
+    {
+        return Number{static_cast<std::uint32_t>(value)};
+    }
+    return Number{value};
+}
+
+Number MakeSignedNumber(const std::int64_t value) noexcept
+{
+    if ((value >= std::numeric_limits<std::int8_t>::min()) && (value <= std::numeric_limits<std::int8_t>::max()))
+    {
+        return Number{static_cast<std::int8_t>(value)};
+    }
+    if ((value >= std::numeric_limits<std::int16_t>::min()) && (value <= std::numeric_limits<std::int16_t>::max()))
+    {
+        return Number{static_cast<std::int16_t>(value)};
+    }
+    if ((value >= std::numeric_limits<std::int32_t>::min()) && (value <= std::numeric_limits<std::int32_t>::max()))
+    {
+        return Number{static_cast<std::int32_t>(value)};
+    }
+    return Number{value};
+}
+
+bool IsDigit(const char character) noexcept
+{
+    return (character >= '0') && (character <= '9');
+}
+
+// Stable bottom-up merge sort of the members by key, so that a lookup finds the first of duplicate keys. The buffer
+// provides room for count nodes, thus sorting does not allocate.
+void SortMembers(FlatNode* const members, FlatNode* const buffer, const std::size_t count) noexcept
+{
+    const auto by_key = [](const FlatNode& lhs, const FlatNode& rhs) noexcept {
+        return lhs.key < rhs.key;
+    };
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) both ranges hold count nodes
+    if (std::is_sorted(members, members + count, by_key))
+    {
+        return;
+    }
+    FlatNode* from{members};
+    FlatNode* to{buffer};
+    for (std::size_t width = 1U; width < count; width *= 2U)
+    {
+        for (std::size_t begin = 0U; begin < count; begin += 2U * width)
+        {
+            const std::size_t middle = std::min(begin + width, count);
+            const std::size_t end = std::min(begin + (2U * width), count);
+            static_cast<void>(std::merge(from + begin, from + middle, from + middle, from + end, to + begin, by_key));
+        }
+        std::swap(from, to);
+    }
+    if (from != members)
+    {
+        static_cast<void>(std::copy(from, from + count, members));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/// \brief Single pass over the buffer that stores all values into the preallocated node array
+///
+/// \details Values are collected on a pending stack. Once a container is closed, its children are moved as one
+/// contiguous (and for objects sorted) block into the node array, and the container itself becomes pending.
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) the cursor is always checked against end_
+class FlatBuilder
+{
+  public:
+    FlatBuilder(const std::string_view buffer,
+                FlatNode* const nodes,
+                score::cpp::pmr::memory_resource& arena,
+                score::cpp::pmr::memory_resource* const upstream) noexcept
+        : current_{buffer.data()},
+          end_{buffer.data() + buffer.size()},
+          nodes_{nodes},
+          arena_{arena},
+          pending_{upstream},
+          frames_{upstream}
+    {
+    }
+
+    score::Result<const FlatNode*> Build(const std::size_t max_values) noexcept
+    {
+        pending_.reserve(max_values);
+        frames_.reserve(kExpectedNestingDepth);
+        bool expect_value{true};
+        while (true)
+        {
+            SkipWhitespace();
+            if (expect_value)
+            {
+                const auto opened_container = ParseValue();
+                if (!opened_container.has_value())
+                {
+                    return score::MakeUnexpected<const FlatNode*>(opened_container.error());
+                }
+                expect_value = opened_container.value();
+                continue;
+            }
+            if (frames_.empty())
+            {
+                break;
+            }
+            if (current_ == end_)
+            {
+                return MakeUnexpected(Error::kParsingError, "Unterminated array or object");
+            }
+            const char character = *current_;
+            ++current_;
+            const FlatNodeType type = frames_.back().type;
+            if (character == ',')
+            {
+                if (type == FlatNodeType::kObject)
+                {
+                    const auto key = ParseKey();
+                    if (!key.has_value())
+                    {
+                        return score::MakeUnexpected<const FlatNode*>(key.error());
+                    }
+                }
+                expect_value = true;
+            }
+            else if (((character == '}') && (type == FlatNodeType::kObject)) ||
+                     ((character == ']') && (type == FlatNodeType::kList)))
+            {
+                CloseContainer();
+            }
+            else
+            {
+                return MakeUnexpected(Error::kParsingError, "Expected ',' or end of array or object");
+            }
+        }
+        if (current_ != end_)
+        {
+            return MakeUnexpected(Error::kParsingError, "Unexpected content after the JSON value");
+        }
+        static_cast<void>(std::uninitialized_copy(pending_.begin(), pending_.end(), nodes_ + size_));
+        ++size_;
+        return nodes_ + (size_ - 1U);
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return size_;
+    }
+
+  private:
+    struct Frame
+    {
+        std::size_t first_pending;
+        std::string_view key;
+        FlatNodeType type;
+    };
+
+    void SkipWhitespace() noexcept
+    {
+        while ((current_ != end_) && ((*current_ == ' ') || (*current_ == '\n') || (*current_ == '\r') ||
+                                      (*current_ == '\t')))
+        {
+            ++current_;
+        }
+    }
+
+    std::string_view CurrentKey() const noexcept
+    {
+        return ((!frames_.empty()) && (frames_.back().type == FlatNodeType::kObject)) ? key_ : std::string_view{};
+    }
+
+    // Returns true if a non-empty container was opened, i.e. a value is expected next.
+    score::Result<bool> ParseValue() noexcept
+    {
+        if (current_ == end_)
+        {
+            return MakeUnexpected(Error::kParsingError, "Expected a value");
+        }
+        switch (*current_)
+        {
+            case '{':
+            case '[':
+                return OpenContainer();
+            case '"':
+            {
+                FlatNode node = MakeNode(FlatNodeType::kString, CurrentKey());
+                const auto result = ParseString(node.string);
+                if (!result.has_value())
+                {
+                    return score::MakeUnexpected<bool>(result.error());
+                }
+                pending_.push_back(node);
+                return false;
+            }
+            case 't':
+                return ParseLiteral("true", FlatNodeType::kBool, true);
+            case 'f':
+                return ParseLiteral("false", FlatNodeType::kBool, false);
+            case 'n':
+                return ParseLiteral("null", FlatNodeType::kNull, false);
+            default:
+                return ParseNumber();
+        }
+    }
+
+    score::Result<bool> OpenContainer() noexcept
+    {
+        const bool is_object{*current_ == '{'};
+        ++current_;
+        frames_.push_back(
+            Frame{pending_.size(), CurrentKey(), is_object ? FlatNodeType::kObject : FlatNodeType::kList});
+        SkipWhitespace();
+        if ((current_ != end_) && (*current_ == (is_object ? '}' : ']')))
+        {
+            ++current_;
+            CloseContainer();
+            return false;
+        }
+        if (is_object)
+        {
+            const auto key = ParseKey();
+            if (!key.has_value())
+            {
+                return score::MakeUnexpected<bool>(key.error());
+            }
+        }
+        return true;
+    }
+
+    void CloseContainer() noexcept
+    {
+        const Frame frame = frames_.back();
+        frames_.pop_back();
+        FlatNode* const pending = pending_.data() + frame.first_pending;
+        const std::size_t count = pending_.size() - frame.first_pending;
+        FlatNode* const children = nodes_ + size_;
+        static_cast<void>(std::uninitialized_copy(pending, pending + count, children));
+        if (frame.type == FlatNodeType::kObject)
+        {
+            SortMembers(children, pending, count);
+        }
+        size_ += count;
+        static_cast<void>(
+            pending_.erase(pending_.begin() + static_cast<std::ptrdiff_t>(frame.first_pending), pending_.end()));
+
+        FlatNode node = MakeNode(frame.type, frame.key);
+        node.children = children;
+        node.size = static_cast<std::uint32_t>(count);
+        pending_.push_back(node);
+    }
+
+    score::Result<void> ParseKey() noexcept
+    {
+        SkipWhitespace();
+        if ((current_ == end_) || (*current_ != '"'))
+        {
+            return MakeUnexpected(Error::kParsingError, "Expected a key");
+        }
+        const auto key = ParseString(key_);
+        if (!key.has_value())
+        {
+            return key;
+        }
+        SkipWhitespace();
+        if ((current_ == end_) || (*current_ != ':'))
+        {
+            return MakeUnexpected(Error::kParsingError, "Expected ':' after key");
+        }
+        ++current_;
+        return {};
+    }
+
+    score::Result<bool> ParseLiteral(const std::string_view literal, const FlatNodeType type, const bool value) noexcept
+    {
+        if ((static_cast<std::size_t>(end_ - current_) < literal.size()) ||
+            (std::string_view{current_, literal.size()} != literal))
+        {
+            return MakeUnexpected(Error::kParsingError, "Invalid literal");
+        }
+        current_ += literal.size();
+        FlatNode node = MakeNode(type, CurrentKey());
+        node.boolean = value;
+        pending_.push_back(node);
+        return false;
+    }
+
+    void SkipDigits() noexcept
+    {
+        while ((current_ != end_) && IsDigit(*current_))
+        {
+            ++current_;
+        }
+    }
+
+    score::Result<bool> ParseNumber() noexcept
+    {
+        const char* const begin = current_;
+        const bool is_negative{*current_ == '-'};
+        if (is_negative)
+        {
+            ++current_;
+        }
+        if ((current_ == end_) || (!IsDigit(*current_)))
+        {
+            return MakeUnexpected(Error::kParsingError, "Expected a value");
+        }
+        // Leading zeros are not allowed
+        if (*current_ == '0')
+        {
+            ++current_;
+        }
+        else
+        {
+            SkipDigits();
+        }
+
+        bool is_integer{true};
+        if ((current_ != end_) && (*current_ == '.'))
+        {
+            is_integer = false;
+            ++current_;
+            if ((current_ == end_) || (!IsDigit(*current_)))
+            {
+                return MakeUnexpected(Error::kParsingError, "Expected digits after decimal point");
+            }
+            SkipDigits();
+        }
+        if ((current_ != end_) && ((*current_ == 'e') || (*current_ == 'E')))
+        {
+            is_integer = false;
+            ++current_;
+            if ((current_ != end_) && ((*current_ == '+') || (*current_ == '-')))
+            {
+                ++current_;
+            }
+            if ((current_ == end_) || (!IsDigit(*current_)))
+            {
+                return MakeUnexpected(Error::kParsingError, "Expected digits in exponent");
+            }
+            SkipDigits();
+        }
+
+        FlatNode node = MakeNode(FlatNodeType::kNumber, CurrentKey());
+        bool converted{false};
+        if (is_integer)
+        {
+            // Integers that do not fit into 64 bit are stored as double, like the tree based parsers do.
+            if (is_negative)
+            {
+                std::int64_t value{};
+                const auto result = std::from_chars(begin, current_, value);
+                converted = (result.ec == std::errc{});
+                if (converted)
+                {
+                    node.number = MakeSignedNumber(value);
+                }
+            }
+            else
+            {
+                std::uint64_t value{};
+                const auto result = std::from_chars(begin, current_, value);
+                converted = (result.ec == std::errc{});
+                if (converted)
+                {
+                    node.number = MakeUnsignedNumber(value);
+                }
+            }
+        }
+        if (!converted)
+        {
+            const auto value = ParseDouble(std::string_view{begin, static_cast<std::size_t>(current_ - begin)});
+            if (!std::isfinite(value))
+            {
+                return MakeUnexpected(Error::kParsingError, "Number out of range");
+            }
+            node.number = Number{value};
+        }
+        pending_.push_back(node);
+        return false;
+    }
+
+    static double ParseDouble(const std::string_view token) noexcept
+    {
+        if (token.size() < kMaxStackNumberLength)
+        {
+            std::array<char, kMaxStackNumberLength> terminated{};
+            static_cast<void>(std::copy(token.begin(), token.end(), terminated.begin()));
+            return std::strtod(terminated.data(), nullptr);
+        }
+        const std::string terminated{token};
+        return std::strtod(terminated.c_str(), nullptr);
+    }
+
+    // Expects the cursor at the opening quote.
+    score::Result<void> ParseString(std::string_view& out) noexcept
+    {
+        ++current_;
+        const char* const begin = current_;
+        while (current_ != end_)
+        {
+            const char character = *current_;
+            if (character == '"')
+            {
+                out = std::string_view{begin, static_cast<std::size_t>(current_ - begin)};
+                ++current_;
+                return {};
+            }
+            if (character == '\\')
+            {
+                return ParseEscapedString(begin, out);
+            }
+            if (static_cast<unsigned char>(character) < 0x20U)
+            {
+                return MakeUnexpected(Error::kParsingError, "Control character in string");
+            }
+            ++current_;
+        }
+        return MakeUnexpected(Error::kParsingError, "Unterminated string");
+    }
+
+    // Decodes the string into the arena. The cursor points to the first escape sequence.
+    score::Result<void> ParseEscapedString(const char* const begin, std::string_view& out) noexcept
+    {
+        // The decoded string is never longer than the encoded one, so the closing quote bounds the required memory.
+        const char* closing_quote{current_};
+        while ((closing_quote != end_) && (*closing_quote != '"'))
+        {
+            if ((*closing_quote == '\\') && ((closing_quote + 1) != end_))
+            {
+                ++closing_quote;
+            }
+            ++closing_quote;
+        }
+        if (closing_quote == end_)
+        {
+            return MakeUnexpected(Error::kParsingError, "Unterminated string");
+        }
+
+        auto* const decoded =
+            static_cast<char*>(arena_.allocate(static_cast<std::size_t>(closing_quote - begin), alignof(char)));
+        std::size_t length{static_cast<std::size_t>(current_ - begin)};
+        static_cast<void>(std::copy(begin, current_, decoded));
+        while (current_ != closing_quote)
+        {
+            const char character = *current_;
+            ++current_;
+            if (character != '\\')
+            {
+                if (static_cast<unsigned char>(character) < 0x20U)
+                {
+                    return MakeUnexpected(Error::kParsingError, "Control character in string");
+                }
+                decoded[length] = character;
+                ++length;
+                continue;
+            }
+            const char escaped = *current_;
+            ++current_;
+            switch (escaped)
+            {
+                case '"':
+                case '\\':
+                case '/':
+                    decoded[length] = escaped;
+                    ++length;
+                    break;
+                case 'b':
+                    decoded[length] = '\b';
+                    ++length;
+                    break;
+                case 'f':
+                    decoded[length] = '\f';
+                    ++length;
+                    break;
+                case 'n':
+                    decoded[length] = '\n';
+                    ++length;
+                    break;
+                case 'r':
+                    decoded[length] = '\r';
+                    ++length;
+                    break;
+                case 't':
+                    decoded[length] = '\t';
+                    ++length;
+                    break;
+                case 'u':
+                {
+                    const auto result = DecodeUnicodeEscape(closing_quote, decoded, length);
+                    if (!result.has_value())
+                    {
+                        return result;
+                    }
+                    break;
+                }
+                default:
+                    return MakeUnexpected(Error::kParsingError, "Invalid escape sequence");
+            }
+        }
+        ++current_;
+        out = std::string_view{decoded, length};
+        return {};
+    }
+
+    bool ReadHex4(const char* const limit, std::uint32_t& code_unit) noexcept
+    {
+        if ((limit - current_) < 4)
+        {
+            return false;
+        }
+        code_unit = 0U;
+        for (std::size_t i = 0U; i < 4U; ++i)
+        {
+            const char character = *current_;
+            ++current_;
+            std::uint32_t digit{};
+            if (IsDigit(character))
+            {
+                digit = static_cast<std::uint32_t>(character - '0');
+            }
+            else if ((character >= 'a') && (character <= 'f'))
+            {
+                digit = static_cast<std::uint32_t>(character - 'a') + 10U;
+            }
+            else if ((character >= 'A') && (character <= 'F'))
+            {
+                digit = static_cast<std::uint32_t>(character - 'A') + 10U;
+            }
+            else
+            {
+                return false;
+            }
+            code_unit = (code_unit << 4U) | digit;
+        }
+        return true;
+    }
+
+    // Decodes \uXXXX (and a following low surrogate) to UTF-8. The cursor points behind the 'u'.
+    score::Result<void> DecodeUnicodeEscape(const char* const limit, char* const decoded, std::size_t& length) noexcept
+    {
+        std::uint32_t code_point{};
+        if (!ReadHex4(limit, code_point))
+        {
+            return MakeUnexpected(Error::kParsingError, "Invalid unicode escape sequence");
+        }
+        if ((code_point >= 0xD800U) && (code_point <= 0xDBFFU))
+        {
+            std::uint32_t low_surrogate{};
+            if (((limit - current_) < 2) || (current_[0] != '\\') || (current_[1] != 'u'))
+            {
+                return MakeUnexpected(Error::kParsingError, "Unpaired surrogate in unicode escape sequence");
+            }
+            current_ += 2;
+            if ((!ReadHex4(limit, low_surrogate)) || (low_surrogate < 0xDC00U) || (low_surrogate > 0xDFFFU))
+            {
+                return MakeUnexpected(Error::kParsingError, "Unpaired surrogate in unicode escape sequence");
+            }
+            code_point = 0x10000U + ((code_point - 0xD800U) << 10U) + (low_surrogate - 0xDC00U);
+        }
+        else if ((code_point >= 0xDC00U) && (code_point <= 0xDFFFU))
+        {
+            return MakeUnexpected(Error::kParsingError, "Unpaired surrogate in unicode escape sequence");
+        }
+
+        const auto append = [decoded, &length](const std::uint32_t byte) noexcept {
+            decoded[length] = static_cast<char>(static_cast<unsigned char>(byte));
+            ++length;
+        };
+        if (code_point < 0x80U)
+        {
+            append(code_point);
+        }
+        else if (code_point < 0x800U)
+        {
+            append(0xC0U | (code_point >> 6U));
+            append(0x80U | (code_point & 0x3FU));
+        }
+        else if (code_point < 0x10000U)
+        {
+            append(0xE0U | (code_point >> 12U));
+            append(0x80U | ((code_point >> 6U) & 0x3FU));
+            append(0x80U | (code_point & 0x3FU));
+        }
+        else
+        {
+            append(0xF0U | (code_point >> 18U));
+            append(0x80U | ((code_point >> 12U) & 0x3FU));
+            append(0x80U | ((code_point >> 6U) & 0x3FU));
+            append(0x80U | (code_point & 0x3FU));
+        }
+        return {};
+    }
+
+    const char* current_;
+    const char* end_;
+    FlatNode* nodes_;
+    std::size_t size_{0U};
+    score::cpp::pmr::memory_resource& arena_;
+    score::cpp::pmr::vector<FlatNode> pending_;
+    score::cpp::pmr::vector<Frame> frames_;
+    std::string_view key_{};
+};
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+}  // namespace
+
+auto FlatParser::FromBuffer(const std::string_view buffer, score::cpp::pmr::memory_resource* const upstream)
+    -> score::Result<FlatDocument>
+{
+    return Parse(buffer, score::cpp::pmr::vector<char>{upstream}, upstream);
+}
+
+auto FlatParser::FromFile(const std::string_view file_path, score::cpp::pmr::memory_resource* const upstream)
+    -> score::Result<FlatDocument>
+{
+    // NOLINTNEXTLINE(score-banned-function) Tolerated because JsonParser::FromFile is also on the banned function list
+    std::ifstream file{std::string{file_path}, std::ios::binary | std::ios::ate};
+    if (!file.is_open())
+    {
+        return MakeUnexpected(Error::kInvalidFilePath, "Failed to open file");
+    }
+    const std::streamoff size{file.tellg()};
+    if (size < 0)
+    {
+        return MakeUnexpected(Error::kInvalidFilePath, "Failed to determine the file size");
+    }
+    score::cpp::pmr::vector<char> content(static_cast<std::size_t>(size), upstream);
+    static_cast<void>(file.seekg(0, std::ios::beg));
+    if (!file.read(content.data(), static_cast<std::streamsize>(size)))
+    {
+        return MakeUnexpected(Error::kInvalidFilePath, "Failed to read file");
+    }
+    const std::string_view buffer{content.data(), content.size()};
+    return Parse(buffer, std::move(content), upstream);
+}
+
+auto FlatParser::Parse(std::string_view buffer,
+                       score::cpp::pmr::vector<char> source,
+                       score::cpp::pmr::memory_resource* const upstream) -> score::Result<FlatDocument>
+{
+    if (buffer.substr(0U, kUtf8ByteOrderMark.size()) == kUtf8ByteOrderMark)
+    {
+        buffer.remove_prefix(kUtf8ByteOrderMark.size());
+    }
+    const BufferStatistics statistics = AnalyzeBuffer(buffer);
+    if (statistics.max_values > std::numeric_limits<std::uint32_t>::max())
+    {
+        return MakeUnexpected(Error::kParsingError, "Document too large");
+    }
+
+    // One upstream allocation for the nodes and, as decoded strings are never longer than the buffer, all strings.
+    const std::size_t node_bytes{statistics.max_values * sizeof(FlatNode)};
+    const std::size_t arena_size{node_bytes + (statistics.has_escapes ? buffer.size() : 0U)};
+    auto arena = std::make_unique<score::cpp::pmr::monotonic_buffer_resource>(arena_size, upstream);
+    auto* const nodes = static_cast<FlatNode*>(arena->allocate(node_bytes, alignof(FlatNode)));
+
+    FlatBuilder builder{buffer, nodes, *arena, upstream};
+    const auto root = builder.Build(statistics.max_values);
+    if (!root.has_value())
+    {
+        return score::MakeUnexpected<FlatDocument>(root.error());
+    }
+    return FlatDocument{std::move(source), std::move(arena), root.value(), builder.Size()};
+}
+
+}  // namespace json
+}  // namespace score
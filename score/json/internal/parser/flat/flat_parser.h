@@ -0,0 +1,64 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_FLAT_FLAT_PARSER_H
+#define SCORE_LIB_JSON_INTERNAL_PARSER_FLAT_FLAT_PARSER_H
+
+#include "score/json/internal/model/flat_document.h"
+#include "score/result/result.h"
+
+#include <score/memory_resource.hpp>
+
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+
+/// \brief In-situ JSON parser that creates a FlatDocument
+///
+/// \details The parser works directly on the buffer instead of a stream, so keys and strings without escape sequences
+/// are referenced instead of copied. A first pass over the buffer computes an upper bound of the number of values,
+/// which allows allocating the arena of the document at once. Nesting is handled without recursion.
+///
+/// Numbers are stored as the smallest fitting unsigned, then signed integer type, otherwise as double, like the
+/// tree based parsers do.
+class FlatParser final
+{
+  public:
+    /// \brief Parses a buffer that has to outlive the returned document
+    /// \param buffer The string_view containing JSON
+    /// \param upstream Memory resource the arena of the document is allocated from
+    /// \return The document, kParsingError on invalid JSON
+    static auto FromBuffer(const std::string_view buffer,
+                           score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource())
+        -> score::Result<FlatDocument>;
+
+    /// \brief Reads the file into memory owned by the returned document and parses it
+    /// \param file_path The JSON file to read
+    /// \param upstream Memory resource the file content and the arena of the document are allocated from
+    /// \return The document, kInvalidFilePath if the file cannot be read, kParsingError on invalid JSON
+    static auto FromFile(const std::string_view file_path,
+                         score::cpp::pmr::memory_resource* const upstream = score::cpp::pmr::get_default_resource())
+        -> score::Result<FlatDocument>;
+
+  private:
+    static auto Parse(const std::string_view buffer,
+                      score::cpp::pmr::vector<char> source,
+                      score::cpp::pmr::memory_resource* const upstream) -> score::Result<FlatDocument>;
+};
+
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_FLAT_FLAT_PARSER_H
@@ -0,0 +1,321 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/json/internal/parser/flat/flat_parser.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace json
+{
+namespace
+{
+
+class CountingMemoryResource : public score::cpp::pmr::memory_resource
+{
+  public:
+    std::size_t allocations{0U};
+
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        ++allocations;
+        return score::cpp::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment) override
+    {
+        score::cpp::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const score::cpp::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+FlatObject RootObject(const FlatDocument& document)
+{
+    const auto object = document.Root().As<FlatObject>();
+    EXPECT_TRUE(object.has_value());
+    return object.value();
+}
+
+TEST(FlatParserTest, ParsesScalars)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing all JSON scalar types into a flat document, cf. RFC-8259 section 3");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    // Given a JSON object containing all scalar types
+    const std::string buffer{R"({"null": null, "true": true, "false": false, "number": 42, "string": "foo"})"};
+
+    // When parsing it
+    const auto document = FlatParser::FromBuffer(buffer);
+
+    // Then every member can be read with its type
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->Size(), 6U);
+    const auto root = RootObject(document.value());
+    EXPECT_EQ(root.size(), 5U);
+    EXPECT_TRUE(root.Find("null")->IsNull());
+    EXPECT_EQ(root.Get<bool>("true").value(), true);
+    EXPECT_EQ(root.Get<bool>("false").value(), false);
+    EXPECT_EQ(root.Get<std::uint32_t>("number").value(), 42U);
+    EXPECT_EQ(root.Get<std::string_view>("string").value(), "foo");
+}
+
+TEST(FlatParserTest, ScalarRootAndSurroundingWhitespace)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing a scalar as top-level value, cf. RFC-8259 section 2");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-value-analysis");
+
+    const auto document = FlatParser::FromBuffer("\xEF\xBB\xBF \n\t\"text\"\r\n ");
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->Root().As<std::string_view>().value(), "text");
+    EXPECT_EQ(document->Size(), 1U);
+}
+
+TEST(FlatParserTest, NumbersUseSmallestFittingType)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Numbers are stored like the tree based parsers store them");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-value-analysis");
+
+    const std::string buffer{
+        R"({"u8": 255, "u16": 65535, "u64": 18446744073709551615, "i8": -128, "i64": -9223372036854775808,
+            "overflow": 18446744073709551616, "double": -1.5e2, "zero": 0, "fraction": 0.25})"};
+    const auto document = FlatParser::FromBuffer(buffer);
+    ASSERT_TRUE(document.has_value());
+    const auto root = RootObject(document.value());
+
+    EXPECT_EQ(root.Get<std::uint8_t>("u8").value(), 255U);
+    EXPECT_FALSE(root.Get<std::int8_t>("u8").has_value());
+    EXPECT_EQ(root.Get<std::uint16_t>("u16").value(), 65535U);
+    EXPECT_EQ(root.Get<std::uint64_t>("u64").value(), 18446744073709551615U);
+    EXPECT_EQ(root.Get<std::int8_t>("i8").value(), -128);
+    EXPECT_EQ(root.Get<std::int64_t>("i64").value(), std::numeric_limits<std::int64_t>::min());
+    EXPECT_DOUBLE_EQ(root.Get<double>("overflow").value(), 18446744073709551616.0);
+    EXPECT_DOUBLE_EQ(root.Get<double>("double").value(), -150.0);
+    EXPECT_EQ(root.Get<std::int32_t>("zero").value(), 0);
+    EXPECT_DOUBLE_EQ(root.Get<double>("fraction").value(), 0.25);
+}
+
+TEST(FlatParserTest, ParsesNestedContainers)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing nested arrays and objects, cf. RFC-8259 sections 4 and 5");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const std::string buffer{R"({"list": [1, [], {}, [2, 3], {"a": "b"}], "object": {"inner": {"value": true}}})"};
+    const auto document = FlatParser::FromBuffer(buffer);
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->Size(), 13U);
+    const auto root = RootObject(document.value());
+
+    const auto list = root.Get<FlatList>("list");
+    ASSERT_TRUE(list.has_value());
+    ASSERT_EQ(list->size(), 5U);
+    EXPECT_EQ(list.value()[0].As<int>().value(), 1);
+    EXPECT_TRUE(list.value()[1].As<FlatList>()->empty());
+    EXPECT_TRUE(list.value()[2].As<FlatObject>()->empty());
+    const auto nested = list.value()[3].As<FlatList>();
+    ASSERT_TRUE(nested.has_value());
+    std::vector<int> values{};
+    for (const auto value : nested.value())
+    {
+        values.push_back(value.As<int>().value());
+    }
+    EXPECT_EQ(values, (std::vector<int>{2, 3}));
+    EXPECT_EQ(list.value()[4].As<FlatObject>()->Get<std::string_view>("a").value(), "b");
+
+    const auto inner = root.Get<FlatObject>("object")->Get<FlatObject>("inner");
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_EQ(inner->Get<bool>("value").value(), true);
+}
+
+TEST(FlatParserTest, ObjectMembersAreSortedAndFirstDuplicateWins)
+{
+    RecordProperty("Verifies", "::score::json::FlatObject::Find");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Object lookup on sorted members, cf. RFC-8259 section 4");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const std::string buffer{R"({"d": 4, "b": 2, "a": 1, "e": 5, "b": 6, "c": 3})"};
+    const auto document = FlatParser::FromBuffer(buffer);
+    ASSERT_TRUE(document.has_value());
+    const auto root = RootObject(document.value());
+
+    std::string keys{};
+    for (const auto& member : root)
+    {
+        keys += member.first;
+    }
+    EXPECT_EQ(keys, "abbcde");
+    EXPECT_EQ(root.Get<int>("b").value(), 2);
+    EXPECT_EQ(root.Get<int>("e").value(), 5);
+
+    const auto missing = root.Find("f");
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), Error::kKeyNotFound);
+    EXPECT_EQ(root.Get<std::string_view>("a").error(), Error::kWrongType);
+}
+
+TEST(FlatParserTest, UnescapedStringsReferToTheBuffer)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Keys and strings without escape sequences are not copied");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const std::string buffer{R"({"key": "value"})"};
+    const auto document = FlatParser::FromBuffer(buffer);
+    ASSERT_TRUE(document.has_value());
+    const auto member = *RootObject(document.value()).begin();
+    EXPECT_EQ(member.first.data(), buffer.data() + 2);
+    EXPECT_EQ(member.second.As<std::string_view>()->data(), buffer.data() + 9);
+}
+
+TEST(FlatParserTest, DecodesEscapeSequences)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Decoding escape sequences, cf. RFC-8259 section 7");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const std::string buffer{R"({"k\"ey": "\"\\\/\b\f\n\r\t", "unicode": "\u0041\u00e4\u20AC\ud83d\ude00"})"};
+    const auto document = FlatParser::FromBuffer(buffer);
+    ASSERT_TRUE(document.has_value());
+    const auto root = RootObject(document.value());
+    EXPECT_EQ(root.Get<std::string_view>("k\"ey").value(), "\"\\/\b\f\n\r\t");
+    EXPECT_EQ(root.Get<std::string_view>("unicode").value(), "A\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80");
+}
+
+TEST(FlatParserTest, RejectsInvalidJson)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Invalid JSON causes a parsing error, cf. RFC-8259 section 9");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "error-guessing");
+
+    const std::vector<std::string> invalid_buffers{
+        "",
+        "   ",
+        "{",
+        "[1, 2",
+        "[1, 2}",
+        "{\"a\": 1]",
+        "{\"a\" 1}",
+        "{\"a\": }",
+        "{1: 2}",
+        "[1,]",
+        "[1 2]",
+        "{} {}",
+        "tru",
+        "nul",
+        "01",
+        "-",
+        "1.",
+        "1e",
+        ".5",
+        "1e999",
+        "\"unterminated",
+        "\"escape\\",
+        "\"\\x\"",
+        "\"\\u12G4\"",
+        "\"\\ud83d\"",
+        "\"\\ude00\"",
+        "\"tab\tin string\"",
+    };
+    for (const auto& buffer : invalid_buffers)
+    {
+        const auto document = FlatParser::FromBuffer(buffer);
+        ASSERT_FALSE(document.has_value()) << buffer;
+        EXPECT_EQ(document.error(), Error::kParsingError) << buffer;
+    }
+}
+
+TEST(FlatParserTest, FromFile)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromFile");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing a flat document from a file path, cf. RFC-8259 section 9");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const std::string file_path = std::tmpnam(nullptr);
+    {
+        std::ofstream file(file_path);
+        file << R"({"num": 1, "string": "foo"})";
+    }
+
+    const auto document = FlatParser::FromFile(file_path);
+    std::remove(file_path.c_str());
+    ASSERT_TRUE(document.has_value());
+    const auto root = RootObject(document.value());
+    EXPECT_EQ(root.Get<int>("num").value(), 1);
+    EXPECT_EQ(root.Get<std::string_view>("string").value(), "foo");
+
+    const auto missing = FlatParser::FromFile(file_path);
+    ASSERT_FALSE(missing.has_value());
+    EXPECT_EQ(missing.error(), Error::kInvalidFilePath);
+}
+
+TEST(FlatParserTest, AllocatesArenaOnce)
+{
+    RecordProperty("Verifies", "::score::json::FlatParser::FromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "All values of a document are stored in a single arena allocation");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    // Given a document with many values and escaped strings
+    std::string buffer{"{"};
+    for (int i = 0; i < 100; ++i)
+    {
+        buffer += "\"key\\n" + std::to_string(i) + "\": [" + std::to_string(i) + ", {\"a\": \"b\"}],";
+    }
+    buffer.back() = '}';
+    CountingMemoryResource resource{};
+
+    // When parsing it from the memory resource
+    const auto document = FlatParser::FromBuffer(buffer, &resource);
+
+    // Then one allocation holds the arena, the others are the temporary stacks of the parser
+    ASSERT_TRUE(document.has_value());
+    EXPECT_EQ(document->Size(), 401U);
+    EXPECT_LE(resource.allocations, 3U);
+    EXPECT_EQ(RootObject(document.value()).Get<FlatList>("key\n42")->size(), 2U);
+}
+
+}  // namespace
+}  // namespace json
+}  // namespace score
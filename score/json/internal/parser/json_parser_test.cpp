@@ -137,6 +137,53 @@ TEST(JsonParserTest, FromFileParseError)
     EXPECT_EQ(result.error(), score::json::Error::kParsingError);
 }
 
+TEST(JsonParserTest, FlatDocumentFromBuffer)
+{
+    RecordProperty("Verifies", "::score::json::JsonParser::FlatDocumentFromBuffer");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing json object into a flat document using FlatDocumentFromBuffer()");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+    RecordProperty("Priority", "3");
+
+    json::JsonParser json_parser{};
+    const auto result = json_parser.FlatDocumentFromBuffer(JSON_INPUT);
+    ASSERT_TRUE(result.has_value());
+    const auto root = result.value().Root().As<FlatObject>();
+    ASSERT_TRUE(root.has_value());
+    EXPECT_EQ(root.value().Get<int>("num").value(), 1);
+    EXPECT_EQ(root.value().Get<std::string_view>("string").value(), "foo");
+
+    const auto error = json_parser.FlatDocumentFromBuffer(JSON_ERROR_INPUT);
+    ASSERT_FALSE(error.has_value());
+    EXPECT_EQ(error.error(), score::json::Error::kParsingError);
+}
+
+TEST(JsonParserTest, FlatDocumentFromFile)
+{
+    RecordProperty("Verifies", "::score::json::JsonParser::FlatDocumentFromFile");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Parsing json object from file path into a flat document");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+    RecordProperty("Priority", "3");
+
+    const std::string file_path = std::tmpnam(nullptr);
+    std::ofstream file(file_path);
+    if (file.is_open())
+    {
+        file << JSON_INPUT;
+        file.close();
+    }
+
+    json::JsonParser json_parser{};
+    const auto result = json_parser.FlatDocumentFromFile(file_path);
+    ASSERT_TRUE(result.has_value());
+    const auto root = result.value().Root().As<FlatObject>();
+    ASSERT_TRUE(root.has_value());
+    EXPECT_EQ(root.value().Get<int>("num").value(), 1);
+}
+
 }  // namespace
 }  // namespace json
 }  // namespace score
@@ -0,0 +1,119 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Contains tests concerning the BlockScanner class.
+ *
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/block_scanner.h"
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace unit_test
+{
+
+using internal::BlockScanner;
+
+/*!
+ * Test that Classify sets one bit per character of each class.
+ *
+ * - Create a block starting with a whitespace, a quote and a backslash, followed by letters.
+ * - Assert that the bits of each class are set at the positions of its characters.
+ * - Assert that every structural character is recognized, also at the last position of a block.
+ * \trace           score::json::vajson::internal::BlockScanner::Classify
+ */
+TEST(UT__BlockScanner, Classify)
+{
+    std::string block{"\t\"\\"};
+    block.resize(BlockScanner::kBlockSize, 'a');
+
+    const internal::BlockClassification classification{BlockScanner::Classify(block.data())};
+    EXPECT_EQ(classification.whitespace, 0b001U);
+    EXPECT_EQ(classification.quotes, 0b010U);
+    EXPECT_EQ(classification.escapes, 0b100U);
+    EXPECT_EQ(classification.structurals, 0U);
+
+    for (const char structural : std::string_view{"{}[]:,"})
+    {
+        block.back() = structural;
+        EXPECT_EQ(BlockScanner::Classify(block.data()).structurals,
+                  std::uint64_t{1U} << (BlockScanner::kBlockSize - 1U));
+    }
+}
+
+/*!
+ * Test that CountWhitespace finds the first character that is no whitespace at every position.
+ *
+ * - Assert that the position is found inside full blocks and in the remainder.
+ * - Assert that the size is returned if there is only whitespace.
+ * \trace           score::json::vajson::internal::BlockScanner::CountWhitespace
+ */
+TEST(UT__BlockScanner, CountWhitespace)
+{
+    const std::size_t size{(3U * BlockScanner::kBlockSize) + 3U};
+    for (std::size_t position{0U}; position < size; ++position)
+    {
+        std::string input(size, ' ');
+        for (std::size_t i{0U}; i < position; ++i)
+        {
+            input[i] = " \n\r\t"[i % 4U];
+        }
+        input[position] = '1';
+
+        EXPECT_EQ(BlockScanner::CountWhitespace(input), position);
+    }
+
+    EXPECT_EQ(BlockScanner::CountWhitespace(std::string(size, '\n')), size);
+    EXPECT_EQ(BlockScanner::CountWhitespace(""), 0U);
+}
+
+/*!
+ * Test that FindFirstOf finds the first delimiter at every position.
+ *
+ * - Assert that the position is found inside full blocks and in the remainder.
+ * - Assert that the size is returned if there is no delimiter.
+ * - Assert that characters with the most significant bit set are not mistaken for delimiters.
+ * \trace           score::json::vajson::internal::BlockScanner::FindFirstOf
+ */
+TEST(UT__BlockScanner, FindFirstOf)
+{
+    const std::size_t size{(3U * BlockScanner::kBlockSize) + 3U};
+    for (std::size_t position{0U}; position < size; ++position)
+    {
+        std::string input(size, '\xA2');
+        input[position] = '\\';
+        input.back() = '"';
+
+        EXPECT_EQ(BlockScanner::FindFirstOf(input, R"("\)"), position);
+    }
+
+    EXPECT_EQ(BlockScanner::FindFirstOf(std::string(size, 'a'), R"("\)"), size);
+    EXPECT_EQ(BlockScanner::FindFirstOf("", R"("\)"), 0U);
+}
+
+}  // namespace unit_test
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
@@ -17,6 +17,7 @@
 /**********************************************************************************************************************
  *  INCLUDES
  *********************************************************************************************************************/
+#include <cstddef>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -47,6 +48,18 @@ struct TestStream
 
     explicit TestStream(const std::string& input) : iss{input}, data{iss}, ops{data} {}
 };
+
+/// \brief Helper to create a JsonData + JsonOps pair whose document is held in memory.
+struct TestBuffer
+{
+    JsonData data;
+    internal::JsonOps ops;
+
+    explicit TestBuffer(const std::string& input)
+        : data{JsonData::FromBuffer(std::string_view{input}).value()}, ops{data}
+    {
+    }
+};
 }  // namespace
 
 /*!
@@ -244,6 +257,85 @@ TEST(UT__JsonOps, ReadUntil)
     ASSERT_EQ(result.value().Value(), ':');
 }
 
+/*!
+ * Test that SkipWhitespace skips whitespace characters of a document held in memory.
+ *
+ * - Assert that whitespace spanning multiple blocks is skipped and the next character can be taken.
+ * - Assert that an EOF after whitespace characters is recognized.
+ * \trace           score::json::vajson::internal::JsonOps::SkipWhitespace
+ */
+TEST(UT__JsonOps, SkipWhitespace__InMemory)
+{
+    {
+        TestBuffer tb{std::string(100U, ' ') + "\t\n\r a"};
+        ASSERT_TRUE(tb.ops.SkipWhitespace());
+        ASSERT_EQ(tb.ops.Take(), 'a');
+    }
+    {
+        TestBuffer tb{std::string(100U, '\n')};
+        ASSERT_FALSE(tb.ops.SkipWhitespace());
+        ASSERT_FALSE(tb.ops.SkipWhitespace());
+    }
+}
+
+/*!
+ * Test that ReadUntil reads until the specified delimiter of a document held in memory.
+ *
+ * - Assert that the callback is invoked once with all characters in front of the delimiter.
+ * - Assert that the delimiter is returned and not consumed.
+ * - Assert that the callback is not invoked if the delimiter is the next character.
+ * \trace           score::json::vajson::internal::JsonOps::ReadUntil
+ */
+TEST(UT__JsonOps, ReadUntil__InMemory)
+{
+    const std::string content(100U, 'x');
+    TestBuffer tb{content + "\\\""};
+
+    std::size_t count{0U};
+    const auto result = tb.ops.ReadUntil(R"("\)", [&content, &count](std::string_view view) noexcept {
+        ++count;
+        EXPECT_EQ(view, content);
+    });
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result.value().Value(), '\\');
+    ASSERT_EQ(count, 1U);
+    ASSERT_EQ(tb.ops.Tell().value(), content.size());
+
+    ASSERT_EQ(tb.ops.Take(), '\\');
+    const auto next = tb.ops.ReadUntil(R"("\)", [](std::string_view) noexcept {
+        FAIL();
+    });
+    ASSERT_TRUE(next.has_value());
+    ASSERT_EQ(next.value().Value(), '"');
+}
+
+/*!
+ * Test that ReadUntil detects the EOF of a document held in memory.
+ *
+ * - Assert that the callback gets all remaining characters and EOF is returned.
+ * - Assert that the document can be read again after restoring a snapshot taken before.
+ * \trace           score::json::vajson::internal::JsonOps::ReadUntil
+ */
+TEST(UT__JsonOps, ReadUntil__InMemoryEof)
+{
+    const std::string content(100U, '1');
+    TestBuffer tb{content};
+
+    for (std::size_t i{0U}; i < 2U; ++i)
+    {
+        ASSERT_TRUE(tb.data.Snap().has_value());
+        std::string read{};
+        const auto result = tb.ops.ReadUntil(",}]", [&read](std::string_view view) noexcept {
+            read.append(view);
+        });
+        ASSERT_TRUE(result.has_value());
+        ASSERT_TRUE(result.value().EofFound());
+        ASSERT_EQ(read, content);
+
+        ASSERT_TRUE(tb.data.Restore().has_value());
+    }
+}
+
 }  // namespace unit_test
 }  // namespace vajson
 }  // namespace json
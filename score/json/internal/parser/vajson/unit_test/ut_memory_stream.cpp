@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Contains tests concerning the MemoryStream class.
+ *
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <ios>
+#include <string>
+#include <string_view>
+
+#include "gtest/gtest.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/memory_stream.h"
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace unit_test
+{
+
+/*!
+ * Test that the characters can be read through the stream and accessed directly.
+ *
+ * - Assert that Remaining follows the characters read through the stream.
+ * - Assert that Advance moves the position of the stream.
+ * \trace           score::json::vajson::internal::MemoryStreamBuffer::Remaining
+ * \trace           score::json::vajson::internal::MemoryStreamBuffer::Advance
+ */
+TEST(UT__MemoryStream, ReadAndAdvance)
+{
+    internal::MemoryStream stream{"abcd"};
+    internal::MemoryStreamBuffer& buffer{stream.GetBuffer()};
+
+    ASSERT_EQ(stream.get(), 'a');
+    ASSERT_EQ(buffer.Remaining(), std::string_view{"bcd"});
+
+    buffer.Advance(2U);
+    ASSERT_EQ(stream.tellg(), std::streampos{3});
+    ASSERT_EQ(stream.get(), 'd');
+    ASSERT_TRUE(buffer.Remaining().empty());
+    ASSERT_EQ(stream.peek(), std::char_traits<char>::eof());
+}
+
+/*!
+ * Test that the stream can be repositioned inside its bounds only.
+ *
+ * - Assert that seeking relative to the beginning, the current position and the end works.
+ * - Assert that seeking outside of the characters fails and leaves the position unchanged.
+ * \trace           score::json::vajson::internal::MemoryStreamBuffer::seekoff
+ * \trace           score::json::vajson::internal::MemoryStreamBuffer::seekpos
+ */
+TEST(UT__MemoryStream, Seek)
+{
+    internal::MemoryStream stream{"abcd"};
+    internal::MemoryStreamBuffer& buffer{stream.GetBuffer()};
+
+    ASSERT_TRUE(stream.seekg(2, std::ios::beg));
+    ASSERT_EQ(buffer.Remaining(), std::string_view{"cd"});
+    ASSERT_TRUE(stream.seekg(-1, std::ios::cur));
+    ASSERT_EQ(buffer.Remaining(), std::string_view{"bcd"});
+    ASSERT_TRUE(stream.seekg(0, std::ios::end));
+    ASSERT_TRUE(buffer.Remaining().empty());
+    ASSERT_TRUE(stream.seekg(std::streampos{0}));
+    ASSERT_EQ(buffer.Remaining(), std::string_view{"abcd"});
+
+    ASSERT_FALSE(stream.seekg(5, std::ios::beg));
+    stream.clear();
+    ASSERT_FALSE(stream.seekg(-1, std::ios::beg));
+    stream.clear();
+    ASSERT_EQ(buffer.Remaining(), std::string_view{"abcd"});
+}
+
+}  // namespace unit_test
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,165 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  block scanner
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/block_scanner.h"
+#include "score/bit.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+namespace
+{
+
+using Block = score::cpp::simd::vec<std::uint8_t>;
+using BlockMask = Block::mask_type;
+
+/*!
+ /// \brief           Loads kBlockSize characters into a register
+ /// \param[in]       block                  Pointer to the first character.
+ /// \return          The loaded block.
+ *
+ /// \context         ANY
+ /// \pre             [block, block + kBlockSize) is a valid range.
+ /// \threadsafe      TRUE
+ /// \reentrant       TRUE
+ */
+inline auto Load(const char* const block) noexcept -> Block
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) char and std::uint8_t may alias each other
+    const auto* const bytes = reinterpret_cast<const std::uint8_t*>(block);
+    return Block{score::cpp::span<const std::uint8_t, Block::size()>{bytes, Block::size()}};
+}
+
+/*!
+ /// \brief           Returns for each character of the block whether it is one of the given characters
+ /// \param[in]       block                  The loaded block.
+ /// \param[in]       characters                  The characters to compare with.
+ /// \return          Mask of the matching characters.
+ *
+ /// \context         ANY
+ /// \pre             -
+ /// \threadsafe      TRUE
+ /// \reentrant       TRUE
+ */
+inline auto AnyOf(const Block& block, const std::string_view characters) noexcept -> BlockMask
+{
+    BlockMask result{false};
+    for (const char character : characters)
+    {
+        result = result || (block == Block{static_cast<std::uint8_t>(character)});
+    }
+    return result;
+}
+
+/*!
+ /// \brief           Returns whether the character is a JSON whitespace character
+ /// \param[in]       character                  The character to check.
+ /// \return          True for space, newline, carriage return and tab.
+ *
+ /// \context         ANY
+ /// \pre             -
+ /// \threadsafe      TRUE
+ /// \reentrant       TRUE
+ */
+inline auto IsWhitespace(const char character) noexcept -> bool
+{
+    return (character == ' ') || (character == '\n') || (character == '\r') || (character == '\t');
+}
+
+}  // namespace
+
+static_assert(BlockScanner::kBlockSize <= 64U, "Classification of a block has to fit into 64 bit");
+
+/// \brief           Mask of the bits that correspond to characters of a block
+constexpr std::uint64_t kBlockBits{(~std::uint64_t{0U}) >> (64U - BlockScanner::kBlockSize)};
+
+/*!
+ * \internal
+ * - Load the block.
+ * - Compare it against every character of each class and collect the results as bit masks.
+ * \endinternal
+ */
+auto BlockScanner::Classify(const char* const block) noexcept -> BlockClassification
+{
+    const Block characters{Load(block)};
+    return BlockClassification{AnyOf(characters, " \n\r\t").to_ullong(),
+                               (characters == Block{std::uint8_t{'"'}}).to_ullong(),
+                               (characters == Block{std::uint8_t{'\\'}}).to_ullong(),
+                               AnyOf(characters, "{}[]:,").to_ullong()};
+}
+
+/*!
+ * \internal
+ * - As long as a whole block is left:
+ *   - Classify the block.
+ *   - If the block contains a character that is no whitespace, return its index.
+ * - Check the remaining characters one by one.
+ * \endinternal
+ */
+auto BlockScanner::CountWhitespace(const std::string_view view) noexcept -> std::size_t
+{
+    std::size_t index{0U};
+    for (; (view.size() - index) >= kBlockSize; index += kBlockSize)
+    {
+        const std::uint64_t others{(~Classify(&view[index]).whitespace) & kBlockBits};
+        if (others != 0U)
+        {
+            return index + static_cast<std::size_t>(score::cpp::countr_zero(others));
+        }
+    }
+
+    const auto rest = std::find_if_not(view.begin() + index, view.end(), IsWhitespace);
+    return static_cast<std::size_t>(rest - view.begin());
+}
+
+/*!
+ * \internal
+ * - As long as a whole block is left:
+ *   - If the block contains a delimiter character, return its index.
+ * - Check the remaining characters one by one.
+ * \endinternal
+ */
+auto BlockScanner::FindFirstOf(const std::string_view view, const std::string_view delimiter) noexcept -> std::size_t
+{
+    std::size_t index{0U};
+    for (; (view.size() - index) >= kBlockSize; index += kBlockSize)
+    {
+        const BlockMask mask{AnyOf(Load(&view[index]), delimiter)};
+        if (any_of(mask))
+        {
+            return index + static_cast<std::size_t>(find_first_set(mask));
+        }
+    }
+
+    return std::min(view.find_first_of(delimiter, index), view.size());
+}
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Classification of JSON input in blocks of characters.
+ *
+ *      \details  Classifies as many characters as fit into a SIMD register (16 with SSE4.2 and NEON, 8 with the
+ *                scalar fallback) at once into whitespace, quotes, escapes and structural characters. JsonOps uses
+ *                the scanner to skip whitespace and to find the end of strings and numbers without looking at every
+ *                character separately.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_BLOCK_SCANNER_H_
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_BLOCK_SCANNER_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/simd.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+
+/// \brief           Bit masks of the character classes of one block, bit i corresponds to the ith character
+struct BlockClassification
+{
+    /// \brief           Space, newline, carriage return and tab
+    std::uint64_t whitespace;
+    /// \brief           Double quotes
+    std::uint64_t quotes;
+    /// \brief           Backslashes
+    std::uint64_t escapes;
+    /// \brief           Curly and square brackets, colons and commas
+    std::uint64_t structurals;
+};
+
+/// \brief           Scans character sequences block by block
+class BlockScanner final
+{
+  public:
+    /// \brief           Number of characters classified at once
+    static constexpr std::size_t kBlockSize{score::cpp::simd::vec<std::uint8_t>::size()};
+
+    /// \brief           Classifies a block of characters
+    /// \param[in]       block
+    ///                  Pointer to kBlockSize characters.
+    /// \return          The character classes of the block.
+    /// \context         ANY
+    /// \pre             [block, block + kBlockSize) is a valid range.
+    /// \threadsafe      TRUE
+    /// \reentrant       TRUE
+    static auto Classify(const char* block) noexcept -> BlockClassification;
+
+    /// \brief           Counts the whitespace characters at the beginning of the view
+    /// \param[in]       view
+    ///                  The characters to scan.
+    /// \return          Index of the first character that is no whitespace, or the size of the view.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE
+    /// \reentrant       TRUE
+    static auto CountWhitespace(std::string_view view) noexcept -> std::size_t;
+
+    /// \brief           Finds the first character that is contained in the delimiter set
+    /// \details         Each delimiter character is compared against a whole block at once.
+    /// \param[in]       view
+    ///                  The characters to scan.
+    /// \param[in]       delimiter
+    ///                  The set of characters to search for.
+    /// \return          Index of the first delimiter character, or the size of the view.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE
+    /// \reentrant       TRUE
+    static auto FindFirstOf(std::string_view view, std::string_view delimiter) noexcept -> std::size_t;
+};
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_BLOCK_SCANNER_H_
@@ -25,6 +25,8 @@
 #include <utility>
 #include <vector>
 
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/block_scanner.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/memory_stream.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/json_data.h"
 namespace score
 {
@@ -203,7 +205,9 @@ auto JsonOps::RewindIf(const bool condition, const std::size_t num) noexcept ->
 
 /*!
  * \internal
- * - Skip all white space characters.
+ * - If the document is held in memory:
+ *   - Skip all white space characters block by block.
+ * - Skip all (remaining) white space characters and detect EOF.
  * \endinternal
  */
 auto JsonOps::SkipWhitespace() noexcept -> bool
@@ -213,6 +217,12 @@ auto JsonOps::SkipWhitespace() noexcept -> bool
     bool done{false};
     bool result{false};
 
+    MemoryStreamBuffer* const memory{this->GetMemoryBuffer()};
+    if (memory != nullptr)
+    {
+        memory->Advance(BlockScanner::CountWhitespace(memory->Remaining()));
+    }
+
     while (!done)
     {
         std::int64_t ch = stream.peek();
@@ -324,6 +334,10 @@ auto JsonOps::ReadExactly(const std::uint64_t num_to_read,
 
 /*!
  * \internal
+ * - If the document is held in memory:
+ *   - Search the delimiter block by block.
+ *   - Trigger the given action on the characters in front of it without copying them.
+ *   - If the delimiter was found, return it.
  * - As long as there are new elements in the stream and the delimiter is not found:
  *   - Trigger the given action on the returned span.
  * - Otherwise:
@@ -339,6 +353,25 @@ auto JsonOps::ReadUntil(const std::string_view delimiter,
     bool done{false};
     Result<OptChar> result{OptChar{-1}};
 
+    MemoryStreamBuffer* const memory{this->GetMemoryBuffer()};
+    if (memory != nullptr)
+    {
+        const std::string_view remaining{memory->Remaining()};
+        const std::size_t length{BlockScanner::FindFirstOf(remaining, delimiter)};
+        if (length > 0U)
+        {
+            callback(remaining.substr(0U, length));
+        }
+        memory->Advance(length);
+
+        // Without a delimiter, the loop below only detects EOF.
+        if (length < remaining.size())
+        {
+            result = Result<OptChar>{OptChar{std::char_traits<char>::to_int_type(remaining[length])}};
+            done = true;
+        }
+    }
+
     while (!done)
     {
         const std::int64_t ch{stream.peek()};
@@ -396,6 +429,22 @@ auto JsonOps::GetJsonDocument() const& noexcept -> const JsonData&
     return this->data_.get();
 }
 
+/*!
+ * \internal
+ * - The stream state is only maintained by the stream functions. Once it is no longer good, leave all handling to them.
+ * \endinternal
+ */
+auto JsonOps::GetMemoryBuffer() & noexcept -> MemoryStreamBuffer*
+{
+    MemoryStreamBuffer* memory{this->GetJsonDocument().GetMemoryBuffer()};
+    if (!this->GetStream().good())
+    {
+        memory = nullptr;
+    }
+
+    return memory;
+}
+
 auto JsonOps::GetStream() & noexcept -> std::istream&
 {
 
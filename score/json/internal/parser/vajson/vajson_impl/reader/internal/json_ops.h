@@ -40,6 +40,8 @@ namespace vajson
 {
 namespace internal
 {
+class MemoryStreamBuffer;
+
 /// \brief           Contains either the character value or an EOF value
 class OptChar
 {
@@ -286,6 +288,14 @@ class JsonOps final
     /// \reentrant       FALSE
     auto RewindIf(bool condition, std::size_t num) noexcept -> Result<void>;
 
+    /// \brief           Get direct access to the characters of a document held in memory
+    /// \return          The buffer of the document, or nullptr if the document is not held in memory or the stream is
+    ///                  not in a good state.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE, for different this pointer
+    auto GetMemoryBuffer() & noexcept -> MemoryStreamBuffer*;
+
     /// \brief           Get direct access to the input stream
     /// \return          Reference to the input stream.
     /// \context         ANY
@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  memory stream
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/memory_stream.h"
+#include <utility>
+
+#include "score/json/internal/parser/vajson/vajson_impl/util/json_error_domain.h"
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+
+/*!
+ * \internal
+ * - Store the characters.
+ * - Let the get area span all of them.
+ * \endinternal
+ */
+MemoryStreamBuffer::MemoryStreamBuffer(std::string content) noexcept : std::streambuf{}, content_{std::move(content)}
+{
+    char* const begin{this->content_.data()};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) end of the owned characters
+    this->setg(begin, begin, begin + this->content_.size());
+}
+
+auto MemoryStreamBuffer::Remaining() const noexcept -> std::string_view
+{
+    return std::string_view{this->gptr(), static_cast<std::size_t>(this->egptr() - this->gptr())};
+}
+
+void MemoryStreamBuffer::Advance(const std::size_t count) noexcept
+{
+    AssertCondition(count <= this->Remaining().size(), "MemoryStreamBuffer::Advance: Cannot advance past the end.");
+    // gbump() takes an int, setg() works for buffers of any size.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+    this->setg(this->eback(), this->gptr() + count, this->egptr());
+}
+
+/*!
+ * \internal
+ * - Only the input sequence can be repositioned.
+ * - Compute the new position from the requested base.
+ * - If the new position is inside the buffer (including the end):
+ *   - Move the cursor and return the new position.
+ * - Otherwise:
+ *   - Return an invalid position and leave the cursor unchanged.
+ * \endinternal
+ */
+auto MemoryStreamBuffer::seekoff(const off_type offset,
+                                 const std::ios_base::seekdir direction,
+                                 const std::ios_base::openmode which) noexcept -> pos_type
+{
+    pos_type result{off_type{-1}};
+    if ((which & std::ios_base::in) != 0)
+    {
+        const off_type size{this->egptr() - this->eback()};
+        off_type base{0};
+        if (direction == std::ios_base::cur)
+        {
+            base = this->gptr() - this->eback();
+        }
+        else if (direction == std::ios_base::end)
+        {
+            base = size;
+        }
+        else
+        {
+            // std::ios_base::beg, the base is the beginning of the buffer
+        }
+
+        const off_type position{base + offset};
+        if ((position >= 0) && (position <= size))
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+            this->setg(this->eback(), this->eback() + position, this->egptr());
+            result = pos_type{position};
+        }
+    }
+
+    return result;
+}
+
+auto MemoryStreamBuffer::seekpos(const pos_type position, const std::ios_base::openmode which) noexcept -> pos_type
+{
+    return this->seekoff(off_type{position}, std::ios_base::beg, which);
+}
+
+/*!
+ * \internal
+ * - Create the buffer from the characters.
+ * - Attach the buffer, which also resets the stream state.
+ * \endinternal
+ */
+MemoryStream::MemoryStream(std::string content) noexcept : std::istream{nullptr}, buffer_{std::move(content)}
+{
+    static_cast<void>(this->rdbuf(&this->buffer_));
+}
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
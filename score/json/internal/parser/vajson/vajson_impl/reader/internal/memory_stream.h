@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+/*!        \file
+ *        \brief  Input stream over a buffer that is completely held in memory.
+ *
+ *      \details  In contrast to std::istringstream, the unread part of the buffer can be accessed as a contiguous
+ *                view. This allows JsonOps to scan multiple characters at once instead of peeking at each one.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MEMORY_STREAM_H_
+#define SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MEMORY_STREAM_H_
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace json
+{
+namespace vajson
+{
+namespace internal
+{
+
+/// \brief           Read-only stream buffer owning its characters
+class MemoryStreamBuffer final : public std::streambuf
+{
+  public:
+    /// \brief           Takes ownership of the passed characters and positions the cursor at the beginning
+    /// \param[in]       content
+    ///                  The characters to read from.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    explicit MemoryStreamBuffer(std::string content) noexcept;
+
+    /// \brief           Deleted copy constructor, the get area refers to the owned characters
+    MemoryStreamBuffer(const MemoryStreamBuffer&) = delete;
+    /// \brief           Deleted move constructor, the get area refers to the owned characters
+    MemoryStreamBuffer(MemoryStreamBuffer&&) = delete;
+    /// \brief           Deleted copy assignment
+    auto operator=(const MemoryStreamBuffer&) -> MemoryStreamBuffer& = delete;
+    /// \brief           Deleted move assignment
+    auto operator=(MemoryStreamBuffer&&) -> MemoryStreamBuffer& = delete;
+
+    /// \brief           Default Destructor
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    ~MemoryStreamBuffer() noexcept override = default;
+
+    /// \brief           Returns the characters that have not been read yet
+    /// \return          View from the current position to the end of the buffer.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    auto Remaining() const noexcept -> std::string_view;
+
+    /// \brief           Moves the current position forward
+    /// \param[in]       count
+    ///                  The number of characters to skip.
+    /// \context         ANY
+    /// \pre             count is not greater than Remaining().size().
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    void Advance(std::size_t count) noexcept;
+
+  protected:
+    /// \brief           Changes the current position relative to the beginning, the current position or the end
+    auto seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) noexcept
+        -> pos_type override;
+
+    /// \brief           Changes the current position to an absolute position
+    auto seekpos(pos_type position, std::ios_base::openmode which) noexcept -> pos_type override;
+
+  private:
+    /// \brief           The owned characters, the get area points into it
+    std::string content_;
+};
+
+/// \brief           Input stream reading from a MemoryStreamBuffer
+class MemoryStream final : public std::istream
+{
+  public:
+    /// \brief           Creates the stream over the passed characters
+    /// \param[in]       content
+    ///                  The characters to read from.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    explicit MemoryStream(std::string content) noexcept;
+
+    /// \brief           Deleted copy constructor
+    MemoryStream(const MemoryStream&) = delete;
+    /// \brief           Deleted move constructor, the stream refers to its buffer member
+    MemoryStream(MemoryStream&&) = delete;
+    /// \brief           Deleted copy assignment
+    auto operator=(const MemoryStream&) -> MemoryStream& = delete;
+    /// \brief           Deleted move assignment
+    auto operator=(MemoryStream&&) -> MemoryStream& = delete;
+
+    /// \brief           Default Destructor
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    ~MemoryStream() noexcept override = default;
+
+    /// \brief           Direct access to the underlying buffer
+    /// \return          Reference to the buffer.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE, for different this pointer
+    auto GetBuffer() & noexcept -> MemoryStreamBuffer&
+    {
+        return this->buffer_;
+    }
+
+  private:
+    /// \brief           The buffer holding the characters
+    MemoryStreamBuffer buffer_;
+};
+
+}  // namespace internal
+}  // namespace vajson
+}  // namespace json
+}  // namespace score
+
+#endif  // SCORE_LIB_JSON_INTERNAL_PARSER_VAJSON_JSON_READER_INTERNAL_MEMORY_STREAM_H_
@@ -23,7 +23,6 @@
 #include <istream>
 #include <limits>
 #include <memory>
-#include <sstream>
 #include <utility>
 
 #include "score/filesystem/filestream/file_factory.h"
@@ -66,6 +65,20 @@ JsonData::JsonData(std::unique_ptr<std::istream> input_stream) noexcept : JsonDa
     this->owned_stream_ = std::move(input_stream);
 }
 
+/*!
+ * \internal
+ * - Initialize the stream buffer from the given input stream.
+ * - Remember the buffer of the stream for direct access.
+ * - Store the given input stream.
+ * \endinternal
+ */
+JsonData::JsonData(std::unique_ptr<internal::MemoryStream> input_stream) noexcept : JsonData(*input_stream)
+{
+
+    this->memory_buffer_ = &input_stream->GetBuffer();
+    this->owned_stream_ = std::move(input_stream);
+}
+
 /*!
  * \internal
  * - Create the input stream from the file.
@@ -84,10 +97,10 @@ auto JsonData::FromFile(const std::string_view path) noexcept -> Result<JsonData
     auto result = MakeErrorResult<JsonData>(JsonErrc::kStreamFailure, "Could not open file");
     if (file_result.has_value())
     {
-        // Read the whole file into an owned buffer once, then parse it through the same in-memory istringstream
+        // Read the whole file into an owned buffer once, then parse it through the same in-memory stream
         // fast path used for FromBuffer. Parsing directly off the file stream is slow because the reader's
         // Snap/Restore backtracking issues repeated seekg/tellg calls, which are expensive on a filebuf but O(1)
-        // on an in-memory stringbuf.
+        // on an in-memory buffer.
         std::istream& file{*file_result.value()};
         file.seekg(0, std::ios::end);
         const std::streamoff size{file.tellg()};
@@ -103,8 +116,7 @@ auto JsonData::FromFile(const std::string_view path) noexcept -> Result<JsonData
         {
             return MakeErrorResult<JsonData>(JsonErrc::kStreamFailure, "Could not read file");
         }
-        std::unique_ptr<std::istream> stream{std::make_unique<std::istringstream>(std::move(content))};
-        result.emplace(JsonData{std::move(stream)});
+        result.emplace(JsonData{std::make_unique<internal::MemoryStream>(std::move(content))});
     }
 
     return result;
@@ -140,9 +152,9 @@ auto JsonData::FromBuffer(const score::safecpp::zstring_view buffer) noexcept ->
  */
 auto JsonData::FromBuffer(const score::cpp::span<const char> buffer) noexcept -> Result<JsonData>
 {
-    // Create istringstream from the buffer
-    std::unique_ptr<std::istream> iss{std::make_unique<std::istringstream>(std::string(buffer.data(), buffer.size()))};
-    return Result<JsonData>{JsonData{std::move(iss)}};
+    // Copy the buffer into a stream whose characters can be scanned in blocks
+    return Result<JsonData>{
+        JsonData{std::make_unique<internal::MemoryStream>(std::string(buffer.data(), buffer.size()))}};
 }
 
 /*!
@@ -25,6 +25,7 @@
  *********************************************************************************************************************/
 #include "score/json/internal/parser/vajson/vajson_impl/reader/internal/config/json_reader_cfg.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/internal/depth_counter.h"
+#include "score/json/internal/parser/vajson/vajson_impl/reader/internal/memory_stream.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader/parser_state.h"
 #include "score/json/internal/parser/vajson/vajson_impl/reader_fwd.h"
 #include "score/json/internal/parser/vajson/vajson_impl/util/types.h"
@@ -48,6 +49,8 @@ class JsonData final
     std::reference_wrapper<std::istream> stream_;
     /// \brief           The potentially owned stream
     std::unique_ptr<std::istream> owned_stream_{nullptr};
+    /// \brief           The buffer of the owned stream if the document is held in memory, nullptr otherwise
+    internal::MemoryStreamBuffer* memory_buffer_{nullptr};
     /// \brief           JSON structure state
     internal::DepthCounter depth_counter_{};
     /// \brief           Current key
@@ -254,6 +257,15 @@ class JsonData final
     auto Restore() noexcept -> Result<void>;
 
   private:
+    /// \brief           Initializes a JSON data object from a document held in memory
+    /// \param[in]       input_stream
+    ///                  to operate on.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      FALSE
+    /// \reentrant       FALSE
+    explicit JsonData(std::unique_ptr<internal::MemoryStream> input_stream) noexcept;
+
     /// \brief           Returns the stream
     /// \return          The stream.
     /// \context         ANY
@@ -274,6 +286,16 @@ class JsonData final
         return this->stream_.get();
     }
 
+    /// \brief           Returns the buffer of the document if it is held in memory
+    /// \return          The buffer, or nullptr if the document is read from a caller provided stream.
+    /// \context         ANY
+    /// \pre             -
+    /// \threadsafe      TRUE, for different this pointer
+    auto GetMemoryBuffer() noexcept -> internal::MemoryStreamBuffer*
+    {
+        return this->memory_buffer_;
+    }
+
     /// \brief           Inspects the document's BOM
     /// \context         ANY
     /// \pre             The read pointer must be at the beginning of the document.
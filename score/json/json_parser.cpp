@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "score/json/json_parser.h"
+#include "score/json/internal/parser/flat/flat_parser.h"
 
 #include <iostream>
 
@@ -20,6 +21,18 @@ namespace score
 namespace json
 {
 
+// The flat document has its own in-situ parser, independent of the selected base library, since the base libraries
+// parse from streams and copy every key and string.
+score::Result<FlatDocument> JsonParser::FlatDocumentFromFile(const std::string_view file_path) const noexcept
+{
+    return FlatParser::FromFile(file_path);
+}
+
+score::Result<FlatDocument> JsonParser::FlatDocumentFromBuffer(const std::string_view buffer) const noexcept
+{
+    return FlatParser::FromBuffer(buffer);
+}
+
 // False positive, user defined literal operator is used to perform conversion.
 // coverity[autosar_cpp14_a13_1_3_violation : FALSE]
 auto operator""_json(const char* const data, const size_t size) -> Any
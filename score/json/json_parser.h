@@ -17,6 +17,7 @@
 #include "score/json/i_json_parser.h"
 #include "score/json/internal/model/any.h"
 #include "score/json/internal/model/error.h"
+#include "score/json/internal/model/flat_document.h"
 #include "score/result/result.h"
 
 #include <string_view>
@@ -38,6 +39,17 @@ class JsonParser : public IJsonParser
     /// \param buffer The string_view that shall be parsed
     /// \return root to the tree of JSON data, error on error
     score::Result<Any> FromBuffer(const std::string_view buffer) const noexcept override;
+
+    /// \brief Parses the underlying file into a read-only document stored in a single arena
+    /// \param file_path The path to the file that shall be parsed
+    /// \return document owning the file content, error on error
+    score::Result<FlatDocument> FlatDocumentFromFile(const std::string_view file_path) const noexcept override;
+
+    /// \brief Parses the underlying buffer into a read-only document stored in a single arena
+    /// \details Keys and strings refer to the buffer, which therefore has to outlive the document.
+    /// \param buffer The string_view that shall be parsed
+    /// \return document referring to the buffer, error on error
+    score::Result<FlatDocument> FlatDocumentFromBuffer(const std::string_view buffer) const noexcept override;
 };
 
 /// \brief Parses the underlying buffer and creates a tree of JSON data
@@ -19,6 +19,7 @@
 #ifndef SCORE_LANGUAGE_FUTURECPP_EXECUTION_HPP
 #define SCORE_LANGUAGE_FUTURECPP_EXECUTION_HPP
 
+#include <score/private/execution/bulk.hpp>          // IWYU pragma: export
 #include <score/private/execution/connect.hpp>       // IWYU pragma: export
 #include <score/private/execution/cpu_context.hpp>   // IWYU pragma: export
 #include <score/private/execution/cpu_scheduler.hpp> // IWYU pragma: export
@@ -29,6 +30,8 @@
 #include <score/private/execution/set_stopped.hpp>   // IWYU pragma: export
 #include <score/private/execution/set_value.hpp>     // IWYU pragma: export
 #include <score/private/execution/start.hpp>         // IWYU pragma: export
+#include <score/private/execution/sync_wait.hpp>     // IWYU pragma: export
 #include <score/private/execution/then.hpp>          // IWYU pragma: export
+#include <score/private/execution/when_all.hpp>      // IWYU pragma: export
 
 #endif // SCORE_LANGUAGE_FUTURECPP_EXECUTION_HPP
@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_HPP
+
+#include <score/private/execution/bulk_sender.hpp>
+#include <score/private/execution/scheduler_t.hpp>
+#include <score/private/execution/sender_adaptor_closure.hpp>
+#include <score/private/execution/sender_t.hpp>
+#include <score/private/type_traits/remove_cvref.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace score::cpp
+{
+namespace execution
+{
+
+namespace detail
+{
+namespace bulk_t_disable_adl
+{
+
+template <typename Scheduler, typename Shape, typename Invocable>
+class bulk_closure : public sender_adaptor_closure<bulk_closure<Scheduler, Shape, Invocable>>
+{
+public:
+    template <typename I>
+    bulk_closure(Scheduler scheduler, const Shape shape, I&& i)
+        : scheduler_{std::move(scheduler)}, shape_{shape}, i_{std::forward<I>(i)}
+    {
+    }
+
+    template <typename Sender>
+    auto operator()(Sender&& sender) &
+    {
+        return score::cpp::execution::detail::make_bulk_sender(std::forward<Sender>(sender), scheduler_, shape_, i_);
+    }
+
+    template <typename Sender>
+    auto operator()(Sender&& sender) &&
+    {
+        return score::cpp::execution::detail::make_bulk_sender(
+            std::forward<Sender>(sender), std::move(scheduler_), shape_, std::move(i_));
+    }
+
+private:
+    Scheduler scheduler_;
+    Shape shape_;
+    Invocable i_;
+};
+
+struct bulk_t
+{
+    template <typename Sender, typename Scheduler, typename Shape, typename Invocable>
+    auto operator()(Sender&& sender, Scheduler scheduler, const Shape shape, Invocable&& invocable) const
+    {
+        static_assert(is_sender<Sender>::value, "not a sender");
+        static_assert(is_scheduler<Scheduler>::value, "not a scheduler");
+        static_assert(std::is_integral<Shape>::value, "shape is not an integral type");
+        return score::cpp::execution::detail::make_bulk_sender(
+            std::forward<Sender>(sender), std::move(scheduler), shape, std::forward<Invocable>(invocable));
+    }
+
+    template <typename Scheduler, typename Shape, typename Invocable>
+    auto operator()(Scheduler scheduler, const Shape shape, Invocable&& invocable) const
+    {
+        static_assert(is_scheduler<Scheduler>::value, "not a scheduler");
+        static_assert(std::is_integral<Shape>::value, "shape is not an integral type");
+        return bulk_closure<Scheduler, Shape, score::cpp::remove_cvref_t<Invocable>>{
+            std::move(scheduler), shape, std::forward<Invocable>(invocable)};
+    }
+};
+
+} // namespace bulk_t_disable_adl
+} // namespace detail
+
+using detail::bulk_t_disable_adl::bulk_t;
+
+/// \brief Invokes an invocable for every index of a range, in parallel on a scheduler, once the input sender completed.
+///
+/// https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2023/p2300r7.html#design-sender-adaptor-bulk
+///
+/// The call `bulk(sender, scheduler, shape, invocable)` returns a sender that invokes `invocable(i)` for every `i` in
+/// `[0, shape)` once `sender` completed with `set_value()`, and then completes with `set_value()`. If `sender`
+/// completes with `set_stopped()`, the returned sender does as well.
+///
+/// Deviating from P2300, the scheduler to run on is passed explicitly, since senders do not expose their completion
+/// scheduler. The range is split into chunks that are claimed by up to `scheduler.max_concurrency()` participants, the
+/// completing thread of `sender` being one of them. Thus `invocable` is invoked concurrently and must be safe to call
+/// concurrently for different indices. Only a fixed number of helper operations is allocated on connect, the cost does
+/// not grow with the number of indices.
+///
+/// `bulk` also supports the pipe syntax
+///
+/// ```
+///     ... | bulk(scheduler, shape, [](auto i){});
+/// ```
+inline constexpr bulk_t bulk{};
+
+} // namespace execution
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_HPP
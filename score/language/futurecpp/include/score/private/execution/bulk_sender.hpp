@@ -0,0 +1,256 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_SENDER_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_SENDER_HPP
+
+#include <score/private/execution/connect.hpp>
+#include <score/private/execution/operation_state_t.hpp>
+#include <score/private/execution/receiver_t.hpp>
+#include <score/private/execution/sender_t.hpp>
+#include <score/private/execution/set_stopped.hpp>
+#include <score/private/execution/set_value.hpp>
+#include <score/private/execution/start.hpp>
+#include <score/private/functional/invoke.hpp>
+#include <score/assert.hpp>
+#include <score/memory_resource.hpp>
+#include <score/type_traits.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace score::cpp
+{
+namespace execution
+{
+namespace detail
+{
+
+template <typename OpState>
+class bulk_input_receiver
+{
+public:
+    using receiver_concept = receiver_t;
+
+    explicit bulk_input_receiver(OpState& op) : op_{&op} {}
+
+    void set_value() && { op_->run(); }
+    void set_stopped() && { op_->stop(); }
+
+private:
+    OpState* op_;
+};
+
+template <typename OpState>
+class bulk_helper_receiver
+{
+public:
+    using receiver_concept = receiver_t;
+
+    explicit bulk_helper_receiver(OpState& op) : op_{&op} {}
+
+    void set_value() && { op_->participate(); }
+    void set_stopped() && { op_->finish(); }
+
+private:
+    OpState* op_;
+};
+
+/// \brief Operation state of `bulk`.
+///
+/// Once the input sender completed, the index range is split into chunks. Up to `max_concurrency() - 1` helpers are
+/// scheduled on the scheduler and the completing thread participates as well. Every participant claims chunks from a
+/// shared counter until none are left, thus an unevenly loaded pool still balances. The last participant to finish
+/// completes the receiver. The helper operation states are allocated once on connect, never per index.
+template <typename Sender, typename Scheduler, typename Shape, typename Invocable, typename Receiver>
+class bulk_op_state
+{
+    static_assert(std::is_object<Receiver>::value, "Receiver is not an object type");
+    static_assert(is_receiver<Receiver>::value, "not a receiver");
+    static_assert(std::is_integral<Shape>::value, "Shape is not an integral type");
+
+    using input_receiver = bulk_input_receiver<bulk_op_state>;
+    using helper_receiver = bulk_helper_receiver<bulk_op_state>;
+    using helper_op_state = connect_result_t<decltype(std::declval<Scheduler&>().schedule()), helper_receiver>;
+
+    friend input_receiver;
+    friend helper_receiver;
+
+public:
+    using operation_state_concept = operation_state_t;
+
+    /// \brief Number of chunks per participant, more chunks balance better but cost more claims.
+    static constexpr Shape chunks_per_participant{4};
+
+    template <typename S, typename I, typename R>
+    bulk_op_state(S&& s, Scheduler scheduler, const Shape shape, I&& i, R&& r)
+        : invocable_{std::forward<I>(i)}
+        , receiver_{std::forward<R>(r)}
+        , shape_{shape}
+        , chunk_size_{1}
+        , chunk_count_{0}
+        , next_chunk_{0}
+        , remaining_{0U}
+        , allocator_{}
+        , helper_count_{static_cast<std::size_t>(std::max(scheduler.max_concurrency() - 1, 0))}
+        , helpers_{allocator_.allocate(helper_count_)}
+        , op_state_{score::cpp::execution::connect(std::forward<S>(s), input_receiver{*this})}
+    {
+        for (std::size_t index{0U}; index < helper_count_; ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) helpers_ holds helper_count_ elements
+            static_cast<void>(::new (static_cast<void*>(helpers_ + index)) helper_op_state(
+                score::cpp::execution::connect(scheduler.schedule(), helper_receiver{*this})));
+        }
+    }
+
+    bulk_op_state(const bulk_op_state&) = delete;
+    bulk_op_state(bulk_op_state&&) = delete;
+    bulk_op_state& operator=(const bulk_op_state&) = delete;
+    bulk_op_state& operator=(bulk_op_state&&) = delete;
+
+    ~bulk_op_state()
+    {
+        for (std::size_t index{0U}; index < helper_count_; ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) helpers_ holds helper_count_ elements
+            helpers_[index].~helper_op_state();
+        }
+        allocator_.deallocate(helpers_, helper_count_);
+    }
+
+    void start() & { score::cpp::execution::start(op_state_); }
+    void start() && = delete;
+
+private:
+    void run()
+    {
+        if (shape_ <= Shape{0})
+        {
+            score::cpp::execution::set_value(std::move(receiver_));
+            return;
+        }
+
+        const auto participants = static_cast<Shape>(helper_count_ + 1U);
+        chunk_size_ = std::max(Shape{1}, static_cast<Shape>(shape_ / (participants * chunks_per_participant)));
+        chunk_count_ = static_cast<Shape>((shape_ / chunk_size_) + (((shape_ % chunk_size_) == 0) ? 0 : 1));
+        const auto helpers = std::min(helper_count_, static_cast<std::size_t>(chunk_count_ - 1));
+
+        remaining_.store(helpers + 1U, std::memory_order_relaxed);
+        for (std::size_t index{0U}; index < helpers; ++index)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) helpers_ holds helper_count_ elements
+            score::cpp::execution::start(helpers_[index]);
+        }
+        participate();
+    }
+
+    void stop() { score::cpp::execution::set_stopped(std::move(receiver_)); }
+
+    void participate()
+    {
+        for (auto chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count_;
+             chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed))
+        {
+            const Shape first{static_cast<Shape>(chunk * chunk_size_)};
+            const Shape last{std::min(shape_, static_cast<Shape>(first + chunk_size_))};
+            for (Shape index{first}; index < last; ++index)
+            {
+                score::cpp::detail::invoke(invocable_, index);
+            }
+        }
+        finish();
+    }
+
+    void finish()
+    {
+        // the last participant completes, after that no participant touches this object anymore
+        if (remaining_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            score::cpp::execution::set_value(std::move(receiver_));
+        }
+    }
+
+    Invocable invocable_;
+    Receiver receiver_;
+    Shape shape_;
+    Shape chunk_size_;
+    Shape chunk_count_;
+    std::atomic<Shape> next_chunk_;
+    std::atomic<std::size_t> remaining_;
+    score::cpp::pmr::polymorphic_allocator<helper_op_state> allocator_;
+    std::size_t helper_count_;
+    helper_op_state* helpers_;
+    connect_result_t<Sender, input_receiver> op_state_;
+};
+
+template <typename Sender, typename Scheduler, typename Shape, typename Invocable>
+class bulk_sender
+{
+    static_assert(std::is_object<Sender>::value, "Sender is not an object type");
+    static_assert(is_sender<Sender>::value, "not a sender");
+    static_assert(std::is_object<Invocable>::value, "Invocable is not an object type");
+
+public:
+    using sender_concept = sender_t;
+
+    template <typename S, typename I>
+    bulk_sender(S&& s, Scheduler scheduler, const Shape shape, I&& i)
+        : s_{std::forward<S>(s)}, scheduler_{std::move(scheduler)}, shape_{shape}, i_{std::forward<I>(i)}
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver&& r) & -> bulk_op_state<Sender, Scheduler, Shape, Invocable, score::cpp::remove_cvref_t<Receiver>>
+    {
+        static_assert(is_receiver<Receiver>::value, "not a receiver");
+        return {s_, scheduler_, shape_, i_, std::forward<Receiver>(r)};
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver&& r) && -> bulk_op_state<Sender, Scheduler, Shape, Invocable, score::cpp::remove_cvref_t<Receiver>>
+    {
+        static_assert(is_receiver<Receiver>::value, "not a receiver");
+        return {std::move(s_), std::move(scheduler_), shape_, std::move(i_), std::forward<Receiver>(r)};
+    }
+
+private:
+    Sender s_;
+    Scheduler scheduler_;
+    Shape shape_;
+    Invocable i_;
+};
+
+template <typename Sender, typename Scheduler, typename Shape, typename Invocable>
+auto make_bulk_sender(Sender&& s, Scheduler scheduler, const Shape shape, Invocable&& i)
+{
+    using type = bulk_sender<score::cpp::remove_cvref_t<Sender>, Scheduler, Shape, score::cpp::remove_cvref_t<Invocable>>;
+    return type{std::forward<Sender>(s), std::move(scheduler), shape, std::forward<Invocable>(i)};
+}
+
+} // namespace detail
+} // namespace execution
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_BULK_SENDER_HPP
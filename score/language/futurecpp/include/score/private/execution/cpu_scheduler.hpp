@@ -25,6 +25,8 @@
 #include <score/private/execution/scheduler_t.hpp>
 #include <score/private/execution/thread_pool.hpp>
 
+#include <cstdint>
+
 namespace score::cpp
 {
 namespace execution
@@ -58,6 +60,9 @@ public:
     /// \brief Customization point `score::cpp::schedule()`.
     auto schedule() { return detail::cpu_scheduler_sender{*pool_}; }
 
+    /// \brief Returns the number of worker threads of the underlying `cpu_context`.
+    std::int32_t max_concurrency() const noexcept { return pool_->max_concurrency(); }
+
     /// \brief Two `cpu_scheduler` compare equal if they share the same underlying `cpu_context`.
     friend bool operator==(const cpu_scheduler& lhs, const cpu_scheduler& rhs) noexcept
     {
@@ -0,0 +1,117 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_SYNC_WAIT_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_SYNC_WAIT_HPP
+
+#include <score/private/execution/connect.hpp>
+#include <score/private/execution/receiver_t.hpp>
+#include <score/private/execution/sender_t.hpp>
+#include <score/private/execution/start.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+namespace score::cpp
+{
+namespace execution
+{
+
+namespace detail
+{
+
+class sync_wait_state
+{
+public:
+    void complete(const bool stopped)
+    {
+        // notify while holding the lock, the waiting thread destroys this object once it observes `done_`
+        const std::lock_guard<std::mutex> lock{mutex_};
+        stopped_ = stopped;
+        done_ = true;
+        condition_.notify_one();
+    }
+
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this]() { return done_; });
+        return !stopped_;
+    }
+
+private:
+    std::mutex mutex_{};
+    std::condition_variable condition_{};
+    bool done_{false};
+    bool stopped_{false};
+};
+
+class sync_wait_receiver
+{
+public:
+    using receiver_concept = receiver_t;
+
+    explicit sync_wait_receiver(sync_wait_state& state) : state_{&state} {}
+
+    void set_value() && { state_->complete(false); }
+    void set_stopped() && { state_->complete(true); }
+
+private:
+    sync_wait_state* state_;
+};
+
+namespace sync_wait_t_disable_adl
+{
+
+struct sync_wait_t
+{
+    template <typename Sender>
+    bool operator()(Sender&& sender) const
+    {
+        static_assert(is_sender<Sender>::value, "not a sender");
+        sync_wait_state state{};
+        auto op_state = score::cpp::execution::connect(std::forward<Sender>(sender), sync_wait_receiver{state});
+        score::cpp::execution::start(op_state);
+        return state.wait();
+    }
+};
+
+} // namespace sync_wait_t_disable_adl
+} // namespace detail
+
+using detail::sync_wait_t_disable_adl::sync_wait_t;
+
+/// \brief Starts a sender and blocks the calling thread until it completed.
+///
+/// https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2023/p2300r7.html#design-sender-consumer-sync_wait
+///
+/// Deviating from P2300, the sender must complete with `set_value()` without values, since senders do not expose their
+/// value types. Thus `sync_wait` returns `true` if the sender completed with `set_value()` and `false` if it completed
+/// with `set_stopped()`, instead of an optional of the values.
+///
+/// Must not be called from a thread of the context the sender runs on, unless that context has further threads to
+/// complete the sender.
+inline constexpr sync_wait_t sync_wait{};
+
+} // namespace execution
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_SYNC_WAIT_HPP
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_HPP
+
+#include <score/private/execution/sender_t.hpp>
+#include <score/private/execution/when_all_sender.hpp>
+#include <score/private/type_traits/remove_cvref.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace score::cpp
+{
+namespace execution
+{
+
+namespace detail
+{
+namespace when_all_t_disable_adl
+{
+
+struct when_all_t
+{
+    template <typename... Senders>
+    auto operator()(Senders&&... senders) const
+    {
+        static_assert(sizeof...(Senders) > 0U, "at least one sender is required");
+        static_assert(std::conjunction<is_sender<Senders>...>::value, "not a sender");
+        return when_all_sender<score::cpp::remove_cvref_t<Senders>...>{std::forward<Senders>(senders)...};
+    }
+};
+
+} // namespace when_all_t_disable_adl
+} // namespace detail
+
+using detail::when_all_t_disable_adl::when_all_t;
+
+/// \brief Completes once all input senders completed.
+///
+/// https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2023/p2300r7.html#design-sender-factory-when_all
+///
+/// The call `when_all(senders...)` returns a sender that starts all input senders and completes with `set_value()`
+/// once all of them completed with `set_value()`. If any of them completes with `set_stopped()`, the returned sender
+/// completes with `set_stopped()` once all of them completed.
+///
+/// Deviating from P2300, the input senders must complete with `set_value()` without values, since senders do not
+/// expose their value types. Pass results by capturing a reference in the invocable of `then`.
+inline constexpr when_all_t when_all{};
+
+} // namespace execution
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_HPP
@@ -0,0 +1,195 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_SENDER_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_SENDER_HPP
+
+#include <score/private/execution/connect.hpp>
+#include <score/private/execution/operation_state_t.hpp>
+#include <score/private/execution/receiver_t.hpp>
+#include <score/private/execution/sender_t.hpp>
+#include <score/private/execution/set_stopped.hpp>
+#include <score/private/execution/set_value.hpp>
+#include <score/private/execution/start.hpp>
+#include <score/type_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace score::cpp
+{
+namespace execution
+{
+namespace detail
+{
+
+template <typename OpState>
+class when_all_receiver
+{
+public:
+    using receiver_concept = receiver_t;
+
+    explicit when_all_receiver(OpState& op) : op_{&op} {}
+
+    void set_value() && { op_->complete(false); }
+    void set_stopped() && { op_->complete(true); }
+
+private:
+    OpState* op_;
+};
+
+/// \brief Holds the operation states of all input senders, constructed in place since they are not movable.
+template <typename Receiver, typename... Senders>
+class when_all_children;
+
+template <typename Receiver>
+class when_all_children<Receiver>
+{
+public:
+    explicit when_all_children(const Receiver&) {}
+
+    void start() & {}
+};
+
+template <typename Receiver, typename Sender, typename... Senders>
+class when_all_children<Receiver, Sender, Senders...>
+{
+public:
+    template <typename S, typename... Ss>
+    when_all_children(const Receiver& r, S&& s, Ss&&... ss)
+        : op_state_{score::cpp::execution::connect(std::forward<S>(s), Receiver{r})}, rest_{r, std::forward<Ss>(ss)...}
+    {
+    }
+
+    void start() &
+    {
+        score::cpp::execution::start(op_state_);
+        rest_.start();
+    }
+
+private:
+    connect_result_t<Sender, Receiver> op_state_;
+    when_all_children<Receiver, Senders...> rest_;
+};
+
+template <typename Receiver, typename... Senders>
+class when_all_op_state
+{
+    static_assert(std::is_object<Receiver>::value, "Receiver is not an object type");
+    static_assert(is_receiver<Receiver>::value, "not a receiver");
+
+    using child_receiver = when_all_receiver<when_all_op_state>;
+    friend child_receiver;
+
+public:
+    using operation_state_concept = operation_state_t;
+
+    template <typename R, typename Tuple>
+    when_all_op_state(R&& r, Tuple&& senders)
+        : when_all_op_state{std::forward<R>(r), std::forward<Tuple>(senders), std::index_sequence_for<Senders...>{}}
+    {
+    }
+
+    when_all_op_state(const when_all_op_state&) = delete;
+    when_all_op_state(when_all_op_state&&) = delete;
+    when_all_op_state& operator=(const when_all_op_state&) = delete;
+    when_all_op_state& operator=(when_all_op_state&&) = delete;
+    ~when_all_op_state() = default;
+
+    void start() & { children_.start(); }
+    void start() && = delete;
+
+private:
+    template <typename R, typename Tuple, std::size_t... Is>
+    when_all_op_state(R&& r, Tuple&& senders, std::index_sequence<Is...>)
+        : receiver_{std::forward<R>(r)}
+        , remaining_{sizeof...(Senders)}
+        , stopped_{false}
+        , children_{child_receiver{*this}, std::get<Is>(std::forward<Tuple>(senders))...}
+    {
+    }
+
+    void complete(const bool stopped)
+    {
+        if (stopped)
+        {
+            stopped_.store(true, std::memory_order_relaxed);
+        }
+        // the last input completes, after that no input touches this object anymore
+        if (remaining_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            if (stopped_.load(std::memory_order_relaxed))
+            {
+                score::cpp::execution::set_stopped(std::move(receiver_));
+            }
+            else
+            {
+                score::cpp::execution::set_value(std::move(receiver_));
+            }
+        }
+    }
+
+    Receiver receiver_;
+    std::atomic<std::size_t> remaining_;
+    std::atomic<bool> stopped_;
+    when_all_children<child_receiver, Senders...> children_;
+};
+
+template <typename... Senders>
+class when_all_sender
+{
+    static_assert(sizeof...(Senders) > 0U, "at least one sender is required");
+    static_assert(std::conjunction<std::is_object<Senders>...>::value, "Sender is not an object type");
+    static_assert(std::conjunction<is_sender<Senders>...>::value, "not a sender");
+
+public:
+    using sender_concept = sender_t;
+
+    template <typename... Ss>
+    explicit when_all_sender(Ss&&... s) : s_{std::forward<Ss>(s)...}
+    {
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver&& r) & -> when_all_op_state<score::cpp::remove_cvref_t<Receiver>, Senders...>
+    {
+        static_assert(is_receiver<Receiver>::value, "not a receiver");
+        return {std::forward<Receiver>(r), s_};
+    }
+
+    template <typename Receiver>
+    auto connect(Receiver&& r) && -> when_all_op_state<score::cpp::remove_cvref_t<Receiver>, Senders...>
+    {
+        static_assert(is_receiver<Receiver>::value, "not a receiver");
+        return {std::forward<Receiver>(r), std::move(s_)};
+    }
+
+private:
+    std::tuple<Senders...> s_;
+};
+
+} // namespace detail
+} // namespace execution
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_EXECUTION_WHEN_ALL_SENDER_HPP
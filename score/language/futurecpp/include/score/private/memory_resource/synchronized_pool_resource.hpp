@@ -0,0 +1,193 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// \file
+/// \copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+/// \brief Score.Futurecpp.Pmr.MemoryResource component
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_HPP
+
+#include <score/private/memory_resource/memory_resource.hpp>
+#include <score/private/memory_resource/pool_options.hpp>
+#include <score/private/memory_resource/unsynchronized_pool_resource.hpp>
+
+#include <cstddef>
+#include <mutex>
+
+namespace score::cpp
+{
+namespace pmr
+{
+
+/// \brief A thread-safe score::cpp::pmr::memory_resource for managing allocations in pools of different block sizes
+///
+/// The class score::cpp::pmr::synchronized_pool_resource is a general-purpose memory resource class with the following
+/// properties:
+///
+/// It owns the allocated memory and frees it on destruction, even if deallocate has not been called for some of the
+/// allocated blocks. It consists of a collection of pools that serves requests for different block sizes. Each pool
+/// manages a collection of chunks that are then divided into blocks of uniform size. The pooling behavior is the one of
+/// unsynchronized_pool_resource.
+///
+/// synchronized_pool_resource may be accessed from multiple threads without external synchronization. All accesses are
+/// serialized by a single mutex. If many threads allocate and deallocate concurrently, thread_caching_pool_resource
+/// scales better.
+///
+/// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions) Follows literaly the C++ standard
+class synchronized_pool_resource : public memory_resource
+{
+public:
+    /// \brief Constructs a synchronized_pool_resource using the specified upstream memory resource and tuned according
+    /// to the specified options.
+    ///
+    /// The resulting object holds a copy of upstream but does not own the resource to which upstream points.
+    ///
+    /// \pre upstream != nullptr
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/synchronized_pool_resource
+    ///
+    /// \param opts A score::cpp::pmr::pool_options struct containing the constructor options
+    /// \param upstream The upstream memory resource to use
+    synchronized_pool_resource(const pool_options& opts, memory_resource* const upstream)
+        : memory_resource{}, mutex_{}, pool_{opts, upstream}
+    {
+    }
+
+    /// \brief Constructs a synchronized_pool_resource using a default constructed instance of pool_options as the
+    /// options and the return value of score::cpp::pmr::get_default_resource() as the upstream memory resource.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/synchronized_pool_resource
+    synchronized_pool_resource() : synchronized_pool_resource(pool_options{}, get_default_resource()) {}
+
+    /// \brief Constructs a synchronized_pool_resource using the specified upstream memory resource and a default
+    /// constructed instance of pool_options as the options.
+    ///
+    /// The resulting object holds a copy of upstream but does not own the resource to which upstream points.
+    ///
+    /// \pre upstream != nullptr
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/synchronized_pool_resource
+    ///
+    /// \param upstream The upstream memory resource to use
+    explicit synchronized_pool_resource(memory_resource* const upstream)
+        : synchronized_pool_resource{pool_options{}, upstream}
+    {
+    }
+
+    /// \brief Constructs a synchronized_pool_resource tuned according to the specified options and using the return
+    /// value of score::cpp::pmr::get_default_resource() as the upstream memory resource.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/synchronized_pool_resource
+    ///
+    /// \param opts A score::cpp::pmr::pool_options struct containing the constructor options
+    explicit synchronized_pool_resource(const pool_options& opts)
+        : synchronized_pool_resource{opts, get_default_resource()}
+    {
+    }
+
+    /// \brief Copy constructor is deleted.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/synchronized_pool_resource
+    synchronized_pool_resource(const synchronized_pool_resource&) = delete;
+
+    /// \brief Destroys a synchronized_pool_resource, releasing all allocated memory.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/%7Esynchronized_pool_resource
+    ~synchronized_pool_resource() override = default;
+
+    /// \brief Copy assignment operator is deleted. synchronized_pool_resource is not copy assignable.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource
+    synchronized_pool_resource& operator=(const synchronized_pool_resource&) = delete;
+
+    /// \brief Releases all memory owned by this resource by calling the deallocate function of the upstream memory
+    /// resource as needed.
+    ///
+    /// Memory is released back to the upstream resource even if deallocate has not been called for some of the
+    /// allocated blocks.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/release
+    void release()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        pool_.release();
+    }
+
+    /// \brief Returns a pointer to the upstream memory resource.
+    ///
+    /// This is the same value as the upstream argument passed to the constructor of this object.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/upstream_resource
+    memory_resource* upstream_resource() const { return pool_.upstream_resource(); }
+
+    /// \brief Returns the options that control the pooling behavior of this resource.
+    ///
+    /// The values in the returned struct may differ from those supplied to the constructor in the following ways:
+    /// * Values of zero will be replaced with implementation-specified defaults;
+    /// * Sizes may be rounded to an unspecified granularity.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/options
+    pool_options options() const { return pool_.options(); }
+
+protected:
+    /// \brief Allocates storage.
+    ///
+    /// Behaves as unsynchronized_pool_resource::do_allocate() while holding the lock of this resource.
+    ///
+    /// \pre alignment is a power of 2.
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/do_allocate
+    ///
+    /// \return A pointer to allocated storage of at least bytes bytes in size, aligned to the specified alignment if
+    /// such alignment is supported, and to alignof(std::max_align_t) otherwise.
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        return pool_.allocate(bytes, alignment);
+    }
+
+    /// \brief Returns the memory at p to the pool.
+    ///
+    /// Behaves as unsynchronized_pool_resource::do_deallocate() while holding the lock of this resource.
+    ///
+    /// \pre p has been allocated from this object with the specified bytes and alignment.
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/do_deallocate
+    void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        pool_.deallocate(p, bytes, alignment);
+    }
+
+    /// \brief Compare for equality with another score::cpp::pmr::memory_resource
+    ///
+    /// Compare *this with \p other for identity - memory allocated using a synchronized_pool_resource can only be
+    /// deallocated using that same resource.
+    ///
+    /// \see https://en.cppreference.com/w/cpp/memory/synchronized_pool_resource/do_is_equal
+    ///
+    /// \return this == &other
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    std::mutex mutex_;
+    unsynchronized_pool_resource pool_;
+};
+
+} // namespace pmr
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_SYNCHRONIZED_POOL_RESOURCE_HPP
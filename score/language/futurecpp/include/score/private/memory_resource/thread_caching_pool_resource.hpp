@@ -0,0 +1,485 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// \file
+/// \copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+/// \brief Score.Futurecpp.Pmr.MemoryResource component
+///
+
+// IWYU pragma: private
+
+#ifndef SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_THREAD_CACHING_POOL_RESOURCE_HPP
+#define SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_THREAD_CACHING_POOL_RESOURCE_HPP
+
+#include <score/private/memory_resource/memory_resource.hpp>
+#include <score/private/memory_resource/polymorphic_allocator.hpp>
+#include <score/private/memory_resource/pool_options.hpp>
+#include <score/private/memory_resource/unsynchronized_pool_resource.hpp>
+
+#include <score/assert.hpp>
+#include <score/bit.hpp>
+#include <score/size.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace score::cpp
+{
+namespace pmr
+{
+
+namespace detail
+{
+
+/// \brief Singly linked list of free blocks that knows its length, such that batches of blocks can be moved from one
+/// list to another.
+class counted_free_list
+{
+public:
+    bool empty() const { return head_ == nullptr; }
+
+    std::size_t size() const { return size_; }
+
+    void* pop_front()
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!empty());
+        node* const front{head_};
+        head_ = front->next;
+        --size_;
+        return front;
+    }
+
+    void push_front(void* const p)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(p != nullptr);
+        head_ = ::new (p) node{head_};
+        ++size_;
+    }
+
+    /// \brief Moves the first count blocks of this list to the front of other.
+    ///
+    /// \pre count <= size()
+    void splice_front_to(counted_free_list& other, const std::size_t count)
+    {
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION(count <= size_);
+        if (count == 0U)
+        {
+            return;
+        }
+        node* const first{head_};
+        node* last{head_};
+        for (std::size_t i{1U}; i < count; ++i)
+        {
+            last = last->next;
+        }
+        head_ = last->next;
+        size_ -= count;
+        last->next = other.head_;
+        other.head_ = first;
+        other.size_ += count;
+    }
+
+    void clear()
+    {
+        head_ = nullptr;
+        size_ = 0U;
+    }
+
+private:
+    struct node
+    {
+        node* next;
+    };
+
+    node* head_{};
+    std::size_t size_{};
+};
+
+/// \brief Hands out the smallest number that is not held by another live thread, such that the numbers of the live
+/// threads stay dense even if threads are created and destroyed over and over.
+class thread_ordinals
+{
+public:
+    std::size_t acquire()
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        const auto free_ordinal = std::find(in_use_.begin(), in_use_.end(), false);
+        const auto ordinal = static_cast<std::size_t>(std::distance(in_use_.begin(), free_ordinal));
+        if (free_ordinal == in_use_.end())
+        {
+            in_use_.push_back(true);
+        }
+        else
+        {
+            *free_ordinal = true;
+        }
+        return ordinal;
+    }
+
+    void release(const std::size_t ordinal)
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        in_use_[ordinal] = false;
+    }
+
+    static thread_ordinals& instance()
+    {
+        // Never destroyed, since detached threads may exit after the destruction of static objects
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory) intentionally leaked
+        static thread_ordinals* const ordinals{new thread_ordinals{}};
+        return *ordinals;
+    }
+
+private:
+    std::mutex mutex_{};
+    std::vector<bool> in_use_{};
+};
+
+/// \brief Holds the number of a thread for the lifetime of the thread.
+class thread_ordinal
+{
+public:
+    thread_ordinal() : value_{thread_ordinals::instance().acquire()} {}
+    thread_ordinal(const thread_ordinal&) = delete;
+    thread_ordinal& operator=(const thread_ordinal&) = delete;
+    ~thread_ordinal() { thread_ordinals::instance().release(value_); }
+
+    std::size_t value() const { return value_; }
+
+private:
+    std::size_t value_;
+};
+
+/// \returns A number that no other live thread holds. The number of an exited thread is reused by later threads.
+inline std::size_t current_thread_ordinal()
+{
+    thread_local const thread_ordinal ordinal{};
+    return ordinal.value();
+}
+
+} // namespace detail
+
+/// \brief A thread-safe score::cpp::pmr::memory_resource that keeps free blocks in per-thread caches
+///
+/// The class score::cpp::pmr::thread_caching_pool_resource serves the same block sizes as unsynchronized_pool_resource and
+/// owns the allocated memory in the same way, i.e. it frees all memory on destruction, even if deallocate has not been
+/// called for some of the allocated blocks.
+///
+/// In contrast to synchronized_pool_resource, allocation and deallocation of pooled block sizes do not contend on a
+/// single lock. Every thread is assigned one of cache_count() caches, which holds a free list per block size. Blocks
+/// are taken from and returned to the cache of the calling thread. Only if the free list of the cache is empty, a
+/// batch of blocks is taken from a shared depot, which carves new blocks from its pools if it has no free blocks left.
+/// If the free list holds two batches, one batch is returned to the depot. Thus a thread that allocates blocks which
+/// are deallocated by another thread, e.g. tasks that are enqueued into a thread pool, takes the depot lock once per
+/// batch instead of once per block.
+///
+/// The cache of a thread is selected by a number that is unique among the live threads of the process, i.e. it is
+/// shared with all threads that use any thread_caching_pool_resource, and reused once a thread exits. Thus threads only
+/// have caches of their own as long as cache_count() is at least the number of live threads that use one of these
+/// resources. Otherwise two threads may share a cache, which stays correct since every cache is protected by a lock,
+/// but contends on that lock.
+///
+/// Allocations that exceed the largest block size are served from the upstream allocator while holding the depot lock.
+///
+/// \note Every cache holds up to two batches per block size, a batch has a size of about 4 KiB. This memory cannot be
+/// used by other threads until it is returned to the depot.
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions) Follows the C++ standard for pool resources
+class thread_caching_pool_resource : public memory_resource
+{
+public:
+    /// \brief Constructs a thread_caching_pool_resource using the specified upstream memory resource, tuned according
+    /// to the specified options and with the specified number of caches.
+    ///
+    /// The resulting object holds a copy of upstream but does not own the resource to which upstream points.
+    ///
+    /// \pre upstream != nullptr
+    /// \pre cache_count > 0
+    ///
+    /// \param opts A score::cpp::pmr::pool_options struct containing the constructor options
+    /// \param cache_count The number of caches, ideally the number of threads that use the resource
+    /// \param upstream The upstream memory resource to use
+    thread_caching_pool_resource(const pool_options& opts,
+                                 const std::size_t cache_count,
+                                 memory_resource* const upstream);
+
+    /// \brief Constructs a thread_caching_pool_resource using the specified upstream memory resource, tuned according
+    /// to the specified options and with one cache per hardware thread.
+    ///
+    /// \pre upstream != nullptr
+    ///
+    /// \param opts A score::cpp::pmr::pool_options struct containing the constructor options
+    /// \param upstream The upstream memory resource to use
+    thread_caching_pool_resource(const pool_options& opts, memory_resource* const upstream)
+        : thread_caching_pool_resource{opts, default_cache_count(), upstream}
+    {
+    }
+
+    /// \brief Constructs a thread_caching_pool_resource using a default constructed instance of pool_options as the
+    /// options, one cache per hardware thread and the return value of score::cpp::pmr::get_default_resource() as the
+    /// upstream memory resource.
+    thread_caching_pool_resource() : thread_caching_pool_resource{pool_options{}, get_default_resource()} {}
+
+    /// \brief Constructs a thread_caching_pool_resource using the specified upstream memory resource, a default
+    /// constructed instance of pool_options as the options and one cache per hardware thread.
+    ///
+    /// \pre upstream != nullptr
+    ///
+    /// \param upstream The upstream memory resource to use
+    explicit thread_caching_pool_resource(memory_resource* const upstream)
+        : thread_caching_pool_resource{pool_options{}, upstream}
+    {
+    }
+
+    /// \brief Constructs a thread_caching_pool_resource tuned according to the specified options, with one cache per
+    /// hardware thread and using the return value of score::cpp::pmr::get_default_resource() as the upstream memory
+    /// resource.
+    ///
+    /// \param opts A score::cpp::pmr::pool_options struct containing the constructor options
+    explicit thread_caching_pool_resource(const pool_options& opts)
+        : thread_caching_pool_resource{opts, get_default_resource()}
+    {
+    }
+
+    /// \brief Copy constructor is deleted.
+    thread_caching_pool_resource(const thread_caching_pool_resource&) = delete;
+
+    /// \brief Destroys a thread_caching_pool_resource, releasing all allocated memory.
+    ~thread_caching_pool_resource() override;
+
+    /// \brief Copy assignment operator is deleted. thread_caching_pool_resource is not copy assignable.
+    thread_caching_pool_resource& operator=(const thread_caching_pool_resource&) = delete;
+
+    /// \brief Releases all memory owned by this resource by calling the deallocate function of the upstream memory
+    /// resource as needed.
+    ///
+    /// Memory is released back to the upstream resource even if deallocate has not been called for some of the
+    /// allocated blocks. The caches are emptied.
+    void release();
+
+    /// \brief Returns a pointer to the upstream memory resource.
+    ///
+    /// This is the same value as the upstream argument passed to the constructor of this object.
+    memory_resource* upstream_resource() const { return pool_.upstream_resource(); }
+
+    /// \brief Returns the options that control the pooling behavior of this resource.
+    ///
+    /// The values in the returned struct may differ from those supplied to the constructor in the following ways:
+    /// * Values of zero will be replaced with implementation-specified defaults;
+    /// * Sizes may be rounded to an unspecified granularity.
+    pool_options options() const { return pool_.options(); }
+
+    /// \brief Returns the number of per-thread caches.
+    std::size_t cache_count() const { return cache_count_; }
+
+protected:
+    /// \brief Allocates storage.
+    ///
+    /// Blocks of pooled sizes are taken from the cache of the calling thread, which is refilled by a batch from the
+    /// depot if it is empty. Larger requests are served by the upstream memory resource.
+    ///
+    /// \pre alignment is a power of 2.
+    ///
+    /// \return A pointer to allocated storage of at least bytes bytes in size, aligned to the specified alignment if
+    /// such alignment is supported, and to alignof(std::max_align_t) otherwise.
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    /// \brief Returns the memory at p to the cache of the calling thread.
+    ///
+    /// If the cache holds two batches of the block size afterwards, one batch is returned to the depot.
+    ///
+    /// \pre p has been allocated from this object with the specified bytes and alignment.
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+    /// \brief Compare for equality with another score::cpp::pmr::memory_resource
+    ///
+    /// \return this == &other
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    using utils = detail::unsynchronized_pool_resource_utils;
+    using bins = std::array<detail::counted_free_list, utils::block_sizes.size()>;
+
+    /// \brief Free blocks of one cache, on a cache line of its own since every cache is used by other threads.
+    ///
+    /// The lock is only contended if threads share the cache. It is held for a few list operations only and never
+    /// while the depot lock is taken or memory is allocated from the pools.
+    struct alignas(64) cache
+    {
+        std::mutex mutex{};
+        bins free_blocks{};
+    };
+
+    static std::size_t default_cache_count() { return std::max(1U, std::thread::hardware_concurrency()); }
+
+    /// \returns The number of blocks that are moved between a cache and the depot at once.
+    static std::size_t batch_size(const std::ptrdiff_t pool_index)
+    {
+        constexpr std::size_t batch_bytes{4096U};
+        constexpr std::size_t max_batch_size{32U};
+        return std::clamp(batch_bytes / score::cpp::at(utils::block_sizes, pool_index), 1_UZ, max_batch_size);
+    }
+
+    /// \returns The cache of the calling thread, which may be shared with other threads, see class description.
+    cache& local_cache() { return caches_[detail::current_thread_ordinal() % cache_count_]; }
+
+    unsynchronized_pool_resource pool_;
+    std::ptrdiff_t pool_count_;
+    std::mutex depot_mutex_;
+    bins depot_;
+    std::size_t cache_count_;
+    cache* caches_;
+};
+
+inline thread_caching_pool_resource::thread_caching_pool_resource(const pool_options& opts,
+                                                                  const std::size_t cache_count,
+                                                                  memory_resource* const upstream)
+    : memory_resource{}
+    , pool_{opts, upstream}
+    , pool_count_{utils::get_pool_index(pool_.options().largest_required_pool_block, 1U) + 1}
+    , depot_mutex_{}
+    , depot_{}
+    , cache_count_{cache_count}
+    , caches_{}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(cache_count > 0U);
+    polymorphic_allocator<cache> cache_allocator{upstream};
+    caches_ = cache_allocator.allocate(cache_count_);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT(caches_ != nullptr);
+    for (std::size_t i{0U}; i < cache_count_; ++i)
+    {
+        cache_allocator.construct(caches_ + i);
+    }
+}
+
+inline thread_caching_pool_resource::~thread_caching_pool_resource()
+{
+    release();
+    polymorphic_allocator<cache> cache_allocator{upstream_resource()};
+    for (std::size_t i{0U}; i < cache_count_; ++i)
+    {
+        caches_[i].~cache();
+    }
+    cache_allocator.deallocate(caches_, cache_count_);
+}
+
+inline void thread_caching_pool_resource::release()
+{
+    for (std::size_t i{0U}; i < cache_count_; ++i)
+    {
+        const std::lock_guard<std::mutex> lock{caches_[i].mutex};
+        for (auto& free_blocks : caches_[i].free_blocks)
+        {
+            free_blocks.clear();
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock{depot_mutex_};
+    for (auto& free_blocks : depot_)
+    {
+        free_blocks.clear();
+    }
+    pool_.release();
+}
+
+inline void* thread_caching_pool_resource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_DBG(score::cpp::has_single_bit(alignment));
+
+    const std::ptrdiff_t pool_index{utils::get_pool_index(bytes, alignment)};
+    if (pool_index >= pool_count_)
+    {
+        const std::lock_guard<std::mutex> lock{depot_mutex_};
+        return pool_.allocate(bytes, alignment);
+    }
+
+    cache& local{local_cache()};
+    {
+        const std::lock_guard<std::mutex> lock{local.mutex};
+        auto& free_blocks = score::cpp::at(local.free_blocks, pool_index);
+        if (!free_blocks.empty())
+        {
+            return free_blocks.pop_front();
+        }
+    }
+
+    // The batch is taken without holding the lock of the cache, such that threads sharing the cache do not wait for
+    // the depot or for the upstream resource
+    const std::size_t count{batch_size(pool_index)};
+    detail::counted_free_list batch{};
+    {
+        const std::lock_guard<std::mutex> depot_lock{depot_mutex_};
+        auto& depot_blocks = score::cpp::at(depot_, pool_index);
+        // Blocks carved from the pool of the same index satisfy the same alignment, as the index of a block size that
+        // is requested with an alignment of 1 is the one of the block size itself. They are carved into the depot, such
+        // that none is lost if the upstream resource throws.
+        const std::size_t block_size{score::cpp::at(utils::block_sizes, pool_index)};
+        for (std::size_t i{depot_blocks.size()}; i < count; ++i)
+        {
+            depot_blocks.push_front(pool_.allocate(block_size, 1U));
+        }
+        depot_blocks.splice_front_to(batch, count);
+    }
+    void* const ptr{batch.pop_front()};
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_DBG(ptr != nullptr);
+
+    const std::lock_guard<std::mutex> lock{local.mutex};
+    batch.splice_front_to(score::cpp::at(local.free_blocks, pool_index), batch.size());
+    return ptr;
+}
+
+inline void
+thread_caching_pool_resource::do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment)
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_DBG(score::cpp::has_single_bit(alignment));
+
+    const std::ptrdiff_t pool_index{utils::get_pool_index(bytes, alignment)};
+    if (pool_index >= pool_count_)
+    {
+        const std::lock_guard<std::mutex> lock{depot_mutex_};
+        pool_.deallocate(p, bytes, alignment);
+        return;
+    }
+
+    cache& local{local_cache()};
+    const std::size_t count{batch_size(pool_index)};
+    detail::counted_free_list batch{};
+    {
+        const std::lock_guard<std::mutex> lock{local.mutex};
+        auto& free_blocks = score::cpp::at(local.free_blocks, pool_index);
+        free_blocks.push_front(p);
+        if (free_blocks.size() >= (2U * count))
+        {
+            free_blocks.splice_front_to(batch, count);
+        }
+    }
+
+    // The batch is returned without holding the lock of the cache
+    if (!batch.empty())
+    {
+        const std::lock_guard<std::mutex> depot_lock{depot_mutex_};
+        batch.splice_front_to(score::cpp::at(depot_, pool_index), batch.size());
+    }
+}
+
+} // namespace pmr
+} // namespace score::cpp
+
+#endif // SCORE_LANGUAGE_FUTURECPP_PRIVATE_MEMORY_RESOURCE_THREAD_CACHING_POOL_RESOURCE_HPP
@@ -52,6 +52,56 @@ namespace neon
 template <typename T>
 struct mask_backend;
 
+template <>
+struct mask_backend<std::uint8_t>
+{
+    using type = uint8x16_t;
+    static constexpr std::size_t width{16};
+
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE broadcast(const bool v) noexcept
+    {
+        return vdupq_n_u8(static_cast<std::uint8_t>(0U - static_cast<std::uint32_t>(v)));
+    }
+
+    template <typename G, std::size_t... Is>
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE init(G&& gen, const std::index_sequence<Is...>) noexcept
+    {
+        static_assert(sizeof...(Is) == width, "one generator call per element");
+        const type r{static_cast<std::uint8_t>(gen(std::integral_constant<std::size_t, Is>{}))...};
+        return vsubq_u8(vdupq_n_u8(0U), r);
+    }
+
+    static bool SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE extract(const type v, const std::size_t i) noexcept
+    {
+        alignas(16) std::uint8_t tmp[width];
+        vst1q_u8(&tmp[0], v);
+        return tmp[i] != 0;
+    }
+
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE logical_not(const type v) noexcept { return vceqzq_u8(v); }
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE logical_and(const type a, const type b) noexcept
+    {
+        return vandq_u8(a, b);
+    }
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE logical_or(const type a, const type b) noexcept
+    {
+        return vorrq_u8(a, b);
+    }
+
+    static bool SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE all_of(const type v) noexcept { return vminvq_u8(v) == 0xFFU; }
+    static bool SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE any_of(const type v) noexcept { return vmaxvq_u8(v) != 0U; }
+    static bool SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE none_of(const type v) noexcept { return vmaxvq_u8(v) == 0U; }
+
+    // NEON has no movemask. Weight each lane with its bit and sum up both halves separately.
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        const type weights{1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U};
+        const type bits{vandq_u8(v, weights)};
+        return static_cast<std::uint64_t>(vaddv_u8(vget_low_u8(bits))) |
+               (static_cast<std::uint64_t>(vaddv_u8(vget_high_u8(bits))) << 8U);
+    }
+};
+
 template <>
 struct mask_backend<std::int32_t>
 {
@@ -105,6 +155,12 @@ struct mask_backend<std::int32_t>
     {
         return vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(v)), 0) == 0;
     }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        const type weights{1U, 2U, 4U, 8U};
+        return vaddvq_u32(vandq_u32(v, weights));
+    }
 };
 
 template <>
@@ -160,6 +216,12 @@ struct mask_backend<float>
     {
         return vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(v)), 0) == 0;
     }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        const type weights{1U, 2U, 4U, 8U};
+        return vaddvq_u32(vandq_u32(v, weights));
+    }
 };
 
 template <>
@@ -213,6 +275,12 @@ struct mask_backend<double>
     {
         return vget_lane_u64(vreinterpret_u64_u32(vmovn_u64(v)), 0) == 0;
     }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        const type weights{1U, 2U};
+        return vaddvq_u64(vandq_u64(v, weights));
+    }
 };
 
 template <typename T>
@@ -222,8 +290,18 @@ template <>
 struct backend<std::uint8_t>
 {
     using type = uint8x16_t;
+    using mask_type = mask_backend<std::uint8_t>::type;
     static constexpr std::size_t width{16};
 
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE broadcast(const std::uint8_t v) noexcept { return vdupq_n_u8(v); }
+
+    template <typename G, std::size_t... Is>
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE init(G&& gen, const std::index_sequence<Is...>) noexcept
+    {
+        static_assert(sizeof...(Is) == width, "one generator call per element");
+        return type{static_cast<std::uint8_t>(gen(std::integral_constant<std::size_t, Is>{}))...};
+    }
+
     static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE load(const std::uint8_t* const v) noexcept
     {
         return vld1q_u8(v);
@@ -232,6 +310,31 @@ struct backend<std::uint8_t>
     {
         return vld1q_u8(v);
     }
+    static void SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE store(std::uint8_t* const v, const type a) noexcept
+    {
+        vst1q_u8(v, a);
+    }
+    static void SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE store_aligned(std::uint8_t* const v, const type a) noexcept
+    {
+        vst1q_u8(v, a);
+    }
+
+    static std::uint8_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE extract(const type v, const std::size_t i) noexcept
+    {
+        alignas(16) std::uint8_t tmp[width];
+        vst1q_u8(&tmp[0], v);
+        return tmp[i];
+    }
+
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE equal(const type a, const type b) noexcept { return vceqq_u8(a, b); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE not_equal(const type a, const type b) noexcept { return vmvnq_u8(vceqq_u8(a, b)); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE less_than(const type a, const type b) noexcept { return vcltq_u8(a, b); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE less_equal(const type a, const type b) noexcept { return vcleq_u8(a, b); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE greater_than(const type a, const type b) noexcept { return vcgtq_u8(a, b); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE greater_equal(const type a, const type b) noexcept { return vcgeq_u8(a, b); }
+
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE min(const type a, const type b) noexcept { return vminq_u8(a, b); }
+    static type SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE max(const type a, const type b) noexcept { return vmaxq_u8(a, b); }
 
     static std::array<float32x4_t, 4> SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_AARCH64_NEON_ALWAYS_INLINE convert(const type v, float) noexcept
     {
@@ -661,6 +764,11 @@ struct native_abi<double>
     using type = neon::abi<double>;
 };
 
+template <>
+struct deduce_abi<std::uint8_t, 16>
+{
+    using type = native_abi<std::uint8_t>::type;
+};
 template <>
 struct deduce_abi<std::int32_t, 4>
 {
@@ -682,6 +790,10 @@ struct deduce_abi<double, 2>
     using type = native_abi<double>::type;
 };
 
+template <>
+struct is_abi_tag<neon::abi<std::uint8_t>> : std::true_type
+{
+};
 template <>
 struct is_abi_tag<neon::abi<std::int32_t>> : std::true_type
 {
@@ -29,6 +29,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 // usable on QNX for ASIL B software. covered by requirement broken_link_c/issue/4049789
@@ -87,6 +88,11 @@ struct array_mask
     {
         return (... && Abi::none_of(v[Is]));
     }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_PRIVATE_SIMD_ARRAY_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        return (... | (Abi::to_bits(v[Is]) << (Is * Abi::width)));
+    }
 };
 
 template <typename T, typename Abi, typename MaskAbi, std::size_t... Is>
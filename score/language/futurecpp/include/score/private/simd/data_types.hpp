@@ -33,6 +33,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -278,6 +279,15 @@ public:
         return basic_mask{Abi::mask_impl::logical_or(static_cast<type>(lhs), static_cast<type>(rhs))};
     }
 
+    /// \brief Returns an integer where the ith bit is set if and only if the ith element is true.
+    ///
+    /// [simd.mask.conv] 29.10.9.4 (C++26)
+    unsigned long long SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE to_ullong() const noexcept
+    {
+        static_assert(size() <= 64U, "bits do not fit into unsigned long long");
+        return static_cast<unsigned long long>(Abi::mask_impl::to_bits(v_));
+    }
+
 private:
     typename Abi::mask_impl::type v_;
 };
@@ -327,6 +337,41 @@ inline bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE none_of(const basic_mask
     return Abi::mask_impl::none_of(static_cast<typename Abi::mask_impl::type>(v));
 }
 
+/// \brief Returns the number of true elements in v.
+///
+/// [parallel] 9.9.4 5
+template <typename T, typename Abi>
+inline int SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE popcount(const basic_mask<T, Abi>& v) noexcept
+{
+    return score::cpp::popcount(v.to_ullong());
+}
+
+/// \brief Returns the lowest index i where v[i] is true.
+///
+/// @pre any_of(v) returns true.
+///
+/// [parallel] 9.9.4 6 and 7
+template <typename T, typename Abi>
+inline int SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE find_first_set(const basic_mask<T, Abi>& v)
+{
+    const unsigned long long bits{v.to_ullong()};
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_DBG(bits != 0U);
+    return score::cpp::countr_zero(bits);
+}
+
+/// \brief Returns the greatest index i where v[i] is true.
+///
+/// @pre any_of(v) returns true.
+///
+/// [parallel] 9.9.4 8 and 9
+template <typename T, typename Abi>
+inline int SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE find_last_set(const basic_mask<T, Abi>& v)
+{
+    const unsigned long long bits{v.to_ullong()};
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_DBG(bits != 0U);
+    return std::numeric_limits<unsigned long long>::digits - 1 - score::cpp::countl_zero(bits);
+}
+
 /// \brief The class template `simd` is a data-parallel type with the element type `T`.
 ///
 /// `T` must be either an integral type, `std::is_integral_v<T> == true`, or a floating point type,
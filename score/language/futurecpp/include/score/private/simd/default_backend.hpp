@@ -73,6 +73,8 @@ struct mask_backend
     static bool any_of(const bool v) noexcept { return v; }
 
     static bool none_of(const bool v) noexcept { return !v; }
+
+    static std::uint64_t to_bits(const bool v) noexcept { return v ? 1U : 0U; }
 };
 
 template <typename T>
@@ -195,6 +197,11 @@ struct native_abi<double>
     using type = scalar::deduce_native_abi<double>;
 };
 
+template <>
+struct deduce_abi<std::uint8_t, 8>
+{
+    using type = native_abi<std::uint8_t>::type;
+};
 template <>
 struct deduce_abi<std::int32_t, 2>
 {
@@ -216,6 +223,10 @@ struct deduce_abi<double, 1>
     using type = native_abi<double>::type;
 };
 
+template <>
+struct is_abi_tag<scalar::abi<std::uint8_t, 0, 1, 2, 3, 4, 5, 6, 7>> : std::true_type
+{
+};
 template <>
 struct is_abi_tag<scalar::abi<std::int32_t, 0, 1>> : std::true_type
 {
@@ -86,6 +86,47 @@ struct float64x2_t
 template <typename T>
 struct mask_backend;
 
+template <>
+struct mask_backend<std::uint8_t>
+{
+    using type = uint8x16_t;
+    static constexpr std::size_t width{16};
+
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE broadcast(const bool v) noexcept
+    {
+        return _mm_set1_epi8(static_cast<char>(-static_cast<std::int32_t>(v)));
+    }
+
+    template <typename G, std::size_t... Is>
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE init(G&& gen, const std::index_sequence<Is...>) noexcept
+    {
+        static_assert(sizeof...(Is) == width, "one generator call per element");
+        const auto r = _mm_setr_epi8(static_cast<char>(gen(std::integral_constant<std::size_t, Is>{}))...);
+        return _mm_sub_epi8(_mm_setzero_si128(), r);
+    }
+
+    static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE extract(const type v, const std::size_t i) noexcept
+    {
+        return (static_cast<std::uint32_t>(_mm_movemask_epi8(v)) & (1U << i)) != 0U;
+    }
+
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE logical_not(const type v) noexcept
+    {
+        return _mm_cmpeq_epi8(v, _mm_setzero_si128());
+    }
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE logical_and(const type a, const type b) noexcept { return _mm_and_si128(a, b); }
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE logical_or(const type a, const type b) noexcept { return _mm_or_si128(a, b); }
+
+    static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE all_of(const type v) noexcept { return _mm_movemask_epi8(v) == 0xFFFF; }
+    static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE any_of(const type v) noexcept { return _mm_movemask_epi8(v) != 0; }
+    static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE none_of(const type v) noexcept { return _mm_movemask_epi8(v) == 0; }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        return static_cast<std::uint64_t>(_mm_movemask_epi8(v));
+    }
+};
+
 template <>
 struct mask_backend<std::int32_t>
 {
@@ -122,6 +163,11 @@ struct mask_backend<std::int32_t>
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE all_of(const type v) noexcept { return _mm_movemask_epi8(v) == 0xFFFF; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE any_of(const type v) noexcept { return _mm_movemask_epi8(v) != 0; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE none_of(const type v) noexcept { return _mm_movemask_epi8(v) == 0; }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        return static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(v)));
+    }
 };
 
 template <>
@@ -157,6 +203,11 @@ struct mask_backend<float>
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE all_of(const type v) noexcept { return _mm_movemask_ps(v) == 0b1111; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE any_of(const type v) noexcept { return _mm_movemask_ps(v) != 0; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE none_of(const type v) noexcept { return _mm_movemask_ps(v) == 0; }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        return static_cast<std::uint64_t>(_mm_movemask_ps(v));
+    }
 };
 
 template <>
@@ -190,6 +241,11 @@ struct mask_backend<double>
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE all_of(const type v) noexcept { return _mm_movemask_pd(v) == 0b11; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE any_of(const type v) noexcept { return _mm_movemask_pd(v) != 0; }
     static bool SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE none_of(const type v) noexcept { return _mm_movemask_pd(v) == 0; }
+
+    static std::uint64_t SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE to_bits(const type v) noexcept
+    {
+        return static_cast<std::uint64_t>(_mm_movemask_pd(v));
+    }
 };
 
 template <typename T>
@@ -199,8 +255,18 @@ template <>
 struct backend<std::uint8_t>
 {
     using type = uint8x16_t;
+    using mask_type = mask_backend<std::uint8_t>::type;
     static constexpr std::size_t width{16};
 
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE broadcast(const std::uint8_t v) noexcept { return _mm_set1_epi8(static_cast<char>(v)); }
+
+    template <typename G, std::size_t... Is>
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE init(G&& gen, const std::index_sequence<Is...>) noexcept
+    {
+        static_assert(sizeof...(Is) == width, "one generator call per element");
+        return _mm_setr_epi8(static_cast<char>(gen(std::integral_constant<std::size_t, Is>{}))...);
+    }
+
     static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE load(const std::uint8_t* const v) noexcept
     {
         return _mm_loadu_si128(reinterpret_cast<const __m128i*>(v));
@@ -209,6 +275,47 @@ struct backend<std::uint8_t>
     {
         return _mm_load_si128(reinterpret_cast<const __m128i*>(v));
     }
+    static void SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE store(std::uint8_t* const v, const type a) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(v), a);
+    }
+    static void SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE store_aligned(std::uint8_t* const v, const type a) noexcept
+    {
+        _mm_store_si128(reinterpret_cast<__m128i*>(v), a);
+    }
+
+    static std::uint8_t SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE extract(const type v, const std::size_t i) noexcept
+    {
+        alignas(16) std::uint8_t tmp[width];
+        _mm_store_si128(reinterpret_cast<__m128i*>(tmp), v);
+        return tmp[i];
+    }
+
+    // SSE has no unsigned byte comparison. `min(a, b) == a` is equivalent to `a <= b`.
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE equal(const type a, const type b) noexcept { return _mm_cmpeq_epi8(a, b); }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE not_equal(const type a, const type b) noexcept
+    {
+        return _mm_xor_si128(_mm_cmpeq_epi8(a, b), _mm_set1_epi8(-1));
+    }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE less_than(const type a, const type b) noexcept
+    {
+        return _mm_xor_si128(greater_equal(a, b), _mm_set1_epi8(-1));
+    }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE less_equal(const type a, const type b) noexcept
+    {
+        return _mm_cmpeq_epi8(_mm_min_epu8(a, b), a);
+    }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE greater_than(const type a, const type b) noexcept
+    {
+        return _mm_xor_si128(less_equal(a, b), _mm_set1_epi8(-1));
+    }
+    static mask_type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE greater_equal(const type a, const type b) noexcept
+    {
+        return _mm_cmpeq_epi8(_mm_max_epu8(a, b), a);
+    }
+
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE min(const type a, const type b) noexcept { return _mm_min_epu8(a, b); }
+    static type SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE max(const type a, const type b) noexcept { return _mm_max_epu8(a, b); }
 
     static std::array<float32x4_t, 4> SCORE_LANGUAGE_FUTURECPP_SIMD_ALWAYS_INLINE convert(const type v, float) noexcept
     {
@@ -522,6 +629,11 @@ struct native_abi<double>
     using type = sse42::abi<double>;
 };
 
+template <>
+struct deduce_abi<std::uint8_t, 16>
+{
+    using type = native_abi<std::uint8_t>::type;
+};
 template <>
 struct deduce_abi<std::int32_t, 4>
 {
@@ -543,6 +655,10 @@ struct deduce_abi<double, 2>
     using type = native_abi<double>::type;
 };
 
+template <>
+struct is_abi_tag<sse42::abi<std::uint8_t>> : std::true_type
+{
+};
 template <>
 struct is_abi_tag<sse42::abi<std::int32_t>> : std::true_type
 {
@@ -0,0 +1,213 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+#include <score/execution.hpp>
+#include <score/execution.hpp> // test include guard
+
+#include <score/type_traits.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace score::cpp
+{
+namespace execution
+{
+namespace
+{
+
+struct inline_sender
+{
+    using sender_concept = sender_t;
+
+    template <typename Receiver>
+    struct op_state
+    {
+        using operation_state_concept = operation_state_t;
+
+        void start() &
+        {
+            if (stopped)
+            {
+                set_stopped(std::move(r));
+            }
+            else
+            {
+                set_value(std::move(r));
+            }
+        }
+
+        Receiver r;
+        bool stopped;
+    };
+
+    template <typename Receiver>
+    op_state<score::cpp::remove_cvref_t<Receiver>> connect(Receiver&& r) const
+    {
+        return {std::forward<Receiver>(r), stopped};
+    }
+
+    bool stopped;
+};
+
+struct result_receiver
+{
+    using receiver_concept = receiver_t;
+
+    void set_value() && { ++*values; }
+    void set_stopped() && { ++*stops; }
+
+    std::int32_t* values;
+    std::int32_t* stops;
+};
+
+/// Runs the helpers of `bulk` inline, optionally completing them with `set_stopped()`.
+struct inline_scheduler
+{
+    using scheduler_concept = scheduler_t;
+
+    inline_sender schedule() const { return {stopped}; }
+    std::int32_t max_concurrency() const noexcept { return concurrency; }
+
+    std::int32_t concurrency;
+    bool stopped;
+};
+
+std::vector<std::int32_t> run_bulk(const inline_scheduler sch, const std::int32_t shape)
+{
+    std::vector<std::int32_t> invocations(static_cast<std::size_t>(shape > 0 ? shape : 0), 0);
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto op = connect(bulk(inline_sender{false}, sch, shape, [&invocations](const std::int32_t i) {
+                          ++invocations.at(static_cast<std::size_t>(i));
+                      }),
+                      result_receiver{&values, &stops});
+    start(op);
+    EXPECT_EQ(values, 1);
+    EXPECT_EQ(stops, 0);
+    return invocations;
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenShape_ExpectEveryIndexInvokedOnce)
+{
+    for (const std::int32_t concurrency : {1, 2, 4, 16})
+    {
+        for (const std::int32_t shape : {0, 1, 3, 7, 64, 1000, 1001})
+        {
+            const auto invocations = run_bulk(inline_scheduler{concurrency, false}, shape);
+            for (const auto count : invocations)
+            {
+                EXPECT_EQ(count, 1) << "concurrency " << concurrency << ", shape " << shape;
+            }
+        }
+    }
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenHelpersAreStopped_ExpectEveryIndexInvokedOnceByCompletingThread)
+{
+    const auto invocations = run_bulk(inline_scheduler{4, true}, 1000);
+
+    for (const auto count : invocations)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenNegativeShape_ExpectNoInvocation)
+{
+    std::int32_t invocations{0};
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto op = connect(bulk(inline_sender{false}, inline_scheduler{2, false}, -5, [&invocations](auto) { ++invocations; }),
+                      result_receiver{&values, &stops});
+    start(op);
+
+    EXPECT_EQ(invocations, 0);
+    EXPECT_EQ(values, 1);
+    EXPECT_EQ(stops, 0);
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenStoppedInputSender_ExpectStoppedAndNoInvocation)
+{
+    std::int32_t invocations{0};
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto op = connect(inline_sender{true} | bulk(inline_scheduler{2, false}, 10, [&invocations](auto) { ++invocations; }),
+                      result_receiver{&values, &stops});
+    start(op);
+
+    EXPECT_EQ(invocations, 0);
+    EXPECT_EQ(values, 0);
+    EXPECT_EQ(stops, 1);
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenLValueSender_ExpectReusable)
+{
+    std::int32_t invocations{0};
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto sender = bulk(inline_sender{false}, inline_scheduler{1, false}, 10, [&invocations](auto) { ++invocations; });
+
+    auto op1 = connect(sender, result_receiver{&values, &stops});
+    start(op1);
+    auto op2 = connect(sender, result_receiver{&values, &stops});
+    start(op2);
+
+    EXPECT_EQ(invocations, 20);
+    EXPECT_EQ(values, 2);
+}
+
+// NOTRACING
+TEST(bulk_test, bulk_GivenCpuContext_ExpectEveryIndexInvokedOnce)
+{
+    constexpr std::int32_t shape{100000};
+    cpu_context ctx{cpu_context::worker_count{4}};
+    auto sch = ctx.get_scheduler();
+    std::vector<std::atomic<std::int32_t>> invocations(static_cast<std::size_t>(shape));
+
+    const bool completed{sync_wait(schedule(sch) | bulk(sch, shape, [&invocations](const std::int32_t i) {
+                                       invocations[static_cast<std::size_t>(i)].fetch_add(1, std::memory_order_relaxed);
+                                   }))};
+
+    EXPECT_TRUE(completed);
+    for (const auto& count : invocations)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+// NOTRACING
+TEST(bulk_test, max_concurrency_GivenCpuScheduler_ExpectNumberOfWorkers)
+{
+    cpu_context ctx{cpu_context::worker_count{3}};
+
+    EXPECT_EQ(ctx.get_scheduler().max_concurrency(), 3);
+}
+
+} // namespace
+} // namespace execution
+} // namespace score::cpp
@@ -33,11 +33,15 @@
 #include <score/memory.hpp>
 #include <score/size.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <memory>
 #include <new>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -1601,4 +1605,348 @@ TEST_P(block_sizes_logarithmic, Spec)
               get_pool_index_spec(get_block_size(), get_alignment()));
 }
 
+template <typename Resource>
+struct thread_safe_pool_resource_test : testing::Test
+{
+    test_memory_resource upstream{};
+};
+
+using thread_safe_pool_resources =
+    ::testing::Types<score::cpp::pmr::synchronized_pool_resource, score::cpp::pmr::thread_caching_pool_resource>;
+TYPED_TEST_SUITE(thread_safe_pool_resource_test, thread_safe_pool_resources, );
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, UpstreamIsConstructorArgument)
+{
+    EXPECT_EQ(TypeParam{&this->upstream}.upstream_resource(), &this->upstream);
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenConstructAndUpstreamIsNullptrThenPanic)
+{
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED((TypeParam{nullptr}));
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED((TypeParam{score::cpp::pmr::pool_options{}, nullptr}));
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenConstructAndUpstreamIsNotProvidedThenUseDefault)
+{
+    EXPECT_EQ(TypeParam{}.upstream_resource(), score::cpp::pmr::get_default_resource());
+    EXPECT_EQ(TypeParam{score::cpp::pmr::pool_options{}}.upstream_resource(), score::cpp::pmr::get_default_resource());
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, OptionsAreTheOnesOfUnsynchronizedPoolResource)
+{
+    const score::cpp::pmr::pool_options opts{100U, 1000U};
+    const TypeParam unit{opts, &this->upstream};
+    const score::cpp::pmr::unsynchronized_pool_resource reference{opts, &this->upstream};
+    EXPECT_EQ(unit.options().max_blocks_per_chunk, reference.options().max_blocks_per_chunk);
+    EXPECT_EQ(unit.options().largest_required_pool_block, reference.options().largest_required_pool_block);
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, SameObjectsAreEqual)
+{
+    TypeParam unit{&this->upstream};
+    EXPECT_TRUE(unit.is_equal(unit));
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, DifferentObjectsAreUnequal)
+{
+    TypeParam unit{&this->upstream};
+    TypeParam other{&this->upstream};
+    EXPECT_FALSE(unit.is_equal(other));
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenAllocateThenAlignmentIsRespected)
+{
+    TypeParam unit{&this->upstream};
+    for (std::size_t alignment{1U}; alignment <= 64U; alignment *= 2U)
+    {
+        for (std::size_t bytes{1U}; bytes <= 8000U; bytes += 97U)
+        {
+            void* const p{unit.allocate(bytes, alignment)};
+            EXPECT_TRUE(is_aligned(p, alignment));
+            std::memset(p, 0xAB, bytes);
+            unit.deallocate(p, bytes, alignment);
+        }
+    }
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenDeallocateThenBlockIsReused)
+{
+    TypeParam unit{&this->upstream};
+    void* const p{unit.allocate(42U, 8U)};
+    unit.deallocate(p, 42U, 8U);
+    EXPECT_EQ(unit.allocate(42U, 8U), p);
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenAllocateAndSizeIsGreaterThanLargestRequiredPoolBlockThenAllocateUpstream)
+{
+    TypeParam unit{score::cpp::pmr::pool_options{0U, 1024U}, &this->upstream};
+    void* const p{unit.allocate(2000U, 16U)};
+    EXPECT_FALSE(this->upstream.allocations.at(p).is_freed);
+    unit.deallocate(p, 2000U, 16U);
+    EXPECT_TRUE(this->upstream.allocations.at(p).is_freed);
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenReleaseThenAllMemoryIsFreedAndResourceIsStillUsable)
+{
+    TypeParam unit{&this->upstream};
+    score::cpp::ignore = unit.allocate(42U, 8U);
+    score::cpp::ignore = unit.allocate(300U, 8U);
+    score::cpp::ignore = unit.allocate(100000U, 8U);
+
+    unit.release();
+
+    const auto unfreed_allocations = [this]() {
+        return std::count_if(this->upstream.allocations.begin(),
+                             this->upstream.allocations.end(),
+                             [](const auto& allocation) { return !allocation.second.is_freed; });
+    };
+    const auto remaining_after_release = unfreed_allocations();
+    void* const p{unit.allocate(42U, 8U)};
+    EXPECT_NE(p, nullptr);
+    unit.deallocate(p, 42U, 8U);
+    unit.release();
+    EXPECT_EQ(unfreed_allocations(), remaining_after_release);
+}
+
+// NOTRACING
+TYPED_TEST(thread_safe_pool_resource_test, WhenAllocateAndDeallocateFromManyThreadsThenBlocksAreNeverSharedAndAllFreed)
+{
+    constexpr std::size_t thread_count{4U};
+    constexpr std::size_t iterations{2000U};
+    TypeParam unit{&this->upstream};
+
+    // every block is allocated by one thread and deallocated by the next one, as done by producers and consumers
+    std::vector<std::atomic<void*>> handover(thread_count);
+    std::vector<std::thread> threads{};
+    for (std::size_t t{0U}; t < thread_count; ++t)
+    {
+        threads.emplace_back([&unit, &handover, t]() {
+            std::vector<unsigned char*> own{};
+            for (std::size_t i{0U}; i < iterations; ++i)
+            {
+                const std::size_t bytes{8U + ((i * 24U) % 256U)};
+                auto* const p = static_cast<unsigned char*>(unit.allocate(bytes, 8U));
+                std::memset(p, static_cast<int>(t), bytes);
+                own.push_back(p);
+                if (own.size() == 4U)
+                {
+                    for (unsigned char* const q : own)
+                    {
+                        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(*q == static_cast<unsigned char>(t));
+                    }
+                    void* const stolen{handover[(t + 1U) % thread_count].exchange(nullptr)};
+                    if (stolen != nullptr)
+                    {
+                        unit.deallocate(stolen, 8U, 8U);
+                    }
+                    void* const previous{handover[t].exchange(unit.allocate(8U, 8U))};
+                    if (previous != nullptr)
+                    {
+                        unit.deallocate(previous, 8U, 8U);
+                    }
+                    for (std::size_t j{0U}; j < own.size(); ++j)
+                    {
+                        const std::size_t freed_bytes{8U + (((i - 3U + j) * 24U) % 256U)};
+                        unit.deallocate(own[j], freed_bytes, 8U);
+                    }
+                    own.clear();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (auto& p : handover)
+    {
+        if (p.load() != nullptr)
+        {
+            unit.deallocate(p.load(), 8U, 8U);
+        }
+    }
+}
+
+struct thread_caching_pool_resource_test : testing::Test
+{
+    test_memory_resource upstream{};
+};
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenConstructAndCacheCountIsZeroThenPanic)
+{
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        (score::cpp::pmr::thread_caching_pool_resource{score::cpp::pmr::pool_options{}, 0U, &upstream}));
+}
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenConstructWithoutCacheCountThenOneCachePerHardwareThread)
+{
+    const score::cpp::pmr::thread_caching_pool_resource unit{&upstream};
+    EXPECT_EQ(unit.cache_count(), std::max(1U, std::thread::hardware_concurrency()));
+    const score::cpp::pmr::thread_caching_pool_resource three_caches{score::cpp::pmr::pool_options{}, 3U, &upstream};
+    EXPECT_EQ(three_caches.cache_count(), 3U);
+}
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenAllocateThenABatchOfBlocksIsTakenFromThePoolAtOnce)
+{
+    score::cpp::pmr::thread_caching_pool_resource unit{score::cpp::pmr::pool_options{}, 1U, &upstream};
+    std::vector<void*> blocks{unit.allocate(64U, 8U)};
+    const auto upstream_allocations = upstream.allocations.size();
+
+    // a batch of 64 byte blocks fills 4 KiB, but is limited to 32 blocks
+    for (std::size_t i{1U}; i < 32U; ++i)
+    {
+        blocks.push_back(unit.allocate(64U, 8U));
+    }
+
+    EXPECT_EQ(upstream.allocations.size(), upstream_allocations);
+    std::sort(blocks.begin(), blocks.end());
+    EXPECT_EQ(std::adjacent_find(blocks.begin(), blocks.end()), blocks.end());
+    for (void* const p : blocks)
+    {
+        unit.deallocate(p, 64U, 8U);
+    }
+}
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenCacheHoldsTwoBatchesThenOneIsReturnedToTheDepotAndReusedByOtherCaches)
+{
+    score::cpp::pmr::thread_caching_pool_resource unit{score::cpp::pmr::pool_options{}, 64U, &upstream};
+
+    // Given a thread that allocated and deallocated two batches
+    std::vector<void*> blocks(64U);
+    std::thread first{[&unit, &blocks]() {
+        for (auto& p : blocks)
+        {
+            p = unit.allocate(64U, 8U);
+        }
+        for (void* const p : blocks)
+        {
+            unit.deallocate(p, 64U, 8U);
+        }
+    }};
+    first.join();
+    const auto upstream_allocations = upstream.allocations.size();
+
+    // When another thread allocates a batch
+    void* reused{};
+    std::thread second{[&unit, &reused]() { reused = unit.allocate(64U, 8U); }};
+    second.join();
+
+    // Then it is served from the depot without a new chunk
+    EXPECT_EQ(upstream.allocations.size(), upstream_allocations);
+    EXPECT_NE(std::find(blocks.begin(), blocks.end(), reused), blocks.end());
+}
+
+/// \brief Forwards to the new_delete_resource, but holds allocations back while blocking is requested.
+class blocking_memory_resource : public score::cpp::pmr::memory_resource
+{
+public:
+    std::atomic<bool> blocking{false};
+    std::atomic<bool> blocked{false};
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        while (blocking.load())
+        {
+            blocked = true;
+            std::this_thread::yield();
+        }
+        return score::cpp::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        score::cpp::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// NOTRACING
+TEST(thread_caching_pool_resource, WhenAThreadAllocatesFromUpstreamThenThreadsSharingItsCacheAreNotBlocked)
+{
+    blocking_memory_resource upstream{};
+    score::cpp::pmr::thread_caching_pool_resource unit{score::cpp::pmr::pool_options{}, 1U, &upstream};
+
+    // Given a thread that waits for the upstream resource while refilling the cache that all threads share
+    void* const cached{unit.allocate(64U, 8U)};
+    upstream.blocking = true;
+    void* refilled{};
+    std::thread refilling{[&unit, &refilled]() { refilled = unit.allocate(256U, 8U); }};
+    while (!upstream.blocked.load())
+    {
+        std::this_thread::yield();
+    }
+
+    // When another thread allocates and deallocates a block that is in the cache
+    auto other = std::async(std::launch::async, [&unit]() {
+        void* const p{unit.allocate(64U, 8U)};
+        unit.deallocate(p, 64U, 8U);
+    });
+
+    // Then it does not wait for the upstream resource
+    EXPECT_EQ(other.wait_for(std::chrono::seconds{10}), std::future_status::ready);
+
+    upstream.blocking = false;
+    refilling.join();
+    other.wait();
+    unit.deallocate(refilled, 256U, 8U);
+    unit.deallocate(cached, 64U, 8U);
+}
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenThreadsAreAliveAtTheSameTimeThenTheyHoldDistinctOrdinals)
+{
+    std::size_t first{};
+    std::size_t second{};
+    std::atomic<bool> first_started{false};
+    std::atomic<bool> second_done{false};
+
+    std::thread first_thread{[&first, &first_started, &second_done]() {
+        first = score::cpp::pmr::detail::current_thread_ordinal();
+        first_started = true;
+        while (!second_done)
+        {
+            std::this_thread::yield();
+        }
+    }};
+    while (!first_started)
+    {
+        std::this_thread::yield();
+    }
+    std::thread second_thread{[&second]() { second = score::cpp::pmr::detail::current_thread_ordinal(); }};
+    second_thread.join();
+    second_done = true;
+    first_thread.join();
+
+    EXPECT_NE(first, second);
+    EXPECT_NE(first, score::cpp::pmr::detail::current_thread_ordinal());
+}
+
+// NOTRACING
+TEST_F(thread_caching_pool_resource_test, WhenThreadExitsThenItsOrdinalIsReusedByTheNextThread)
+{
+    std::size_t first{};
+    std::thread{[&first]() { first = score::cpp::pmr::detail::current_thread_ordinal(); }}.join();
+
+    std::size_t second{};
+    std::thread{[&second]() { second = score::cpp::pmr::detail::current_thread_ordinal(); }}.join();
+
+    EXPECT_EQ(first, second);
+}
+
 } // anonymous namespace
@@ -62,7 +62,8 @@ class simd_mask_fixture : public testing::Test
 {
 };
 
-using ElementTypes = ::testing::Types<score::cpp::simd::mask<std::int32_t>,
+using ElementTypes = ::testing::Types<score::cpp::simd::mask<std::uint8_t>,
+                                      score::cpp::simd::mask<std::int32_t>,
                                       score::cpp::simd::mask<float>,
                                       score::cpp::simd::mask<double>,
                                       rebind<float, score::cpp::simd::mask<std::uint8_t>>::type>;
@@ -282,4 +283,64 @@ TYPED_TEST(simd_mask_fixture, NoneOf)
     }
 }
 
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398051
+TYPED_TEST(simd_mask_fixture, ToUllong)
+{
+    EXPECT_EQ(TypeParam{false}.to_ullong(), 0U);
+    EXPECT_EQ(TypeParam{true}.to_ullong(), (~0ULL) >> (64U - TypeParam::size()));
+
+    for (std::size_t i{0U}; i < TypeParam::size(); ++i)
+    {
+        generator<TypeParam::size()> gen{false};
+        gen[i] = true;
+        const TypeParam a{gen};
+
+        EXPECT_EQ(a.to_ullong(), 1ULL << i);
+    }
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398051
+TYPED_TEST(simd_mask_fixture, Popcount)
+{
+    generator<TypeParam::size()> gen{false};
+
+    for (std::size_t i{0U}; i < TypeParam::size(); ++i)
+    {
+        EXPECT_EQ(popcount(TypeParam{gen}), static_cast<int>(i));
+        gen[i] = true;
+    }
+    EXPECT_EQ(popcount(TypeParam{gen}), static_cast<int>(TypeParam::size()));
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398051
+TYPED_TEST(simd_mask_fixture, FindFirstSetAndFindLastSet)
+{
+    for (std::size_t i{0U}; i < TypeParam::size(); ++i)
+    {
+        for (std::size_t j{i}; j < TypeParam::size(); ++j)
+        {
+            generator<TypeParam::size()> gen{false};
+            gen[i] = true;
+            gen[j] = true;
+            const TypeParam a{gen};
+
+            EXPECT_EQ(find_first_set(a), static_cast<int>(i));
+            EXPECT_EQ(find_last_set(a), static_cast<int>(j));
+        }
+    }
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398051
+TYPED_TEST(simd_mask_fixture, FindFirstSet_WhenNoneSet_ThenPreconditionViolated)
+{
+    const TypeParam a{false};
+
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(find_first_set(a));
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(find_last_set(a));
+}
+
 } // namespace
@@ -1051,6 +1051,68 @@ TEST(simd_vec, ConvertCharToFloat)
     }
 }
 
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398050
+TEST(simd_vec, ByteLoadAndStore)
+{
+    using vec = score::cpp::simd::vec<std::uint8_t>;
+    std::array<std::uint8_t, vec::size()> seq;
+    std::iota(seq.begin(), seq.end(), std::uint8_t{0xF0U});
+
+    const vec a{seq};
+    std::array<std::uint8_t, vec::size()> r{};
+    unchecked_store(a, r);
+
+    EXPECT_EQ(seq, r);
+    for (std::size_t i{0U}; i < a.size(); ++i)
+    {
+        EXPECT_EQ(a[i], seq[i]);
+    }
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398050
+TEST(simd_vec, ByteCompareIsUnsigned)
+{
+    using vec = score::cpp::simd::vec<std::uint8_t>;
+    std::array<std::uint8_t, vec::size()> seq;
+    std::iota(seq.begin(), seq.end(), std::uint8_t{0x7CU});
+
+    const vec a{seq};
+    const vec pivot{std::uint8_t{0x80U}};
+
+    for (std::size_t i{0U}; i < a.size(); ++i)
+    {
+        EXPECT_EQ((a == pivot)[i], seq[i] == 0x80U);
+        EXPECT_EQ((a != pivot)[i], seq[i] != 0x80U);
+        EXPECT_EQ((a < pivot)[i], seq[i] < 0x80U);
+        EXPECT_EQ((a <= pivot)[i], seq[i] <= 0x80U);
+        EXPECT_EQ((a > pivot)[i], seq[i] > 0x80U);
+        EXPECT_EQ((a >= pivot)[i], seq[i] >= 0x80U);
+        EXPECT_EQ(min(a, pivot)[i], std::min(seq[i], std::uint8_t{0x80U}));
+        EXPECT_EQ(max(a, pivot)[i], std::max(seq[i], std::uint8_t{0x80U}));
+    }
+}
+
+/// @testmethods TM_REQUIREMENT
+/// @requirement CB-#18398050
+TEST(simd_vec, ByteClassifyToBits)
+{
+    using vec = score::cpp::simd::vec<std::uint8_t>;
+    std::array<std::uint8_t, vec::size()> seq;
+    seq.fill(std::uint8_t{'a'});
+    seq.front() = std::uint8_t{'"'};
+    seq.back() = std::uint8_t{'"'};
+
+    const vec a{seq};
+    const auto quotes = (a == vec{std::uint8_t{'"'}});
+
+    EXPECT_EQ(quotes.to_ullong(), 1ULL | (1ULL << (vec::size() - 1U)));
+    EXPECT_EQ(popcount(quotes), 2);
+    EXPECT_EQ(find_first_set(quotes), 0);
+    EXPECT_EQ(find_last_set(quotes), static_cast<int>(vec::size() - 1U));
+}
+
 /// @testmethods TM_REQUIREMENT
 /// @requirement CB-#18398050
 TYPED_TEST(simd_vec_fixture, WhereAssignment)
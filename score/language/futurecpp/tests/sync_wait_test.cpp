@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+#include <score/execution.hpp>
+#include <score/execution.hpp> // test include guard
+
+#include <score/type_traits.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace score::cpp
+{
+namespace execution
+{
+namespace
+{
+
+struct inline_sender
+{
+    using sender_concept = sender_t;
+
+    template <typename Receiver>
+    struct op_state
+    {
+        using operation_state_concept = operation_state_t;
+
+        void start() &
+        {
+            if (stopped)
+            {
+                set_stopped(std::move(r));
+            }
+            else
+            {
+                set_value(std::move(r));
+            }
+        }
+
+        Receiver r;
+        bool stopped;
+    };
+
+    template <typename Receiver>
+    op_state<score::cpp::remove_cvref_t<Receiver>> connect(Receiver&& r) const
+    {
+        return {std::forward<Receiver>(r), stopped};
+    }
+
+    bool stopped;
+};
+
+struct result_receiver
+{
+    using receiver_concept = receiver_t;
+
+    void set_value() && { ++*values; }
+    void set_stopped() && { ++*stops; }
+
+    std::int32_t* values;
+    std::int32_t* stops;
+};
+
+// NOTRACING
+TEST(sync_wait_test, sync_wait_GivenValueSender_ExpectTrue)
+{
+    EXPECT_TRUE(sync_wait(inline_sender{false}));
+}
+
+// NOTRACING
+TEST(sync_wait_test, sync_wait_GivenStoppedSender_ExpectFalse)
+{
+    EXPECT_FALSE(sync_wait(inline_sender{true}));
+}
+
+// NOTRACING
+TEST(sync_wait_test, sync_wait_GivenSenderOnCpuContext_ExpectBlocksUntilCompleted)
+{
+    cpu_context ctx{cpu_context::worker_count{1}};
+    std::thread::id worker{};
+    bool executed{false};
+
+    const bool completed{sync_wait(schedule(ctx.get_scheduler()) | then([&worker, &executed]() {
+                                       worker = std::this_thread::get_id();
+                                       executed = true;
+                                   }))};
+
+    EXPECT_TRUE(completed);
+    EXPECT_TRUE(executed);
+    EXPECT_NE(worker, std::this_thread::get_id());
+}
+
+} // namespace
+} // namespace execution
+} // namespace score::cpp
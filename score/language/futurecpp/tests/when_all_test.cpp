@@ -0,0 +1,145 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+///
+/// @file
+/// @copyright Copyright (c) 2026 Contributors to the Eclipse Foundation
+///
+
+#include <score/execution.hpp>
+#include <score/execution.hpp> // test include guard
+
+#include <score/type_traits.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace score::cpp
+{
+namespace execution
+{
+namespace
+{
+
+struct inline_sender
+{
+    using sender_concept = sender_t;
+
+    template <typename Receiver>
+    struct op_state
+    {
+        using operation_state_concept = operation_state_t;
+
+        void start() &
+        {
+            if (stopped)
+            {
+                set_stopped(std::move(r));
+            }
+            else
+            {
+                set_value(std::move(r));
+            }
+        }
+
+        Receiver r;
+        bool stopped;
+    };
+
+    template <typename Receiver>
+    op_state<score::cpp::remove_cvref_t<Receiver>> connect(Receiver&& r) const
+    {
+        return {std::forward<Receiver>(r), stopped};
+    }
+
+    bool stopped;
+};
+
+struct result_receiver
+{
+    using receiver_concept = receiver_t;
+
+    void set_value() && { ++*values; }
+    void set_stopped() && { ++*stops; }
+
+    std::int32_t* values;
+    std::int32_t* stops;
+};
+
+// NOTRACING
+TEST(when_all_test, when_all_GivenValueSenders_ExpectValue)
+{
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto op = connect(when_all(inline_sender{false}, inline_sender{false}, inline_sender{false}),
+                      result_receiver{&values, &stops});
+    start(op);
+
+    EXPECT_EQ(values, 1);
+    EXPECT_EQ(stops, 0);
+}
+
+// NOTRACING
+TEST(when_all_test, when_all_GivenOneStoppedSender_ExpectStopped)
+{
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    auto op = connect(when_all(inline_sender{false}, inline_sender{true}, inline_sender{false}),
+                      result_receiver{&values, &stops});
+    start(op);
+
+    EXPECT_EQ(values, 0);
+    EXPECT_EQ(stops, 1);
+}
+
+// NOTRACING
+TEST(when_all_test, when_all_GivenLValueSender_ExpectReusable)
+{
+    std::int32_t values{0};
+    std::int32_t stops{0};
+    const auto sender = when_all(inline_sender{false});
+    auto input = inline_sender{false};
+    auto sender_of_lvalue = when_all(input, sender);
+
+    auto op1 = connect(sender_of_lvalue, result_receiver{&values, &stops});
+    start(op1);
+    auto op2 = connect(sender_of_lvalue, result_receiver{&values, &stops});
+    start(op2);
+
+    EXPECT_EQ(values, 2);
+    EXPECT_EQ(stops, 0);
+}
+
+// NOTRACING
+TEST(when_all_test, when_all_GivenSendersOnCpuContext_ExpectAllCompletedBeforeContinuation)
+{
+    cpu_context ctx{cpu_context::worker_count{2}};
+    auto sch = ctx.get_scheduler();
+    std::atomic<std::int32_t> counter{0};
+    std::int32_t observed{0};
+
+    const bool completed{sync_wait(when_all(schedule(sch) | then([&counter]() { ++counter; }),
+                                            schedule(sch) | then([&counter]() { ++counter; }),
+                                            schedule(sch) | then([&counter]() { ++counter; })) |
+                                   then([&counter, &observed]() { observed = counter.load(); }))};
+
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(observed, 3);
+}
+
+} // namespace
+} // namespace execution
+} // namespace score::cpp
@@ -36,8 +36,8 @@ using RecorderCreatorFn = std::unique_ptr<Recorder> (*)(const detail::Configurat
                                                         score::cpp::pmr::memory_resource* memory_resource);
 
 /// \brief Maximum number of supported log modes. Matches the LogMode enum.
-/// kConsole=0, kFile=1, kRemote=2, kSystem=3, kCustom=4, plus one spare.
-static constexpr std::size_t kMaxBackendSlots{6U};
+/// kConsole=0, kFile=1, kRemote=2, kSystem=3, kCustom=4, kBinaryFile=5, kSharedMemory=6, plus one spare.
+static constexpr std::size_t kMaxBackendSlots{8U};
 
 /// \brief Maps LogMode enum value to array index. Returns kMaxBackendSlots on invalid input.
 constexpr std::size_t ModeToSlotIndex(const LogMode mode) noexcept
@@ -54,6 +54,10 @@ constexpr std::size_t ModeToSlotIndex(const LogMode mode) noexcept
             return 3U;
         case LogMode::kCustom:
             return 4U;
+        case LogMode::kBinaryFile:
+            return 5U;
+        case LogMode::kSharedMemory:
+            return 6U;
         case LogMode::kInvalid:
             [[fallthrough]];
         default:
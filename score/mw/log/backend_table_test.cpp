@@ -71,6 +71,16 @@ TEST(ModeToSlotIndexTest, CustomModeMapsToSlotFour)
     EXPECT_EQ(ModeToSlotIndex(LogMode::kCustom), 4U);
 }
 
+TEST(ModeToSlotIndexTest, BinaryFileModeMapsToSlotFive)
+{
+    EXPECT_EQ(ModeToSlotIndex(LogMode::kBinaryFile), 5U);
+}
+
+TEST(ModeToSlotIndexTest, SharedMemoryModeMapsToSlotSix)
+{
+    EXPECT_EQ(ModeToSlotIndex(LogMode::kSharedMemory), 6U);
+}
+
 TEST(ModeToSlotIndexTest, InvalidModeReturnsSentinel)
 {
     EXPECT_EQ(ModeToSlotIndex(LogMode::kInvalid), kMaxBackendSlots);
@@ -0,0 +1,80 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for acquiring and releasing slots of the CircularAllocator from parallel threads.
+///
+/// Every iteration acquires a slot, writes into it and releases it again, like a producer of a log message. The same
+/// allocator is used by 1 to 8 threads in parallel.
+///   * SingleShard -> all threads search the same ring, i.e. the behaviour before sharding
+///   * Sharded     -> one shard per thread, threads only meet if their own shard is full
+///
+/// Reported are the acquired slots per second (items_per_second) over all threads.
+
+#include "score/mw/log/detail/circular_allocator.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{64U};
+
+template <std::size_t NumberOfShards>
+CircularAllocator<std::uint64_t>& GetAllocator()
+{
+    //  Shared by all threads of a benchmark:
+    static CircularAllocator<std::uint64_t> allocator{kNumberOfSlots, 0U, NumberOfShards};
+    return allocator;
+}
+
+template <std::size_t NumberOfShards>
+void AcquireAndRelease(benchmark::State& state)
+{
+    auto& allocator = GetAllocator<NumberOfShards>();
+    std::int64_t failed_acquisitions{0};
+    for (auto _ : state)
+    {
+        const auto slot = allocator.AcquireSlotToWrite();
+        if (!slot.has_value())
+        {
+            ++failed_acquisitions;
+            continue;
+        }
+        auto& data = allocator.GetUnderlyingBufferFor(slot.value());
+        data = data + 1U;
+        benchmark::DoNotOptimize(data);
+        allocator.ReleaseSlot(slot.value());
+    }
+    state.SetItemsProcessed(state.iterations() - failed_acquisitions);
+    state.counters["failed"] = static_cast<double>(failed_acquisitions);
+}
+
+BENCHMARK_TEMPLATE(AcquireAndRelease, 1U)->Name("SingleShard")->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(AcquireAndRelease, 8U)->Name("Sharded")->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,248 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for the latency of the logging path, from a disabled statement to the write call.
+///
+///   * DisabledStatement           -> LogDebug() below the threshold of the context, nothing reaches the recorder
+///   * StreamArgument/<type>       -> one operator<< of the given type into an enabled LogStream, formatted as text.
+///                                    Creating and flushing the stream is not included, the backend drops messages.
+///   * EmptyRecorderStartStop      -> StartRecord() and StopRecord() of the EmptyRecorder, i.e. the cost of the
+///                                    recorder interface alone
+///   * TextRecorderDevNull         -> LogInfo() with an integer and a string, formatted by the TextRecorder and
+///                                    written to /dev/null with one writev call
+///   * CircularAllocatorContention -> acquire, write and release a slot of the allocator of the console backend from
+///                                    1 to 32 threads in parallel
+///
+/// Besides the calls per second (items_per_second), every benchmark reports the median (p50_ns) and the 99th percentile
+/// (p99_ns) of the latency of a single call. The cheap calls are timed in batches, see LatencySampler.
+
+#include "score/mw/log/benchmark/latency_statistics.h"
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/log_record.h"
+#include "score/mw/log/detail/text_recorder/file_output_backend.h"
+#include "score/mw/log/detail/text_recorder/text_message_builder.h"
+#include "score/mw/log/detail/text_recorder/text_recorder.h"
+#include "score/mw/log/logger.h"
+#include "score/mw/log/logging.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/sys_uio.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+using benchmark_support::LatencySampler;
+
+constexpr std::string_view kContext{"BNCH"};
+constexpr std::size_t kCallsPerSampleOfCheapCall{64U};
+constexpr std::size_t kArgumentsPerStatement{16U};
+constexpr std::size_t kMaxSlotsPerBatch{32U};
+
+detail::Configuration CreateConfiguration()
+{
+    detail::Configuration config{};
+    config.SetEcuId("ECU1");
+    config.SetAppId("BNCH");
+    config.SetDefaultLogLevel(LogLevel::kWarn);
+    config.SetContextLogLevel({{detail::LoggingIdentifier{kContext}, LogLevel::kInfo}});
+    return config;
+}
+
+class DroppingBackend final : public detail::Backend
+{
+  public:
+    score::cpp::optional<SlotHandle> ReserveSlot() noexcept override
+    {
+        return SlotHandle{0U};
+    }
+
+    void FlushSlot(const SlotHandle&) noexcept override {}
+
+    detail::LogRecord& GetLogRecord(const SlotHandle&) noexcept override
+    {
+        return record_;
+    }
+
+  private:
+    detail::LogRecord record_{};
+};
+
+std::unique_ptr<detail::CircularAllocator<detail::LogRecord>> CreateAllocator()
+{
+    //  Sized and sharded like the allocator of the console backend:
+    const auto config = CreateConfiguration();
+    return std::make_unique<detail::CircularAllocator<detail::LogRecord>>(
+        config.GetNumberOfSlots(),
+        detail::LogRecord{config.GetSlotSizeInBytes()},
+        detail::GetRecommendedNumberOfShards(config.GetNumberOfSlots()));
+}
+
+Recorder& GetDroppingRecorder()
+{
+    static detail::TextRecorder recorder{CreateConfiguration(), std::make_unique<DroppingBackend>(), false};
+    return recorder;
+}
+
+Recorder& GetDevNullRecorder()
+{
+    static detail::TextRecorder recorder{
+        CreateConfiguration(),
+        std::make_unique<detail::FileOutputBackend>(
+            std::make_unique<detail::TextMessageBuilder>("ECU1"),
+            ::open("/dev/null", O_WRONLY),
+            CreateAllocator(),
+            score::os::Fcntl::Default(score::cpp::pmr::get_default_resource()),
+            score::os::SysUio::Default(score::cpp::pmr::get_default_resource()),
+            kMaxSlotsPerBatch),
+        false};
+    return recorder;
+}
+
+void DisabledStatement(benchmark::State& state)
+{
+    SetLogRecorder(&GetDevNullRecorder());
+    Logger logger{kContext};
+    LatencySampler sampler{state, kCallsPerSampleOfCheapCall};
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        sampler.Sample([&logger, &value]() noexcept {
+            logger.LogDebug() << value++;
+        });
+    }
+    sampler.Report();
+}
+
+template <typename T>
+void StreamArgument(benchmark::State& state, const T argument)
+{
+    SetLogRecorder(&GetDroppingRecorder());
+    Logger logger{kContext};
+    LatencySampler sampler{state, kArgumentsPerStatement};
+    for (auto _ : state)
+    {
+        auto stream = logger.LogInfo();
+        sampler.Sample([&stream, &argument]() noexcept {
+            stream << argument;
+        });
+    }
+    sampler.Report();
+}
+
+void EmptyRecorderStartStop(benchmark::State& state)
+{
+    detail::EmptyRecorder empty_recorder{};
+    //  Called through the interface like by a LogStream, hide the type from the compiler to keep the virtual calls:
+    Recorder* recorder = &empty_recorder;
+    benchmark::DoNotOptimize(recorder);
+    LatencySampler sampler{state, kCallsPerSampleOfCheapCall};
+    for (auto _ : state)
+    {
+        sampler.Sample([recorder]() noexcept {
+            const auto slot = recorder->StartRecord(kContext, LogLevel::kInfo);
+            if (slot.has_value())
+            {
+                recorder->StopRecord(slot.value());
+            }
+        });
+    }
+    sampler.Report();
+}
+
+void TextRecorderDevNull(benchmark::State& state)
+{
+    SetLogRecorder(&GetDevNullRecorder());
+    Logger logger{kContext};
+    LatencySampler sampler{state, 1U};
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        sampler.Sample([&logger, &value]() noexcept {
+            logger.LogInfo() << value++ << std::string_view{"value of the end to end benchmark"};
+        });
+    }
+    sampler.Report();
+}
+
+detail::CircularAllocator<detail::LogRecord>& GetSharedAllocator()
+{
+    //  Shared by all threads of a benchmark:
+    static const auto allocator = CreateAllocator();
+    return *allocator;
+}
+
+void CircularAllocatorContention(benchmark::State& state)
+{
+    auto& allocator = GetSharedAllocator();
+    LatencySampler sampler{state, 1U};
+    std::int64_t failed_acquisitions{0};
+    for (auto _ : state)
+    {
+        sampler.Sample([&allocator, &failed_acquisitions]() noexcept {
+            const auto slot = allocator.AcquireSlotToWrite();
+            if (!slot.has_value())
+            {
+                ++failed_acquisitions;
+                return;
+            }
+            auto& log_record = allocator.GetUnderlyingBufferFor(slot.value());
+            log_record.GetLogEntry().num_of_args = 1U;
+            benchmark::DoNotOptimize(log_record);
+            allocator.ReleaseSlot(slot.value());
+        });
+    }
+    sampler.Report();
+    state.counters["failed"] = static_cast<double>(failed_acquisitions);
+}
+
+constexpr std::array<char, 16U> kRawBuffer{};
+
+BENCHMARK(DisabledStatement)->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, bool, true)->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, int8, std::int8_t{-42})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, int32, std::int32_t{-123456})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, int64, std::int64_t{-1234567890123})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, uint64, std::uint64_t{1234567890123U})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, float, 3.14159F)->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, double, 2.718281828459045)->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, hex32, LogHex32{0xDEADBEEFU})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, bin16, LogBin16{0xA5A5U})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, string_view, std::string_view{"sixteen bytes!!!"})->UseManualTime();
+BENCHMARK_CAPTURE(StreamArgument, raw_buffer, LogRawBuffer{kRawBuffer.data(), kRawBuffer.size()})->UseManualTime();
+BENCHMARK(EmptyRecorderStartStop)->UseManualTime();
+BENCHMARK(TextRecorderDevNull)->UseManualTime();
+BENCHMARK(CircularAllocatorContention)->ThreadRange(1, 32)->UseManualTime();
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,211 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_BENCHMARK_LATENCY_STATISTICS_H
+#define SCORE_MW_LOG_BENCHMARK_LATENCY_STATISTICS_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace benchmark_support
+{
+
+/// \brief Histogram of durations in nanoseconds with a bounded relative error.
+///
+/// \details Durations below 16 ns are counted exactly. Above, every power of two is split into 16 buckets, thus a
+/// percentile is off by at most 1/16 of its value. The memory needed does not depend on the number of samples.
+class LatencyHistogram
+{
+  public:
+    void Record(const std::uint64_t nanoseconds) noexcept
+    {
+        ++buckets_.at(GetBucketIndex(nanoseconds));
+        ++number_of_samples_;
+    }
+
+    void Add(const LatencyHistogram& other) noexcept
+    {
+        for (std::size_t index = 0U; index < kNumberOfBuckets; ++index)
+        {
+            buckets_[index] += other.buckets_[index];
+        }
+        number_of_samples_ += other.number_of_samples_;
+    }
+
+    std::uint64_t GetNumberOfSamples() const noexcept
+    {
+        return number_of_samples_;
+    }
+
+    /// \brief Returns the duration that the given fraction of the samples does not exceed, e.g. 0.99 for p99.
+    ///
+    /// \details The result is the middle of the bucket the percentile falls into, or zero without any sample.
+    double GetPercentile(const double fraction) const noexcept
+    {
+        const auto exact_rank = std::ceil(fraction * static_cast<double>(number_of_samples_));
+        const auto rank = std::max(std::uint64_t{1U}, static_cast<std::uint64_t>(exact_rank));
+        std::uint64_t samples_up_to_bucket{0U};
+        for (std::size_t index = 0U; index < kNumberOfBuckets; ++index)
+        {
+            samples_up_to_bucket += buckets_[index];
+            if (samples_up_to_bucket >= rank)
+            {
+                return GetBucketMiddle(index);
+            }
+        }
+        return 0.0;
+    }
+
+  private:
+    static constexpr std::uint64_t kSubBucketBits{4U};
+    static constexpr std::uint64_t kNumberOfSubBuckets{1U << kSubBucketBits};
+    static constexpr std::size_t kNumberOfBuckets{(64U - kSubBucketBits + 1U) * kNumberOfSubBuckets};
+
+    static std::size_t GetBucketIndex(const std::uint64_t nanoseconds) noexcept
+    {
+        if (nanoseconds < kNumberOfSubBuckets)
+        {
+            return static_cast<std::size_t>(nanoseconds);
+        }
+        auto exponent = kSubBucketBits;
+        while ((nanoseconds >> (exponent + 1U)) != 0U)
+        {
+            ++exponent;
+        }
+        const auto sub_bucket = (nanoseconds >> (exponent - kSubBucketBits)) & (kNumberOfSubBuckets - 1U);
+        return static_cast<std::size_t>(((exponent - kSubBucketBits + 1U) * kNumberOfSubBuckets) + sub_bucket);
+    }
+
+    static double GetBucketMiddle(const std::size_t index) noexcept
+    {
+        if (index < kNumberOfSubBuckets)
+        {
+            return static_cast<double>(index);
+        }
+        const auto exponent = (index / kNumberOfSubBuckets) - 1U + kSubBucketBits;
+        const auto sub_bucket = index % kNumberOfSubBuckets;
+        const auto width = std::uint64_t{1U} << (exponent - kSubBucketBits);
+        const auto lower_bound = (kNumberOfSubBuckets + sub_bucket) * width;
+        return static_cast<double>(lower_bound) + (static_cast<double>(width - 1U) / 2.0);
+    }
+
+    std::array<std::uint64_t, kNumberOfBuckets> buckets_{};
+    std::uint64_t number_of_samples_{0U};
+};
+
+/// \brief Measures the latency of single calls in a Google Benchmark and reports its percentiles as counters.
+///
+/// \details Every Sample() times a batch of calls with the steady clock and records the average duration per call, the
+/// overhead of reading the clock is subtracted. Cheap calls are batched to keep this overhead small, which smooths
+/// outliers within a batch. Calls that take longer than reading the clock should use a batch size of one.
+///
+/// The measured time is reported as iteration time, thus benchmarks need to be registered with UseManualTime(). The Time
+/// column then shows the duration of a batch, without the benchmark loop and the sampling, and items_per_second the
+/// rate of calls. All threads of a multi-threaded benchmark record into their own histogram, the first thread reports
+/// the percentiles over all of them as p50_ns and p99_ns after the benchmark loop.
+class LatencySampler
+{
+  public:
+    LatencySampler(benchmark::State& state, const std::size_t calls_per_sample) noexcept
+        : state_{state}, calls_per_sample_{calls_per_sample}
+    {
+        //  The benchmark loop starts and ends with a barrier for all threads. Thus, thread 0 prepares and reads the
+        //  histograms while no other thread uses them:
+        if (state_.thread_index() == 0)
+        {
+            GetHistogramsOfAllThreads().assign(static_cast<std::size_t>(state_.threads()), LatencyHistogram{});
+        }
+    }
+
+    template <typename Operation>
+    void Sample(Operation&& operation) noexcept
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t call = 0U; call < calls_per_sample_; ++call)
+        {
+            operation();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const auto elapsed = static_cast<std::uint64_t>(
+            std::max(std::chrono::nanoseconds::rep{0},
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() - GetClockOverhead()));
+        GetHistogramsOfAllThreads()[static_cast<std::size_t>(state_.thread_index())].Record(elapsed);
+        state_.SetIterationTime(static_cast<double>(elapsed) * 1e-9);
+    }
+
+    /// \brief To be called after the benchmark loop.
+    void Report() noexcept
+    {
+        state_.SetItemsProcessed(state_.iterations() * static_cast<benchmark::IterationCount>(calls_per_sample_));
+        if (state_.thread_index() != 0)
+        {
+            return;
+        }
+        LatencyHistogram all_threads{};
+        for (const auto& histogram : GetHistogramsOfAllThreads())
+        {
+            all_threads.Add(histogram);
+        }
+        const auto calls_per_sample = static_cast<double>(calls_per_sample_);
+        //  Counters are summed up over the threads, only the first thread sets them:
+        state_.counters["p50_ns"] = all_threads.GetPercentile(0.50) / calls_per_sample;
+        state_.counters["p99_ns"] = all_threads.GetPercentile(0.99) / calls_per_sample;
+    }
+
+  private:
+    static std::vector<LatencyHistogram>& GetHistogramsOfAllThreads() noexcept
+    {
+        //  Benchmarks run one after the other, thus they share the histograms:
+        static std::vector<LatencyHistogram> histograms{};
+        return histograms;
+    }
+
+    static std::chrono::nanoseconds::rep GetClockOverhead() noexcept
+    {
+        static const auto overhead = []() noexcept {
+            constexpr std::size_t kNumberOfMeasurements{1001U};
+            std::vector<std::chrono::nanoseconds::rep> measurements(kNumberOfMeasurements);
+            for (auto& measurement : measurements)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                const auto end = std::chrono::steady_clock::now();
+                measurement = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            }
+            const auto median = measurements.begin() + static_cast<std::ptrdiff_t>(kNumberOfMeasurements / 2U);
+            std::nth_element(measurements.begin(), median, measurements.end());
+            return *median;
+        }();
+        return overhead;
+    }
+
+    benchmark::State& state_;
+    std::size_t calls_per_sample_;
+};
+
+}  // namespace benchmark_support
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_BENCHMARK_LATENCY_STATISTICS_H
@@ -0,0 +1,145 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for the cost of a log statement in the frontend, from Logger down to the recorder.
+///
+/// The context of the logger is configured with a threshold of info among other contexts. The recorder is a text
+/// recorder whose backend drops every message, thus only the frontend and the log level check are measured.
+///   * Disabled         -> LogDebug() below the threshold, dropped by the threshold resolved by the logger
+///   * DisabledBaseline -> a debug stream created per call, the log level is looked up by the recorder in StartRecord
+///   * Enabled          -> LogInfo() at the threshold, the message is formatted by the recorder
+///   * IsLogEnabled     -> Logger::IsLogEnabled() answered from the resolved threshold
+///
+/// Reported are the log statements per second (items_per_second).
+
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/text_recorder/text_recorder.h"
+#include "score/mw/log/log_stream_factory.h"
+#include "score/mw/log/logger.h"
+#include "score/mw/log/logging.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+constexpr std::string_view kContext{"BNCH"};
+constexpr std::size_t kNumberOfOtherContexts{32U};
+
+class DroppingBackend final : public detail::Backend
+{
+  public:
+    score::cpp::optional<SlotHandle> ReserveSlot() noexcept override
+    {
+        return SlotHandle{0U};
+    }
+
+    void FlushSlot(const SlotHandle&) noexcept override {}
+
+    detail::LogRecord& GetLogRecord(const SlotHandle&) noexcept override
+    {
+        return record_;
+    }
+
+  private:
+    detail::LogRecord record_{};
+};
+
+detail::Configuration CreateConfiguration()
+{
+    detail::Configuration config{};
+    config.SetAppId("BNCH");
+    config.SetDefaultLogLevel(LogLevel::kWarn);
+    detail::ContextLogLevelMap context_log_level_map{{detail::LoggingIdentifier{kContext}, LogLevel::kInfo}};
+    for (std::size_t index = 0U; index < kNumberOfOtherContexts; ++index)
+    {
+        const auto context = std::to_string(index);
+        context_log_level_map.emplace(detail::LoggingIdentifier{context}, LogLevel::kVerbose);
+    }
+    config.SetContextLogLevel(context_log_level_map);
+    return config;
+}
+
+void SetupRecorder()
+{
+    //  Shared by all benchmarks:
+    static detail::TextRecorder recorder{CreateConfiguration(), std::make_unique<DroppingBackend>(), false};
+    SetLogRecorder(&recorder);
+}
+
+void Disabled(benchmark::State& state)
+{
+    SetupRecorder();
+    Logger logger{kContext};
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        logger.LogDebug() << value++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void DisabledBaseline(benchmark::State& state)
+{
+    SetupRecorder();
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        detail::LogStreamFactory::GetStream(LogLevel::kDebug, kContext) << value++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void Enabled(benchmark::State& state)
+{
+    SetupRecorder();
+    Logger logger{kContext};
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        logger.LogInfo() << value++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void IsLogEnabled(benchmark::State& state)
+{
+    SetupRecorder();
+    Logger logger{kContext};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(logger.IsLogEnabled(LogLevel::kDebug));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Disabled);
+BENCHMARK(DisabledBaseline);
+BENCHMARK(Enabled);
+BENCHMARK(IsLogEnabled);
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
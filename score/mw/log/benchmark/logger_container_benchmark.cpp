@@ -0,0 +1,98 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for looking up an existing logger in the LoggerContainer.
+///
+/// The container is filled with 10, 100 and 1000 contexts, then every iteration looks up one of them round robin:
+///   * LinearFind -> WaitFreeStack::Find with a predicate comparing the context, i.e. the lookup before the hash index
+///   * GetLogger  -> LoggerContainer::GetLogger, which finds the logger through the WaitFreeHashIndex
+///
+/// Reported are the lookups per second (items_per_second).
+
+#include "score/mw/log/detail/wait_free_stack/wait_free_stack.h"
+#include "score/mw/log/logger.h"
+#include "score/mw/log/logger_container.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+std::vector<std::string> CreateContexts(const std::size_t number_of_contexts)
+{
+    std::vector<std::string> contexts{};
+    for (std::size_t index = 0U; index < number_of_contexts; ++index)
+    {
+        contexts.push_back(std::to_string(index));
+    }
+    return contexts;
+}
+
+void LinearFind(benchmark::State& state)
+{
+    const auto contexts = CreateContexts(static_cast<std::size_t>(state.range(0)));
+    detail::WaitFreeStack<Logger> stack{contexts.size()};
+    for (const auto& context : contexts)
+    {
+        std::ignore = stack.TryPush(Logger{context});
+    }
+
+    std::size_t index{0U};
+    for (auto _ : state)
+    {
+        const std::string_view context{contexts[index]};
+        auto logger = stack.Find([context](const Logger& element) noexcept {
+            return element.GetContext() == context;
+        });
+        benchmark::DoNotOptimize(logger);
+        index = (index + 1U) % contexts.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void GetLogger(benchmark::State& state)
+{
+    const auto contexts = CreateContexts(static_cast<std::size_t>(state.range(0)));
+    LoggerContainer container{contexts.size()};
+    for (const auto& context : contexts)
+    {
+        std::ignore = container.GetLogger(context);
+    }
+
+    std::size_t index{0U};
+    for (auto _ : state)
+    {
+        Logger& logger = container.GetLogger(contexts[index]);
+        benchmark::DoNotOptimize(&logger);
+        index = (index + 1U) % contexts.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(LinearFind)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(GetLogger)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
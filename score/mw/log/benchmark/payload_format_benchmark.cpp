@@ -0,0 +1,91 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing the cost of appending log arguments with TextFormat and BinaryFormat.
+///
+/// Every iteration appends the arguments of a typical message to an emptied payload, like the hot path of a recorder
+/// between StartRecord and StopRecord:
+///   * TextFormat   -> arguments are formatted to text, as done by the text recorder
+///   * BinaryFormat -> arguments are copied with a type tag, as done by the binary recorder
+///
+/// Reported are the messages per second (items_per_second) and the payload size per message (bytes_per_message).
+
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/mw/log/detail/text_recorder/text_format.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kPayloadSize{2048U};
+
+struct TextFormatter
+{
+    template <typename T>
+    static void Log(VerbosePayload& payload, const T value) noexcept
+    {
+        TextFormat::Log(payload, value);
+    }
+};
+
+struct BinaryFormatter
+{
+    template <typename T>
+    static void Log(VerbosePayload& payload, const T value) noexcept
+    {
+        std::ignore = BinaryFormat::Log(payload, value);
+    }
+};
+
+template <typename Formatter>
+void FormatMessage(benchmark::State& state)
+{
+    ByteVector buffer{};
+    VerbosePayload payload{kPayloadSize, buffer};
+    std::uint32_t counter{0U};
+    for (auto _ : state)
+    {
+        payload.Reset();
+        Formatter::Log(payload, std::string_view{"Received frame"});
+        Formatter::Log(payload, counter++);
+        Formatter::Log(payload, std::string_view{"latency"});
+        Formatter::Log(payload, 0.125);
+        Formatter::Log(payload, std::int64_t{-1234567890123});
+        Formatter::Log(payload, LogHex32{0xDEADBEEFU});
+        benchmark::DoNotOptimize(payload.GetSpan().data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bytes_per_message"] = static_cast<double>(payload.GetSpan().size());
+}
+
+BENCHMARK_TEMPLATE(FormatMessage, TextFormatter)->Name("TextFormat");
+BENCHMARK_TEMPLATE(FormatMessage, BinaryFormatter)->Name("BinaryFormat");
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
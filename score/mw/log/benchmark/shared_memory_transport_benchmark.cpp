@@ -0,0 +1,235 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for the cost a log message has for the logging process, per output transport.
+///
+/// Every iteration logs a message with an integer and a string argument. All transports write into /dev/null, thus
+/// the cost of the device is left out and only the work done in the logging process is measured.
+///   * Text         -> TextRecorder, formats in the caller and writes with writev() in the caller
+///   * BinaryFile   -> BinaryRecorder, serializes in the caller and writes with writev() in the caller
+///   * SharedMemory -> BinaryRecorder, serializes in the caller and copies the record into shared memory. A drainer in
+///                     a forked process decodes the records and writes them, like shared_memory_log_drainer.
+///
+/// Reported are the messages per second (items_per_second). For SharedMemory the timing is paused whenever the ring is
+/// full until the drainer emptied it, thus no message is dropped and the drainer does not run during the measurement,
+/// even on a single core.
+
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_drainer.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_recorder_factory.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+#include "score/mw/log/detail/text_recorder/file_output_backend.h"
+#include "score/mw/log/detail/text_recorder/text_message_builder.h"
+#include "score/mw/log/detail/text_recorder/text_recorder.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/sys_uio.h"
+#include "score/os/unistd.h"
+#include "score/os/utils/signal_impl.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::string_view kAppId{"BSHM"};
+constexpr std::size_t kNumberOfSlots{32UL};
+constexpr std::size_t kMaxSlotsPerBatch{32UL};
+
+Configuration CreateConfiguration()
+{
+    Configuration config{};
+    config.SetEcuId("ECU1");
+    config.SetAppId(kAppId);
+    config.SetDefaultLogLevel(LogLevel::kInfo);
+    config.SetNumberOfSlots(kNumberOfSlots);
+    return config;
+}
+
+std::unique_ptr<FileOutputBackend> CreateDevNullBackend(std::unique_ptr<IMessageBuilder> message_builder)
+{
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    const auto config = CreateConfiguration();
+    auto allocator = std::make_unique<CircularAllocator<LogRecord>>(
+        config.GetNumberOfSlots(), LogRecord{config.GetSlotSizeInBytes()}, std::size_t{1UL});
+    return std::make_unique<FileOutputBackend>(std::move(message_builder),
+                                               ::open("/dev/null", O_WRONLY),
+                                               std::move(allocator),
+                                               score::os::Fcntl::Default(memory_resource),
+                                               score::os::SysUio::Default(memory_resource),
+                                               kMaxSlotsPerBatch);
+}
+
+/// Forks a drainer for the ring of this process. It ends by itself once this process terminated.
+void ForkDrainer()
+{
+    if (::fork() != 0)
+    {
+        return;
+    }
+
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    const auto unistd = score::os::Unistd::Default(memory_resource);
+    const auto stat = score::os::Stat::Default(memory_resource);
+    const auto segment = SharedMemorySegment::Open(SharedMemoryRecorderFactory::GetSharedMemoryName(kAppId),
+                                                   score::os::Mman::Default(memory_resource),
+                                                   *unistd,
+                                                   *stat);
+    const auto ring = SharedMemoryRing::Attach(segment.value().GetMemory());
+    SharedMemoryDrainer drainer{ring.value(),
+                                ::open("/dev/null", O_WRONLY),
+                                score::os::Unistd::Default(memory_resource),
+                                std::make_unique<score::os::SignalImpl>()};
+    while (drainer.IsProducerAlive())
+    {
+        if (drainer.Drain() == 0UL)
+        {
+            std::ignore = ::usleep(100U);
+        }
+    }
+    drainer.Finish();
+    std::ignore = segment.value().UnlinkIfUnchanged(*unistd, *stat);
+    ::_exit(0);
+}
+
+Recorder& GetTextRecorder()
+{
+    static TextRecorder recorder{
+        CreateConfiguration(), CreateDevNullBackend(std::make_unique<TextMessageBuilder>("ECU1")), false};
+    return recorder;
+}
+
+Recorder& GetBinaryFileRecorder()
+{
+    static BinaryRecorder recorder{CreateConfiguration(),
+                                   CreateDevNullBackend(std::make_unique<BinaryMessageBuilder>())};
+    return recorder;
+}
+
+Recorder& GetSharedMemoryRecorder()
+{
+    static const auto recorder = []() {
+        auto* const memory_resource = score::cpp::pmr::get_default_resource();
+        SharedMemoryRecorderFactory factory{score::os::Mman::Default(memory_resource),
+                                            score::os::Unistd::Default(memory_resource)};
+        auto shared_memory_recorder = factory.CreateLogRecorder(CreateConfiguration(), memory_resource);
+        ForkDrainer();
+        return shared_memory_recorder;
+    }();
+    return *recorder;
+}
+
+void LogMessage(Recorder& recorder, const std::int32_t value)
+{
+    const auto slot = recorder.StartRecord("CTX1", LogLevel::kInfo);
+    if (slot.has_value())
+    {
+        recorder.Log(slot.value(), value);
+        recorder.Log(slot.value(), std::string_view{"value of the shared memory transport benchmark"});
+        recorder.StopRecord(slot.value());
+    }
+}
+
+void LogMessages(benchmark::State& state, Recorder& recorder)
+{
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        LogMessage(recorder, value++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void Text(benchmark::State& state)
+{
+    LogMessages(state, GetTextRecorder());
+}
+
+void BinaryFile(benchmark::State& state)
+{
+    LogMessages(state, GetBinaryFileRecorder());
+}
+
+void SharedMemory(benchmark::State& state)
+{
+    auto& recorder = GetSharedMemoryRecorder();
+    //  The ring of the recorder, mapped a second time to read its counter:
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    const auto unistd = score::os::Unistd::Default(memory_resource);
+    const auto segment = SharedMemorySegment::Open(SharedMemoryRecorderFactory::GetSharedMemoryName(kAppId),
+                                                   score::os::Mman::Default(memory_resource),
+                                                   *unistd,
+                                                   *score::os::Stat::Default(memory_resource));
+    const auto ring = SharedMemoryRing::Attach(segment.value().GetMemory());
+    const auto number_of_ring_slots = static_cast<std::int32_t>(ring.value().GetNumberOfSlots());
+    const auto dropped_before = ring.value().GetNumberOfDroppedMessages();
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    const auto wait_until_drained = [&ring, &committed]() {
+        committed.clear();
+        ring.value().CollectCommittedSlots(committed);
+        while (!committed.empty())
+        {
+            std::ignore = ::usleep(50U);
+            committed.clear();
+            ring.value().CollectCommittedSlots(committed);
+        }
+    };
+
+    wait_until_drained();
+    std::int32_t value{0};
+    for (auto _ : state)
+    {
+        LogMessage(recorder, value++);
+        if ((value % number_of_ring_slots) == 0)
+        {
+            state.PauseTiming();
+            wait_until_drained();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["dropped"] = static_cast<double>(ring.value().GetNumberOfDroppedMessages() - dropped_before);
+}
+
+BENCHMARK(Text);
+BENCHMARK(BinaryFile);
+BENCHMARK(SharedMemory);
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,184 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing the per-span and the batched (writev) drain mode of the SlotDrainer.
+///
+/// Every iteration queues a burst of 1, 8 or 32 log lines and flushes them into /dev/null with one Flush() call. Each
+/// line consists of a header owned by the message builder and a payload in the slot, like a text log message.
+///   * PerSpan -> every span is written with its own write call, i.e. two calls per line
+///   * Batched -> all lines of the burst are gathered and written with a single writev call
+///
+/// Reported are the lines per second (items_per_second) and the write system calls per line. The latter are taken
+/// from the syscw counter of /proc/self/io and are only available on Linux.
+
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/log_record.h"
+#include "score/mw/log/detail/text_recorder/imessage_builder.h"
+#include "score/mw/log/detail/text_recorder/slot_drainer.h"
+
+#include "score/os/sys_uio.h"
+#include "score/os/unistd.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{64U};
+constexpr std::size_t kSlotSizeInBytes{256U};
+constexpr std::string_view kHeader{"2026/10/17 12:00:00.123456 123456789 000 ECU1 APP CTX log info verbose 3 "};
+constexpr std::string_view kPayload{"the quick brown fox jumps over the lazy dog 42 3.14\n"};
+
+/// Returns header and payload of a log line, the header is reused for every message.
+class HeaderAndPayloadBuilder final : public IMessageBuilder
+{
+  public:
+    score::cpp::optional<score::cpp::span<const std::uint8_t>> GetNextSpan() noexcept override
+    {
+        if (log_record_ == nullptr)
+        {
+            return {};
+        }
+        if (!header_done_)
+        {
+            header_done_ = true;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) text is written as bytes
+            return score::cpp::span<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(kHeader.data()),
+                                                        kHeader.size()};
+        }
+        const auto payload = log_record_->GetVerbosePayload().GetSpan();
+        log_record_ = nullptr;
+        return payload;
+    }
+
+    void SetNextMessage(LogRecord& log_record) noexcept override
+    {
+        log_record_ = &log_record;
+        header_done_ = false;
+    }
+
+  private:
+    LogRecord* log_record_{nullptr};
+    bool header_done_{false};
+};
+
+/// Number of write system calls of this process so far, or -1 if the OS does not provide it.
+std::int64_t WriteSystemCalls()
+{
+    std::ifstream io_statistics{"/proc/self/io"};
+    std::string key{};
+    std::int64_t value{};
+    while (io_statistics >> key >> value)
+    {
+        if (key == "syscw:")
+        {
+            return value;
+        }
+    }
+    return -1;
+}
+
+std::unique_ptr<SlotDrainer> CreatePerSpanDrainer(std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                                                  const std::int32_t file_descriptor,
+                                                  const std::size_t)
+{
+    return std::make_unique<SlotDrainer>(std::make_unique<HeaderAndPayloadBuilder>(),
+                                         std::move(allocator),
+                                         file_descriptor,
+                                         score::os::Unistd::Default(score::cpp::pmr::get_default_resource()),
+                                         kNumberOfSlots);
+}
+
+std::unique_ptr<SlotDrainer> CreateBatchedDrainer(std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                                                  const std::int32_t file_descriptor,
+                                                  const std::size_t lines_per_flush)
+{
+    return std::make_unique<SlotDrainer>(std::make_unique<HeaderAndPayloadBuilder>(),
+                                         std::move(allocator),
+                                         file_descriptor,
+                                         lines_per_flush,
+                                         score::os::SysUio::Default(score::cpp::pmr::get_default_resource()),
+                                         kNumberOfSlots);
+}
+
+template <std::unique_ptr<SlotDrainer> (*CreateDrainer)(std::shared_ptr<CircularAllocator<LogRecord>>,
+                                                        const std::int32_t,
+                                                        const std::size_t)>
+void Drain(benchmark::State& state)
+{
+    const auto lines_per_flush = static_cast<std::size_t>(state.range(0));
+    // NOLINTNEXTLINE(score-banned-function) benchmark needs a sink that accepts all data
+    const std::int32_t file_descriptor = ::open("/dev/null", O_WRONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+    {
+        state.SkipWithError("Could not open /dev/null");
+        return;
+    }
+
+    auto allocator = std::make_shared<CircularAllocator<LogRecord>>(kNumberOfSlots, LogRecord{kSlotSizeInBytes});
+    {
+        auto drainer = CreateDrainer(allocator, file_descriptor, lines_per_flush);
+
+        const auto system_calls_before = WriteSystemCalls();
+        for (auto _ : state)
+        {
+            for (std::size_t line = 0U; line < lines_per_flush; ++line)
+            {
+                const auto slot = allocator->AcquireSlotToWrite();
+                auto& payload = allocator->GetUnderlyingBufferFor(slot.value()).GetVerbosePayload();
+                payload.Reset();
+                payload.Put(kPayload.data(), kPayload.size());
+                drainer->PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
+            }
+            drainer->Flush();
+        }
+        const auto system_calls_after = WriteSystemCalls();
+
+        const auto lines = state.iterations() * static_cast<std::int64_t>(lines_per_flush);
+        state.SetItemsProcessed(lines);
+        if ((system_calls_before >= 0) && (lines > 0))
+        {
+            state.counters["syscalls_per_line"] =
+                static_cast<double>(system_calls_after - system_calls_before) / static_cast<double>(lines);
+        }
+    }
+    // NOLINTNEXTLINE(score-banned-function) counterpart of open() above
+    ::close(file_descriptor);
+}
+
+BENCHMARK_TEMPLATE(Drain, CreatePerSpanDrainer)->Name("PerSpan")->ArgName("lines")->Arg(1)->Arg(8)->Arg(32);
+BENCHMARK_TEMPLATE(Drain, CreateBatchedDrainer)->Name("Batched")->ArgName("lines")->Arg(1)->Arg(8)->Arg(32);
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
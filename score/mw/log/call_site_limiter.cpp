@@ -0,0 +1,98 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/call_site_limiter.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+
+namespace
+{
+
+std::int64_t ToNanoseconds(const std::chrono::steady_clock::time_point time_point) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+}
+
+}  // namespace
+
+static_assert(std::atomic<std::int64_t>::is_always_lock_free, "The limiter must be lock-free");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "The limiter must be lock-free");
+
+bool CallSiteLimiter::TryAcquire(const std::chrono::steady_clock::time_point now) noexcept
+{
+    const bool acquired = (every_nth_ == 0UL) ? TryAcquireToken(ToNanoseconds(now)) : TryAcquireSample();
+    if (!acquired)
+    {
+        std::ignore = suppressed_count_.fetch_add(1UL, std::memory_order_relaxed);
+    }
+    return acquired;
+}
+
+bool CallSiteLimiter::TryAcquireToken(const std::int64_t now_ns) noexcept
+{
+    //  Generic cell rate algorithm: equivalent to a token bucket, but the whole state is a single time stamp. A message
+    //  passes if the bucket would be full again no later than the burst tolerance from now.
+    auto theoretical_arrival_time_ns = theoretical_arrival_time_ns_.load(std::memory_order_relaxed);
+    std::int64_t next_theoretical_arrival_time_ns{};
+    do
+    {
+        const auto earliest_ns = std::max(theoretical_arrival_time_ns, now_ns);
+        if ((earliest_ns - now_ns) > burst_tolerance_ns_)
+        {
+            return false;
+        }
+        next_theoretical_arrival_time_ns = earliest_ns + emission_interval_ns_;
+    } while (!theoretical_arrival_time_ns_.compare_exchange_weak(
+        theoretical_arrival_time_ns, next_theoretical_arrival_time_ns, std::memory_order_relaxed));
+    return true;
+}
+
+bool CallSiteLimiter::TryAcquireSample() noexcept
+{
+    return (number_of_messages_.fetch_add(1UL, std::memory_order_relaxed) % every_nth_) == 0UL;
+}
+
+std::uint64_t CallSiteLimiter::TakeSuppressedCount(const std::chrono::steady_clock::time_point now) noexcept
+{
+    //  Cheap check first, since most messages pass without any message suppressed before:
+    if (suppressed_count_.load(std::memory_order_relaxed) == 0UL)
+    {
+        return 0UL;
+    }
+
+    const auto now_ns = ToNanoseconds(now);
+    auto next_summary_time_ns = next_summary_time_ns_.load(std::memory_order_relaxed);
+    if (now_ns < next_summary_time_ns)
+    {
+        return 0UL;
+    }
+    //  Only the thread that moves the time of the next summary reports the count:
+    const auto summary_interval_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(kSummaryInterval).count();
+    if (!next_summary_time_ns_.compare_exchange_strong(
+            next_summary_time_ns, now_ns + summary_interval_ns, std::memory_order_relaxed))
+    {
+        return 0UL;
+    }
+    return suppressed_count_.exchange(0UL, std::memory_order_relaxed);
+}
+
+}  // namespace log
+}  // namespace mw
+}  // namespace score
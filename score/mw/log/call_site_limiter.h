@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_CALL_SITE_LIMITER_H
+#define SCORE_MW_LOG_CALL_SITE_LIMITER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+
+/// \brief CallSiteLimiter Class to limit how often a single log statement reaches the recorder.
+///
+/// \details A limiter is meant to be a static object at the call site, that is passed to the Logger:
+///
+///     static score::mw::log::CallSiteLimiter limiter{score::mw::log::CallSiteLimiter::RateLimit{10U, 5U}};
+///     logger.LogWarn(limiter) << "Queue is full";
+///
+/// The constructors are constexpr, thus such a static object is constant-initialized without a guard. A limiter either
+/// lets messages pass like a token bucket, i.e. at a sustained rate with bursts of a given size, or samples one of N
+/// messages. Either decision is taken by a single atomic operation (a compare-and-swap loop for the rate limit), thus
+/// it is lock-free. A rejected message neither reserves a slot nor formats its arguments.
+///
+/// Rejected messages are counted. The Logger reports the count in a summary message before a message that passes the
+/// limiter, at most once per kSummaryInterval. Thus a flooding call site still leaves a trace without flooding itself.
+///
+/// \note The summary is only emitted by the next message of the call site that passes the limiter, not by a timer.
+/// If a call site floods and then stays quiet, the messages suppressed last are never reported. This deliberately
+/// deviates from a periodic summary: the logging library has no periodic activity within the process that could flush
+/// the counts, and a limiter is a constant-initialized object that knows neither its Logger nor its context, which
+/// would be needed to report on its own.
+class CallSiteLimiter final
+{
+  public:
+    /// \brief Lets messages_per_second messages pass on average, and up to burst messages at once.
+    ///
+    /// \details Both values are at least one.
+    struct RateLimit
+    {
+        std::uint32_t messages_per_second;
+        std::uint32_t burst;
+    };
+
+    /// \brief Lets the first and then every nth message pass.
+    ///
+    /// \details every_nth is at least one.
+    struct Sampling
+    {
+        std::uint32_t every_nth;
+    };
+
+    /// \brief Minimum time between two summaries of rejected messages.
+    static constexpr std::chrono::seconds kSummaryInterval{1};
+
+    constexpr explicit CallSiteLimiter(const RateLimit rate_limit) noexcept
+        : emission_interval_ns_{kNanosecondsPerSecond / AtLeastOne(rate_limit.messages_per_second)},
+          burst_tolerance_ns_{emission_interval_ns_ * (AtLeastOne(rate_limit.burst) - 1)},
+          every_nth_{0U},
+          theoretical_arrival_time_ns_{kNoTime},
+          number_of_messages_{0UL},
+          suppressed_count_{0UL},
+          next_summary_time_ns_{kNoTime}
+    {
+    }
+
+    constexpr explicit CallSiteLimiter(const Sampling sampling) noexcept
+        : emission_interval_ns_{0},
+          burst_tolerance_ns_{0},
+          every_nth_{static_cast<std::uint64_t>(AtLeastOne(sampling.every_nth))},
+          theoretical_arrival_time_ns_{kNoTime},
+          number_of_messages_{0UL},
+          suppressed_count_{0UL},
+          next_summary_time_ns_{kNoTime}
+    {
+    }
+
+    CallSiteLimiter(CallSiteLimiter&&) noexcept = delete;
+    CallSiteLimiter(const CallSiteLimiter&) noexcept = delete;
+    CallSiteLimiter& operator=(CallSiteLimiter&&) noexcept = delete;
+    CallSiteLimiter& operator=(const CallSiteLimiter&) noexcept = delete;
+    ~CallSiteLimiter() noexcept = default;
+
+    /// \brief Decides whether a message at time now passes the limiter. Counts the message as suppressed otherwise.
+    /// \thread-safe
+    bool TryAcquire(const std::chrono::steady_clock::time_point now) noexcept;
+
+    /// \brief Returns the number of suppressed messages and resets it, if a summary is due at time now. Returns zero
+    /// otherwise.
+    /// \thread-safe
+    std::uint64_t TakeSuppressedCount(const std::chrono::steady_clock::time_point now) noexcept;
+
+  private:
+    static constexpr std::int64_t kNanosecondsPerSecond{1000000000};
+    static constexpr std::int64_t kNoTime{std::numeric_limits<std::int64_t>::min()};
+
+    static constexpr std::int64_t AtLeastOne(const std::uint32_t value) noexcept
+    {
+        return (value == 0U) ? 1 : static_cast<std::int64_t>(value);
+    }
+
+    bool TryAcquireToken(const std::int64_t now_ns) noexcept;
+    bool TryAcquireSample() noexcept;
+
+    const std::int64_t emission_interval_ns_;
+    const std::int64_t burst_tolerance_ns_;
+    /// Zero if the limiter is a rate limit.
+    const std::uint64_t every_nth_;
+    /// Time at which the bucket is full again, see the generic cell rate algorithm.
+    std::atomic<std::int64_t> theoretical_arrival_time_ns_;
+    std::atomic<std::uint64_t> number_of_messages_;
+    std::atomic<std::uint64_t> suppressed_count_;
+    std::atomic<std::int64_t> next_summary_time_ns_;
+};
+
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_CALL_SITE_LIMITER_H
@@ -0,0 +1,172 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/call_site_limiter.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace
+{
+
+using std::chrono_literals::operator""ms;
+
+const std::chrono::steady_clock::time_point kStart{std::chrono::seconds{100}};
+
+TEST(CallSiteLimiterTest, RateLimitShallLetBurstPassAtOnce)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A rate limit shall let up to burst messages pass at the same time.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Boundary value analysis");
+
+    // Given a limiter of 10 messages per second with a burst of 3
+    CallSiteLimiter unit{CallSiteLimiter::RateLimit{10U, 3U}};
+
+    // Then three messages pass at once, the fourth one is rejected
+    EXPECT_TRUE(unit.TryAcquire(kStart));
+    EXPECT_TRUE(unit.TryAcquire(kStart));
+    EXPECT_TRUE(unit.TryAcquire(kStart));
+    EXPECT_FALSE(unit.TryAcquire(kStart));
+}
+
+TEST(CallSiteLimiterTest, RateLimitShallRefillAtTheConfiguredRate)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A rate limit shall let messages pass again at the configured rate.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Boundary value analysis");
+
+    // Given an exhausted limiter of 10 messages per second without burst
+    CallSiteLimiter unit{CallSiteLimiter::RateLimit{10U, 1U}};
+    ASSERT_TRUE(unit.TryAcquire(kStart));
+    ASSERT_FALSE(unit.TryAcquire(kStart));
+
+    // Then the next message passes once 100 ms have passed, but only one
+    EXPECT_FALSE(unit.TryAcquire(kStart + 99ms));
+    EXPECT_TRUE(unit.TryAcquire(kStart + 100ms));
+    EXPECT_FALSE(unit.TryAcquire(kStart + 100ms));
+
+    // And a long pause refills the bucket only up to the burst
+    EXPECT_TRUE(unit.TryAcquire(kStart + 10000ms));
+    EXPECT_FALSE(unit.TryAcquire(kStart + 10000ms));
+}
+
+TEST(CallSiteLimiterTest, ZeroRateLimitShallBeTreatedAsOne)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A rate limit of zero shall let one message per second pass.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Boundary value analysis");
+
+    CallSiteLimiter unit{CallSiteLimiter::RateLimit{0U, 0U}};
+
+    EXPECT_TRUE(unit.TryAcquire(kStart));
+    EXPECT_FALSE(unit.TryAcquire(kStart + 999ms));
+    EXPECT_TRUE(unit.TryAcquire(kStart + 1000ms));
+}
+
+TEST(CallSiteLimiterTest, SamplingShallLetTheFirstOfEveryNMessagesPass)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Sampling shall let the first and then every nth message pass.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    CallSiteLimiter unit{CallSiteLimiter::Sampling{3U}};
+
+    std::vector<bool> passed{};
+    for (std::size_t index = 0UL; index < 7UL; ++index)
+    {
+        passed.push_back(unit.TryAcquire(kStart));
+    }
+
+    EXPECT_EQ(passed, (std::vector<bool>{true, false, false, true, false, false, true}));
+}
+
+TEST(CallSiteLimiterTest, SuppressedCountShallBeReportedOncePerSummaryInterval)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The number of rejected messages shall be reported and reset at most once per summary interval.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a limiter that rejected two messages
+    CallSiteLimiter unit{CallSiteLimiter::Sampling{3U}};
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart), 0UL);
+    ASSERT_TRUE(unit.TryAcquire(kStart));
+    ASSERT_FALSE(unit.TryAcquire(kStart));
+    ASSERT_FALSE(unit.TryAcquire(kStart));
+
+    // Then the count is reported once
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart), 2UL);
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart), 0UL);
+
+    // And messages rejected afterwards are reported after the summary interval only
+    ASSERT_TRUE(unit.TryAcquire(kStart));
+    ASSERT_FALSE(unit.TryAcquire(kStart));
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart + CallSiteLimiter::kSummaryInterval - 1ms), 0UL);
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart + CallSiteLimiter::kSummaryInterval), 1UL);
+}
+
+TEST(CallSiteLimiterTest, ConcurrentCallersShallNotExceedTheBurst)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Threads using the same limiter concurrently shall together get no more messages through than the "
+                   "burst, and every rejected message shall be counted.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    constexpr std::size_t kThreads{4UL};
+    constexpr std::size_t kMessagesPerThread{1000UL};
+    constexpr std::uint32_t kBurst{50U};
+    CallSiteLimiter unit{CallSiteLimiter::RateLimit{1U, kBurst}};
+
+    std::atomic<std::size_t> passed{0UL};
+    std::vector<std::thread> threads{};
+    for (std::size_t thread = 0UL; thread < kThreads; ++thread)
+    {
+        threads.emplace_back([&unit, &passed]() {
+            for (std::size_t message = 0UL; message < kMessagesPerThread; ++message)
+            {
+                if (unit.TryAcquire(kStart))
+                {
+                    std::ignore = passed.fetch_add(1UL);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(passed.load(), kBurst);
+    EXPECT_EQ(unit.TakeSuppressedCount(kStart), (kThreads * kMessagesPerThread) - kBurst);
+}
+
+}  // namespace
+}  // namespace log
+}  // namespace mw
+}  // namespace score
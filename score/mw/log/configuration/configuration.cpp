@@ -85,6 +85,36 @@ void Configuration::SetLogFilePath(const std::string_view log_file_path)
     log_file_path_ = ToString(log_file_path);
 }
 
+std::size_t Configuration::GetLogFileSizeLimit() const noexcept
+{
+    return log_file_size_limit_bytes_;
+}
+
+void Configuration::SetLogFileSizeLimit(const std::size_t size_limit_bytes) noexcept
+{
+    log_file_size_limit_bytes_ = size_limit_bytes;
+}
+
+std::size_t Configuration::GetLogFileSegmentCount() const noexcept
+{
+    return log_file_segment_count_;
+}
+
+void Configuration::SetLogFileSegmentCount(const std::size_t segment_count) noexcept
+{
+    log_file_segment_count_ = segment_count;
+}
+
+bool Configuration::GetLogFileSyncOnRotation() const noexcept
+{
+    return log_file_sync_on_rotation_;
+}
+
+void Configuration::SetLogFileSyncOnRotation(const bool sync_on_rotation) noexcept
+{
+    log_file_sync_on_rotation_ = sync_on_rotation;
+}
+
 LogLevel Configuration::GetDefaultLogLevel() const noexcept
 {
     return default_log_level_;
@@ -168,6 +198,12 @@ void Configuration::SetSlotSizeInBytes(const std::size_t slot_size_bytes) noexce
 bool Configuration::IsLogLevelEnabled(const LogLevel& log_level,
                                       const std::string_view context,
                                       const bool check_for_console) const noexcept
+{
+    return log_level <= GetLogLevelThreshold(context, check_for_console);
+}
+
+LogLevel Configuration::GetLogLevelThreshold(const std::string_view context,
+                                             const bool check_for_console) const noexcept
 {
     auto max_log_level = LogLevel::kOff;
 
@@ -186,7 +222,7 @@ bool Configuration::IsLogLevelEnabled(const LogLevel& log_level,
         max_log_level = default_console_log_level_;
     }
 
-    return log_level <= max_log_level;
+    return max_log_level;
 }
 
 void Configuration::SetDataRouterUid(const std::size_t uid) noexcept
@@ -54,6 +54,15 @@ class Configuration final
     std::string_view GetLogFilePath() const noexcept;
     void SetLogFilePath(const std::string_view);
 
+    std::size_t GetLogFileSizeLimit() const noexcept;
+    void SetLogFileSizeLimit(const std::size_t size_limit_bytes) noexcept;
+
+    std::size_t GetLogFileSegmentCount() const noexcept;
+    void SetLogFileSegmentCount(const std::size_t segment_count) noexcept;
+
+    bool GetLogFileSyncOnRotation() const noexcept;
+    void SetLogFileSyncOnRotation(const bool sync_on_rotation) noexcept;
+
     LogLevel GetDefaultLogLevel() const noexcept;
     void SetDefaultLogLevel(const LogLevel) noexcept;
 
@@ -93,6 +102,10 @@ class Configuration final
                            const std::string_view context,
                            const bool check_for_console = false) const noexcept;
 
+    /// \brief Returns the most verbose log level that is enabled for the context.
+    /// \details A log level is enabled by IsLogLevelEnabled() if it is less or equal to this threshold.
+    LogLevel GetLogLevelThreshold(const std::string_view context, const bool check_for_console = false) const noexcept;
+
   private:
     /// \brief DLT ECU ID, four bytes max.
     LoggingIdentifier ecu_id_{"ECU1"};
@@ -109,6 +122,15 @@ class Configuration final
     /// \brief Directory path used for file logging.
     std::string log_file_path_{"/tmp"};
 
+    /// \brief Size limit of a segment of a rotated log file in bytes, 0 disables rotation.
+    std::size_t log_file_size_limit_bytes_{0UL};
+
+    /// \brief Number of segments of a rotated log file that are kept.
+    std::size_t log_file_segment_count_{4UL};
+
+    /// \brief Synchronize a segment of a rotated log file to the storage device once it is closed.
+    bool log_file_sync_on_rotation_{false};
+
     /// \brief Default log maximum log level.
     LogLevel default_log_level_{LogLevel::kWarn};
 
@@ -140,6 +140,42 @@ TEST(ConfigurationTestSuite, IsLogEnabledShallReturnFalseIfLogLevelIsBelowDefaul
     EXPECT_FALSE(config.IsLogLevelEnabled(LogLevel::kVerbose, k_ctx, true));
 }
 
+TEST(ConfigurationTestSuite, LogLevelThresholdShallBeTheLevelOfTheContext)
+{
+    RecordProperty("Requirement", "SCR-1633254");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The threshold of a configured context shall be the log level of the context.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    Configuration config{};
+
+    const std::string_view k_ctx{"CTX1"};
+    const ContextLogLevelMap context_log_level_map{{LoggingIdentifier{k_ctx}, LogLevel::kError}};
+    config.SetContextLogLevel(context_log_level_map);
+    config.SetDefaultLogLevel(LogLevel::kVerbose);
+    EXPECT_EQ(config.GetLogLevelThreshold(k_ctx), LogLevel::kError);
+}
+
+TEST(ConfigurationTestSuite, LogLevelThresholdShallBeTheDefaultLevelForUnknownContexts)
+{
+    RecordProperty("Requirement", "SCR-1633254");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The threshold of a context without configuration shall be the default log level, or the default "
+                   "console log level for the console.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    Configuration config{};
+
+    const std::string_view k_ctx{"CTX1"};
+    config.SetDefaultLogLevel(LogLevel::kDebug);
+    config.SetDefaultConsoleLogLevel(LogLevel::kWarn);
+    EXPECT_EQ(config.GetLogLevelThreshold(k_ctx), LogLevel::kDebug);
+    EXPECT_EQ(config.GetLogLevelThreshold(k_ctx, true), LogLevel::kWarn);
+}
+
 TEST(ConfigurationTestSuite, AppidWithMoreThanFourCharactersShallBeTruncated)
 {
     RecordProperty("Requirement", "SCR-1633316");
@@ -36,6 +36,9 @@ constexpr std::string_view kEcuIdKey{"ecuId"};
 constexpr std::string_view kAppIdKey{"appId"};
 constexpr std::string_view kAppDescriptionKey{"appDesc"};
 constexpr std::string_view kLogFilePathKey{"logFilePath"};
+constexpr std::string_view kLogFileSizeLimitKey{"logFileSizeLimit"};
+constexpr std::string_view kLogFileSegmentCountKey{"logFileSegmentCount"};
+constexpr std::string_view kLogFileSyncOnRotationKey{"logFileSyncOnRotation"};
 constexpr std::string_view kLogModeKey{"logMode"};
 constexpr std::string_view kLogLevelKey{"logLevel"};
 constexpr std::string_view kLogLevelThresholdConsoleKey{"logLevelThresholdConsole"};
@@ -70,7 +73,9 @@ const std::unordered_map<std::string_view, LogMode> kStringToLogMode{{{"kRemote"
                                                                       {"kConsole", LogMode::kConsole},
                                                                       {"kFile", LogMode::kFile},
                                                                       {"kSystem", LogMode::kSystem},
-                                                                      {"kCustom", LogMode::kCustom}}};
+                                                                      {"kCustom", LogMode::kCustom},
+                                                                      {"kBinaryFile", LogMode::kBinaryFile},
+                                                                      {"kSharedMemory", LogMode::kSharedMemory}}};
 
 /// \brief Provide user feedback in case a configuration file contains errors.
 template <typename T>
@@ -189,6 +194,42 @@ score::Result<void> ParseLogFilePath(const score::json::Object& root, Configurat
     // clang-format on
 }
 
+score::Result<void> ParseLogFileSizeLimit(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kLogFileSizeLimitKey,
+        [&config](const auto value) noexcept { config.SetLogFileSizeLimit(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseLogFileSegmentCount(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<std::size_t>(
+        root,
+        kLogFileSegmentCountKey,
+        [&config](const auto value) noexcept { config.SetLogFileSegmentCount(value); }
+    );
+    // clang-format on
+}
+
+score::Result<void> ParseLogFileSyncOnRotation(const score::json::Object& root, Configuration& config) noexcept
+{
+    // Disabling clang-format to address Coverity warning: autosar_cpp14_a7_1_7_violation
+    // clang-format off
+    return GetElementAndThen<bool>(
+        root,
+        kLogFileSyncOnRotationKey,
+        [&config](const auto value) noexcept { config.SetLogFileSyncOnRotation(value); }
+    );
+    // clang-format on
+}
+
 /// \brief Returns the corresponding log mode of the string.
 score::Result<LogMode> LogModeFromString(const std::string_view str) noexcept
 {
@@ -196,8 +237,9 @@ score::Result<LogMode> LogModeFromString(const std::string_view str) noexcept
 
     if (result == kStringToLogMode.end())
     {
-        return MakeUnexpected(Error::kInvalidLogModeString,
-                              "Expected `kRemote`, `kConsole`, `kSystem`, `kFile` or `kCustom`.");
+        return MakeUnexpected(
+            Error::kInvalidLogModeString,
+            "Expected `kRemote`, `kConsole`, `kSystem`, `kFile`, `kCustom`, `kBinaryFile` or `kSharedMemory`.");
     }
 
     return result->second;
@@ -435,6 +477,9 @@ void ParseConfigurationElements(const score::json::Object& root, const std::stri
     ReportOnError(ParseAppId(root, config), path);
     ReportOnError(ParseAppDescription(root, config), path);
     ReportOnError(ParseLogFilePath(root, config), path);
+    ReportOnError(ParseLogFileSizeLimit(root, config), path);
+    ReportOnError(ParseLogFileSegmentCount(root, config), path);
+    ReportOnError(ParseLogFileSyncOnRotation(root, config), path);
     ReportOnError(ParseLogMode(root, config), path);
     ReportOnError(ParseLogLevel(root, config), path);
     ReportOnError(ParseLogLevelConsole(root, config), path);
@@ -45,6 +45,9 @@ const std::size_t kEcuConfigStackBufferSize{3000};
 const std::size_t kEcuConfigRingBufferSize{4096};
 const LogLevel kEcuConfigLogLevelConsole{LogLevel::kVerbose};
 const std::string_view kAppConfigLogFilePath{"/var/tmp"};
+const std::size_t kEcuConfigLogFileSizeLimit{1048576};
+const std::size_t kEcuConfigLogFileSegmentCount{3};
+const bool kEcuConfigLogFileSyncOnRotation{true};
 const ContextLogLevelMap kCombinedContextLogLevel{{LoggingIdentifier{"DTC"}, LogLevel::kInfo},
                                                   {LoggingIdentifier{"FOO"}, LogLevel::kWarn},
                                                   {LoggingIdentifier{"vcip"}, LogLevel::kDebug},
@@ -289,6 +292,22 @@ TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseLogFilePathFromAppConfig
     EXPECT_EQ(GetReader().ReadConfig()->GetLogFilePath(), kAppConfigLogFilePath);
 }
 
+TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseLogFileRotationFromEcuConfig)
+{
+    RecordProperty("Requirement", "SCR-1633316");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "TargetConfigReader shall parse the segment size limit, the segment count and the synchronization "
+                   "of rotated log files from the configuration file correctly.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    const auto config = GetReader().ReadConfig();
+    EXPECT_EQ(config->GetLogFileSizeLimit(), kEcuConfigLogFileSizeLimit);
+    EXPECT_EQ(config->GetLogFileSegmentCount(), kEcuConfigLogFileSegmentCount);
+    EXPECT_EQ(config->GetLogFileSyncOnRotation(), kEcuConfigLogFileSyncOnRotation);
+}
+
 TEST_F(TargetConfigReaderFixture, ConfigReaderShallParseContextLogLevelFromEcuAndAppConfig)
 {
     RecordProperty("Requirement", "SCR-1633316, SCR-1634075");
@@ -0,0 +1,131 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/context_handle.h"
+
+#include "score/mw/log/runtime.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::uint32_t kGenerationShift{32U};
+constexpr std::uint64_t kThresholdMask{0xFFFFFFFFUL};
+constexpr std::uint64_t kUnknownThreshold{0xFFUL};
+
+/// Starts at one, thus the zero initialized cache of a new ContextHandle never matches.
+// coverity[autosar_cpp14_a3_3_2_violation] std::atomic with constant initializer is constant-initialized
+std::atomic<std::uint32_t> recorder_generation{1U};
+
+}  // namespace
+
+ContextHandle::ContextHandle(const std::string_view context) noexcept : context_{context}, resolved_threshold_{0UL} {}
+
+ContextHandle::ContextHandle(const ContextHandle& other) noexcept
+    : context_{other.context_}, resolved_threshold_{other.resolved_threshold_.load(std::memory_order_relaxed)}
+{
+}
+
+ContextHandle::ContextHandle(ContextHandle&& other) noexcept
+    : context_{other.context_}, resolved_threshold_{other.resolved_threshold_.load(std::memory_order_relaxed)}
+{
+}
+
+ContextHandle& ContextHandle::operator=(const ContextHandle& other) noexcept
+{
+    if (this != &other)
+    {
+        context_ = other.context_;
+        resolved_threshold_.store(other.resolved_threshold_.load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+ContextHandle& ContextHandle::operator=(ContextHandle&& other) noexcept
+{
+    return *this = static_cast<const ContextHandle&>(other);
+}
+
+std::string_view ContextHandle::GetContext() const noexcept
+{
+    return context_.GetStringView();
+}
+
+score::cpp::optional<LogLevel> ContextHandle::GetLogLevelThreshold() const noexcept
+{
+    const auto threshold = GetResolvedThreshold() & kThresholdMask;
+    if (threshold == kUnknownThreshold)
+    {
+        return {};
+    }
+    return static_cast<LogLevel>(threshold);
+}
+
+bool ContextHandle::IsFilteredOut(const LogLevel log_level) const noexcept
+{
+    // kUnknownThreshold is above every log level, thus nothing is filtered out without a threshold.
+    return static_cast<std::uint64_t>(log_level) > (GetResolvedThreshold() & kThresholdMask);
+}
+
+void ContextHandle::InvalidateAll() noexcept
+{
+    // Release pairs with the acquire in Resolve(): whoever sees the new generation also sees the new recorder, thus
+    // never caches the threshold of the previous recorder under the new generation.
+    auto generation = recorder_generation.load(std::memory_order_relaxed);
+    std::uint32_t next_generation{};
+    do
+    {
+        next_generation = generation + 1U;
+        if (next_generation == 0U)
+        {
+            next_generation = 1U;
+        }
+    } while (!recorder_generation.compare_exchange_weak(
+        generation, next_generation, std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::uint64_t ContextHandle::GetResolvedThreshold() const noexcept
+{
+    const auto resolved_threshold = resolved_threshold_.load(std::memory_order_relaxed);
+    if ((resolved_threshold >> kGenerationShift) == recorder_generation.load(std::memory_order_relaxed))
+    {
+        return resolved_threshold;
+    }
+    return Resolve();
+}
+
+std::uint64_t ContextHandle::Resolve() const noexcept
+{
+    // The generation is read before the recorder. If the recorder changes in between, the cache is outdated right away
+    // and resolved again on next use.
+    const std::uint64_t generation = recorder_generation.load(std::memory_order_acquire);
+    const auto threshold = Runtime::GetRecorder().GetLogLevelThreshold(context_.GetStringView());
+    const auto resolved_threshold =
+        (generation << kGenerationShift) |
+        (threshold.has_value() ? static_cast<std::uint64_t>(threshold.value()) : kUnknownThreshold);
+    resolved_threshold_.store(resolved_threshold, std::memory_order_relaxed);
+    return resolved_threshold;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
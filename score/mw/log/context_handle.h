@@ -0,0 +1,81 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_CONTEXT_HANDLE_H
+#define SCORE_MW_LOG_CONTEXT_HANDLE_H
+
+#include "score/mw/log/detail/logging_identifier.h"
+#include "score/mw/log/log_level.h"
+
+#include "score/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Context of a Logger together with the log level threshold that the current Recorder applies to it.
+///
+/// \details The threshold is resolved once by Recorder::GetLogLevelThreshold() and cached with the generation of the
+/// recorder it was resolved for. Checking a log level thus costs a relaxed load of the cache and of the generation
+/// instead of a lookup of the context in the configuration. Runtime::SetRecorder() invalidates all cached thresholds
+/// by InvalidateAll(). For recorders that do not provide a threshold, the caller has to ask the recorder every time.
+/// InvalidateAll() publishes the generation with release semantics and the threshold is resolved after an acquire load
+/// of it, thus a threshold is never cached under the generation of a recorder it was not resolved from.
+///
+/// Concurrent use is thread-safe. Copying is not thread-safe against concurrent assignment, like for Logger.
+class ContextHandle final
+{
+  public:
+    explicit ContextHandle(const std::string_view context) noexcept;
+
+    ContextHandle(const ContextHandle& other) noexcept;
+    ContextHandle(ContextHandle&& other) noexcept;
+    ContextHandle& operator=(const ContextHandle& other) noexcept;
+    ContextHandle& operator=(ContextHandle&& other) noexcept;
+    ~ContextHandle() noexcept = default;
+
+    std::string_view GetContext() const noexcept;
+
+    /// \brief Returns the threshold of the current recorder for the context, empty if the recorder does not have a
+    /// fixed one.
+    score::cpp::optional<LogLevel> GetLogLevelThreshold() const noexcept;
+
+    /// \brief Returns true if the current recorder is known to discard messages of the log level for the context.
+    bool IsFilteredOut(const LogLevel log_level) const noexcept;
+
+    /// \brief Makes every ContextHandle resolve its threshold again on next use.
+    static void InvalidateAll() noexcept;
+
+  private:
+    std::uint64_t GetResolvedThreshold() const noexcept;
+    std::uint64_t Resolve() const noexcept;
+
+    LoggingIdentifier context_;
+    /// Generation of the recorder in the upper, threshold in the lower 32 bits.
+    mutable std::atomic<std::uint64_t> resolved_threshold_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_CONTEXT_HANDLE_H
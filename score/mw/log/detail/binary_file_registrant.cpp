@@ -0,0 +1,54 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/backend_table.h"
+#include "score/mw/log/detail/binary_recorder/binary_recorder_factory.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+std::unique_ptr<Recorder> CreateBinaryFileRecorder(const Configuration& config,
+                                                   score::cpp::pmr::memory_resource* memory_resource)
+{
+    BinaryRecorderFactory factory{score::os::Fcntl::Default(memory_resource),
+                                  score::os::Unistd::Default(memory_resource)};
+    return factory.CreateLogRecorder(config, memory_resource);
+}
+
+/*
+Deviation from Rule A3-3-2:
+- Static and thread-local objects shall be constant-initialized.
+Deviation from Rule M0-1-3:
+- A project shall not contain unused variables.
+Deviation from Rule M0-1-9:
+- There shall be no dead code.
+Justification:
+- Same static registration pattern as kConsoleRegistrant in console_registrant.cpp.
+*/
+// coverity[autosar_cpp14_a3_3_2_violation] See above
+// coverity[autosar_cpp14_m0_1_3_violation] See above
+// coverity[autosar_cpp14_m0_1_9_violation] See above
+const BackendRegistrant kBinaryFileRegistrant{LogMode::kBinaryFile, &CreateBinaryFileRecorder};
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
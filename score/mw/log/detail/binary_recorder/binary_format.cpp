@@ -0,0 +1,196 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::size_t kTypeTagSize{sizeof(BinaryArgumentType)};
+constexpr std::size_t kLengthFieldSize{sizeof(std::uint16_t)};
+
+template <typename T>
+AddArgumentResult PutFixedSizeArgument(VerbosePayload& payload, const BinaryArgumentType type, const T data) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be serialized");
+    constexpr std::size_t kArgumentSize = kTypeTagSize + sizeof(T);
+    if (payload.WillOverflow(kArgumentSize))
+    {
+        return AddArgumentResult::kNotAdded;
+    }
+
+    std::ignore = payload.Put(
+        [type, data](const score::cpp::span<Byte> buffer) noexcept {
+            std::ignore = std::memcpy(buffer.data(), &type, kTypeTagSize);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) buffer has space for tag and value
+            std::ignore = std::memcpy(buffer.data() + kTypeTagSize, &data, sizeof(T));
+            return kArgumentSize;
+        },
+        kArgumentSize);
+    return AddArgumentResult::kAdded;
+}
+
+AddArgumentResult PutVariableLengthArgument(VerbosePayload& payload,
+                                            const BinaryArgumentType type,
+                                            const Byte* const data,
+                                            const std::size_t size) noexcept
+{
+    constexpr std::size_t kArgumentHeaderSize = kTypeTagSize + kLengthFieldSize;
+    if (payload.WillOverflow(kArgumentHeaderSize))
+    {
+        return AddArgumentResult::kNotAdded;
+    }
+
+    //  Like the text format, data that does not fit is cut off:
+    const auto length = static_cast<std::uint16_t>(std::min(
+        {size, payload.RemainingCapacity() - kArgumentHeaderSize, kBinaryMaxVariableLengthArgumentSize}));
+    std::ignore = payload.Put(
+        [type, data, length](const score::cpp::span<Byte> buffer) noexcept {
+            std::ignore = std::memcpy(buffer.data(), &type, kTypeTagSize);
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) buffer has space for header and data
+            std::ignore = std::memcpy(buffer.data() + kTypeTagSize, &length, kLengthFieldSize);
+            if (length > 0U)
+            {
+                std::ignore = std::memcpy(buffer.data() + kArgumentHeaderSize, data, length);
+            }
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return kArgumentHeaderSize + length;
+        },
+        kArgumentHeaderSize + length);
+    return AddArgumentResult::kAdded;
+}
+
+}  // namespace
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const bool data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kBool, static_cast<std::uint8_t>(data ? 1U : 0U));
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::uint8_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kUint8, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::uint16_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kUint16, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::uint32_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kUint32, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::uint64_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kUint64, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int8_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kInt8, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int16_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kInt16, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int32_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kInt32, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::int64_t data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kInt64, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const float data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kFloat, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const double data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kDouble, data);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const std::string_view data) noexcept
+{
+    return PutVariableLengthArgument(payload, BinaryArgumentType::kString, data.data(), data.size());
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogRawBuffer data) noexcept
+{
+    return PutVariableLengthArgument(
+        payload, BinaryArgumentType::kRawBuffer, data.data(), static_cast<std::size_t>(data.size()));
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex8 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kHex8, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex16 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kHex16, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex32 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kHex32, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogHex64 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kHex64, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin8 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kBin8, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin16 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kBin16, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin32 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kBin32, data.value);
+}
+
+AddArgumentResult BinaryFormat::Log(VerbosePayload& payload, const LogBin64 data) noexcept
+{
+    return PutFixedSizeArgument(payload, BinaryArgumentType::kBin64, data.value);
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,98 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
+
+#include "score/mw/log/detail/add_argument_result.h"
+#include "score/mw/log/detail/verbose_payload.h"
+#include "score/mw/log/log_types.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Type tag that precedes every argument in the payload of a binary log record.
+enum class BinaryArgumentType : std::uint8_t
+{
+    kBool = 1,
+    kUint8,
+    kUint16,
+    kUint32,
+    kUint64,
+    kInt8,
+    kInt16,
+    kInt32,
+    kInt64,
+    kFloat,
+    kDouble,
+    kString,
+    kRawBuffer,
+    kHex8,
+    kHex16,
+    kHex32,
+    kHex64,
+    kBin8,
+    kBin16,
+    kBin32,
+    kBin64,
+};
+
+/// \brief Maximum length of a string or raw buffer argument, limited by its 16 bit length field.
+constexpr std::size_t kBinaryMaxVariableLengthArgumentSize{0xFFFFUL};
+
+/// \brief BinaryFormat Class used to append arguments to a payload without formatting them to text.
+///
+/// \details Every argument is stored as its type tag followed by the value in the byte order of the writer. Strings and
+/// raw buffers have a 16 bit length field in between. Fixed size arguments are only added if they fit completely,
+/// strings and raw buffers are truncated to the remaining space, as done by TextFormat. Rendering to text is deferred
+/// to the offline BinaryLogDecoder.
+class BinaryFormat
+{
+  public:
+    static AddArgumentResult Log(VerbosePayload& payload, const bool data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::uint8_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::uint16_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::uint32_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::uint64_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int8_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int16_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int32_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::int64_t data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const float data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const double data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const std::string_view data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogRawBuffer data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex8 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex16 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex32 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogHex64 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin8 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin16 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin32 data) noexcept;
+    static AddArgumentResult Log(VerbosePayload& payload, const LogBin64 data) noexcept;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_FORMAT_H
@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+template <typename T>
+T ReadValueAt(const score::cpp::span<const std::uint8_t> data, const std::size_t offset)
+{
+    T value{};
+    std::memcpy(&value, &data[offset], sizeof(T));
+    return value;
+}
+
+class BinaryFormatFixture : public ::testing::Test
+{
+  public:
+    ByteVector buffer{};
+    VerbosePayload payload{100, buffer};
+    ByteVector size_four_buffer{};
+    VerbosePayload capacity_four_payload{4, size_four_buffer};
+};
+
+TEST_F(BinaryFormatFixture, FixedSizeArgumentShallBeStoredAsTypeTagAndValue)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryFormat shall store a fixed size argument as its type tag and its value.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given an empty payload
+    // When logging an unsigned 32 bit integer
+    const auto result = BinaryFormat::Log(payload, std::uint32_t{0x11223344U});
+
+    // Then the type tag is followed by the native representation of the value
+    ASSERT_EQ(result, AddArgumentResult::kAdded);
+    const auto data = payload.GetSpan();
+    ASSERT_EQ(data.size(), 5);
+    EXPECT_EQ(static_cast<BinaryArgumentType>(data[0]), BinaryArgumentType::kUint32);
+    EXPECT_EQ(ReadValueAt<std::uint32_t>(data, 1UL), 0x11223344U);
+}
+
+TEST_F(BinaryFormatFixture, FormattingWrappersShallBeDistinguishedByTheirTypeTag)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryFormat shall store hex and binary wrappers with their own type tags.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given an empty payload
+    // When logging the same value as hex and as binary
+    BinaryFormat::Log(payload, LogHex16{0xBEEFU});
+    BinaryFormat::Log(payload, LogBin16{0xBEEFU});
+
+    // Then both arguments carry the raw value, but different type tags
+    const auto data = payload.GetSpan();
+    ASSERT_EQ(data.size(), 6);
+    EXPECT_EQ(static_cast<BinaryArgumentType>(data[0]), BinaryArgumentType::kHex16);
+    EXPECT_EQ(ReadValueAt<std::uint16_t>(data, 1UL), 0xBEEFU);
+    EXPECT_EQ(static_cast<BinaryArgumentType>(data[3]), BinaryArgumentType::kBin16);
+    EXPECT_EQ(ReadValueAt<std::uint16_t>(data, 4UL), 0xBEEFU);
+}
+
+TEST_F(BinaryFormatFixture, StringShallBeStoredWithLengthPrefix)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryFormat shall store a string as type tag, 16 bit length and characters.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given an empty payload
+    // When logging a string
+    const auto result = BinaryFormat::Log(payload, std::string_view{"abc"});
+
+    // Then the characters follow the type tag and the length
+    ASSERT_EQ(result, AddArgumentResult::kAdded);
+    const auto data = payload.GetSpan();
+    ASSERT_EQ(data.size(), 6);
+    EXPECT_EQ(static_cast<BinaryArgumentType>(data[0]), BinaryArgumentType::kString);
+    EXPECT_EQ(ReadValueAt<std::uint16_t>(data, 1UL), 3U);
+    EXPECT_EQ(std::memcmp(&data[3], "abc", 3UL), 0);
+}
+
+TEST_F(BinaryFormatFixture, FixedSizeArgumentShallNotBeAddedIfItDoesNotFit)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryFormat shall not add a fixed size argument partially.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    // Given a payload with space for four bytes
+    // When logging an argument needing five bytes
+    const auto result = BinaryFormat::Log(capacity_four_payload, std::int32_t{-1});
+
+    // Then nothing is added
+    EXPECT_EQ(result, AddArgumentResult::kNotAdded);
+    EXPECT_EQ(capacity_four_payload.GetSpan().size(), 0);
+}
+
+TEST_F(BinaryFormatFixture, StringShallBeTruncatedToRemainingSpace)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryFormat shall cut off a string that does not fit into the payload.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    // Given a payload with space for four bytes
+    // When logging a string of five characters
+    const auto result = BinaryFormat::Log(capacity_four_payload, std::string_view{"hello"});
+
+    // Then only the first character fits behind type tag and length
+    ASSERT_EQ(result, AddArgumentResult::kAdded);
+    const auto data = capacity_four_payload.GetSpan();
+    ASSERT_EQ(data.size(), 4);
+    EXPECT_EQ(ReadValueAt<std::uint16_t>(data, 1UL), 1U);
+    EXPECT_EQ(data[3], 'h');
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,253 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/mw/log/detail/log_entry.h"
+#include "score/mw/log/detail/text_recorder/text_format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+using ByteSpan = score::cpp::span<const std::uint8_t>;
+using SizeType = ByteSpan::size_type;
+
+constexpr std::size_t kTypeTagSize{sizeof(BinaryArgumentType)};
+constexpr std::size_t kLengthFieldSize{sizeof(std::uint16_t)};
+
+/// Every variable length argument may expand to two characters per byte plus a separator.
+constexpr std::size_t kMaxLineSize{4UL * kBinaryMaxVariableLengthArgumentSize};
+
+template <typename T>
+T ReadAt(const ByteSpan data, const std::size_t offset) noexcept
+{
+    T value{};
+    std::ignore = std::memcpy(&value, &data[static_cast<SizeType>(offset)], sizeof(T));
+    return value;
+}
+
+template <typename T, typename Rendered = T>
+score::cpp::expected<std::size_t, BinaryLogDecoderError> DecodeFixedSizeArgument(const ByteSpan data,
+                                                                                VerbosePayload& line) noexcept
+{
+    constexpr std::size_t kArgumentSize = kTypeTagSize + sizeof(T);
+    if (static_cast<std::size_t>(data.size()) < kArgumentSize)
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+    }
+    TextFormat::Log(line, Rendered{ReadAt<T>(data, kTypeTagSize)});
+    return kArgumentSize;
+}
+
+template <typename Rendered>
+score::cpp::expected<std::size_t, BinaryLogDecoderError> DecodeVariableLengthArgument(const ByteSpan data,
+                                                                                     VerbosePayload& line) noexcept
+{
+    constexpr std::size_t kArgumentHeaderSize = kTypeTagSize + kLengthFieldSize;
+    if (static_cast<std::size_t>(data.size()) < kArgumentHeaderSize)
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+    }
+    const auto length = static_cast<std::size_t>(ReadAt<std::uint16_t>(data, kTypeTagSize));
+    if (static_cast<std::size_t>(data.size()) < (kArgumentHeaderSize + length))
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the text formatter expects characters
+    const auto* const characters = reinterpret_cast<const char*>(&data[static_cast<SizeType>(kArgumentHeaderSize)]);
+    TextFormat::Log(line, Rendered{characters, static_cast<typename Rendered::size_type>(length)});
+    return kArgumentHeaderSize + length;
+}
+
+}  // namespace
+
+std::string_view ToString(const BinaryLogDecoderError error) noexcept
+{
+    switch (error)
+    {
+        case BinaryLogDecoderError::kInvalidFileHeader:
+            return "Not a binary log file";
+        case BinaryLogDecoderError::kUnsupportedVersion:
+            return "Unsupported version of the binary log file format";
+        case BinaryLogDecoderError::kByteOrderMismatch:
+            return "The file was written with a different byte order";
+        case BinaryLogDecoderError::kTruncatedRecord:
+            return "The record is truncated";
+        case BinaryLogDecoderError::kInvalidRecordSize:
+            return "The record size is smaller than the record header";
+        case BinaryLogDecoderError::kInvalidArgument:
+            return "The record contains an unknown argument type";
+        default:
+            return "Unknown error";
+    }
+}
+
+BinaryLogDecoder::BinaryLogDecoder() noexcept : ecu_id_{""}, line_buffer_{}, line_{kMaxLineSize, line_buffer_} {}
+
+score::cpp::expected<std::size_t, BinaryLogDecoderError> BinaryLogDecoder::ReadFileHeader(const ByteSpan data) noexcept
+{
+    if ((static_cast<std::size_t>(data.size()) < kBinaryLogFileHeaderSize) ||
+        (!std::equal(kBinaryLogFileMagic.begin(), kBinaryLogFileMagic.end(), data.begin())))
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kInvalidFileHeader);
+    }
+
+    std::size_t offset = kBinaryLogFileMagic.size();
+    if (ReadAt<std::uint16_t>(data, offset) != kBinaryLogFormatVersion)
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kUnsupportedVersion);
+    }
+    offset += sizeof(std::uint16_t);
+
+    const auto byte_order_mark = ReadAt<std::uint16_t>(data, offset);
+    if (byte_order_mark != kBinaryLogByteOrderMark)
+    {
+        constexpr std::uint16_t kSwappedByteOrderMark{0x0201U};
+        return score::cpp::make_unexpected((byte_order_mark == kSwappedByteOrderMark)
+                                               ? BinaryLogDecoderError::kByteOrderMismatch
+                                               : BinaryLogDecoderError::kInvalidFileHeader);
+    }
+    offset += sizeof(std::uint16_t);
+
+    ecu_id_.data = ReadAt<decltype(ecu_id_.data)>(data, offset);
+    return kBinaryLogFileHeaderSize;
+}
+
+score::cpp::expected<std::size_t, BinaryLogDecoderError> BinaryLogDecoder::DecodeRecord(const ByteSpan data) noexcept
+{
+    const auto header = DeserializeRecordHeader(data);
+    if (!header.has_value())
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+    }
+    const std::size_t record_size = kBinaryLogRecordSizeFieldSize + header->size;
+    if (record_size < kBinaryLogRecordHeaderSize)
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kInvalidRecordSize);
+    }
+    if (static_cast<std::size_t>(data.size()) < record_size)
+    {
+        return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+    }
+
+    LogEntry log_entry{};
+    log_entry.app_id = header->app_id;
+    log_entry.ctx_id = header->ctx_id;
+    log_entry.log_level = header->log_level;
+    log_entry.num_of_args = header->number_of_arguments;
+    const std::chrono::nanoseconds time_since_epoch{header->time_since_epoch_nsec};
+    const std::chrono::system_clock::time_point time_point{
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(time_since_epoch)};
+
+    line_.Reset();
+    TextFormat::PutHeader(line_, log_entry, ecu_id_.GetStringView(), time_point, header->time_stamp);
+
+    auto arguments = data.subspan(static_cast<SizeType>(kBinaryLogRecordHeaderSize),
+                                  static_cast<SizeType>(record_size - kBinaryLogRecordHeaderSize));
+    while (arguments.size() > 0)
+    {
+        const auto argument_size = DecodeArgument(arguments);
+        if (!argument_size.has_value())
+        {
+            return argument_size;
+        }
+        arguments = arguments.subspan(static_cast<SizeType>(argument_size.value()));
+    }
+
+    TextFormat::TerminateLog(line_);
+    return record_size;
+}
+
+std::string_view BinaryLogDecoder::GetLine() const noexcept
+{
+    const auto line = line_.GetSpan();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the line consists of characters
+    return {reinterpret_cast<const char*>(line.data()), static_cast<std::size_t>(line.size())};
+}
+
+score::cpp::expected<std::size_t, BinaryLogDecoderError> BinaryLogDecoder::DecodeArgument(const ByteSpan data) noexcept
+{
+    switch (static_cast<BinaryArgumentType>(data[0]))
+    {
+        case BinaryArgumentType::kBool:
+        {
+            constexpr std::size_t kArgumentSize = kTypeTagSize + sizeof(std::uint8_t);
+            if (static_cast<std::size_t>(data.size()) < kArgumentSize)
+            {
+                return score::cpp::make_unexpected(BinaryLogDecoderError::kTruncatedRecord);
+            }
+            TextFormat::Log(line_, ReadAt<std::uint8_t>(data, kTypeTagSize) != 0U);
+            return kArgumentSize;
+        }
+        case BinaryArgumentType::kUint8:
+            return DecodeFixedSizeArgument<std::uint8_t>(data, line_);
+        case BinaryArgumentType::kUint16:
+            return DecodeFixedSizeArgument<std::uint16_t>(data, line_);
+        case BinaryArgumentType::kUint32:
+            return DecodeFixedSizeArgument<std::uint32_t>(data, line_);
+        case BinaryArgumentType::kUint64:
+            return DecodeFixedSizeArgument<std::uint64_t>(data, line_);
+        case BinaryArgumentType::kInt8:
+            return DecodeFixedSizeArgument<std::int8_t>(data, line_);
+        case BinaryArgumentType::kInt16:
+            return DecodeFixedSizeArgument<std::int16_t>(data, line_);
+        case BinaryArgumentType::kInt32:
+            return DecodeFixedSizeArgument<std::int32_t>(data, line_);
+        case BinaryArgumentType::kInt64:
+            return DecodeFixedSizeArgument<std::int64_t>(data, line_);
+        case BinaryArgumentType::kFloat:
+            return DecodeFixedSizeArgument<float>(data, line_);
+        case BinaryArgumentType::kDouble:
+            return DecodeFixedSizeArgument<double>(data, line_);
+        case BinaryArgumentType::kString:
+            return DecodeVariableLengthArgument<std::string_view>(data, line_);
+        case BinaryArgumentType::kRawBuffer:
+            return DecodeVariableLengthArgument<LogRawBuffer>(data, line_);
+        case BinaryArgumentType::kHex8:
+            return DecodeFixedSizeArgument<std::uint8_t, LogHex8>(data, line_);
+        case BinaryArgumentType::kHex16:
+            return DecodeFixedSizeArgument<std::uint16_t, LogHex16>(data, line_);
+        case BinaryArgumentType::kHex32:
+            return DecodeFixedSizeArgument<std::uint32_t, LogHex32>(data, line_);
+        case BinaryArgumentType::kHex64:
+            return DecodeFixedSizeArgument<std::uint64_t, LogHex64>(data, line_);
+        case BinaryArgumentType::kBin8:
+            return DecodeFixedSizeArgument<std::uint8_t, LogBin8>(data, line_);
+        case BinaryArgumentType::kBin16:
+            return DecodeFixedSizeArgument<std::uint16_t, LogBin16>(data, line_);
+        case BinaryArgumentType::kBin32:
+            return DecodeFixedSizeArgument<std::uint32_t, LogBin32>(data, line_);
+        case BinaryArgumentType::kBin64:
+            return DecodeFixedSizeArgument<std::uint64_t, LogBin64>(data, line_);
+        default:
+            return score::cpp::make_unexpected(BinaryLogDecoderError::kInvalidArgument);
+    }
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
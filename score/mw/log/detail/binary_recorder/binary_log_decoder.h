@@ -0,0 +1,87 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_DECODER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_DECODER_H
+
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+#include "score/mw/log/detail/verbose_payload.h"
+
+#include <score/expected.hpp>
+#include <score/span.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+enum class BinaryLogDecoderError : std::uint8_t
+{
+    kInvalidFileHeader = 0,
+    kUnsupportedVersion,
+    kByteOrderMismatch,
+    kTruncatedRecord,
+    kInvalidRecordSize,
+    kInvalidArgument,
+};
+
+/// \brief Returns a human readable description of the error.
+std::string_view ToString(const BinaryLogDecoderError error) noexcept;
+
+/// \brief Renders the records of a file written by the BinaryRecorder in the layout of the text recorder.
+///
+/// \details The header and every argument of a record are formatted with TextFormat, thus a decoded line looks like the
+/// line the text recorder writes for the same message. Only the text recorder may cut off long messages earlier, as the
+/// formatted arguments need more space in a slot than the binary ones.
+class BinaryLogDecoder final
+{
+  public:
+    BinaryLogDecoder() noexcept;
+
+    /// \brief Reads and checks the file header at the beginning of data.
+    ///
+    /// \return The number of bytes of the file header.
+    score::cpp::expected<std::size_t, BinaryLogDecoderError> ReadFileHeader(
+        const score::cpp::span<const std::uint8_t> data) noexcept;
+
+    /// \brief Renders the record at the beginning of data into a text line, see GetLine().
+    ///
+    /// \pre ReadFileHeader() succeeded.
+    /// \return The number of bytes of the record.
+    score::cpp::expected<std::size_t, BinaryLogDecoderError> DecodeRecord(
+        const score::cpp::span<const std::uint8_t> data) noexcept;
+
+    /// \brief Returns the line of the last record, including the line break. Only valid if DecodeRecord() succeeded.
+    std::string_view GetLine() const noexcept;
+
+  private:
+    score::cpp::expected<std::size_t, BinaryLogDecoderError> DecodeArgument(
+        const score::cpp::span<const std::uint8_t> data) noexcept;
+
+    LoggingIdentifier ecu_id_;
+    ByteVector line_buffer_;
+    VerbosePayload line_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_DECODER_H
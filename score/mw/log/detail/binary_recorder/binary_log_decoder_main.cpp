@@ -0,0 +1,66 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Offline tool rendering a file written by the BinaryRecorder to the text layout of the console output.
+///
+/// Usage: binary_log_decoder_tool <file.mwlog>
+///
+/// The lines are written to stdout. Decoding stops at the first corrupt or truncated record, which is reported with
+/// its file offset on stderr. All records before it are still written, thus the file of a crashed process can be read
+/// up to its last complete record.
+
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file.mwlog>\n";
+        return 2;
+    }
+
+    std::ifstream file{argv[1], std::ios::binary};
+    if (!file)
+    {
+        std::cerr << argv[1] << ": cannot open file\n";
+        return 1;
+    }
+    const std::vector<std::uint8_t> content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    const score::cpp::span<const std::uint8_t> data{content.data(), content.size()};
+
+    score::mw::log::detail::BinaryLogDecoder decoder{};
+    auto result = decoder.ReadFileHeader(data);
+    std::size_t offset{0UL};
+    while (result.has_value())
+    {
+        offset += result.value();
+        if (offset == content.size())
+        {
+            return 0;
+        }
+        result = decoder.DecodeRecord(data.subspan(offset));
+        if (result.has_value())
+        {
+            std::cout << decoder.GetLine();
+        }
+    }
+
+    std::cerr << argv[1] << ": offset " << offset << ": " << score::mw::log::detail::ToString(result.error()) << '\n';
+    return 1;
+}
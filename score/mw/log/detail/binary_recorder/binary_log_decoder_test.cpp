@@ -0,0 +1,277 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+#include "score/mw/log/detail/text_recorder/text_format.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using Bytes = std::vector<std::uint8_t>;
+
+void Append(Bytes& bytes, const score::cpp::span<const std::uint8_t> data)
+{
+    bytes.insert(bytes.end(), data.begin(), data.end());
+}
+
+class BinaryLogDecoderFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        const auto file_header = SerializeFileHeader(LoggingIdentifier{"ECU1"});
+        file_.assign(file_header.begin(), file_header.end());
+
+        auto& log_entry = log_record_.GetLogEntry();
+        log_entry.app_id = LoggingIdentifier{"APP"};
+        log_entry.ctx_id = LoggingIdentifier{"CTX"};
+        log_entry.log_level = LogLevel::kInfo;
+    }
+
+    /// Logs the value into the binary record and into the expected text line.
+    template <typename T>
+    void Log(const T value)
+    {
+        ASSERT_EQ(BinaryFormat::Log(log_record_.GetVerbosePayload(), value), AddArgumentResult::kAdded);
+        TextFormat::Log(expected_arguments_, value);
+        log_record_.GetLogEntry().num_of_args++;
+    }
+
+    /// Appends the record as written by the BinaryRecorder and returns the line expected from the decoder.
+    std::string WriteRecord()
+    {
+        BinaryMessageBuilder builder{};
+        builder.SetNextMessage(log_record_);
+        const auto header_span = builder.GetNextSpan().value();
+        const auto header = DeserializeRecordHeader(header_span).value();
+        Append(file_, header_span);
+        Append(file_, builder.GetNextSpan().value());
+
+        ByteVector buffer{};
+        VerbosePayload expected_line{1024UL, buffer};
+        const std::chrono::system_clock::time_point time_point{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds{header.time_since_epoch_nsec})};
+        TextFormat::PutHeader(expected_line, log_record_.GetLogEntry(), "ECU1", time_point, header.time_stamp);
+        const auto arguments = expected_arguments_.GetSpan();
+        expected_line.Put(reinterpret_cast<const char*>(arguments.data()), static_cast<std::size_t>(arguments.size()));
+        TextFormat::TerminateLog(expected_line);
+        const auto line = expected_line.GetSpan();
+        return std::string{reinterpret_cast<const char*>(line.data()), static_cast<std::size_t>(line.size())};
+    }
+
+    score::cpp::span<const std::uint8_t> FileFrom(const std::size_t offset) const
+    {
+        return score::cpp::span<const std::uint8_t>{file_.data() + offset, file_.size() - offset};
+    }
+
+  protected:
+    Bytes file_{};
+    LogRecord log_record_{1024UL};
+    ByteVector expected_arguments_buffer_{};
+    VerbosePayload expected_arguments_{1024UL, expected_arguments_buffer_};
+    BinaryLogDecoder unit_{};
+};
+
+TEST_F(BinaryLogDecoderFixture, DecodedLineShallMatchTextFormatForAllArgumentTypes)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "BinaryLogDecoder shall render a record in the same layout as the text recorder formats the "
+                   "message.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a record containing every argument type
+    Log(true);
+    Log(std::uint8_t{255U});
+    Log(std::uint16_t{65535U});
+    Log(std::uint32_t{4294967295U});
+    Log(std::uint64_t{18446744073709551615UL});
+    Log(std::int8_t{-128});
+    Log(std::int16_t{-32768});
+    Log(std::int32_t{-2147483647});
+    Log(std::int64_t{-9223372036854775807L});
+    Log(1.5F);
+    Log(-0.25);
+    Log(std::string_view{"text"});
+    Log(LogRawBuffer{"\x01\x02\xff", 3});
+    Log(LogHex8{0xABU});
+    Log(LogHex16{0xABCDU});
+    Log(LogHex32{0xDEADBEEFU});
+    Log(LogHex64{0x0123456789ABCDEFUL});
+    Log(LogBin8{0x5AU});
+    Log(LogBin16{0x5A5AU});
+    Log(LogBin32{0x5A5A5A5AU});
+    Log(LogBin64{0x5A5A5A5A5A5A5A5AUL});
+    const auto expected_line = WriteRecord();
+
+    // When decoding the file
+    ASSERT_EQ(unit_.ReadFileHeader(file_).value(), kBinaryLogFileHeaderSize);
+    const auto record_size = unit_.DecodeRecord(FileFrom(kBinaryLogFileHeaderSize));
+
+    // Then the whole record is consumed and the line equals the text format
+    ASSERT_TRUE(record_size.has_value());
+    EXPECT_EQ(record_size.value(), file_.size() - kBinaryLogFileHeaderSize);
+    EXPECT_EQ(unit_.GetLine(), expected_line);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallDecodeConsecutiveRecords)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall return the size of a record to find the next one.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a file with two records
+    Log(std::string_view{"first"});
+    std::ignore = WriteRecord();
+    log_record_.GetVerbosePayload().Reset();
+    log_record_.GetLogEntry().num_of_args = 0U;
+    expected_arguments_.Reset();
+    Log(std::string_view{"second"});
+    const auto second_line = WriteRecord();
+
+    // When decoding the records one after the other
+    std::size_t offset = unit_.ReadFileHeader(file_).value();
+    offset += unit_.DecodeRecord(FileFrom(offset)).value();
+    offset += unit_.DecodeRecord(FileFrom(offset)).value();
+
+    // Then the end of the file is reached with the second line
+    EXPECT_EQ(offset, file_.size());
+    EXPECT_EQ(unit_.GetLine(), second_line);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallRejectFileWithoutMagic)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall reject a file not starting with the magic.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    file_[0] = 'X';
+    EXPECT_EQ(unit_.ReadFileHeader(file_).error(), BinaryLogDecoderError::kInvalidFileHeader);
+    EXPECT_EQ(unit_.ReadFileHeader(FileFrom(file_.size() - 1UL)).error(), BinaryLogDecoderError::kInvalidFileHeader);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallRejectUnsupportedVersion)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall reject a file of an unknown format version.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    const std::uint16_t version{kBinaryLogFormatVersion + 1U};
+    std::memcpy(&file_[kBinaryLogFileMagic.size()], &version, sizeof(version));
+    EXPECT_EQ(unit_.ReadFileHeader(file_).error(), BinaryLogDecoderError::kUnsupportedVersion);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallDetectByteOrderMismatch)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall reject a file written with a different byte order.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    std::swap(file_[kBinaryLogFileMagic.size() + 2UL], file_[kBinaryLogFileMagic.size() + 3UL]);
+    EXPECT_EQ(unit_.ReadFileHeader(file_).error(), BinaryLogDecoderError::kByteOrderMismatch);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallDetectTruncatedRecord)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall report a record cut off at the end of the file.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    // Given a record of which the last byte is missing, e.g. because the writer crashed
+    Log(std::string_view{"truncated"});
+    std::ignore = WriteRecord();
+    file_.pop_back();
+
+    ASSERT_TRUE(unit_.ReadFileHeader(file_).has_value());
+    EXPECT_EQ(unit_.DecodeRecord(FileFrom(kBinaryLogFileHeaderSize)).error(), BinaryLogDecoderError::kTruncatedRecord);
+    EXPECT_EQ(unit_.DecodeRecord(FileFrom(file_.size() - 1UL)).error(), BinaryLogDecoderError::kTruncatedRecord);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallDetectInvalidRecordSize)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall reject a record that is smaller than its header.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    std::ignore = WriteRecord();
+    const std::uint32_t size{1U};
+    std::memcpy(&file_[kBinaryLogFileHeaderSize], &size, sizeof(size));
+
+    ASSERT_TRUE(unit_.ReadFileHeader(file_).has_value());
+    EXPECT_EQ(unit_.DecodeRecord(FileFrom(kBinaryLogFileHeaderSize)).error(),
+              BinaryLogDecoderError::kInvalidRecordSize);
+}
+
+TEST_F(BinaryLogDecoderFixture, ShallDetectUnknownArgumentType)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryLogDecoder shall reject a record with an unknown argument type.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    Log(std::uint8_t{1U});
+    std::ignore = WriteRecord();
+    file_[kBinaryLogFileHeaderSize + kBinaryLogRecordHeaderSize] = 0xFFU;
+
+    ASSERT_TRUE(unit_.ReadFileHeader(file_).has_value());
+    EXPECT_EQ(unit_.DecodeRecord(FileFrom(kBinaryLogFileHeaderSize)).error(), BinaryLogDecoderError::kInvalidArgument);
+}
+
+TEST(BinaryLogDecoderErrorTest, EveryErrorShallHaveADescription)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Every decoder error shall have a human readable description.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    for (const auto error : {BinaryLogDecoderError::kInvalidFileHeader,
+                             BinaryLogDecoderError::kUnsupportedVersion,
+                             BinaryLogDecoderError::kByteOrderMismatch,
+                             BinaryLogDecoderError::kTruncatedRecord,
+                             BinaryLogDecoderError::kInvalidRecordSize,
+                             BinaryLogDecoderError::kInvalidArgument})
+    {
+        EXPECT_FALSE(ToString(error).empty());
+        EXPECT_NE(ToString(error), "Unknown error");
+    }
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
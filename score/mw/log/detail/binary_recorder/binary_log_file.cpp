@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+
+#include <cstring>
+#include <type_traits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+static_assert(sizeof(LogLevel) == 1UL, "The record header reserves a single byte for the log level");
+
+template <typename T, std::size_t N>
+std::size_t WriteAt(std::array<std::uint8_t, N>& buffer, const std::size_t offset, const T& value) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be serialized");
+    static_assert(sizeof(T) <= N, "Value does not fit into the buffer");
+    std::ignore = std::memcpy(&buffer.at(offset), &value, sizeof(T));
+    return offset + sizeof(T);
+}
+
+template <typename T>
+std::size_t ReadAt(const score::cpp::span<const std::uint8_t> data, const std::size_t offset, T& value) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be deserialized");
+    using SizeType = score::cpp::span<const std::uint8_t>::size_type;
+    std::ignore = std::memcpy(&value, &data[static_cast<SizeType>(offset)], sizeof(T));
+    return offset + sizeof(T);
+}
+
+}  // namespace
+
+BinaryLogFileHeaderBuffer SerializeFileHeader(const LoggingIdentifier& ecu_id) noexcept
+{
+    BinaryLogFileHeaderBuffer buffer{};
+    auto offset = WriteAt(buffer, 0UL, kBinaryLogFileMagic);
+    offset = WriteAt(buffer, offset, kBinaryLogFormatVersion);
+    offset = WriteAt(buffer, offset, kBinaryLogByteOrderMark);
+    std::ignore = WriteAt(buffer, offset, ecu_id.data);
+    return buffer;
+}
+
+void SerializeRecordHeader(const BinaryLogRecordHeader& header, BinaryLogRecordHeaderBuffer& buffer) noexcept
+{
+    auto offset = WriteAt(buffer, 0UL, header.size);
+    offset = WriteAt(buffer, offset, header.time_since_epoch_nsec);
+    offset = WriteAt(buffer, offset, header.time_stamp);
+    offset = WriteAt(buffer, offset, header.app_id.data);
+    offset = WriteAt(buffer, offset, header.ctx_id.data);
+    offset = WriteAt(buffer, offset, header.log_level);
+    std::ignore = WriteAt(buffer, offset, header.number_of_arguments);
+}
+
+score::cpp::optional<BinaryLogRecordHeader> DeserializeRecordHeader(
+    const score::cpp::span<const std::uint8_t> data) noexcept
+{
+    if (static_cast<std::size_t>(data.size()) < kBinaryLogRecordHeaderSize)
+    {
+        return {};
+    }
+
+    BinaryLogRecordHeader header{};
+    auto offset = ReadAt(data, 0UL, header.size);
+    offset = ReadAt(data, offset, header.time_since_epoch_nsec);
+    offset = ReadAt(data, offset, header.time_stamp);
+    offset = ReadAt(data, offset, header.app_id.data);
+    offset = ReadAt(data, offset, header.ctx_id.data);
+    offset = ReadAt(data, offset, header.log_level);
+    std::ignore = ReadAt(data, offset, header.number_of_arguments);
+    return header;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,98 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_FILE_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_FILE_H
+
+#include "score/mw/log/detail/logging_identifier.h"
+#include "score/mw/log/log_level.h"
+
+#include <score/optional.hpp>
+#include <score/span.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Layout of the files written by the binary recorder.
+///
+/// \details A file starts with a file header, followed by one record per log message:
+///
+///   file header: | "MWLOGBIN" | u16 version | u16 byte order mark | char[4] ECU id |                     16 bytes
+///   record:      | u32 size | u64 system time [ns] | u32 time stamp [0.1 ms] | char[4] app id | char[4] ctx id |
+///                | u8 log level | u8 number of arguments | arguments ... |                   26 bytes + arguments
+///
+/// The size of a record counts all bytes after the size field, thus a reader can skip records without understanding
+/// them. The arguments are encoded by BinaryFormat. All integers are stored in the byte order of the writer, a reader
+/// detects a different byte order by the byte order mark.
+constexpr std::array<char, 8UL> kBinaryLogFileMagic{'M', 'W', 'L', 'O', 'G', 'B', 'I', 'N'};
+constexpr std::uint16_t kBinaryLogFormatVersion{1U};
+constexpr std::uint16_t kBinaryLogByteOrderMark{0x0102U};
+constexpr std::size_t kBinaryLogFileHeaderSize{16UL};
+constexpr std::size_t kBinaryLogRecordHeaderSize{26UL};
+constexpr std::size_t kBinaryLogRecordSizeFieldSize{sizeof(std::uint32_t)};
+
+/*
+Deviation from Rule M11-0-1:
+- Member data in non-POD class types shall be private.
+Justification:
+- The type is a plain collection of the fields of a record header without invariants.
+*/
+// coverity[autosar_cpp14_m11_0_1_violation]
+struct BinaryLogRecordHeader
+{
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t size{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t time_since_epoch_nsec{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t time_stamp{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    LoggingIdentifier app_id{""};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    LoggingIdentifier ctx_id{""};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    LogLevel log_level{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint8_t number_of_arguments{};
+};
+
+using BinaryLogFileHeaderBuffer = std::array<std::uint8_t, kBinaryLogFileHeaderSize>;
+using BinaryLogRecordHeaderBuffer = std::array<std::uint8_t, kBinaryLogRecordHeaderSize>;
+
+/// \brief Serializes the file header for a file written on the given ECU.
+BinaryLogFileHeaderBuffer SerializeFileHeader(const LoggingIdentifier& ecu_id) noexcept;
+
+/// \brief Serializes a record header.
+void SerializeRecordHeader(const BinaryLogRecordHeader& header, BinaryLogRecordHeaderBuffer& buffer) noexcept;
+
+/// \brief Reads a record header from the beginning of data.
+///
+/// \return The header, or an empty optional if data is shorter than a record header.
+score::cpp::optional<BinaryLogRecordHeader> DeserializeRecordHeader(
+    const score::cpp::span<const std::uint8_t> data) noexcept;
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_LOG_FILE_H
@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+
+#include "score/os/utils/high_resolution_steady_clock.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+/// Same time base as the time stamp of the text recorder.
+inline std::uint32_t TimeStamp() noexcept
+{
+    const std::uint32_t timestamp = std::chrono::duration_cast<std::chrono::duration<uint32_t, std::ratio<1, 10000>>>(
+                                        score::os::HighResolutionSteadyClock::now().time_since_epoch())
+                                        .count();
+    return timestamp;
+}
+
+inline std::uint64_t TimeSinceEpoch() noexcept
+{
+    const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+    return static_cast<std::uint64_t>(nanoseconds);
+}
+
+}  // namespace
+
+BinaryMessageBuilder::BinaryMessageBuilder() noexcept
+    : IMessageBuilder(), log_record_{}, header_{}, parsing_phase_{ParsingPhase::kHeader}
+{
+}
+
+void BinaryMessageBuilder::SetNextMessage(LogRecord& log_record) noexcept
+{
+    log_record_ = log_record;
+
+    const auto& log_entry = log_record.GetLogEntry();
+    const auto payload_size = static_cast<std::size_t>(log_record.GetVerbosePayload().GetSpan().size());
+
+    BinaryLogRecordHeader header{};
+    //  The payload is limited by the slot size, which is far below the range of the size field:
+    header.size = static_cast<std::uint32_t>(
+        std::min(kBinaryLogRecordHeaderSize - kBinaryLogRecordSizeFieldSize + payload_size,
+                 static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max())));
+    header.time_since_epoch_nsec = TimeSinceEpoch();
+    header.time_stamp = TimeStamp();
+    header.app_id = log_entry.app_id;
+    header.ctx_id = log_entry.ctx_id;
+    header.log_level = log_entry.log_level;
+    header.number_of_arguments = log_entry.num_of_args;
+    SerializeRecordHeader(header, header_);
+
+    parsing_phase_ = ParsingPhase::kHeader;
+}
+
+score::cpp::optional<score::cpp::span<const std::uint8_t>> BinaryMessageBuilder::GetNextSpan() noexcept
+{
+    if (!log_record_.has_value())
+    {
+        return {};
+    }
+
+    score::cpp::optional<score::cpp::span<const std::uint8_t>> return_result = {};
+    switch (parsing_phase_)
+    {
+        case ParsingPhase::kHeader:
+            parsing_phase_ = ParsingPhase::kPayload;
+            return_result = score::cpp::span<const std::uint8_t>{header_.data(), header_.size()};
+            break;
+        case ParsingPhase::kPayload:
+            parsing_phase_ = ParsingPhase::kReinitialize;
+            return_result = log_record_.value().get().GetVerbosePayload().GetSpan();
+            break;
+        case ParsingPhase::kReinitialize:
+        default:
+            parsing_phase_ = ParsingPhase::kHeader;
+            log_record_.reset();
+            break;
+    }
+    return return_result;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,58 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_MESSAGE_BUILDER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_MESSAGE_BUILDER_H
+
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+#include "score/mw/log/detail/text_recorder/imessage_builder.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Splits a log record into the record header and the argument payload of the binary log file format.
+///
+/// \details The payload was already serialized by BinaryFormat when the arguments were logged, thus it is written as
+/// is. Only the fixed size record header is built here.
+class BinaryMessageBuilder : public IMessageBuilder
+{
+  public:
+    BinaryMessageBuilder() noexcept;
+
+    score::cpp::optional<score::cpp::span<const std::uint8_t>> GetNextSpan() noexcept override;
+
+    void SetNextMessage(LogRecord& log_record) noexcept override;
+
+  private:
+    enum class ParsingPhase : std::uint8_t
+    {
+        kHeader = 0,
+        kPayload,
+        kReinitialize,
+    };
+    score::cpp::optional<std::reference_wrapper<LogRecord>> log_record_;
+    BinaryLogRecordHeaderBuffer header_;
+    ParsingPhase parsing_phase_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_MESSAGE_BUILDER_H
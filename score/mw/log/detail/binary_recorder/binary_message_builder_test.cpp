@@ -0,0 +1,122 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+#include "score/mw/log/detail/binary_recorder/binary_format.h"
+
+#include "gtest/gtest.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+class BinaryMessageBuilderFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        auto& log_entry = log_record_.GetLogEntry();
+        log_entry.app_id = LoggingIdentifier{"BMB"};
+        log_entry.ctx_id = LoggingIdentifier{"CTX"};
+        log_entry.log_level = LogLevel::kWarn;
+        log_entry.num_of_args = 2U;
+        BinaryFormat::Log(log_record_.GetVerbosePayload(), std::uint8_t{7U});
+        BinaryFormat::Log(log_record_.GetVerbosePayload(), std::string_view{"payload"});
+    }
+
+  protected:
+    BinaryMessageBuilder unit_{};
+    LogRecord log_record_{};
+};
+
+TEST_F(BinaryMessageBuilderFixture, ShallDepleteAfterHeaderAndPayload)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryMessageBuilder shall deplete after getting header and payload.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    unit_.SetNextMessage(log_record_);
+    EXPECT_TRUE(unit_.GetNextSpan().has_value());
+    EXPECT_TRUE(unit_.GetNextSpan().has_value());
+    EXPECT_FALSE(unit_.GetNextSpan().has_value());
+    EXPECT_FALSE(unit_.GetNextSpan().has_value());
+}
+
+TEST_F(BinaryMessageBuilderFixture, HeaderShallDescribeTheRecord)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The record header shall contain the size of the record, the identifiers, the log level and the "
+                   "number of arguments.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a log record with two arguments
+    unit_.SetNextMessage(log_record_);
+
+    // When getting the header and the payload
+    const auto header_span = unit_.GetNextSpan().value();
+    const auto payload_span = unit_.GetNextSpan().value();
+
+    // Then the header can be read back and its size covers everything after the size field
+    ASSERT_EQ(static_cast<std::size_t>(header_span.size()), kBinaryLogRecordHeaderSize);
+    const auto header = DeserializeRecordHeader(header_span);
+    ASSERT_TRUE(header.has_value());
+    const auto payload_size = static_cast<std::size_t>(payload_span.size());
+    EXPECT_EQ(header->size, kBinaryLogRecordHeaderSize - kBinaryLogRecordSizeFieldSize + payload_size);
+    EXPECT_EQ(header->app_id.GetStringView(), "BMB");
+    EXPECT_EQ(header->ctx_id.GetStringView(), "CTX");
+    EXPECT_EQ(header->log_level, LogLevel::kWarn);
+    EXPECT_EQ(header->number_of_arguments, 2U);
+    EXPECT_NE(header->time_since_epoch_nsec, 0U);
+}
+
+TEST_F(BinaryMessageBuilderFixture, PayloadShallBePassedUnchanged)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryMessageBuilder shall pass the serialized arguments unchanged.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    unit_.SetNextMessage(log_record_);
+    std::ignore = unit_.GetNextSpan();
+    const auto payload_span = unit_.GetNextSpan().value();
+
+    const auto expected = log_record_.GetVerbosePayload().GetSpan();
+    EXPECT_EQ(payload_span.data(), expected.data());
+    EXPECT_EQ(payload_span.size(), expected.size());
+}
+
+TEST(BinaryMessageBuilderTest, ShallReturnNothingWithoutMessage)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "BinaryMessageBuilder shall return no span if no message was set.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    BinaryMessageBuilder unit{};
+    EXPECT_FALSE(unit.GetNextSpan().has_value());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
+
+#include "score/mw/log/configuration/configuration.h"
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/recorder.h"
+#include "score/os/unistd.h"
+
+#include <score/memory.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Recorder that stores the arguments of a log message in their binary representation.
+///
+/// \details The arguments are serialized by BinaryFormat instead of being formatted to text, which is deferred to the
+/// offline BinaryLogDecoder. The records are written by the backend with a BinaryMessageBuilder.
+class BinaryRecorder : public Recorder
+{
+  public:
+    BinaryRecorder(const detail::Configuration& config, std::unique_ptr<detail::Backend> backend) noexcept;
+
+    /// \brief Creates a recorder that owns the log file the backend writes into.
+    ///
+    /// \details The file is closed on destruction, after the backend flushed the remaining records.
+    BinaryRecorder(const detail::Configuration& config,
+                   std::unique_ptr<detail::Backend> backend,
+                   const std::int32_t file_descriptor,
+                   score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+    BinaryRecorder(BinaryRecorder&&) noexcept = delete;
+    BinaryRecorder(const BinaryRecorder&) noexcept = delete;
+    BinaryRecorder& operator=(BinaryRecorder&&) noexcept = delete;
+    BinaryRecorder& operator=(const BinaryRecorder&) noexcept = delete;
+
+    ~BinaryRecorder() override;
+
+    score::cpp::optional<SlotHandle> StartRecord(const std::string_view context_id,
+                                                 const LogLevel log_level) noexcept override;
+    void StopRecord(const SlotHandle& slot) noexcept override;
+
+    void Log(const SlotHandle& slot, const bool data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int8_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int16_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int32_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::uint64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const std::int64_t data) noexcept override;
+    void Log(const SlotHandle& slot, const float data) noexcept override;
+    void Log(const SlotHandle& slot, const double data) noexcept override;
+    void Log(const SlotHandle& slot, const LogRawBuffer data) noexcept override;
+    void Log(const SlotHandle& slot, const std::string_view data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogHex64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin8 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin16 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin32 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogBin64 data) noexcept override;
+    void Log(const SlotHandle& slot, const LogSlog2Message data) noexcept override;
+
+    bool IsLogEnabled(const LogLevel&, const std::string_view) const noexcept override;
+
+    score::cpp::optional<LogLevel> GetLogLevelThreshold(const std::string_view context) const noexcept override;
+
+  private:
+    std::unique_ptr<detail::Backend> backend_;
+
+    detail::Configuration config_;
+    std::int32_t file_descriptor_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_H
@@ -0,0 +1,142 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_recorder_factory.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/error.h"
+#include "score/mw/log/detail/initialization_reporter.h"
+#include "score/mw/log/detail/text_recorder/file_output_backend.h"
+
+#include "score/os/sys_uio.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::size_t kMaxSlotsPerBatch{32UL};
+
+}  // namespace
+
+BinaryRecorderFactory::BinaryRecorderFactory(score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                                             score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept
+    : LogRecorderFactory<BinaryRecorderFactory>(), fcntl_{std::move(fcntl_instance)}, unistd_{std::move(unistd)}
+{
+}
+
+std::string BinaryRecorderFactory::GetLogFilePath(const Configuration& config)
+{
+    std::string path{config.GetLogFilePath()};
+    path.append("/").append(config.GetAppId()).append(kBinaryLogFileExtension);
+    return path;
+}
+
+RotatingFileSettings BinaryRecorderFactory::GetRotatingFileSettings(const Configuration& config)
+{
+    RotatingFileSettings settings{};
+    settings.path_prefix.append(config.GetLogFilePath()).append("/").append(config.GetAppId());
+    settings.extension = std::string{kBinaryLogFileExtension};
+    settings.segment_size = config.GetLogFileSizeLimit();
+    settings.segment_count = config.GetLogFileSegmentCount();
+    settings.sync_closed_segments = config.GetLogFileSyncOnRotation();
+    //  Every segment can be decoded on its own:
+    const auto file_header = SerializeFileHeader(LoggingIdentifier{config.GetEcuId()});
+    settings.segment_header.assign(file_header.begin(), file_header.end());
+    return settings;
+}
+
+std::unique_ptr<Recorder> BinaryRecorderFactory::CreateConcreteLogRecorder(
+    const Configuration& config,
+    score::cpp::pmr::memory_resource* memory_resource)
+{
+    if (config.GetLogFileSizeLimit() > 0UL)
+    {
+        return CreateRotatingLogRecorder(config, memory_resource);
+    }
+
+    const auto file_path = GetLogFilePath(config);
+    const auto open_flags = score::os::Fcntl::Open::kWriteOnly | score::os::Fcntl::Open::kCreate |
+                            score::os::Fcntl::Open::kTruncate | score::os::Fcntl::Open::kCloseOnExec;
+    const auto access_rights =
+        score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser | score::os::Stat::Mode::kReadGroup;
+    const auto file_descriptor = fcntl_->open(file_path.c_str(), open_flags, access_rights);
+    if (!file_descriptor.has_value())
+    {
+        ReportInitializationError(Error::kLogFileCreationFailed, file_path);
+        return std::make_unique<EmptyRecorder>();
+    }
+
+    //  The file header is written once, before any record. A file without it could not be decoded:
+    const auto file_header = SerializeFileHeader(LoggingIdentifier{config.GetEcuId()});
+    const auto written = unistd_->write(file_descriptor.value(), file_header.data(), file_header.size());
+    if ((!written.has_value()) || (static_cast<std::size_t>(written.value()) != file_header.size()))
+    {
+        ReportInitializationError(Error::kLogFileCreationFailed, file_path);
+        std::ignore = unistd_->close(file_descriptor.value());
+        return std::make_unique<EmptyRecorder>();
+    }
+
+    auto allocator =
+        std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
+                                                       LogRecord{config.GetSlotSizeInBytes()},
+                                                       GetRecommendedNumberOfShards(config.GetNumberOfSlots()));
+    auto backend = std::make_unique<FileOutputBackend>(std::make_unique<BinaryMessageBuilder>(),
+                                                       file_descriptor.value(),
+                                                       std::move(allocator),
+                                                       score::os::Fcntl::Default(memory_resource),
+                                                       score::os::SysUio::Default(memory_resource),
+                                                       kMaxSlotsPerBatch);
+    return std::make_unique<BinaryRecorder>(
+        config, std::move(backend), file_descriptor.value(), score::os::Unistd::Default(memory_resource));
+}
+
+std::unique_ptr<Recorder> BinaryRecorderFactory::CreateRotatingLogRecorder(
+    const Configuration& config,
+    score::cpp::pmr::memory_resource* memory_resource)
+{
+    auto settings = GetRotatingFileSettings(config);
+    const auto first_segment_path = RotatingFile::GetSegmentPath(settings, 0UL);
+    auto rotating_file = std::make_shared<RotatingFile>(
+        std::move(settings), score::os::Fcntl::Default(memory_resource), score::os::Unistd::Default(memory_resource));
+    if (!rotating_file->Open().has_value())
+    {
+        ReportInitializationError(Error::kLogFileCreationFailed, first_segment_path);
+        return std::make_unique<EmptyRecorder>();
+    }
+
+    auto allocator =
+        std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
+                                                       LogRecord{config.GetSlotSizeInBytes()},
+                                                       GetRecommendedNumberOfShards(config.GetNumberOfSlots()));
+    //  The backend owns the file, it closes the last segment after writing the remaining records on destruction:
+    auto backend = std::make_unique<FileOutputBackend>(std::make_unique<BinaryMessageBuilder>(),
+                                                       std::move(rotating_file),
+                                                       std::move(allocator),
+                                                       score::os::SysUio::Default(memory_resource),
+                                                       kMaxSlotsPerBatch);
+    return std::make_unique<BinaryRecorder>(config, std::move(backend));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,72 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_FACTORY_H
+#define SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_FACTORY_H
+
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+#include "score/mw/log/detail/log_recorder_factory.hpp"
+#include "score/mw/log/detail/text_recorder/rotating_file.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/unistd.h"
+
+#include <string>
+#include <string_view>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief File name extension of the files written by the binary recorder.
+constexpr std::string_view kBinaryLogFileExtension{".mwlog"};
+
+/// \brief Creates a BinaryRecorder that writes into the file "<log file path>/<app id>.mwlog".
+///
+/// \details An existing file is truncated. If the file can not be created, an EmptyRecorder is returned.
+///
+/// If the configuration sets a log file size limit, the recorder writes into a RotatingFile instead, with the segments
+/// "<log file path>/<app id>.<n>.mwlog". Every segment starts with the file header.
+class BinaryRecorderFactory : public LogRecorderFactory<BinaryRecorderFactory>
+{
+  public:
+    BinaryRecorderFactory(score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                          score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+
+    std::unique_ptr<Recorder> CreateConcreteLogRecorder(const Configuration& config,
+                                                        score::cpp::pmr::memory_resource* memory_resource);
+
+    /// \brief Returns the path of the file that a recorder for the given configuration writes into.
+    static std::string GetLogFilePath(const Configuration& config);
+
+    /// \brief Returns the settings of the rotating file that a recorder for the given configuration writes into.
+    static RotatingFileSettings GetRotatingFileSettings(const Configuration& config);
+
+  private:
+    std::unique_ptr<Recorder> CreateRotatingLogRecorder(const Configuration& config,
+                                                        score::cpp::pmr::memory_resource* memory_resource);
+
+    score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_BINARY_RECORDER_BINARY_RECORDER_FACTORY_H
@@ -0,0 +1,295 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/binary_recorder/binary_recorder_factory.h"
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+#include "score/mw/log/detail/empty_recorder.h"
+
+#include "score/os/mocklib/fcntl_mock.h"
+#include "score/os/mocklib/unistdmock.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::Return;
+
+class BinaryRecorderFactoryFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        config_.SetLogFilePath(::testing::TempDir());
+        config_.SetEcuId("ECU1");
+        config_.SetAppId("BINF");
+        config_.SetDefaultLogLevel(LogLevel::kInfo);
+        config_.SetLogMode({LogMode::kBinaryFile});
+    }
+
+    std::vector<std::uint8_t> ReadLogFile() const
+    {
+        return ReadFile(BinaryRecorderFactory::GetLogFilePath(config_));
+    }
+
+    static std::vector<std::uint8_t> ReadFile(const std::string& path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        return std::vector<std::uint8_t>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    /// Returns the number of records in the file, or an empty optional if the file is not decodable completely.
+    static score::cpp::optional<std::size_t> CountRecords(const std::vector<std::uint8_t>& file)
+    {
+        score::cpp::span<const std::uint8_t> data{file.data(), file.size()};
+        BinaryLogDecoder decoder{};
+        const auto file_header_size = decoder.ReadFileHeader(data);
+        if (!file_header_size.has_value())
+        {
+            return {};
+        }
+        data = data.subspan(file_header_size.value());
+        std::size_t number_of_records{0UL};
+        while (data.size() > 0)
+        {
+            const auto record_size = decoder.DecodeRecord(data);
+            if (!record_size.has_value())
+            {
+                return {};
+            }
+            data = data.subspan(record_size.value());
+            ++number_of_records;
+        }
+        return number_of_records;
+    }
+
+  protected:
+    Configuration config_{};
+    score::cpp::pmr::memory_resource* memory_resource_{score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(BinaryRecorderFactoryFixture, LogFilePathShallBeDerivedFromConfiguration)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The binary log file shall be named after the application in the log file path.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    config_.SetLogFilePath("/var/log");
+    EXPECT_EQ(BinaryRecorderFactory::GetLogFilePath(config_), "/var/log/BINF.mwlog");
+}
+
+TEST_F(BinaryRecorderFactoryFixture, RotatingFileSettingsShallBeDerivedFromConfiguration)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The segments of a rotated binary log file shall be named after the application and start with "
+                   "the file header.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    config_.SetLogFilePath("/var/log");
+    config_.SetLogFileSizeLimit(4096UL);
+    config_.SetLogFileSegmentCount(5UL);
+    config_.SetLogFileSyncOnRotation(true);
+
+    const auto settings = BinaryRecorderFactory::GetRotatingFileSettings(config_);
+
+    EXPECT_EQ(RotatingFile::GetSegmentPath(settings, 1UL), "/var/log/BINF.1.mwlog");
+    EXPECT_EQ(settings.segment_size, 4096UL);
+    EXPECT_EQ(settings.segment_count, 5UL);
+    EXPECT_TRUE(settings.sync_closed_segments);
+    const auto file_header = SerializeFileHeader(LoggingIdentifier{"ECU1"});
+    EXPECT_EQ(settings.segment_header, std::vector<std::uint8_t>(file_header.begin(), file_header.end()));
+}
+
+TEST_F(BinaryRecorderFactoryFixture, RotatedSegmentsShallBeDecodableOnTheirOwn)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If a log file size limit is configured, the records shall be spread over segments that can be "
+                   "decoded on their own, without losing records.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    constexpr std::size_t kSegmentCount{3UL};
+    config_.SetLogFileSizeLimit(128UL);
+    config_.SetLogFileSegmentCount(kSegmentCount);
+    const auto settings = BinaryRecorderFactory::GetRotatingFileSettings(config_);
+    for (std::size_t index = 0UL; index < kSegmentCount; ++index)
+    {
+        std::ignore = ::unlink(RotatingFile::GetSegmentPath(settings, index).c_str());
+    }
+
+    // Given a recorder with a small log file size limit
+    std::size_t number_of_records{0UL};
+    {
+        BinaryRecorderFactory factory{score::os::Fcntl::Default(memory_resource_),
+                                      score::os::Unistd::Default(memory_resource_)};
+        auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+        ASSERT_EQ(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+
+        const auto log_record = [&recorder, &number_of_records]() {
+            const auto slot = recorder->StartRecord("CTX1", LogLevel::kError);
+            ASSERT_TRUE(slot.has_value());
+            recorder->Log(slot.value(), std::string_view{"fills the segment"});
+            recorder->StopRecord(slot.value());
+            ++number_of_records;
+        };
+
+        // When logging until the recorder switched to the second segment, i.e. the third one is prepared
+        const auto third_segment_path = RotatingFile::GetSegmentPath(settings, 2UL);
+        for (std::size_t attempt = 0UL; (attempt < 5000UL) && (::access(third_segment_path.c_str(), F_OK) != 0);
+             ++attempt)
+        {
+            log_record();
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        // And logging once more into the second segment
+        log_record();
+    }
+
+    // Then every segment is decodable and together they contain all records
+    std::size_t number_of_decoded_records{0UL};
+    for (std::size_t index = 0UL; index < kSegmentCount; ++index)
+    {
+        const auto path = RotatingFile::GetSegmentPath(settings, index);
+        if (::access(path.c_str(), F_OK) == 0)
+        {
+            const auto records_in_segment = CountRecords(ReadFile(path));
+            ASSERT_TRUE(records_in_segment.has_value()) << path;
+            number_of_decoded_records += records_in_segment.value();
+        }
+    }
+    EXPECT_GT(CountRecords(ReadFile(RotatingFile::GetSegmentPath(settings, 1UL))).value_or(0UL), 0UL);
+    EXPECT_EQ(number_of_decoded_records, number_of_records);
+}
+
+TEST_F(BinaryRecorderFactoryFixture, ShallReturnEmptyRecorderIfFirstSegmentCannotBeCreated)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The factory shall fall back to an EmptyRecorder if the first segment of a rotated log file cannot "
+                   "be created.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    config_.SetLogFilePath(::testing::TempDir() + "/not_existing_directory");
+    config_.SetLogFileSizeLimit(4096UL);
+    BinaryRecorderFactory factory{score::os::Fcntl::Default(memory_resource_),
+                                  score::os::Unistd::Default(memory_resource_)};
+
+    auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+
+    EXPECT_NE(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+}
+
+TEST_F(BinaryRecorderFactoryFixture, RecordsShallBeWrittenToFileAndDecodable)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The recorder created by the factory shall write a binary log file that is decoded to text lines.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a recorder writing into a temporary directory
+    {
+        BinaryRecorderFactory factory{score::os::Fcntl::Default(memory_resource_),
+                                      score::os::Unistd::Default(memory_resource_)};
+        auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+        ASSERT_EQ(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+
+        // When logging one enabled and one disabled message
+        const auto slot = recorder->StartRecord("CTX1", LogLevel::kError);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), std::uint32_t{42U});
+        recorder->Log(slot.value(), std::string_view{"hello"});
+        recorder->StopRecord(slot.value());
+        EXPECT_FALSE(recorder->StartRecord("CTX1", LogLevel::kVerbose).has_value());
+    }
+
+    // Then the file contains exactly the enabled message
+    const auto file = ReadLogFile();
+    const score::cpp::span<const std::uint8_t> data{file.data(), file.size()};
+    BinaryLogDecoder decoder{};
+    const auto file_header_size = decoder.ReadFileHeader(data);
+    ASSERT_TRUE(file_header_size.has_value());
+    const auto record_size = decoder.DecodeRecord(data.subspan(file_header_size.value()));
+    ASSERT_TRUE(record_size.has_value());
+    EXPECT_EQ(file_header_size.value() + record_size.value(), file.size());
+    EXPECT_THAT(std::string{decoder.GetLine()}, HasSubstr(" 000 ECU1 BINF CTX1 log error verbose 2 42 hello \n"));
+}
+
+TEST_F(BinaryRecorderFactoryFixture, ShallReturnEmptyRecorderIfFileCannotBeCreated)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The factory shall fall back to an EmptyRecorder if the log file cannot be created.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
+    EXPECT_CALL(*fcntl_mock, open(_, _, _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EACCES))));
+    BinaryRecorderFactory factory{std::move(fcntl_mock), score::os::Unistd::Default(memory_resource_)};
+
+    auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+
+    EXPECT_NE(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+}
+
+TEST_F(BinaryRecorderFactoryFixture, ShallCloseFileAndReturnEmptyRecorderIfFileHeaderCannotBeWritten)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The factory shall close the file and fall back to an EmptyRecorder if the file header cannot be "
+                   "written.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    constexpr std::int32_t kFileDescriptor{17};
+    auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
+    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    EXPECT_CALL(*fcntl_mock, open(_, _, _)).WillOnce(Return(kFileDescriptor));
+    EXPECT_CALL(*unistd_mock, write(kFileDescriptor, _, kBinaryLogFileHeaderSize))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOSPC))));
+    EXPECT_CALL(*unistd_mock, close(kFileDescriptor)).WillOnce(Return(score::cpp::expected_blank<score::os::Error>{}));
+    BinaryRecorderFactory factory{std::move(fcntl_mock), std::move(unistd_mock)};
+
+    auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+
+    EXPECT_NE(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
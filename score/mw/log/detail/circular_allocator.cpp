@@ -11,3 +11,43 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/log/detail/circular_allocator.h"
+
+#include <thread>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+/// Shards with fewer slots would be exhausted by a short burst of a single thread, which then needs to search the
+/// shards of the other threads anyway.
+constexpr std::size_t kMinimumSlotsPerShard{4UL};
+
+}  // namespace
+
+std::size_t GetCurrentThreadOrdinal() noexcept
+{
+    static std::atomic<std::size_t> next_thread_ordinal{0UL};
+    thread_local const std::size_t thread_ordinal = next_thread_ordinal.fetch_add(1UL, std::memory_order_relaxed);
+    return thread_ordinal;
+}
+
+std::size_t GetRecommendedNumberOfShards(const std::size_t capacity) noexcept
+{
+    //  hardware_concurrency() returns 0 if the value is not computable:
+    const auto hardware_threads =
+        std::max(std::size_t{1UL}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    return std::max(std::size_t{1UL}, std::min(hardware_threads, capacity / kMinimumSlotsPerShard));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
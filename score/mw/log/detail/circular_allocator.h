@@ -18,8 +18,11 @@
 #include "slot.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -33,12 +36,28 @@ namespace log
 namespace detail
 {
 
+/// \brief Returns a small number that is unique for the calling thread.
+///
+/// \details The numbers are handed out in the order in which threads call this function for the first time. They are
+/// used to spread the threads over the shards of a CircularAllocator.
+std::size_t GetCurrentThreadOrdinal() noexcept;
+
+/// \brief Returns the number of shards that a CircularAllocator of the given capacity should be split into.
+///
+/// \details One shard per hardware thread, as long as every shard keeps at least kMinimumSlotsPerShard slots.
+std::size_t GetRecommendedNumberOfShards(const std::size_t capacity) noexcept;
+
 /// \brief A Ring-Buffer that allows multiple producers to stream data in a lock-free manner
 ///
 /// \details This implementation is right now specific to our first iteration of our logging implementation.
 /// As it can be seen below there is no way for a consumer to acquire data. Further, we need to make this implementation
 /// Shared-Memory ready. But, for our first iteration this is good enough :).
 ///
+/// The slots can be split into shards, i.e. contiguous sub-rings with their own cursor and occupancy counter. Every
+/// thread starts its search in its home shard and only falls back to the other shards if its own one is full. Thus,
+/// threads logging in parallel neither contend on a common sequence counter nor on the cache lines of each others
+/// slots. Slot indices are global over all shards, so that the consumers do not need to know about the sharding.
+///
 /// \tparam T Any type that shall be stored within the Ring-Buffer.
 template <typename T>
 class CircularAllocator final
@@ -47,13 +66,30 @@ class CircularAllocator final
     /// \brief Constructs a Ring-Buffer of capacity, without further acquiring memory during runtime.
     ///
     /// \param capacity The size of how many elements of T shall be stored within the Ring-Buffer
-    explicit CircularAllocator(std::size_t capacity, const T& initial_value = T{})
-        : claimed_sequence_{}, buffer_(capacity)
+    /// \param initial_value The value every slot is initialized with
+    /// \param number_of_shards The number of sub-rings, limited to [1, capacity]. With a single shard the slots are
+    /// handed out strictly round-robin.
+    explicit CircularAllocator(std::size_t capacity,
+                               const T& initial_value = T{},
+                               const std::size_t number_of_shards = 1UL)
+        : buffer_(capacity), shards_(std::max(std::size_t{1UL}, std::min(number_of_shards, capacity)))
     {
         for (auto& slot : buffer_)
         {
             slot.SetData(initial_value);
         }
+
+        //  Distribute the slots as evenly as possible, the first shards take the remainder:
+        const auto slots_per_shard = capacity / shards_.size();
+        const auto remainder = capacity % shards_.size();
+        std::size_t begin{0UL};
+        for (std::size_t shard_index{0UL}; shard_index < shards_.size(); ++shard_index)
+        {
+            auto& shard = shards_.at(shard_index);
+            shard.begin = begin;
+            shard.size = slots_per_shard + ((shard_index < remainder) ? 1UL : 0UL);
+            begin += shard.size;
+        }
     }
 
     /// \brief Starts a Transaction for a producer to stream data into a slot
@@ -63,22 +99,18 @@ class CircularAllocator final
     /// \post Slot is acquired and able to be written
     score::cpp::optional<std::size_t> AcquireSlotToWrite() noexcept
     {
-        const auto max_number_of_loops = buffer_.size();
-        std::uint32_t loop_limiter{0UL};
-        std::size_t slot_index{};
-        do
+        const auto home_shard = (shards_.size() == 1UL) ? 0UL : (GetCurrentThreadOrdinal() % shards_.size());
+        std::size_t shard_index{home_shard};
+        for (std::size_t visited_shards{0UL}; visited_shards < shards_.size(); ++visited_shards)
         {
-            loop_limiter++;
-            slot_index = claimed_sequence_.fetch_add(1UL);
-            slot_index %= buffer_.capacity();
-
-            if (loop_limiter > max_number_of_loops)
+            const auto slot_index = TryAcquireSlotInShard(shards_.at(shard_index));
+            if (slot_index.has_value())
             {
-                return {};
+                return slot_index;
             }
-        } while (!buffer_.at(slot_index).TryUse());
-
-        return slot_index;
+            shard_index = (shard_index + 1UL == shards_.size()) ? 0UL : (shard_index + 1UL);
+        }
+        return {};
     }
 
     /// \brief Get a buffer for a specific slot to write data into it
@@ -99,26 +131,86 @@ class CircularAllocator final
     /// \post Slot is marked as finished and could be overwritten by another call to AcquireSlotToWrite()
     void ReleaseSlot(std::size_t slot) noexcept
     {
+        //  Decrement before the slot becomes free, so that the counter never exceeds the number of used slots.
+        //  Otherwise a producer could skip a shard that already has a free slot again.
+        std::ignore = FindShardOf(slot).used.fetch_sub(1UL, std::memory_order_relaxed);
         buffer_.at(slot).Release();
     }
 
     /// \brief Returns number of used elements
     ///
+    /// \details Only sums up the occupancy counters of the shards instead of inspecting every slot.
+    ///
     /// \return The number of used elements
     std::size_t GetUsedCount() noexcept
     {
-        // Static cast is allowed as count_if should not return negative value:
-        return static_cast<std::size_t>(std::count_if(buffer_.begin(), buffer_.end(), [](auto&& i) {
-            return i.IsUsed();
-        }));
+        std::size_t used_count{0UL};
+        for (const auto& shard : shards_)
+        {
+            used_count += shard.used.load(std::memory_order_relaxed);
+        }
+        return used_count;
+    }
+
+    /// \brief Returns the number of shards the slots are split into.
+    std::size_t GetNumberOfShards() const noexcept
+    {
+        return shards_.size();
     }
 
   private:
-    std::atomic<std::size_t> claimed_sequence_;
+    /// \brief A contiguous range of slots with its own cursor and occupancy counter.
+    ///
+    /// \details Every shard starts on its own cache line, since the cursor and the counter of one shard are updated by
+    /// other threads than the ones of its neighbours.
+    struct alignas(kCacheLineSize) Shard
+    {
+        std::size_t begin{0UL};
+        std::size_t size{0UL};
+        //  Position in the shard where the next search starts. It is only a hint, concurrent producers may store
+        //  stale values, which is harmless as the slot flags decide about the ownership.
+        std::atomic<std::size_t> next{0UL};
+        //  Lower bound of the used slots in the shard, which is incremented only after a slot was taken and
+        //  decremented before it is released:
+        std::atomic<std::size_t> used{0UL};
+    };
+
+    score::cpp::optional<std::size_t> TryAcquireSlotInShard(Shard& shard) noexcept
+    {
+        if (shard.used.load(std::memory_order_relaxed) >= shard.size)
+        {
+            return {};
+        }
+
+        std::size_t position = shard.next.load(std::memory_order_relaxed);
+        for (std::size_t visited_slots{0UL}; visited_slots < shard.size; ++visited_slots)
+        {
+            const auto next_position = (position + 1UL == shard.size) ? 0UL : (position + 1UL);
+            if (buffer_.at(shard.begin + position).TryUse())
+            {
+                shard.next.store(next_position, std::memory_order_relaxed);
+                std::ignore = shard.used.fetch_add(1UL, std::memory_order_relaxed);
+                return shard.begin + position;
+            }
+            position = next_position;
+        }
+        return {};
+    }
+
+    Shard& FindShardOf(const std::size_t slot) noexcept
+    {
+        //  The shards are sorted by their first slot, the number of shards is in the order of the number of cores:
+        auto shard = std::find_if(shards_.begin(), shards_.end(), [slot](const Shard& candidate) noexcept {
+            return slot < candidate.begin + candidate.size;
+        });
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(shard != shards_.end());
+        return *shard;
+    }
 
     // For the beginning this is still an std::vector with standard allocator. Once we refactor the IPC to DataRouter,
     // this data type will be directly placed in SharedMemory and a custom allocator will be added.
     std::vector<Slot<T>> buffer_;
+    std::vector<Shard> shards_;
 };
 
 }  // namespace detail
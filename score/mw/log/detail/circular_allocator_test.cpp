@@ -206,6 +206,127 @@ TEST_F(CircularAllocatorFixture, TryAcquireWhenAllSlotsAcquired)
     EXPECT_FALSE(slot.has_value());
 }
 
+TEST_F(CircularAllocatorFixture, NumberOfShardsIsLimitedByCapacity)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The number of shards shall be at least one and at most the capacity.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    EXPECT_EQ(CircularAllocator<std::int32_t>(2U, 0, 4U).GetNumberOfShards(), 2U);
+    EXPECT_EQ(CircularAllocator<std::int32_t>(5U, 0, 0U).GetNumberOfShards(), 1U);
+    EXPECT_EQ(CircularAllocator<std::int32_t>(8U, 0, 4U).GetNumberOfShards(), 4U);
+}
+
+TEST_F(CircularAllocatorFixture, SingleThreadAcquiresSlotsOfAllShards)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If the shard of a thread is full, the slots of the other shards shall be used before acquiring "
+                   "fails.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    // Given a Ring-Buffer that is split into shards of unequal size
+    constexpr std::size_t kNumberOfSlots{11U};
+    CircularAllocator<std::int32_t> unit{kNumberOfSlots, 0, 4U};
+
+    // When a single thread acquires all slots
+    std::array<bool, kNumberOfSlots> acquired{};
+    for (std::size_t counter{}; counter < kNumberOfSlots; counter++)
+    {
+        const auto slot = unit.AcquireSlotToWrite();
+        ASSERT_TRUE(slot.has_value());
+        ASSERT_LT(slot.value(), kNumberOfSlots);
+        EXPECT_FALSE(acquired.at(slot.value()));
+        acquired.at(slot.value()) = true;
+    }
+
+    // Then every slot was handed out once and no further slot is available
+    EXPECT_EQ(unit.GetUsedCount(), kNumberOfSlots);
+    EXPECT_FALSE(unit.AcquireSlotToWrite().has_value());
+
+    // And a released slot can be acquired again, independent of its shard
+    unit.ReleaseSlot(7U);
+    EXPECT_EQ(unit.GetUsedCount(), kNumberOfSlots - 1U);
+    EXPECT_EQ(unit.AcquireSlotToWrite(), score::cpp::optional<std::size_t>{7U});
+}
+
+TEST_F(CircularAllocatorFixture, UsedCountFollowsAcquireAndRelease)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The used count shall reflect the acquired and not yet released slots.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    CircularAllocator<std::int32_t> unit{4U, 0, 2U};
+    EXPECT_EQ(unit.GetUsedCount(), 0U);
+
+    const auto first = unit.AcquireSlotToWrite();
+    const auto second = unit.AcquireSlotToWrite();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(unit.GetUsedCount(), 2U);
+
+    unit.ReleaseSlot(first.value());
+    EXPECT_EQ(unit.GetUsedCount(), 1U);
+    unit.ReleaseSlot(second.value());
+    EXPECT_EQ(unit.GetUsedCount(), 0U);
+}
+
+TEST_F(CircularAllocatorFixture, WritingFromMultipleThreadsIsSafeWithInsufficientCapacityOfShards)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "When writing to a sharded CircularAllocator with multiple threads in parallel and trying to "
+                   "allocate more slots than capacity, the number of reserved slots shall be equal to the capacity.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    // Given a Ring-Buffer with less shards than threads
+    constexpr std::size_t kNumberOfSlots{100};
+    CircularAllocator<std::int32_t> unit{kNumberOfSlots, 0, 4U};
+
+    // When trying to write into it from multiple threads such that the number of slots is insufficient.
+    std::array<std::thread, 10> threads{};
+    std::array<std::size_t, 10> number_of_reserved_slots_per_thread{};
+    for (std::size_t counter{}; counter < threads.size(); counter++)
+    {
+        threads.at(counter) = std::thread([&unit, counter, &number_of_reserved_slots_per_thread]() noexcept {
+            for (std::size_t number{}; number < 50; number++)
+            {
+                if (unit.AcquireSlotToWrite().has_value())
+                {
+                    number_of_reserved_slots_per_thread[counter]++;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then the number of reserved slots shall be equal to the capacity.
+    const std::size_t number_of_reserved_slots =
+        std::accumulate(number_of_reserved_slots_per_thread.begin(), number_of_reserved_slots_per_thread.end(), 0U);
+    EXPECT_EQ(number_of_reserved_slots, kNumberOfSlots);
+    EXPECT_EQ(unit.GetUsedCount(), kNumberOfSlots);
+}
+
+TEST_F(CircularAllocatorFixture, RecommendedNumberOfShardsKeepsShardsLargeEnough)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The recommended number of shards shall not create tiny shards.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    EXPECT_EQ(GetRecommendedNumberOfShards(0U), 1U);
+    EXPECT_EQ(GetRecommendedNumberOfShards(7U), 1U);
+    EXPECT_LE(GetRecommendedNumberOfShards(64U), 16U);
+    EXPECT_GE(GetRecommendedNumberOfShards(64U), 1U);
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
@@ -252,6 +252,33 @@ bool CompositeRecorder::IsLogEnabled(const LogLevel& log_level, const std::strin
     return is_log_enabled;
 }
 
+score::cpp::optional<LogLevel> CompositeRecorder::GetLogLevelThreshold(const std::string_view context) const noexcept
+{
+    // The most verbose threshold of all recorders, if every recorder has a fixed one.
+
+    if (recorders_.empty())
+    {
+        return {};
+    }
+    score::cpp::optional<LogLevel> composite_threshold{LogLevel::kOff};
+
+    ForEachRecorder(
+        recorders_,
+        [&composite_threshold, context](const auto& recorder, const SlotHandle::RecorderIdentifier) noexcept {
+            const auto threshold = recorder.GetLogLevelThreshold(context);
+            if ((!threshold.has_value()) || (!composite_threshold.has_value()))
+            {
+                composite_threshold.reset();
+            }
+            else if (threshold.value() > composite_threshold.value())
+            {
+                composite_threshold = threshold;
+            }
+        });
+
+    return composite_threshold;
+}
+
 }  // namespace detail
 }  // namespace log
 }  // namespace mw
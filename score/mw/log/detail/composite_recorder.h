@@ -69,6 +69,8 @@ class CompositeRecorder final : public Recorder
 
     bool IsLogEnabled(const LogLevel& log_level, const std::string_view context) const noexcept override;
 
+    score::cpp::optional<LogLevel> GetLogLevelThreshold(const std::string_view context) const noexcept override;
+
   private:
     std::vector<std::unique_ptr<Recorder>> recorders_;
 };
@@ -19,6 +19,7 @@
 
 #include "score/callback.hpp"
 
+#include <array>
 #include <cstring>
 #include <limits>
 
@@ -69,6 +70,15 @@ const LogBin64 kBin64{kUint64 - 2};
 LogRawBuffer gLogRawBuffer{nullptr, 0};
 LogSlog2Message gLogSlog2Message{1, "Hello World"};
 
+class ThresholdRecorderMock : public RecorderMock
+{
+  public:
+    MOCK_METHOD(score::cpp::optional<LogLevel>,
+                GetLogLevelThreshold,
+                (const std::string_view context),
+                (const, noexcept, override));
+};
+
 MATCHER_P(LogStringEquals, expected, "matches LogString objects")
 {
     return (arg.Size() == expected.Size()) && (std::memcmp(arg.Data(), expected.Data(), arg.Size()) == 0);
@@ -343,6 +353,59 @@ TEST_F(CompositeRecorderFixture, LogShallBeDisabledIfAllRecorderAreDisabled)
     EXPECT_FALSE(composite_recorder.IsLogEnabled(kLogLevel, kContext));
 }
 
+TEST_F(CompositeRecorderFixture, LogLevelThresholdShallBeTheMostVerboseThresholdOfAllRecorders)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The threshold of the composite recorder shall let pass every log level enabled by any recorder.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    // Given recorders with different thresholds, the most verbose one being debug
+    const std::array<LogLevel, 3U> thresholds{LogLevel::kError, LogLevel::kDebug, LogLevel::kInfo};
+    CreateAllAvailableRecorders([&thresholds](std::size_t recorder) {
+        auto mock_recorder = std::make_unique<ThresholdRecorderMock>();
+        EXPECT_CALL(*mock_recorder, GetLogLevelThreshold(kContext))
+            .WillRepeatedly(Return(thresholds.at(recorder % thresholds.size())));
+        return mock_recorder;
+    });
+
+    // When asking the composite recorder for the threshold
+    auto& composite_recorder = CreateCompositeRecorder();
+    const auto threshold = composite_recorder.GetLogLevelThreshold(kContext);
+
+    // Then the most verbose threshold is returned
+    ASSERT_TRUE(threshold.has_value());
+    EXPECT_EQ(threshold.value(), LogLevel::kDebug);
+}
+
+TEST_F(CompositeRecorderFixture, LogLevelThresholdShallBeEmptyIfOneRecorderHasNoThreshold)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The composite recorder shall not provide a threshold if one of its recorders does not provide "
+                   "one.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    // Given one recorder without threshold among recorders with threshold
+    CreateAllAvailableRecorders([](std::size_t recorder) -> std::unique_ptr<Recorder> {
+        if (recorder == 0U)
+        {
+            return std::make_unique<RecorderMock>();
+        }
+        auto mock_recorder = std::make_unique<ThresholdRecorderMock>();
+        EXPECT_CALL(*mock_recorder, GetLogLevelThreshold(kContext)).WillRepeatedly(Return(LogLevel::kWarn));
+        return mock_recorder;
+    });
+
+    // When asking the composite recorder for the threshold
+    auto& composite_recorder = CreateCompositeRecorder();
+
+    // Then no threshold is returned
+    EXPECT_FALSE(composite_recorder.GetLogLevelThreshold(kContext).has_value());
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
@@ -76,6 +76,9 @@ std::string_view score::mw::log::detail::ErrorDomain::MessageFor(const score::re
         case Error::kFailedToCreateMessagePassingClient:
             error_msg = "Failed to create message passing client.";
             break;
+        case Error::kSharedMemoryCreationFailed:
+            error_msg = "Failed to create the shared memory for log messages.";
+            break;
         case Error::kUnknownError:
             error_msg = "Unknown Error";
             break;
@@ -45,6 +45,7 @@ enum class Error : score::result::ErrorCode
     kBlockingTerminationSignalFailed,
     kMemoryResourceError,
     kFailedToCreateMessagePassingClient,
+    kSharedMemoryCreationFailed,
 };
 
 class ErrorDomain final : public score::result::ErrorDomain
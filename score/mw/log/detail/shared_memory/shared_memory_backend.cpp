@@ -0,0 +1,86 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_backend.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_message_builder.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+SharedMemoryBackend::SharedMemoryBackend(std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                                         SharedMemoryRing ring,
+                                         std::unique_ptr<SharedMemorySegment> segment) noexcept
+    : Backend(), buffer_allocator_{std::move(allocator)}, segment_{std::move(segment)}, ring_{ring}
+{
+}
+
+score::cpp::optional<SlotHandle> SharedMemoryBackend::ReserveSlot() noexcept
+{
+    const auto slot = buffer_allocator_->AcquireSlotToWrite();
+    if (slot.has_value())
+    {
+        // CircularAllocator has capacity limited by CheckFoxMaxCapacity thus the cast is valid:
+        // coverity[autosar_cpp14_a4_7_1_violation]
+        return SlotHandle{static_cast<SlotIndex>(slot.value())};
+    }
+    return {};
+}
+
+void SharedMemoryBackend::FlushSlot(const SlotHandle& slot) noexcept
+{
+    const auto slot_index = static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder());
+    const auto shared_slot = ring_.AcquireSlot();
+    if (shared_slot.has_value())
+    {
+        //  A builder per call, as the backend is flushed by several threads in parallel:
+        BinaryMessageBuilder message_builder{};
+        message_builder.SetNextMessage(buffer_allocator_->GetUnderlyingBufferFor(slot_index));
+
+        const auto destination = ring_.GetSlotData(shared_slot.value());
+        const auto capacity = static_cast<std::size_t>(destination.size());
+        std::size_t size{0UL};
+        for (auto span = message_builder.GetNextSpan(); span.has_value(); span = message_builder.GetNextSpan())
+        {
+            //  The ring slot holds a record header and a full local slot, thus nothing is cut off here:
+            const auto length = std::min(static_cast<std::size_t>(span.value().size()), capacity - size);
+            if (length > 0UL)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) size is within the slot
+                std::ignore = std::memcpy(destination.data() + size, span.value().data(), length);
+            }
+            size += length;
+        }
+        ring_.CommitSlot(shared_slot.value(), size);
+    }
+    buffer_allocator_->ReleaseSlot(slot_index);
+}
+
+LogRecord& SharedMemoryBackend::GetLogRecord(const SlotHandle& slot) noexcept
+{
+    //  Cast to bigger integer type:
+    return buffer_allocator_->GetUnderlyingBufferFor(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,63 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_BACKEND_H
+#define SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_BACKEND_H
+
+#include "score/mw/log/detail/backend.h"
+#include "score/mw/log/detail/circular_allocator.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+
+#include <memory>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Backend that hands complete binary log records over to a drainer process through a SharedMemoryRing.
+///
+/// \details The producer only fills a local slot and copies the record into the shared ring on flush. Formatting and
+/// writing the records is left to the drainer, thus the producer never waits for a file or terminal. A record is
+/// dropped if the shared ring is full.
+class SharedMemoryBackend final : public Backend
+{
+  public:
+    /// \param segment Optional owner of the memory of the ring, kept mapped as long as the backend exists.
+    SharedMemoryBackend(std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                        SharedMemoryRing ring,
+                        std::unique_ptr<SharedMemorySegment> segment) noexcept;
+
+    score::cpp::optional<SlotHandle> ReserveSlot() noexcept override;
+
+    /// \brief Copies the record of the slot into the shared ring and releases the slot.
+    void FlushSlot(const SlotHandle& slot) noexcept override;
+
+    LogRecord& GetLogRecord(const SlotHandle& slot) noexcept override;
+
+  private:
+    std::unique_ptr<CircularAllocator<LogRecord>> buffer_allocator_;
+    std::unique_ptr<SharedMemorySegment> segment_;
+    SharedMemoryRing ring_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_BACKEND_H
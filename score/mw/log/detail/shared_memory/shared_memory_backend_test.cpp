@@ -0,0 +1,148 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_backend.h"
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using ::testing::HasSubstr;
+
+constexpr std::size_t kLocalSlotSize{64UL};
+constexpr std::size_t kRingSlotSize{kBinaryLogRecordHeaderSize + kLocalSlotSize};
+
+class SharedMemoryBackendFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        config_.SetEcuId("ECU1");
+        config_.SetAppId("SHMB");
+        config_.SetDefaultLogLevel(LogLevel::kInfo);
+    }
+
+    std::unique_ptr<BinaryRecorder> CreateRecorder(const std::size_t number_of_local_slots,
+                                                   const std::size_t number_of_ring_slots)
+    {
+        ring_ = SharedMemoryRing::Create({memory_.data(), memory_.size()},
+                                         number_of_ring_slots,
+                                         kRingSlotSize,
+                                         ::getpid(),
+                                         SerializeFileHeader(LoggingIdentifier{"ECU1"}));
+        auto allocator = std::make_unique<CircularAllocator<LogRecord>>(
+            number_of_local_slots, LogRecord{kLocalSlotSize}, std::size_t{1UL});
+        return std::make_unique<BinaryRecorder>(
+            config_, std::make_unique<SharedMemoryBackend>(std::move(allocator), ring_.value(), nullptr));
+    }
+
+    std::vector<std::string> DecodeCommittedRecords() const
+    {
+        std::vector<SharedMemoryCommittedSlot> committed{};
+        ring_.value().CollectCommittedSlots(committed);
+        BinaryLogDecoder decoder{};
+        EXPECT_TRUE(decoder.ReadFileHeader(ring_.value().GetFileHeader()).has_value());
+        std::vector<std::string> lines{};
+        for (const auto& committed_slot : committed)
+        {
+            EXPECT_TRUE(decoder.DecodeRecord(ring_.value().GetCommittedData(committed_slot.slot)).has_value());
+            lines.emplace_back(decoder.GetLine());
+        }
+        return lines;
+    }
+
+  protected:
+    Configuration config_{};
+    score::cpp::optional<SharedMemoryRing> ring_{};
+    alignas(64) std::array<std::uint8_t, 4096UL> memory_{};
+};
+
+TEST_F(SharedMemoryBackendFixture, FlushShallCopyTheRecordIntoTheRingAndReleaseTheLocalSlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A flushed record shall be committed to the shared ring, its local slot shall be free again.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a recorder with a single local slot
+    auto recorder = CreateRecorder(1UL, 4UL);
+
+    // When three messages are logged one after the other
+    for (std::uint32_t index{0U}; index < 3U; ++index)
+    {
+        const auto slot = recorder->StartRecord("CTX1", LogLevel::kWarn);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), index);
+        recorder->StopRecord(slot.value());
+    }
+
+    // Then all of them are committed in order
+    const auto lines = DecodeCommittedRecords();
+    ASSERT_EQ(lines.size(), 3UL);
+    EXPECT_THAT(lines.at(0UL), HasSubstr(" ECU1 SHMB CTX1 log warn verbose 1 0 \n"));
+    EXPECT_THAT(lines.at(1UL), HasSubstr(" ECU1 SHMB CTX1 log warn verbose 1 1 \n"));
+    EXPECT_THAT(lines.at(2UL), HasSubstr(" ECU1 SHMB CTX1 log warn verbose 1 2 \n"));
+}
+
+TEST_F(SharedMemoryBackendFixture, FullRingShallDropTheRecordButReleaseTheLocalSlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If the shared ring is full, the record shall be dropped and counted, the producer shall not "
+                   "block.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    // Given a ring with two slots that are not drained
+    auto recorder = CreateRecorder(1UL, 2UL);
+
+    // When four messages are logged
+    for (std::uint32_t index{0U}; index < 4U; ++index)
+    {
+        const auto slot = recorder->StartRecord("CTX1", LogLevel::kError);
+        ASSERT_TRUE(slot.has_value());
+        recorder->Log(slot.value(), index);
+        recorder->StopRecord(slot.value());
+    }
+
+    // Then the first two are kept and the others are counted as dropped
+    const auto lines = DecodeCommittedRecords();
+    ASSERT_EQ(lines.size(), 2UL);
+    EXPECT_THAT(lines.at(0UL), HasSubstr(" verbose 1 0 \n"));
+    EXPECT_THAT(lines.at(1UL), HasSubstr(" verbose 1 1 \n"));
+    EXPECT_EQ(ring_.value().GetNumberOfDroppedMessages(), 2U);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,126 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_drainer.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+SharedMemoryDrainer::SharedMemoryDrainer(SharedMemoryRing ring,
+                                         const std::int32_t output_file_descriptor,
+                                         score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                                         std::unique_ptr<score::os::Signal> signal)
+    : ring_{ring},
+      output_file_descriptor_{output_file_descriptor},
+      unistd_{std::move(unistd)},
+      signal_{std::move(signal)},
+      decoder_{},
+      committed_slots_{},
+      written_records_{0U},
+      lost_records_{0U},
+      torn_records_{0U}
+{
+    //  The header was serialized by the producer on the same machine, and SharedMemoryRing::Attach() already checked
+    //  the layout of the ring. A broken header only shows up as records that can not be decoded:
+    std::ignore = decoder_.ReadFileHeader(ring_.GetFileHeader());
+    committed_slots_.reserve(ring_.GetNumberOfSlots());
+}
+
+std::size_t SharedMemoryDrainer::Drain()
+{
+    return Drain(false);
+}
+
+std::size_t SharedMemoryDrainer::Drain(const bool skip_gaps)
+{
+    committed_slots_.clear();
+    ring_.CollectCommittedSlots(committed_slots_);
+    std::size_t released_slots{0UL};
+    for (const auto& committed_slot : committed_slots_)
+    {
+        if ((!skip_gaps) && (committed_slot.sequence != ring_.GetNextSequenceToDrain()))
+        {
+            break;
+        }
+
+        const auto decoded = decoder_.DecodeRecord(ring_.GetCommittedData(committed_slot.slot));
+        if (decoded.has_value() && Write(decoder_.GetLine()))
+        {
+            ++written_records_;
+        }
+        else
+        {
+            ++lost_records_;
+        }
+        ring_.ReleaseSlot(committed_slot.slot);
+        ring_.SetNextSequenceToDrain(committed_slot.sequence + 1U);
+        ++released_slots;
+    }
+    return released_slots;
+}
+
+bool SharedMemoryDrainer::IsProducerAlive() const noexcept
+{
+    //  Signal 0 only checks whether the process exists:
+    const auto result = signal_->Kill(ring_.GetProducerPid(), 0);
+    return result.has_value() || (result.error() != score::os::Error::Code::kNoSuchProcess);
+}
+
+void SharedMemoryDrainer::Finish()
+{
+    std::ignore = Drain(false);
+    torn_records_ += static_cast<std::uint64_t>(ring_.ReclaimAbandonedSlots());
+    //  The records behind a torn one are complete, only their predecessor will never be committed:
+    std::ignore = Drain(true);
+}
+
+bool SharedMemoryDrainer::Write(const std::string_view line) noexcept
+{
+    std::size_t offset{0UL};
+    while (offset < line.size())
+    {
+        const auto written =
+            unistd_->write(output_file_descriptor_, line.substr(offset).data(), line.size() - offset);
+        if ((!written.has_value()) || (written.value() <= 0))
+        {
+            return false;
+        }
+        offset += static_cast<std::size_t>(written.value());
+    }
+    return true;
+}
+
+std::uint64_t SharedMemoryDrainer::GetNumberOfWrittenRecords() const noexcept
+{
+    return written_records_;
+}
+
+std::uint64_t SharedMemoryDrainer::GetNumberOfLostRecords() const noexcept
+{
+    return lost_records_;
+}
+
+std::uint64_t SharedMemoryDrainer::GetNumberOfTornRecords() const noexcept
+{
+    return torn_records_;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_DRAINER_H
+#define SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_DRAINER_H
+
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+
+#include "score/os/unistd.h"
+#include "score/os/utils/signal.h"
+
+#include <score/memory.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Reader side of a SharedMemoryRing, running in a separate process.
+///
+/// \details Renders the committed records in the layout of the text recorder (see BinaryLogDecoder) and writes them
+/// into the output file descriptor. The drainer owns the formatting and the output, thus a producer that crashes can
+/// only lose the record it was writing.
+///
+/// Records are written strictly in the order of their sequence numbers. At a gap the drainer stops and waits for the
+/// missing record to be committed, only Finish() skips the gaps that a terminated producer left behind.
+class SharedMemoryDrainer final
+{
+  public:
+    SharedMemoryDrainer(SharedMemoryRing ring,
+                        const std::int32_t output_file_descriptor,
+                        score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
+                        std::unique_ptr<score::os::Signal> signal);
+
+    /// \brief Writes and releases the records that are committed right now, up to the first gap in their sequence.
+    ///
+    /// \return The number of released slots.
+    std::size_t Drain();
+
+    /// \brief Returns false once the producer process terminated.
+    bool IsProducerAlive() const noexcept;
+
+    /// \brief Drains the remaining records of a terminated producer and reclaims the slots it left behind.
+    ///
+    /// \pre IsProducerAlive() returned false.
+    void Finish();
+
+    /// \brief Number of records that were written into the output.
+    std::uint64_t GetNumberOfWrittenRecords() const noexcept;
+
+    /// \brief Number of records that were committed but could not be decoded or written.
+    std::uint64_t GetNumberOfLostRecords() const noexcept;
+
+    /// \brief Number of slots that a terminated producer acquired but never committed.
+    std::uint64_t GetNumberOfTornRecords() const noexcept;
+
+  private:
+    std::size_t Drain(const bool skip_gaps);
+    bool Write(const std::string_view line) noexcept;
+
+    SharedMemoryRing ring_;
+    std::int32_t output_file_descriptor_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+    std::unique_ptr<score::os::Signal> signal_;
+    BinaryLogDecoder decoder_;
+    std::vector<SharedMemoryCommittedSlot> committed_slots_;
+    std::uint64_t written_records_;
+    std::uint64_t lost_records_;
+    std::uint64_t torn_records_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_DRAINER_H
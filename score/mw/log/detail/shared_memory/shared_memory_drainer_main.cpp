@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Drainer process of the shared memory log mode.
+///
+/// Usage: shared_memory_log_drainer <app id> [output file]
+///
+/// Waits until the application created its shared memory object "/mw_log_<app id>" and writes its log messages in the
+/// layout of the console output to the output file, or stdout. Once the application terminated, the remaining messages
+/// are written, the shared memory object is removed unless a restarted application replaced it already, and the number
+/// of lost messages is reported on stderr.
+
+#include "score/mw/log/detail/shared_memory/shared_memory_drainer.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_recorder_factory.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+#include "score/os/utils/signal_impl.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+constexpr std::chrono::milliseconds kPollingInterval{1};
+constexpr std::chrono::milliseconds kOpenRetryInterval{10};
+
+score::mw::log::detail::SharedMemorySegment OpenWhenCreated(const std::string& name,
+                                                            score::cpp::pmr::memory_resource* const memory_resource,
+                                                            const score::os::Unistd& unistd,
+                                                            const score::os::Stat& stat)
+{
+    while (true)
+    {
+        auto segment = score::mw::log::detail::SharedMemorySegment::Open(
+            name, score::os::Mman::Default(memory_resource), unistd, stat);
+        if (segment.has_value())
+        {
+            return std::move(segment).value();
+        }
+        std::this_thread::sleep_for(kOpenRetryInterval);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    if ((argc != 2) && (argc != 3))
+    {
+        std::cerr << "Usage: " << argv[0] << " <app id> [output file]\n";
+        return 2;
+    }
+
+    auto* const memory_resource = score::cpp::pmr::get_default_resource();
+    const auto unistd = score::os::Unistd::Default();
+
+    std::int32_t output{STDOUT_FILENO};
+    if (argc == 3)
+    {
+        const auto file = score::os::Fcntl::Default()->open(
+            argv[2],
+            score::os::Fcntl::Open::kWriteOnly | score::os::Fcntl::Open::kCreate | score::os::Fcntl::Open::kTruncate,
+            score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser | score::os::Stat::Mode::kReadGroup);
+        if (!file.has_value())
+        {
+            std::cerr << argv[2] << ": cannot open file\n";
+            return 1;
+        }
+        output = file.value();
+    }
+
+    const auto name = score::mw::log::detail::SharedMemoryRecorderFactory::GetSharedMemoryName(argv[1]);
+    const auto stat = score::os::Stat::Default();
+    const auto segment = OpenWhenCreated(name, memory_resource, *unistd, *stat);
+
+    //  The producer may still initialize the ring after it created the object:
+    auto ring = score::mw::log::detail::SharedMemoryRing::Attach(segment.GetMemory());
+    while ((!ring.has_value()) && (ring.error() == score::mw::log::detail::SharedMemoryRingError::kNotInitialized))
+    {
+        std::this_thread::sleep_for(kOpenRetryInterval);
+        ring = score::mw::log::detail::SharedMemoryRing::Attach(segment.GetMemory());
+    }
+    if (!ring.has_value())
+    {
+        std::cerr << name << ": " << score::mw::log::detail::ToString(ring.error()) << '\n';
+        return 1;
+    }
+
+    score::mw::log::detail::SharedMemoryDrainer drainer{ring.value(),
+                                                        output,
+                                                        score::os::Unistd::Default(memory_resource),
+                                                        std::make_unique<score::os::SignalImpl>()};
+    while (drainer.IsProducerAlive())
+    {
+        if (drainer.Drain() == 0UL)
+        {
+            std::this_thread::sleep_for(kPollingInterval);
+        }
+    }
+    drainer.Finish();
+    //  A restarted producer may already have replaced the object, whose name must then stay for its drainer:
+    std::ignore = segment.UnlinkIfUnchanged(*unistd, *stat);
+
+    std::cerr << name << ": " << drainer.GetNumberOfWrittenRecords() << " written, "
+              << ring.value().GetNumberOfDroppedMessages() << " dropped, " << drainer.GetNumberOfLostRecords()
+              << " lost, " << drainer.GetNumberOfTornRecords() << " torn\n";
+    return 0;
+}
@@ -0,0 +1,432 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_drainer.h"
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_backend.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+
+#include "score/os/utils/signal_impl.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <csignal>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfRingSlots{8UL};
+constexpr std::size_t kLocalSlotSize{64UL};
+constexpr std::size_t kRingSlotSize{kBinaryLogRecordHeaderSize + kLocalSlotSize};
+
+enum class ProducerEnd : std::uint8_t
+{
+    kExitAfterCommit,
+    kExitWhileWriting,
+    kKilledWhileWriting,
+};
+
+/// Logs the given number of messages, each with its index as argument, through a SharedMemoryBackend.
+void LogIndexedMessages(SharedMemoryRing ring, const std::uint32_t number_of_messages)
+{
+    Configuration config{};
+    config.SetEcuId("ECU1");
+    config.SetAppId("SHMD");
+    config.SetDefaultLogLevel(LogLevel::kInfo);
+    auto allocator =
+        std::make_unique<CircularAllocator<LogRecord>>(2UL, LogRecord{kLocalSlotSize}, std::size_t{1UL});
+    BinaryRecorder recorder{config, std::make_unique<SharedMemoryBackend>(std::move(allocator), ring, nullptr)};
+    for (std::uint32_t index{0U}; index < number_of_messages; ++index)
+    {
+        const auto slot = recorder.StartRecord("CTX1", LogLevel::kError);
+        if (slot.has_value())
+        {
+            recorder.Log(slot.value(), index);
+            recorder.StopRecord(slot.value());
+        }
+    }
+}
+
+class SharedMemoryDrainerFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        //  The process id keeps parallel test runs apart, as shared memory objects are visible system wide:
+        name_ = "/mw_log_drainer_test_" + std::to_string(::getpid());
+        auto segment = SharedMemorySegment::Create(name_,
+                                                   SharedMemoryRing::GetRequiredSize(kNumberOfRingSlots, kRingSlotSize),
+                                                   score::os::Mman::Default(memory_resource_),
+                                                   *unistd_);
+        ASSERT_TRUE(segment.has_value());
+        segment_ = std::make_unique<SharedMemorySegment>(std::move(segment).value());
+        ASSERT_EQ(::pipe(output_.data()), 0);
+    }
+
+    void TearDown() override
+    {
+        std::ignore = segment_->Unlink();
+        std::ignore = ::close(output_.at(0UL));
+        std::ignore = ::close(output_.at(1UL));
+    }
+
+    SharedMemoryRing CreateRing(const pid_t producer_pid)
+    {
+        return SharedMemoryRing::Create(segment_->GetMemory(),
+                                        kNumberOfRingSlots,
+                                        kRingSlotSize,
+                                        producer_pid,
+                                        SerializeFileHeader(LoggingIdentifier{"ECU1"}));
+    }
+
+    SharedMemoryDrainer CreateDrainer(const std::int32_t output_file_descriptor)
+    {
+        const auto ring = SharedMemoryRing::Attach(segment_->GetMemory());
+        EXPECT_TRUE(ring.has_value());
+        return SharedMemoryDrainer{ring.value(),
+                                   output_file_descriptor,
+                                   score::os::Unistd::Default(memory_resource_),
+                                   std::make_unique<score::os::SignalImpl>()};
+    }
+
+    /// Reads the lines written into the pipe so far.
+    std::vector<std::string> ReadLines()
+    {
+        std::ignore = ::close(output_.at(1UL));
+        output_.at(1UL) = -1;
+        std::string output{};
+        std::array<char, 4096UL> buffer{};
+        for (auto length = ::read(output_.at(0UL), buffer.data(), buffer.size()); length > 0;
+             length = ::read(output_.at(0UL), buffer.data(), buffer.size()))
+        {
+            output.append(buffer.data(), static_cast<std::size_t>(length));
+        }
+
+        std::vector<std::string> lines{};
+        for (auto end = output.find('\n'); end != std::string::npos; end = output.find('\n'))
+        {
+            lines.push_back(output.substr(0UL, end + 1UL));
+            output.erase(0UL, end + 1UL);
+        }
+        return lines;
+    }
+
+    /// Forks a producer that logs the given number of messages and ends as requested.
+    pid_t ForkProducer(const std::uint32_t number_of_messages, const ProducerEnd end)
+    {
+        std::array<std::int32_t, 2UL> ready{};
+        EXPECT_EQ(::pipe(ready.data()), 0);
+        const auto pid = ::fork();
+        if (pid == 0)
+        {
+            //  Only async-signal-safe exits in the child, it must not run the tests of the parent:
+            auto ring = CreateRing(::getpid());
+            std::ignore = ::write(ready.at(1UL), "r", 1UL);
+            LogIndexedMessages(ring, number_of_messages);
+            if (end != ProducerEnd::kExitAfterCommit)
+            {
+                const auto torn_slot = ring.AcquireSlot();
+                if (torn_slot.has_value())
+                {
+                    const auto data = ring.GetSlotData(torn_slot.value());
+                    std::ignore = std::memset(data.data(), 0xAB, static_cast<std::size_t>(data.size()) / 2UL);
+                }
+            }
+            if (end == ProducerEnd::kKilledWhileWriting)
+            {
+                std::ignore = ::raise(SIGKILL);
+            }
+            ::_exit(0);
+        }
+
+        char ready_byte{};
+        EXPECT_EQ(::read(ready.at(0UL), &ready_byte, 1UL), 1);
+        std::ignore = ::close(ready.at(0UL));
+        std::ignore = ::close(ready.at(1UL));
+        return pid;
+    }
+
+  protected:
+    score::cpp::pmr::memory_resource* memory_resource_{score::cpp::pmr::get_default_resource()};
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_{score::os::Unistd::Default(memory_resource_)};
+    score::cpp::pmr::unique_ptr<score::os::Stat> stat_{score::os::Stat::Default(memory_resource_)};
+    std::string name_{};
+    std::unique_ptr<SharedMemorySegment> segment_{};
+    std::array<std::int32_t, 2UL> output_{-1, -1};
+};
+
+TEST_F(SharedMemoryDrainerFixture, DrainShallWriteTheRecordsInOrderAndReleaseTheirSlots)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The drainer shall write committed records as text lines in the order they were logged.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a ring holding as many records as it has slots
+    auto ring = CreateRing(::getpid());
+    LogIndexedMessages(ring, kNumberOfRingSlots);
+    auto drainer = CreateDrainer(output_.at(1UL));
+
+    // When draining
+    EXPECT_EQ(drainer.Drain(), kNumberOfRingSlots);
+
+    // Then every record is written in order and all slots are free again
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords(), kNumberOfRingSlots);
+    EXPECT_EQ(drainer.GetNumberOfLostRecords(), 0U);
+    EXPECT_EQ(drainer.Drain(), 0UL);
+    LogIndexedMessages(ring, kNumberOfRingSlots);
+    EXPECT_EQ(ring.GetNumberOfDroppedMessages(), 0U);
+
+    const auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), kNumberOfRingSlots);
+    for (std::size_t index{0UL}; index < lines.size(); ++index)
+    {
+        const std::string expected_end{" ECU1 SHMD CTX1 log error verbose 1 " + std::to_string(index) + " \n"};
+        ASSERT_GE(lines.at(index).size(), expected_end.size());
+        EXPECT_EQ(lines.at(index).substr(lines.at(index).size() - expected_end.size()), expected_end);
+    }
+}
+
+TEST_F(SharedMemoryDrainerFixture, DrainShallWaitForARecordThatIsStillWritten)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A record shall not be written before an earlier record that is still written by the producer.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a slot that is still written and a later record that is already committed
+    auto ring = CreateRing(::getpid());
+    ASSERT_TRUE(ring.AcquireSlot().has_value());
+    LogIndexedMessages(ring, 1U);
+    auto drainer = CreateDrainer(output_.at(1UL));
+
+    // When draining, nothing is written
+    EXPECT_EQ(drainer.Drain(), 0UL);
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords(), 0U);
+
+    // Then finishing the ring skips the slot that will never be committed
+    drainer.Finish();
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords(), 1U);
+    EXPECT_EQ(drainer.GetNumberOfTornRecords(), 1U);
+    EXPECT_EQ(ring.GetNextSequenceToDrain(), 2U);
+}
+
+TEST_F(SharedMemoryDrainerFixture, RecordThatCannotBeWrittenShallBeCountedAsLost)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "If the output fails, the record shall be counted as lost and its slot released.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    auto ring = CreateRing(::getpid());
+    LogIndexedMessages(ring, 1U);
+    auto drainer = CreateDrainer(-1);
+
+    EXPECT_EQ(drainer.Drain(), 1UL);
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords(), 0U);
+    EXPECT_EQ(drainer.GetNumberOfLostRecords(), 1U);
+    EXPECT_EQ(drainer.Drain(), 0UL);
+}
+
+TEST_F(SharedMemoryDrainerFixture, ProducerShallBeReportedAliveUntilItsProcessTerminated)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The drainer shall detect that the producer process terminated.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a producer that logs and exits
+    const auto pid = ForkProducer(1U, ProducerEnd::kExitAfterCommit);
+    auto drainer = CreateDrainer(output_.at(1UL));
+
+    // When the producer was reaped
+    std::int32_t status{};
+    ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+
+    // Then it is no longer alive, while this process is
+    EXPECT_FALSE(drainer.IsProducerAlive());
+    std::ignore = CreateRing(::getpid());
+    EXPECT_TRUE(CreateDrainer(output_.at(1UL)).IsProducerAlive());
+}
+
+class SharedMemoryDrainerCrashFixture : public SharedMemoryDrainerFixture,
+                                        public ::testing::WithParamInterface<ProducerEnd>
+{
+};
+
+TEST_P(SharedMemoryDrainerCrashFixture, ProducerDyingMidRecordShallOnlyLoseThatRecord)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If the producer terminates while writing a record, all records committed before shall be written "
+                   "and the half written slot shall be reclaimed.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    // Given a producer that commits five records and dies while writing the sixth
+    constexpr std::uint32_t kCommittedRecords{5U};
+    const auto pid = ForkProducer(kCommittedRecords, GetParam());
+    std::int32_t status{};
+    ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+    EXPECT_EQ(WIFSIGNALED(status), GetParam() == ProducerEnd::kKilledWhileWriting);
+
+    // When the drainer finishes the ring of the terminated producer
+    auto drainer = CreateDrainer(output_.at(1UL));
+    ASSERT_FALSE(drainer.IsProducerAlive());
+    drainer.Finish();
+
+    // Then only the torn record is missing and its slot is free again
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords(), kCommittedRecords);
+    EXPECT_EQ(drainer.GetNumberOfLostRecords(), 0U);
+    EXPECT_EQ(drainer.GetNumberOfTornRecords(), 1U);
+    EXPECT_EQ(ReadLines().size(), kCommittedRecords);
+    const auto ring = SharedMemoryRing::Attach(segment_->GetMemory());
+    ASSERT_TRUE(ring.has_value());
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    ring.value().CollectCommittedSlots(committed);
+    EXPECT_TRUE(committed.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(ProducerEnds,
+                         SharedMemoryDrainerCrashFixture,
+                         ::testing::Values(ProducerEnd::kExitWhileWriting, ProducerEnd::kKilledWhileWriting));
+
+TEST_F(SharedMemoryDrainerFixture, DrainingAlongARunningProducerShallNeitherLoseNorDuplicateRecords)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Every record of a producer in another process shall either be written once or counted as "
+                   "dropped.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a producer that logs far more records than the ring holds
+    constexpr std::uint32_t kRecords{200U};
+    const auto pid = ForkProducer(kRecords, ProducerEnd::kExitAfterCommit);
+    auto drainer = CreateDrainer(output_.at(1UL));
+
+    // When draining until the producer is gone
+    std::int32_t status{};
+    while (::waitpid(pid, &status, WNOHANG) != pid)
+    {
+        std::ignore = drainer.Drain();
+    }
+    drainer.Finish();
+
+    // Then written and dropped records add up, and the written ones are in order
+    const auto ring = SharedMemoryRing::Attach(segment_->GetMemory());
+    ASSERT_TRUE(ring.has_value());
+    EXPECT_EQ(drainer.GetNumberOfWrittenRecords() + ring.value().GetNumberOfDroppedMessages(), kRecords);
+    EXPECT_EQ(drainer.GetNumberOfTornRecords(), 0U);
+    const auto lines = ReadLines();
+    ASSERT_EQ(lines.size(), drainer.GetNumberOfWrittenRecords());
+    std::int64_t previous_index{-1};
+    for (const auto& line : lines)
+    {
+        const auto value_begin = line.rfind(' ', line.size() - 3UL) + 1UL;
+        const auto index = std::stoll(line.substr(value_begin));
+        EXPECT_GT(index, previous_index);
+        previous_index = index;
+    }
+}
+
+TEST_F(SharedMemoryDrainerFixture, DrainerShallRemoveTheSharedMemoryObjectItDrained)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The drainer shall remove the shared memory object once it drained it.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a drainer that opened the object of the producer
+    const auto drained = SharedMemorySegment::Open(name_, score::os::Mman::Default(memory_resource_), *unistd_, *stat_);
+    ASSERT_TRUE(drained.has_value());
+
+    // When it removes the object after draining
+    const auto unlinked = drained.value().UnlinkIfUnchanged(*unistd_, *stat_);
+
+    // Then the name is removed
+    ASSERT_TRUE(unlinked.has_value());
+    EXPECT_TRUE(unlinked.value());
+    EXPECT_FALSE(
+        SharedMemorySegment::Open(name_, score::os::Mman::Default(memory_resource_), *unistd_, *stat_).has_value());
+}
+
+TEST_F(SharedMemoryDrainerFixture, DrainerShallNotRemoveTheSharedMemoryObjectOfARestartedProducer)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "A drainer that finishes after its producer restarted shall not remove the shared memory object of "
+                   "the restarted producer.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    // Given a drainer that opened the object of the producer
+    const auto drained = SharedMemorySegment::Open(name_, score::os::Mman::Default(memory_resource_), *unistd_, *stat_);
+    ASSERT_TRUE(drained.has_value());
+
+    // When the producer restarts and replaces the object before the drainer removes it
+    auto restarted = SharedMemorySegment::Create(name_,
+                                                 SharedMemoryRing::GetRequiredSize(kNumberOfRingSlots, kRingSlotSize),
+                                                 score::os::Mman::Default(memory_resource_),
+                                                 *unistd_);
+    ASSERT_TRUE(restarted.has_value());
+    segment_ = std::make_unique<SharedMemorySegment>(std::move(restarted).value());
+    const auto unlinked = drained.value().UnlinkIfUnchanged(*unistd_, *stat_);
+
+    // Then the object of the restarted producer can still be opened by its drainer
+    ASSERT_TRUE(unlinked.has_value());
+    EXPECT_FALSE(unlinked.value());
+    EXPECT_TRUE(
+        SharedMemorySegment::Open(name_, score::os::Mman::Default(memory_resource_), *unistd_, *stat_).has_value());
+}
+
+TEST_F(SharedMemoryDrainerFixture, CreatedSegmentShallNotBeRemovedByIdentity)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Only segments that were opened know the object they refer to, thus the creator cannot remove "
+                   "the object by its identity.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of boundary values");
+
+    // When removing the object through the segment that created it
+    const auto unlinked = segment_->UnlinkIfUnchanged(*unistd_, *stat_);
+
+    // Then this is reported as error and the object stays
+    ASSERT_FALSE(unlinked.has_value());
+    EXPECT_EQ(unlinked.error(), score::os::Error::Code::kInvalidArgument);
+    EXPECT_TRUE(
+        SharedMemorySegment::Open(name_, score::os::Mman::Default(memory_resource_), *unistd_, *stat_).has_value());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
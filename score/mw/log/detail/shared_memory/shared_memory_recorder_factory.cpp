@@ -0,0 +1,88 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_recorder_factory.h"
+
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+#include "score/mw/log/detail/binary_recorder/binary_recorder.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/error.h"
+#include "score/mw/log/detail/initialization_reporter.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_backend.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::string_view kSharedMemoryNamePrefix{"/mw_log_"};
+
+}  // namespace
+
+SharedMemoryRecorderFactory::SharedMemoryRecorderFactory(score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+                                                         score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept
+    : LogRecorderFactory<SharedMemoryRecorderFactory>(), mman_{std::move(mman)}, unistd_{std::move(unistd)}
+{
+}
+
+std::string SharedMemoryRecorderFactory::GetSharedMemoryName(const std::string_view app_id)
+{
+    std::string name{kSharedMemoryNamePrefix};
+    name.append(app_id);
+    return name;
+}
+
+std::unique_ptr<Recorder> SharedMemoryRecorderFactory::CreateConcreteLogRecorder(
+    const Configuration& config,
+    score::cpp::pmr::memory_resource* memory_resource)
+{
+    const auto name = GetSharedMemoryName(config.GetAppId());
+    //  Every ring slot holds the record header in front of the payload of a local slot:
+    const auto ring_slot_size = kBinaryLogRecordHeaderSize + config.GetSlotSizeInBytes();
+    const auto number_of_ring_slots = config.GetNumberOfSlots() * kSharedMemoryRingSlotsPerLocalSlot;
+
+    auto segment = SharedMemorySegment::Create(name,
+                                               SharedMemoryRing::GetRequiredSize(number_of_ring_slots, ring_slot_size),
+                                               std::move(mman_),
+                                               *unistd_);
+    if (!segment.has_value())
+    {
+        ReportInitializationError(Error::kSharedMemoryCreationFailed, name);
+        return std::make_unique<EmptyRecorder>();
+    }
+
+    auto owned_segment = std::make_unique<SharedMemorySegment>(std::move(segment).value());
+    auto ring = SharedMemoryRing::Create(owned_segment->GetMemory(),
+                                         number_of_ring_slots,
+                                         ring_slot_size,
+                                         unistd_->getpid(),
+                                         SerializeFileHeader(LoggingIdentifier{config.GetEcuId()}));
+    auto allocator =
+        std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
+                                                       LogRecord{config.GetSlotSizeInBytes()},
+                                                       GetRecommendedNumberOfShards(config.GetNumberOfSlots()));
+    std::ignore = memory_resource;
+    return std::make_unique<BinaryRecorder>(
+        config, std::make_unique<SharedMemoryBackend>(std::move(allocator), ring, std::move(owned_segment)));
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
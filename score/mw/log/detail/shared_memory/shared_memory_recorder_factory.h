@@ -0,0 +1,65 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RECORDER_FACTORY_H
+#define SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RECORDER_FACTORY_H
+
+#include "score/mw/log/detail/log_recorder_factory.hpp"
+
+#include "score/os/mman.h"
+#include "score/os/unistd.h"
+
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Number of slots of the shared ring per local slot of the recorder.
+///
+/// \details Local slots are released as soon as a message is copied into the ring, thus the ring is the buffer that
+/// has to bridge the time until the drainer process catches up.
+constexpr std::size_t kSharedMemoryRingSlotsPerLocalSlot{4UL};
+
+/// \brief Creates a BinaryRecorder whose records are handed over to a drainer process in the shared memory object
+/// "/mw_log_<app id>".
+///
+/// \details An existing object of the same name is replaced. If the object can not be created, an EmptyRecorder is
+/// returned.
+class SharedMemoryRecorderFactory : public LogRecorderFactory<SharedMemoryRecorderFactory>
+{
+  public:
+    SharedMemoryRecorderFactory(score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+                                score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+
+    std::unique_ptr<Recorder> CreateConcreteLogRecorder(const Configuration& config,
+                                                        score::cpp::pmr::memory_resource* memory_resource);
+
+    /// \brief Returns the name of the shared memory object of the given application.
+    static std::string GetSharedMemoryName(const std::string_view app_id);
+
+  private:
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RECORDER_FACTORY_H
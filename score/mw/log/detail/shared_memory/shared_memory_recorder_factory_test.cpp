@@ -0,0 +1,152 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_recorder_factory.h"
+#include "score/mw/log/detail/binary_recorder/binary_log_decoder.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+
+#include "score/os/mocklib/mman_mock.h"
+#include "score/os/stat.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::Return;
+
+class SharedMemoryRecorderFactoryFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        //  The process id keeps parallel test runs apart, as shared memory objects are visible system wide:
+        app_id_ = "S" + std::to_string(::getpid() % 1000);
+        config_.SetEcuId("ECU1");
+        config_.SetAppId(app_id_);
+        config_.SetDefaultLogLevel(LogLevel::kInfo);
+        config_.SetLogMode({LogMode::kSharedMemory});
+        config_.SetNumberOfSlots(2UL);
+        config_.SetSlotSizeInBytes(256UL);
+    }
+
+    void TearDown() override
+    {
+        std::ignore = score::os::Mman::Default(memory_resource_)
+                          ->shm_unlink(SharedMemoryRecorderFactory::GetSharedMemoryName(app_id_).c_str());
+    }
+
+  protected:
+    std::string app_id_{};
+    Configuration config_{};
+    score::cpp::pmr::memory_resource* memory_resource_{score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(SharedMemoryRecorderFactoryFixture, SharedMemoryNameShallBeDerivedFromApplication)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The shared memory object shall be named after the application.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    EXPECT_EQ(SharedMemoryRecorderFactory::GetSharedMemoryName("APP1"), "/mw_log_APP1");
+}
+
+TEST_F(SharedMemoryRecorderFactoryFixture, RecordsShallBeHandedOverInSharedMemory)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The recorder created by the factory shall commit decodable records into the shared memory ring.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a recorder of the shared memory mode
+    SharedMemoryRecorderFactory factory{score::os::Mman::Default(memory_resource_),
+                                        score::os::Unistd::Default(memory_resource_)};
+    auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+    ASSERT_EQ(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+
+    // When logging one enabled and one disabled message
+    const auto slot = recorder->StartRecord("CTX1", LogLevel::kError);
+    ASSERT_TRUE(slot.has_value());
+    recorder->Log(slot.value(), std::uint32_t{42U});
+    recorder->Log(slot.value(), std::string_view{"hello"});
+    recorder->StopRecord(slot.value());
+    EXPECT_FALSE(recorder->StartRecord("CTX1", LogLevel::kVerbose).has_value());
+
+    // Then a drainer that opens the shared memory by name finds exactly the enabled message
+    auto unistd = score::os::Unistd::Default(memory_resource_);
+    const auto segment = SharedMemorySegment::Open(SharedMemoryRecorderFactory::GetSharedMemoryName(app_id_),
+                                                   score::os::Mman::Default(memory_resource_),
+                                                   *unistd,
+                                                   *score::os::Stat::Default(memory_resource_));
+    ASSERT_TRUE(segment.has_value());
+    const auto ring = SharedMemoryRing::Attach(segment.value().GetMemory());
+    ASSERT_TRUE(ring.has_value());
+    EXPECT_EQ(ring.value().GetProducerPid(), ::getpid());
+    EXPECT_EQ(ring.value().GetNumberOfSlots(), 2UL * kSharedMemoryRingSlotsPerLocalSlot);
+
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    ring.value().CollectCommittedSlots(committed);
+    ASSERT_EQ(committed.size(), 1UL);
+    BinaryLogDecoder decoder{};
+    ASSERT_TRUE(decoder.ReadFileHeader(ring.value().GetFileHeader()).has_value());
+    const auto data = ring.value().GetCommittedData(committed.at(0UL).slot);
+    const auto record_size = decoder.DecodeRecord(data);
+    ASSERT_TRUE(record_size.has_value());
+    EXPECT_EQ(record_size.value(), static_cast<std::size_t>(data.size()));
+    EXPECT_THAT(std::string{decoder.GetLine()}, HasSubstr(" 000 ECU1 " + app_id_));
+    EXPECT_THAT(std::string{decoder.GetLine()}, HasSubstr(" CTX1 log error verbose 2 42 hello \n"));
+}
+
+TEST_F(SharedMemoryRecorderFactoryFixture, ShallReturnEmptyRecorderIfSharedMemoryCannotBeCreated)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The factory shall fall back to an EmptyRecorder if the shared memory object cannot be created.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    auto mman_mock = score::cpp::pmr::make_unique<score::os::MmanMock>(memory_resource_);
+    EXPECT_CALL(*mman_mock, shm_unlink(_)).WillRepeatedly(Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*mman_mock, shm_open(_, _, _))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EACCES))));
+    SharedMemoryRecorderFactory factory{std::move(mman_mock), score::os::Unistd::Default(memory_resource_)};
+
+    auto recorder = factory.CreateLogRecorder(config_, memory_resource_);
+
+    EXPECT_NE(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
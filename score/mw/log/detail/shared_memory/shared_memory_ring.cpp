@@ -0,0 +1,329 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::array<char, 8UL> kSharedMemoryRingMagic{'M', 'W', 'L', 'O', 'G', 'S', 'H', 'M'};
+constexpr std::uint32_t kSharedMemoryRingVersion{1U};
+constexpr std::uint32_t kInitialized{0x52494E47U};
+constexpr std::size_t kCacheLineSize{64UL};
+
+enum class SlotState : std::uint32_t
+{
+    kFree = 0U,
+    kWriting,
+    kCommitted,
+};
+
+constexpr std::uint32_t ToValue(const SlotState state) noexcept
+{
+    return static_cast<std::uint32_t>(state);
+}
+
+constexpr std::size_t RoundUpToCacheLine(const std::size_t size) noexcept
+{
+    return ((size + kCacheLineSize) - 1UL) / kCacheLineSize * kCacheLineSize;
+}
+
+}  // namespace
+
+/*
+Deviation from Rule M11-0-1:
+- Member data in non-POD class types shall be private.
+Justification:
+- The types describe the layout of the shared memory region and are only accessed by SharedMemoryRing.
+*/
+// coverity[autosar_cpp14_m11_0_1_violation]
+struct SharedMemoryRing::Header
+{
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::atomic<std::uint32_t> initialized;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t version;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::array<char, 8UL> magic;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t number_of_slots;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t slot_size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t slot_stride;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t slots_offset;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::int64_t producer_pid;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    BinaryLogFileHeaderBuffer file_header;
+    //  Written by every producer thread, thus kept away from the read-mostly fields above:
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> next_sequence;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::atomic<std::uint64_t> dropped_messages;
+    //  Only written by the drainer:
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    alignas(kCacheLineSize) std::atomic<std::uint64_t> next_sequence_to_drain;
+};
+
+// coverity[autosar_cpp14_m11_0_1_violation] see above
+struct SharedMemoryRing::SlotHeader
+{
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::atomic<std::uint32_t> state;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint32_t size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t sequence;
+};
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Atomics in shared memory must be lock-free");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Atomics in shared memory must be lock-free");
+
+std::string_view ToString(const SharedMemoryRingError error) noexcept
+{
+    switch (error)
+    {
+        case SharedMemoryRingError::kTooSmall:
+            return "Shared memory region is smaller than its ring";
+        case SharedMemoryRingError::kNotInitialized:
+            return "Shared memory ring is not initialized yet";
+        case SharedMemoryRingError::kInvalidLayout:
+        default:
+            return "Shared memory region does not contain a ring of this version";
+    }
+}
+
+SharedMemoryRing::SharedMemoryRing(std::uint8_t* const base) noexcept : base_{base} {}
+
+std::size_t SharedMemoryRing::GetRequiredSize(const std::size_t number_of_slots, const std::size_t slot_size) noexcept
+{
+    return RoundUpToCacheLine(sizeof(Header)) + (number_of_slots * RoundUpToCacheLine(sizeof(SlotHeader) + slot_size));
+}
+
+SharedMemoryRing SharedMemoryRing::Create(const score::cpp::span<std::uint8_t> memory,
+                                          const std::size_t number_of_slots,
+                                          const std::size_t slot_size,
+                                          const pid_t producer_pid,
+                                          const BinaryLogFileHeaderBuffer& file_header) noexcept
+{
+    // NOLINTNEXTLINE(score-no-dynamic-raw-memory) objects are placed into the given shared memory
+    auto* const header = new (memory.data()) Header{};
+    header->version = kSharedMemoryRingVersion;
+    header->magic = kSharedMemoryRingMagic;
+    header->number_of_slots = number_of_slots;
+    header->slot_size = slot_size;
+    header->slot_stride = RoundUpToCacheLine(sizeof(SlotHeader) + slot_size);
+    header->slots_offset = RoundUpToCacheLine(sizeof(Header));
+    header->producer_pid = static_cast<std::int64_t>(producer_pid);
+    header->file_header = file_header;
+
+    SharedMemoryRing ring{memory.data()};
+    for (std::size_t slot{0UL}; slot < number_of_slots; ++slot)
+    {
+        // NOLINTNEXTLINE(score-no-dynamic-raw-memory) objects are placed into the given shared memory
+        std::ignore = new (&ring.GetSlotHeader(slot)) SlotHeader{};
+    }
+    header->initialized.store(kInitialized, std::memory_order_release);
+    return ring;
+}
+
+score::cpp::expected<SharedMemoryRing, SharedMemoryRingError> SharedMemoryRing::Attach(
+    const score::cpp::span<std::uint8_t> memory) noexcept
+{
+    const auto memory_size = static_cast<std::size_t>(memory.size());
+    if (memory_size < RoundUpToCacheLine(sizeof(Header)))
+    {
+        return score::cpp::make_unexpected(SharedMemoryRingError::kTooSmall);
+    }
+
+    SharedMemoryRing ring{memory.data()};
+    const auto& header = ring.GetHeader();
+    if (header.initialized.load(std::memory_order_acquire) != kInitialized)
+    {
+        return score::cpp::make_unexpected(SharedMemoryRingError::kNotInitialized);
+    }
+    if ((header.magic != kSharedMemoryRingMagic) || (header.version != kSharedMemoryRingVersion) ||
+        (header.slots_offset < sizeof(Header)) || (header.slot_stride < (sizeof(SlotHeader) + header.slot_size)) ||
+        (header.number_of_slots == 0UL))
+    {
+        return score::cpp::make_unexpected(SharedMemoryRingError::kInvalidLayout);
+    }
+    if ((memory_size - header.slots_offset) / header.slot_stride < header.number_of_slots)
+    {
+        return score::cpp::make_unexpected(SharedMemoryRingError::kTooSmall);
+    }
+    return ring;
+}
+
+score::cpp::optional<std::size_t> SharedMemoryRing::AcquireSlot() noexcept
+{
+    auto& header = GetHeader();
+    const auto number_of_slots = static_cast<std::size_t>(header.number_of_slots);
+    const auto first_slot = header.next_sequence.load(std::memory_order_relaxed);
+
+    //  Starting behind the last acquired slot spreads concurrent producers over the ring:
+    for (std::size_t probe{0UL}; probe < number_of_slots; ++probe)
+    {
+        const auto slot = static_cast<std::size_t>((first_slot + probe) % number_of_slots);
+        auto& slot_header = GetSlotHeader(slot);
+        auto expected = ToValue(SlotState::kFree);
+        if ((slot_header.state.load(std::memory_order_relaxed) == expected) &&
+            slot_header.state.compare_exchange_strong(
+                expected, ToValue(SlotState::kWriting), std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            //  Drawn only for acquired slots, thus the sequence numbers of all messages in the ring have no gaps:
+            slot_header.sequence = header.next_sequence.fetch_add(1UL, std::memory_order_relaxed);
+            return slot;
+        }
+    }
+
+    std::ignore = header.dropped_messages.fetch_add(1UL, std::memory_order_relaxed);
+    return {};
+}
+
+score::cpp::span<std::uint8_t> SharedMemoryRing::GetSlotData(const std::size_t slot) noexcept
+{
+    return {GetSlotDataBegin(slot), static_cast<score::cpp::span<std::uint8_t>::size_type>(GetSlotSize())};
+}
+
+void SharedMemoryRing::CommitSlot(const std::size_t slot, const std::size_t size) noexcept
+{
+    auto& slot_header = GetSlotHeader(slot);
+    slot_header.size = static_cast<std::uint32_t>(std::min(size, GetSlotSize()));
+    slot_header.state.store(ToValue(SlotState::kCommitted), std::memory_order_release);
+}
+
+void SharedMemoryRing::CollectCommittedSlots(std::vector<SharedMemoryCommittedSlot>& committed_slots) const
+{
+    const auto first_collected = committed_slots.size();
+    for (std::size_t slot{0UL}; slot < GetNumberOfSlots(); ++slot)
+    {
+        const auto& slot_header = GetSlotHeader(slot);
+        if (slot_header.state.load(std::memory_order_acquire) == ToValue(SlotState::kCommitted))
+        {
+            committed_slots.push_back(SharedMemoryCommittedSlot{slot_header.sequence, slot});
+        }
+    }
+
+    //  Slots are reused in any order, only the sequence number tells which message was first:
+    using Difference = std::vector<SharedMemoryCommittedSlot>::difference_type;
+    std::sort(committed_slots.begin() + static_cast<Difference>(first_collected),
+              committed_slots.end(),
+              [](const SharedMemoryCommittedSlot& lhs, const SharedMemoryCommittedSlot& rhs) noexcept {
+                  return lhs.sequence < rhs.sequence;
+              });
+}
+
+score::cpp::span<const std::uint8_t> SharedMemoryRing::GetCommittedData(const std::size_t slot) const noexcept
+{
+    //  The size is checked again, as the region can be written by another process:
+    const auto size = std::min(static_cast<std::size_t>(GetSlotHeader(slot).size), GetSlotSize());
+    return {GetSlotDataBegin(slot), static_cast<score::cpp::span<const std::uint8_t>::size_type>(size)};
+}
+
+void SharedMemoryRing::ReleaseSlot(const std::size_t slot) noexcept
+{
+    GetSlotHeader(slot).state.store(ToValue(SlotState::kFree), std::memory_order_release);
+}
+
+std::size_t SharedMemoryRing::ReclaimAbandonedSlots() noexcept
+{
+    std::size_t reclaimed_slots{0UL};
+    for (std::size_t slot{0UL}; slot < GetNumberOfSlots(); ++slot)
+    {
+        auto expected = ToValue(SlotState::kWriting);
+        if (GetSlotHeader(slot).state.compare_exchange_strong(
+                expected, ToValue(SlotState::kFree), std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            ++reclaimed_slots;
+        }
+    }
+    return reclaimed_slots;
+}
+
+std::size_t SharedMemoryRing::GetNumberOfSlots() const noexcept
+{
+    return static_cast<std::size_t>(GetHeader().number_of_slots);
+}
+
+std::size_t SharedMemoryRing::GetSlotSize() const noexcept
+{
+    return static_cast<std::size_t>(GetHeader().slot_size);
+}
+
+pid_t SharedMemoryRing::GetProducerPid() const noexcept
+{
+    return static_cast<pid_t>(GetHeader().producer_pid);
+}
+
+std::uint64_t SharedMemoryRing::GetNumberOfDroppedMessages() const noexcept
+{
+    return GetHeader().dropped_messages.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SharedMemoryRing::GetNextSequenceToDrain() const noexcept
+{
+    return GetHeader().next_sequence_to_drain.load(std::memory_order_relaxed);
+}
+
+void SharedMemoryRing::SetNextSequenceToDrain(const std::uint64_t sequence) noexcept
+{
+    GetHeader().next_sequence_to_drain.store(sequence, std::memory_order_relaxed);
+}
+
+score::cpp::span<const std::uint8_t> SharedMemoryRing::GetFileHeader() const noexcept
+{
+    const auto& file_header = GetHeader().file_header;
+    return {file_header.data(), file_header.size()};
+}
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// The region is raw shared memory, its objects were placed by Create() at the offsets stored in the header.
+SharedMemoryRing::Header& SharedMemoryRing::GetHeader() const noexcept
+{
+    // coverity[autosar_cpp14_a5_2_4_violation] see above
+    return *reinterpret_cast<Header*>(base_);
+}
+
+SharedMemoryRing::SlotHeader& SharedMemoryRing::GetSlotHeader(const std::size_t slot) const noexcept
+{
+    const auto& header = GetHeader();
+    // coverity[autosar_cpp14_a5_2_4_violation] see above
+    return *reinterpret_cast<SlotHeader*>(base_ + header.slots_offset + (slot * header.slot_stride));
+}
+
+std::uint8_t* SharedMemoryRing::GetSlotDataBegin(const std::size_t slot) const noexcept
+{
+    // coverity[autosar_cpp14_a5_2_4_violation] see above
+    return reinterpret_cast<std::uint8_t*>(&GetSlotHeader(slot)) + sizeof(SlotHeader);
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
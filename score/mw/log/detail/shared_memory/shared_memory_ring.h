@@ -0,0 +1,158 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RING_H
+#define SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RING_H
+
+#include "score/mw/log/detail/binary_recorder/binary_log_file.h"
+
+#include <score/expected.hpp>
+#include <score/optional.hpp>
+#include <score/span.hpp>
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+enum class SharedMemoryRingError : std::uint8_t
+{
+    kTooSmall = 0,
+    kNotInitialized,
+    kInvalidLayout,
+};
+
+/// \brief Returns a human readable description of the error.
+std::string_view ToString(const SharedMemoryRingError error) noexcept;
+
+/// \brief A slot that was committed by the producer, see SharedMemoryRing::CollectCommittedSlots().
+struct SharedMemoryCommittedSlot
+{
+    std::uint64_t sequence;
+    std::size_t slot;
+};
+
+/// \brief Fixed number of slots in a memory region that is shared between the process that writes log records and a
+/// drainer process that reads them.
+///
+/// \details The region starts with a header, followed by the slots:
+///
+///   header: | magic | layout | producer pid | binary log file header | sequence counter | dropped counter |
+///           | next sequence to drain |
+///   slot:   | state | size | sequence | data ...                                               (cache line aligned)
+///
+/// All positions are stored as offsets from the start of the region, thus both processes can map it at different
+/// addresses. Only lock-free atomics are placed in the region.
+///
+/// A producer acquires a free slot by a compare-exchange of its state, copies a complete binary log record (see
+/// binary_log_file.h) into it and commits it. Every acquired slot draws the next number of a sequence counter, which
+/// the drainer uses to restore the order of the messages. If no slot is free, the message is dropped and counted, it
+/// does not draw a number. Thus a gap in the committed sequence numbers means that a message is still written.
+///
+/// If the producer terminates while it writes into a slot, the slot never becomes committed. Once the drainer knows
+/// that the producer is gone, it reclaims such slots by ReclaimAbandonedSlots() and drops their content.
+class SharedMemoryRing final
+{
+  public:
+    /// \brief Returns the number of bytes of a region that holds the given slots.
+    static std::size_t GetRequiredSize(const std::size_t number_of_slots, const std::size_t slot_size) noexcept;
+
+    /// \brief Initializes the region as empty ring.
+    ///
+    /// \details The initialization is completed by a release store, thus a drainer that attaches concurrently either
+    /// sees the whole header or fails with kNotInitialized.
+    ///
+    /// \pre memory is aligned to a cache line and has at least GetRequiredSize() bytes.
+    static SharedMemoryRing Create(const score::cpp::span<std::uint8_t> memory,
+                                   const std::size_t number_of_slots,
+                                   const std::size_t slot_size,
+                                   const pid_t producer_pid,
+                                   const BinaryLogFileHeaderBuffer& file_header) noexcept;
+
+    /// \brief Uses a region that was initialized by Create(), usually in another process.
+    static score::cpp::expected<SharedMemoryRing, SharedMemoryRingError> Attach(
+        const score::cpp::span<std::uint8_t> memory) noexcept;
+
+    /// \brief Acquires a free slot for the producer.
+    ///
+    /// \return The slot, or an empty optional if all slots are in use. Then the message is counted as dropped.
+    score::cpp::optional<std::size_t> AcquireSlot() noexcept;
+
+    /// \brief Returns the data of a slot that was acquired by AcquireSlot().
+    score::cpp::span<std::uint8_t> GetSlotData(const std::size_t slot) noexcept;
+
+    /// \brief Hands the first size bytes of the slot over to the drainer.
+    void CommitSlot(const std::size_t slot, const std::size_t size) noexcept;
+
+    /// \brief Appends all committed slots in the order of their acquisition.
+    ///
+    /// \details The slots are not read at once. A message committed during the call may be missing while a later one
+    /// is contained, which shows up as gap in the sequence numbers.
+    void CollectCommittedSlots(std::vector<SharedMemoryCommittedSlot>& committed_slots) const;
+
+    /// \brief Returns the data that was committed for the slot.
+    score::cpp::span<const std::uint8_t> GetCommittedData(const std::size_t slot) const noexcept;
+
+    /// \brief Returns a committed slot to the producer.
+    void ReleaseSlot(const std::size_t slot) noexcept;
+
+    /// \brief Frees the slots that were acquired but never committed.
+    ///
+    /// \pre The producer terminated, otherwise it may still write into these slots.
+    /// \return The number of reclaimed slots.
+    std::size_t ReclaimAbandonedSlots() noexcept;
+
+    std::size_t GetNumberOfSlots() const noexcept;
+    std::size_t GetSlotSize() const noexcept;
+    pid_t GetProducerPid() const noexcept;
+    std::uint64_t GetNumberOfDroppedMessages() const noexcept;
+
+    /// \brief Returns the sequence number of the first message the drainer did not write yet.
+    ///
+    /// \details Kept in the region, thus a restarted drainer continues where the previous one stopped.
+    std::uint64_t GetNextSequenceToDrain() const noexcept;
+    void SetNextSequenceToDrain(const std::uint64_t sequence) noexcept;
+
+    /// \brief Returns the header of the binary log file the records of this ring belong to.
+    score::cpp::span<const std::uint8_t> GetFileHeader() const noexcept;
+
+  private:
+    struct Header;
+    struct SlotHeader;
+
+    explicit SharedMemoryRing(std::uint8_t* const base) noexcept;
+
+    Header& GetHeader() const noexcept;
+    SlotHeader& GetSlotHeader(const std::size_t slot) const noexcept;
+    std::uint8_t* GetSlotDataBegin(const std::size_t slot) const noexcept;
+
+    std::uint8_t* base_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_RING_H
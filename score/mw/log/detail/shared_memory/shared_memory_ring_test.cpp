@@ -0,0 +1,291 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_ring.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <cstring>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+constexpr std::size_t kNumberOfSlots{4UL};
+constexpr std::size_t kSlotSize{32UL};
+constexpr pid_t kProducerPid{1234};
+
+class SharedMemoryRingFixture : public ::testing::Test
+{
+  public:
+    SharedMemoryRing CreateRing()
+    {
+        return SharedMemoryRing::Create(GetMemory(), kNumberOfSlots, kSlotSize, kProducerPid, file_header_);
+    }
+
+    score::cpp::span<std::uint8_t> GetMemory()
+    {
+        return {memory_.data(), SharedMemoryRing::GetRequiredSize(kNumberOfSlots, kSlotSize)};
+    }
+
+    static void Write(SharedMemoryRing& ring, const std::size_t slot, const std::uint8_t value)
+    {
+        const auto data = ring.GetSlotData(slot);
+        std::ignore = std::memset(data.data(), value, static_cast<std::size_t>(data.size()));
+    }
+
+  protected:
+    const BinaryLogFileHeaderBuffer file_header_{SerializeFileHeader(LoggingIdentifier{"ECU1"})};
+    alignas(64) std::array<std::uint8_t, 1024UL> memory_{};
+};
+
+TEST_F(SharedMemoryRingFixture, AttachedRingShallSeeTheLayoutOfTheCreatedRing)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A ring attached to initialized memory shall report the parameters of its creation.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a ring that was created in the memory
+    ASSERT_LE(SharedMemoryRing::GetRequiredSize(kNumberOfSlots, kSlotSize), memory_.size());
+    std::ignore = CreateRing();
+
+    // When the memory is attached
+    const auto ring = SharedMemoryRing::Attach(GetMemory());
+
+    // Then the layout and the producer are known
+    ASSERT_TRUE(ring.has_value());
+    EXPECT_EQ(ring.value().GetNumberOfSlots(), kNumberOfSlots);
+    EXPECT_EQ(ring.value().GetSlotSize(), kSlotSize);
+    EXPECT_EQ(ring.value().GetProducerPid(), kProducerPid);
+    EXPECT_EQ(ring.value().GetNumberOfDroppedMessages(), 0U);
+    const auto file_header = ring.value().GetFileHeader();
+    EXPECT_TRUE(std::equal(file_header.begin(), file_header.end(), file_header_.begin(), file_header_.end()));
+}
+
+TEST_F(SharedMemoryRingFixture, AttachShallFailOnUninitializedMemory)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Memory that was not initialized by a producer shall not be attached.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    const auto ring = SharedMemoryRing::Attach(GetMemory());
+    ASSERT_FALSE(ring.has_value());
+    EXPECT_EQ(ring.error(), SharedMemoryRingError::kNotInitialized);
+}
+
+TEST_F(SharedMemoryRingFixture, AttachShallFailIfTheMemoryIsSmallerThanTheRing)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A ring shall not be attached if its slots exceed the memory.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    std::ignore = CreateRing();
+
+    const auto ring = SharedMemoryRing::Attach(GetMemory().first(GetMemory().size() - 1));
+    ASSERT_FALSE(ring.has_value());
+    EXPECT_EQ(ring.error(), SharedMemoryRingError::kTooSmall);
+
+    const auto header_only = SharedMemoryRing::Attach(GetMemory().first(8));
+    ASSERT_FALSE(header_only.has_value());
+    EXPECT_EQ(header_only.error(), SharedMemoryRingError::kTooSmall);
+}
+
+TEST_F(SharedMemoryRingFixture, AttachShallFailOnForeignContent)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Memory that does not contain a ring of this version shall not be attached.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a ring whose magic was overwritten
+    std::ignore = CreateRing();
+    memory_.at(8UL) = 'X';
+
+    const auto ring = SharedMemoryRing::Attach(GetMemory());
+    ASSERT_FALSE(ring.has_value());
+    EXPECT_EQ(ring.error(), SharedMemoryRingError::kInvalidLayout);
+    EXPECT_FALSE(ToString(ring.error()).empty());
+}
+
+TEST_F(SharedMemoryRingFixture, CommittedSlotsShallBeCollectedInTheOrderOfAcquisition)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Committed slots shall be collected in the order they were acquired, not committed, in.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given three acquired slots that are committed in reverse order
+    auto ring = CreateRing();
+    const auto first = ring.AcquireSlot();
+    const auto second = ring.AcquireSlot();
+    const auto third = ring.AcquireSlot();
+    ASSERT_TRUE(first.has_value() && second.has_value() && third.has_value());
+    Write(ring, first.value(), 1U);
+    Write(ring, second.value(), 2U);
+    Write(ring, third.value(), 3U);
+    ring.CommitSlot(third.value(), 3UL);
+    ring.CommitSlot(second.value(), 2UL);
+    ring.CommitSlot(first.value(), 1UL);
+
+    // When the drainer collects them
+    auto drainer = SharedMemoryRing::Attach(GetMemory());
+    ASSERT_TRUE(drainer.has_value());
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    drainer.value().CollectCommittedSlots(committed);
+
+    // Then they are in the order of acquisition with the committed data
+    ASSERT_EQ(committed.size(), 3UL);
+    EXPECT_EQ(committed.at(0UL).slot, first.value());
+    EXPECT_EQ(committed.at(1UL).slot, second.value());
+    EXPECT_EQ(committed.at(2UL).slot, third.value());
+    for (std::size_t index{0UL}; index < committed.size(); ++index)
+    {
+        const auto data = drainer.value().GetCommittedData(committed.at(index).slot);
+        ASSERT_EQ(static_cast<std::size_t>(data.size()), index + 1UL);
+        EXPECT_EQ(data[0], static_cast<std::uint8_t>(index + 1UL));
+    }
+}
+
+TEST_F(SharedMemoryRingFixture, SlotsThatAreNotCommittedShallNotBeCollected)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Slots that are still written by the producer shall not be visible to the drainer.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    auto ring = CreateRing();
+    ASSERT_TRUE(ring.AcquireSlot().has_value());
+
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    ring.CollectCommittedSlots(committed);
+    EXPECT_TRUE(committed.empty());
+}
+
+TEST_F(SharedMemoryRingFixture, FullRingShallDropAndCountMessages)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "If all slots are in use, a message shall be dropped and counted.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given all slots are acquired
+    auto ring = CreateRing();
+    for (std::size_t slot{0UL}; slot < kNumberOfSlots; ++slot)
+    {
+        ASSERT_TRUE(ring.AcquireSlot().has_value());
+    }
+
+    // When another slot is acquired, it fails
+    EXPECT_FALSE(ring.AcquireSlot().has_value());
+    EXPECT_FALSE(ring.AcquireSlot().has_value());
+
+    // Then the drops are counted, but do not leave gaps in the sequence
+    EXPECT_EQ(ring.GetNumberOfDroppedMessages(), 2U);
+    ring.ReleaseSlot(0UL);
+    const auto slot = ring.AcquireSlot();
+    ASSERT_TRUE(slot.has_value());
+    ring.CommitSlot(slot.value(), 1UL);
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    ring.CollectCommittedSlots(committed);
+    ASSERT_EQ(committed.size(), 1UL);
+    EXPECT_EQ(committed.at(0UL).sequence, kNumberOfSlots);
+}
+
+TEST_F(SharedMemoryRingFixture, ReleasedSlotShallBeAcquiredAgain)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A slot released by the drainer shall be available to the producer again.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a full ring
+    auto ring = CreateRing();
+    for (std::size_t slot{0UL}; slot < kNumberOfSlots; ++slot)
+    {
+        const auto acquired = ring.AcquireSlot();
+        ASSERT_TRUE(acquired.has_value());
+        ring.CommitSlot(acquired.value(), 1UL);
+    }
+
+    // When one slot is released
+    ring.ReleaseSlot(2UL);
+
+    // Then exactly that slot is acquired next
+    const auto acquired = ring.AcquireSlot();
+    ASSERT_TRUE(acquired.has_value());
+    EXPECT_EQ(acquired.value(), 2UL);
+    EXPECT_FALSE(ring.AcquireSlot().has_value());
+}
+
+TEST_F(SharedMemoryRingFixture, CommittedSizeShallBeLimitedToTheSlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "The committed data shall never exceed the slot.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    auto ring = CreateRing();
+    const auto slot = ring.AcquireSlot();
+    ASSERT_TRUE(slot.has_value());
+    ring.CommitSlot(slot.value(), kSlotSize + 100UL);
+
+    EXPECT_EQ(static_cast<std::size_t>(ring.GetCommittedData(slot.value()).size()), kSlotSize);
+}
+
+TEST_F(SharedMemoryRingFixture, ReclaimShallOnlyFreeSlotsThatWereNeverCommitted)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Slots a terminated producer left half written shall be freed, committed slots shall be kept.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    // Given a committed slot and two slots that were abandoned while written
+    auto ring = CreateRing();
+    const auto committed_slot = ring.AcquireSlot();
+    ASSERT_TRUE(committed_slot.has_value());
+    ring.CommitSlot(committed_slot.value(), 1UL);
+    ASSERT_TRUE(ring.AcquireSlot().has_value());
+    ASSERT_TRUE(ring.AcquireSlot().has_value());
+
+    // When the abandoned slots are reclaimed
+    EXPECT_EQ(ring.ReclaimAbandonedSlots(), 2UL);
+
+    // Then the committed slot is still collected and the other slots are free again
+    std::vector<SharedMemoryCommittedSlot> committed{};
+    ring.CollectCommittedSlots(committed);
+    ASSERT_EQ(committed.size(), 1UL);
+    EXPECT_EQ(committed.at(0UL).slot, committed_slot.value());
+    for (std::size_t slot{1UL}; slot < kNumberOfSlots; ++slot)
+    {
+        EXPECT_TRUE(ring.AcquireSlot().has_value());
+    }
+    EXPECT_EQ(ring.ReclaimAbandonedSlots(), 3UL);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,195 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/shared_memory/shared_memory_segment.h"
+
+#include <utility>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+SharedMemorySegment::SharedMemorySegment(std::string name,
+                                         score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+                                         void* const address,
+                                         const std::size_t size,
+                                         const score::cpp::optional<ObjectIdentity> identity) noexcept
+    : name_{std::move(name)}, mman_{std::move(mman)}, address_{address}, size_{size}, identity_{identity}
+{
+}
+
+SharedMemorySegment::SharedMemorySegment(SharedMemorySegment&& other) noexcept
+    : name_{std::move(other.name_)},
+      mman_{std::move(other.mman_)},
+      address_{other.address_},
+      size_{other.size_},
+      identity_{other.identity_}
+{
+    other.address_ = nullptr;
+    other.size_ = 0UL;
+}
+
+SharedMemorySegment::~SharedMemorySegment() noexcept
+{
+    if ((mman_ != nullptr) && (address_ != nullptr))
+    {
+        std::ignore = mman_->munmap(address_, size_);
+    }
+}
+
+score::cpp::expected<SharedMemorySegment, score::os::Error> SharedMemorySegment::Create(
+    const std::string& name,
+    const std::size_t size,
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+    const score::os::Unistd& unistd) noexcept
+{
+    std::ignore = mman->shm_unlink(name.c_str());
+
+    //  The drainer process updates the slot states, thus it needs write access too:
+    const auto file_descriptor = mman->shm_open(
+        name.c_str(),
+        score::os::Fcntl::Open::kReadWrite | score::os::Fcntl::Open::kCreate | score::os::Fcntl::Open::kExclusive,
+        score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser | score::os::Stat::Mode::kReadGroup |
+            score::os::Stat::Mode::kWriteGroup);
+    if (!file_descriptor.has_value())
+    {
+        return score::cpp::make_unexpected(file_descriptor.error());
+    }
+
+    const auto truncated = unistd.ftruncate(file_descriptor.value(), static_cast<off_t>(size));
+    if (!truncated.has_value())
+    {
+        std::ignore = unistd.close(file_descriptor.value());
+        std::ignore = mman->shm_unlink(name.c_str());
+        return score::cpp::make_unexpected(truncated.error());
+    }
+
+    auto segment = Map(name, std::move(mman), file_descriptor.value(), size, {});
+    std::ignore = unistd.close(file_descriptor.value());
+    return segment;
+}
+
+score::cpp::expected<SharedMemorySegment, score::os::Error> SharedMemorySegment::Open(
+    const std::string& name,
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+    const score::os::Unistd& unistd,
+    const score::os::Stat& stat) noexcept
+{
+    const auto file_descriptor =
+        mman->shm_open(name.c_str(), score::os::Fcntl::Open::kReadWrite, score::os::Stat::Mode::kNone);
+    if (!file_descriptor.has_value())
+    {
+        return score::cpp::make_unexpected(file_descriptor.error());
+    }
+
+    score::os::StatBuffer status{};
+    const auto stat_result = stat.fstat(file_descriptor.value(), status);
+    if (!stat_result.has_value())
+    {
+        std::ignore = unistd.close(file_descriptor.value());
+        return score::cpp::make_unexpected(stat_result.error());
+    }
+
+    auto segment = Map(name,
+                       std::move(mman),
+                       file_descriptor.value(),
+                       static_cast<std::size_t>(status.st_size),
+                       ObjectIdentity{status.st_dev, status.st_ino});
+    std::ignore = unistd.close(file_descriptor.value());
+    return segment;
+}
+
+score::cpp::expected<SharedMemorySegment, score::os::Error> SharedMemorySegment::Map(
+    const std::string& name,
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+    const std::int32_t file_descriptor,
+    const std::size_t size,
+    const score::cpp::optional<ObjectIdentity> identity) noexcept
+{
+    const auto address = mman->mmap(nullptr,
+                                    size,
+                                    score::os::Mman::Protection::kRead | score::os::Mman::Protection::kWrite,
+                                    score::os::Mman::Map::kShared,
+                                    file_descriptor,
+                                    0);
+    if (!address.has_value())
+    {
+        return score::cpp::make_unexpected(address.error());
+    }
+    return SharedMemorySegment{name, std::move(mman), address.value(), size, identity};
+}
+
+score::cpp::span<std::uint8_t> SharedMemorySegment::GetMemory() const noexcept
+{
+    return {static_cast<std::uint8_t*>(address_), static_cast<score::cpp::span<std::uint8_t>::size_type>(size_)};
+}
+
+const std::string& SharedMemorySegment::GetName() const noexcept
+{
+    return name_;
+}
+
+score::cpp::expected_blank<score::os::Error> SharedMemorySegment::Unlink() const noexcept
+{
+    return mman_->shm_unlink(name_.c_str());
+}
+
+score::cpp::expected<bool, score::os::Error> SharedMemorySegment::UnlinkIfUnchanged(
+    const score::os::Unistd& unistd,
+    const score::os::Stat& stat) const noexcept
+{
+    if (!identity_.has_value())
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EINVAL));
+    }
+
+    const auto file_descriptor =
+        mman_->shm_open(name_.c_str(), score::os::Fcntl::Open::kReadOnly, score::os::Stat::Mode::kNone);
+    if (!file_descriptor.has_value())
+    {
+        //  Somebody else removed the name already:
+        if (file_descriptor.error() == score::os::Error::Code::kNoSuchFileOrDirectory)
+        {
+            return false;
+        }
+        return score::cpp::make_unexpected(file_descriptor.error());
+    }
+
+    score::os::StatBuffer status{};
+    const auto stat_result = stat.fstat(file_descriptor.value(), status);
+    std::ignore = unistd.close(file_descriptor.value());
+    if (!stat_result.has_value())
+    {
+        return score::cpp::make_unexpected(stat_result.error());
+    }
+    if ((status.st_dev != identity_->device) || (status.st_ino != identity_->inode))
+    {
+        return false;
+    }
+
+    const auto unlinked = mman_->shm_unlink(name_.c_str());
+    if (!unlinked.has_value())
+    {
+        return score::cpp::make_unexpected(unlinked.error());
+    }
+    return true;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,119 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_SEGMENT_H
+#define SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_SEGMENT_H
+
+#include "score/os/errno.h"
+#include "score/os/mman.h"
+#include "score/os/stat.h"
+#include "score/os/unistd.h"
+
+#include <score/expected.hpp>
+#include <score/memory.hpp>
+#include <score/optional.hpp>
+#include <score/span.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Named POSIX shared memory object that is mapped into the address space of this process.
+///
+/// \details The mapping is removed on destruction, the object itself stays until Unlink() is called. Thus a drainer
+/// can still read the messages of a producer that already terminated.
+class SharedMemorySegment final
+{
+  public:
+    /// \brief Creates the object with the given size and maps it.
+    ///
+    /// \details An object of the same name is replaced, as it can only be left over by a terminated producer.
+    static score::cpp::expected<SharedMemorySegment, score::os::Error> Create(
+        const std::string& name,
+        const std::size_t size,
+        score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+        const score::os::Unistd& unistd) noexcept;
+
+    /// \brief Maps an existing object as a whole.
+    static score::cpp::expected<SharedMemorySegment, score::os::Error> Open(
+        const std::string& name,
+        score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+        const score::os::Unistd& unistd,
+        const score::os::Stat& stat) noexcept;
+
+    SharedMemorySegment(SharedMemorySegment&& other) noexcept;
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(SharedMemorySegment&&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    ~SharedMemorySegment() noexcept;
+
+    score::cpp::span<std::uint8_t> GetMemory() const noexcept;
+
+    const std::string& GetName() const noexcept;
+
+    /// \brief Removes the name of the object. The memory is released once all processes removed their mapping.
+    score::cpp::expected_blank<score::os::Error> Unlink() const noexcept;
+
+    /// \brief Removes the name only if it still refers to the mapped object.
+    ///
+    /// \details A restarted producer replaces the object of the same name by Create(). A drainer of the previous
+    /// producer must not remove the name of the new object, as a drainer of the new producer could no longer open it.
+    /// Thus the device and inode of the object behind the name are compared with the ones of the mapped object, which
+    /// are only known for segments mapped by Open(). The name may still be replaced in between the check and the
+    /// removal, which requires a producer to restart within a few system calls.
+    ///
+    /// \return True if the name was removed, false if it refers to another object or does not exist anymore.
+    score::cpp::expected<bool, score::os::Error> UnlinkIfUnchanged(const score::os::Unistd& unistd,
+                                                               const score::os::Stat& stat) const noexcept;
+
+  private:
+    /// \brief Identifies an object independent of its name.
+    struct ObjectIdentity
+    {
+        std::uint64_t device;
+        std::uint64_t inode;
+    };
+
+    SharedMemorySegment(std::string name,
+                        score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+                        void* const address,
+                        const std::size_t size,
+                        const score::cpp::optional<ObjectIdentity> identity) noexcept;
+
+    static score::cpp::expected<SharedMemorySegment, score::os::Error> Map(
+        const std::string& name,
+        score::cpp::pmr::unique_ptr<score::os::Mman> mman,
+        const std::int32_t file_descriptor,
+        const std::size_t size,
+        const score::cpp::optional<ObjectIdentity> identity) noexcept;
+
+    std::string name_;
+    score::cpp::pmr::unique_ptr<score::os::Mman> mman_;
+    void* address_;
+    std::size_t size_;
+    score::cpp::optional<ObjectIdentity> identity_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_SHARED_MEMORY_SHARED_MEMORY_SEGMENT_H
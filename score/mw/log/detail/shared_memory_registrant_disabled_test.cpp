@@ -0,0 +1,57 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/backend_table.h"
+
+#include "gtest/gtest.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+TEST(SharedMemoryRegistrantTest, SharedMemoryBackendIsNotRegisteredWhenDisabled)
+{
+    RecordProperty("Description",
+                   "The shared memory backend registrant shall not be registered when shared memory logging is "
+                   "disabled.");
+    RecordProperty("TestType", "control-flow-analysis");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    EXPECT_FALSE(IsBackendAvailable(LogMode::kSharedMemory));
+}
+
+TEST(SharedMemoryRegistrantTest, CreateRecorderForModeReturnsNullptrWhenSharedMemoryLoggingDisabled)
+{
+    RecordProperty("Description",
+                   "CreateRecorderForMode shall return nullptr for LogMode::kSharedMemory when shared memory logging "
+                   "is disabled.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    const Configuration config;
+    auto recorder = CreateRecorderForMode(LogMode::kSharedMemory, config, score::cpp::pmr::get_default_resource());
+
+    EXPECT_EQ(recorder, nullptr);
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,64 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/backend_table.h"
+#include "score/mw/log/detail/empty_recorder.h"
+#include "score/mw/log/detail/shared_memory/shared_memory_recorder_factory.h"
+
+#include "gtest/gtest.h"
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+TEST(SharedMemoryRegistrantTest, SharedMemoryBackendIsRegisteredAfterStaticInitialization)
+{
+    RecordProperty("Description",
+                   "The shared memory backend registrant shall be registered for LogMode::kSharedMemory");
+    RecordProperty("TestType", "control-flow-analysis");
+    RecordProperty("DerivationTechnique", "Analysis of functional dependencies");
+
+    EXPECT_TRUE(IsBackendAvailable(LogMode::kSharedMemory));
+}
+
+TEST(SharedMemoryRegistrantTest, SharedMemoryBackendCreatorReturnsBinaryRecorder)
+{
+    RecordProperty("Description",
+                   "The registered shared memory backend shall return a Recorder handing records over in shared "
+                   "memory.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "Analysis of functional dependencies");
+
+    ASSERT_TRUE(IsBackendAvailable(LogMode::kSharedMemory));
+
+    Configuration config;
+    config.SetAppId("SHMR");
+    auto recorder = CreateRecorderForMode(LogMode::kSharedMemory, config, score::cpp::pmr::get_default_resource());
+
+    ASSERT_NE(recorder, nullptr);
+    EXPECT_EQ(dynamic_cast<EmptyRecorder*>(recorder.get()), nullptr);
+    std::ignore =
+        score::os::Mman::Default()->shm_unlink(SharedMemoryRecorderFactory::GetSharedMemoryName("SHMR").c_str());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -14,6 +14,7 @@
 #define SCORE_MW_LOG_DETAIL_SLOT_H
 
 #include <atomic>
+#include <cstddef>
 
 namespace score
 {
@@ -25,8 +26,15 @@ namespace log
 namespace detail
 {
 
+/// Size of a cache line on the supported targets, used to keep independently written data on separate lines.
+constexpr std::size_t kCacheLineSize{64UL};
+
+/// \brief A single element of the CircularAllocator.
+///
+/// \details Every slot starts on its own cache line. Slots are written and flagged by different threads at the same
+/// time, the padding avoids that a producer writing into one slot invalidates the cache line of its neighbour.
 template <typename T>
-class Slot
+class alignas(kCacheLineSize) Slot
 {
   public:
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): false positive, this constructor delegates to another one
@@ -35,14 +35,20 @@ std::unique_ptr<Backend> ConsoleRecorderFactory::CreateConsoleLoggingBackend(
     score::cpp::pmr::memory_resource* memory_resource) noexcept
 {
     auto message_builder = std::make_unique<TextMessageBuilder>(config.GetEcuId());
-    auto allocator = std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
-                                                                    LogRecord{config.GetSlotSizeInBytes()});
+    //  Threads that log in parallel start searching for a free slot in different shards of the allocator:
+    auto allocator =
+        std::make_unique<CircularAllocator<LogRecord>>(config.GetNumberOfSlots(),
+                                                       LogRecord{config.GetSlotSizeInBytes()},
+                                                       GetRecommendedNumberOfShards(config.GetNumberOfSlots()));
 
+    //  Slots queue up while stdout would block, write them out with one writev call per batch once it drains:
+    constexpr std::size_t kMaxSlotsPerBatch = 32UL;
     return std::make_unique<FileOutputBackend>(std::move(message_builder),
                                                STDOUT_FILENO,
                                                std::move(allocator),
                                                score::os::FcntlImpl::Default(memory_resource),
-                                               score::os::Unistd::Default(memory_resource));
+                                               score::os::SysUio::Default(memory_resource),
+                                               kMaxSlotsPerBatch);
 }
 
 }  // namespace detail
@@ -32,10 +32,45 @@ FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_bu
       buffer_allocator_(std::move(allocator)),
       slot_drainer_(std::move(message_builder), buffer_allocator_, file_descriptor, std::move(unistd))
 {
-    const auto flags = fcntl_instance->fcntl(file_descriptor, score::os::Fcntl::Command::kFileGetStatusFlags);
+    SetNonBlocking(file_descriptor, *fcntl_instance);
+}
+
+FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                                     const std::int32_t file_descriptor,
+                                     std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                                     score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                                     const std::size_t max_slots_per_batch) noexcept
+    : Backend(),
+      buffer_allocator_(std::move(allocator)),
+      slot_drainer_(
+          std::move(message_builder), buffer_allocator_, file_descriptor, max_slots_per_batch, std::move(sys_uio))
+{
+    SetNonBlocking(file_descriptor, *fcntl_instance);
+}
+
+FileOutputBackend::FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                                     std::shared_ptr<RotatingFile> rotating_file,
+                                     std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                                     const std::size_t max_slots_per_batch) noexcept
+    : Backend(),
+      buffer_allocator_(std::move(allocator)),
+      slot_drainer_(std::move(message_builder),
+                    buffer_allocator_,
+                    std::move(rotating_file),
+                    max_slots_per_batch,
+                    std::move(sys_uio))
+{
+    //  Regular files never block, the segments are used as opened by the RotatingFile.
+}
+
+void FileOutputBackend::SetNonBlocking(const std::int32_t file_descriptor, score::os::Fcntl& fcntl_instance) noexcept
+{
+    const auto flags = fcntl_instance.fcntl(file_descriptor, score::os::Fcntl::Command::kFileGetStatusFlags);
     if (flags.has_value())
     {
-        std::ignore = fcntl_instance->fcntl(
+        std::ignore = fcntl_instance.fcntl(
             file_descriptor,
             score::os::Fcntl::Command::kFileSetStatusFlags,
             flags.value() | score::os::Fcntl::Open::kNonBlocking | score::os::Fcntl::Open::kCloseOnExec);
@@ -36,6 +36,23 @@ class FileOutputBackend final : public Backend
                       std::unique_ptr<CircularAllocator<LogRecord>> allocator,
                       score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
                       score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+
+    /// \brief Creates a backend that writes the queued slots in batches of up to max_slots_per_batch slots with a
+    /// single writev call each, see SlotDrainer.
+    FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                      const std::int32_t file_descriptor,
+                      std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                      score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                      score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                      const std::size_t max_slots_per_batch) noexcept;
+
+    /// \brief Creates a backend that writes batches like above into the segments of a RotatingFile.
+    FileOutputBackend(std::unique_ptr<IMessageBuilder> message_builder,
+                      std::shared_ptr<RotatingFile> rotating_file,
+                      std::unique_ptr<CircularAllocator<LogRecord>> allocator,
+                      score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                      const std::size_t max_slots_per_batch) noexcept;
+
     /// \brief Before a producer can store data in our buffer, he has to reserve a slot.
     ///
     /// \return SlotHandle if a slot was able to be reserved, empty otherwise.
@@ -60,6 +77,8 @@ class FileOutputBackend final : public Backend
     LogRecord& GetLogRecord(const SlotHandle& slot) noexcept override;
 
   private:
+    void SetNonBlocking(const std::int32_t file_descriptor, score::os::Fcntl& fcntl_instance) noexcept;
+
     // shared with SlotDrainer
     std::shared_ptr<CircularAllocator<LogRecord>> buffer_allocator_;
     SlotDrainer slot_drainer_;
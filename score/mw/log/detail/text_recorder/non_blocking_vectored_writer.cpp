@@ -0,0 +1,112 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
+
+#include <algorithm>
+#include <climits>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+std::size_t NonBlockingVectoredWriter::GetMaxIoVectors() noexcept
+{
+/// \brief Maximum number of iovec entries accepted by writev.
+/// POSIX only guarantees _XOPEN_IOV_MAX (16) if the OS does not provide IOV_MAX.
+// coverity[autosar_cpp14_a16_0_1_violation]
+#if defined IOV_MAX
+    constexpr std::size_t kMaxIoVectorsSupportedByOs = static_cast<std::size_t>(IOV_MAX);
+// coverity[autosar_cpp14_a16_0_1_violation]
+#else
+    constexpr std::size_t kMaxIoVectorsSupportedByOs = 16UL;
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+    return kMaxIoVectorsSupportedByOs;
+}
+
+NonBlockingVectoredWriter::NonBlockingVectoredWriter(const std::int32_t file_handle,
+                                                     score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept
+    : sys_uio_{std::move(sys_uio)}, file_handle_{file_handle}, io_vectors_{}
+{
+}
+
+void NonBlockingVectoredWriter::SetIoVectors(const score::cpp::span<struct iovec> io_vectors) noexcept
+{
+    io_vectors_ = io_vectors;
+    SkipEmptyIoVectors();
+}
+
+void NonBlockingVectoredWriter::SetFileHandle(const std::int32_t file_handle) noexcept
+{
+    file_handle_ = file_handle;
+}
+
+score::cpp::expected<NonBlockingVectoredWriter::Result, score::mw::log::detail::Error>
+NonBlockingVectoredWriter::FlushIntoFile() noexcept
+{
+    if (io_vectors_.size() == 0UL)
+    {
+        return Result::kDone;
+    }
+
+    const auto count = std::min(static_cast<std::size_t>(io_vectors_.size()), GetMaxIoVectors());
+    // count is limited by IOV_MAX which is an int:
+    const auto written = sys_uio_->writev(file_handle_, io_vectors_.data(), static_cast<std::int32_t>(count));
+    if (!written.has_value())
+    {
+        return score::cpp::make_unexpected(score::mw::log::detail::Error::kUnknownError);
+    }
+
+    Advance(static_cast<std::size_t>(written.value()));
+    return (io_vectors_.size() == 0UL) ? Result::kDone : Result::kWouldBlock;
+}
+
+void NonBlockingVectoredWriter::Advance(std::size_t number_of_written_bytes) noexcept
+{
+    while ((number_of_written_bytes > 0UL) && (io_vectors_.size() > 0UL))
+    {
+        auto& front = io_vectors_[0UL];
+        if (number_of_written_bytes < front.iov_len)
+        {
+            //  The write stopped inside of this buffer, continue from the first byte that was not written:
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) iov_base points to an array
+            front.iov_base = static_cast<std::uint8_t*>(front.iov_base) + number_of_written_bytes;
+            front.iov_len -= number_of_written_bytes;
+            number_of_written_bytes = 0UL;
+        }
+        else
+        {
+            number_of_written_bytes -= front.iov_len;
+            io_vectors_ = io_vectors_.subspan(1UL);
+        }
+    }
+    SkipEmptyIoVectors();
+}
+
+void NonBlockingVectoredWriter::SkipEmptyIoVectors() noexcept
+{
+    while ((io_vectors_.size() > 0UL) && (io_vectors_[0UL].iov_len == 0UL))
+    {
+        io_vectors_ = io_vectors_.subspan(1UL);
+    }
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -0,0 +1,83 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
+#define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
+
+#include "score/os/sys_uio.h"
+#include "score/mw/log/detail/error.h"
+
+#include <score/span.hpp>
+
+#include <cstdint>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief NonBlockingVectoredWriter Class to write a batch of buffers into a file with a single system call.
+///
+/// \details This is the gathering counterpart of NonBlockingWriter. It uses the writev system call to write all
+/// buffers described by an array of iovec in one go. If the file descriptor accepts only a part of the data, the
+/// iovec array is advanced in place, so that the next FlushIntoFile() call continues with the first byte that was not
+/// written yet, even if this is in the middle of a buffer.
+class NonBlockingVectoredWriter final
+{
+  public:
+    enum class Result : std::uint8_t
+    {
+        kWouldBlock = 0,
+        kDone,
+    };
+
+    /// \brief Returns the maximum number of iovec entries that are passed to one writev call.
+    static std::size_t GetMaxIoVectors() noexcept;
+
+    explicit NonBlockingVectoredWriter(const std::int32_t file_handle,
+                                       score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio) noexcept;
+
+    /// \brief Sets the buffers that shall be written by the following FlushIntoFile() calls.
+    ///
+    /// \details The writer does not copy the iovec array. The array and the memory it points to must stay valid and
+    /// unchanged until FlushIntoFile() returned Result::kDone. The array is modified to track partial writes.
+    void SetIoVectors(const score::cpp::span<struct iovec> io_vectors) noexcept;
+
+    /// \brief Sets the file that the following FlushIntoFile() calls write into.
+    ///
+    /// \details Shall only be called once all data was written, otherwise the remaining data ends up in the new file.
+    void SetFileHandle(const std::int32_t file_handle) noexcept;
+
+    /// \brief Writes as much of the remaining data as the file accepts with a single writev call.
+    ///
+    /// \return Result::kDone when all the data has been written, Result::kWouldBlock if there is data left.
+    score::cpp::expected<Result, score::mw::log::detail::Error> FlushIntoFile() noexcept;
+
+  private:
+    void Advance(std::size_t number_of_written_bytes) noexcept;
+    void SkipEmptyIoVectors() noexcept;
+
+    score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio_;
+    std::int32_t file_handle_;
+    score::cpp::span<struct iovec> io_vectors_;  // the part of the iovec array that is not flushed yet.
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_TEXT_RECORDER_NON_BLOCKING_VECTORED_WRITER_H
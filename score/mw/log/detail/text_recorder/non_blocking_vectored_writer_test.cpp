@@ -0,0 +1,216 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
+
+#include "score/os/mocklib/sys_uio_mock.h"
+
+#include "gtest/gtest.h"
+
+#include <array>
+#include <vector>
+
+using ::testing::_;
+using ::testing::Return;
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+struct NonBlockingVectoredWriterTestFixture : ::testing::Test
+{
+    void SetUp() override
+    {
+        auto sys_uio = score::cpp::pmr::make_unique<score::os::SysUioMock>(score::cpp::pmr::get_default_resource());
+        sys_uio_ = sys_uio.get();
+        writer_ = std::make_unique<NonBlockingVectoredWriter>(kFileDescriptor, std::move(sys_uio));
+
+        for (std::size_t i = 0UL; i < io_vectors_.size(); ++i)
+        {
+            io_vectors_.at(i).iov_base = buffers_.at(i).data();
+            io_vectors_.at(i).iov_len = buffers_.at(i).size();
+        }
+    }
+
+    void TearDown() override
+    {
+        writer_.reset();
+        sys_uio_ = nullptr;
+    }
+
+    score::cpp::span<struct iovec> IoVectors() noexcept
+    {
+        return {io_vectors_.data(), static_cast<score::cpp::span<struct iovec>::size_type>(io_vectors_.size())};
+    }
+
+  protected:
+    static constexpr std::int32_t kFileDescriptor{42};
+
+    std::unique_ptr<NonBlockingVectoredWriter> writer_;
+    score::os::SysUioMock* sys_uio_{};
+
+    std::array<std::array<std::uint8_t, 8UL>, 3UL> buffers_{};
+    std::array<struct iovec, 3UL> io_vectors_{};
+};
+
+TEST_F(NonBlockingVectoredWriterTestFixture, WritesAllBuffersWithOneCall)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "All buffers are written with a single writev call if the file accepts all data.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    writer_->SetIoVectors(IoVectors());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, io_vectors_.data(), 3)).WillOnce(Return(24));
+
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, ResumesPartialWriteInTheMiddleOfABuffer)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "After a partial write that ended inside of a buffer, the next call starts at the first byte that "
+                   "was not written.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    writer_->SetIoVectors(IoVectors());
+
+    //  Given the first call only writes the first buffer and three bytes of the second one
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, io_vectors_.data(), 3)).WillOnce(Return(11));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kWouldBlock, writer_->FlushIntoFile().value());
+
+    //  Then the next call starts with the remaining five bytes of the second buffer
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, &io_vectors_.at(1UL), 2))
+        .WillOnce([this](const std::int32_t, const struct iovec* io_vectors, const std::int32_t) {
+            EXPECT_EQ(io_vectors[0].iov_base, &buffers_.at(1UL).at(3UL));
+            EXPECT_EQ(io_vectors[0].iov_len, 5UL);
+            EXPECT_EQ(io_vectors[1].iov_base, buffers_.at(2UL).data());
+            EXPECT_EQ(io_vectors[1].iov_len, 8UL);
+            return 13;
+        });
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, ResumesPartialWriteAtABufferBoundary)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "After a partial write that ended exactly at the end of a buffer, the next call starts with the "
+                   "next buffer.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    writer_->SetIoVectors(IoVectors());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, io_vectors_.data(), 3)).WillOnce(Return(16));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kWouldBlock, writer_->FlushIntoFile().value());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, &io_vectors_.at(2UL), 1)).WillOnce(Return(8));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, SkipsEmptyBuffers)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Empty buffers are not passed to writev and nothing is written if all are empty.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    //  Given the first and the last buffer are empty
+    io_vectors_.at(0UL).iov_len = 0UL;
+    io_vectors_.at(2UL).iov_len = 0UL;
+    writer_->SetIoVectors(IoVectors());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, &io_vectors_.at(1UL), 2)).WillOnce(Return(8));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+
+    //  When there is nothing left, then writev is not called at all
+    EXPECT_CALL(*sys_uio_, writev(_, _, _)).Times(0);
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, LimitsNumberOfBuffersPerCall)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "No more than GetMaxIoVectors() buffers are passed to one writev call.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    //  Given more buffers than writev accepts
+    const std::size_t max_io_vectors = NonBlockingVectoredWriter::GetMaxIoVectors();
+    std::array<std::uint8_t, 1UL> byte{};
+    std::vector<struct iovec> io_vectors(max_io_vectors + 1UL, iovec{byte.data(), byte.size()});
+    writer_->SetIoVectors(
+        {io_vectors.data(), static_cast<score::cpp::span<struct iovec>::size_type>(io_vectors.size())});
+
+    //  Then the data is written with two calls
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, io_vectors.data(), static_cast<std::int32_t>(max_io_vectors)))
+        .WillOnce(Return(static_cast<std::int64_t>(max_io_vectors)));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kWouldBlock, writer_->FlushIntoFile().value());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, &io_vectors.at(max_io_vectors), 1)).WillOnce(Return(1));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, ReturnsErrorIfWriteFails)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "An error of writev is reported and the data is retried with the next call.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "error-guessing");
+
+    writer_->SetIoVectors(IoVectors());
+
+    EXPECT_CALL(*sys_uio_, writev(kFileDescriptor, io_vectors_.data(), 3))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN))))
+        .WillOnce(Return(24));
+
+    const auto result = writer_->FlushIntoFile();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::kUnknownError);
+
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+TEST_F(NonBlockingVectoredWriterTestFixture, WritesIntoTheFileSetLast)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "After the file handle was changed, the following buffers go to the new file.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    constexpr std::int32_t kOtherFileDescriptor{43};
+
+    //  Given a writer that switched to another file
+    writer_->SetFileHandle(kOtherFileDescriptor);
+    writer_->SetIoVectors(IoVectors());
+
+    //  Then the buffers are written into the other file
+    EXPECT_CALL(*sys_uio_, writev(kOtherFileDescriptor, io_vectors_.data(), 3)).WillOnce(Return(24));
+    EXPECT_EQ(NonBlockingVectoredWriter::Result::kDone, writer_->FlushIntoFile().value());
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
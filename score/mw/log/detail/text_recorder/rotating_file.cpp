@@ -0,0 +1,240 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/rotating_file.h"
+
+#include <algorithm>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+namespace
+{
+
+constexpr std::size_t kMinSegmentCount{3UL};
+constexpr std::int32_t kNoFileDescriptor{-1};
+
+RotatingFileSettings WithValidSegmentCount(RotatingFileSettings settings) noexcept
+{
+    //  The next segment replaces the oldest one when it is prepared. With less than three segments, that is the one
+    //  that is currently written or the one that was just closed:
+    settings.segment_count = std::max(settings.segment_count, kMinSegmentCount);
+    return settings;
+}
+
+}  // namespace
+
+RotatingFile::RotatingFile(RotatingFileSettings settings,
+                           score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                           score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept
+    : settings_{WithValidSegmentCount(std::move(settings))},
+      fcntl_{std::move(fcntl_instance)},
+      unistd_{std::move(unistd)},
+      current_segment_{kNoFileDescriptor, 0UL, 0UL},
+      mutex_{},
+      condition_{},
+      next_segment_{},
+      closed_segment_{},
+      next_segment_requested_{false},
+      next_segment_index_{0UL},
+      stop_requested_{false},
+      worker_{}
+{
+}
+
+RotatingFile::~RotatingFile()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        stop_requested_ = true;
+    }
+    condition_.notify_all();
+    if (worker_.joinable())
+    {
+        worker_.join();
+    }
+
+    if (closed_segment_.has_value())
+    {
+        CloseSegment(closed_segment_.value());
+    }
+    if (next_segment_.has_value())
+    {
+        //  Never written, only the header would remain:
+        std::ignore = unistd_->close(next_segment_.value().file_descriptor);
+        std::ignore = unistd_->unlink(GetSegmentPath(settings_, next_segment_.value().index).c_str());
+    }
+    if (current_segment_.file_descriptor != kNoFileDescriptor)
+    {
+        CloseSegment(current_segment_);
+    }
+}
+
+score::cpp::expected_blank<Error> RotatingFile::Open() noexcept
+{
+    const auto first_segment = CreateSegment(0UL);
+    if (!first_segment.has_value())
+    {
+        return score::cpp::make_unexpected(Error::kLogFileCreationFailed);
+    }
+    current_segment_ = first_segment.value();
+
+    //  Prepare the second segment right away, the background thread owns the handover state from now on:
+    next_segment_requested_ = true;
+    next_segment_index_ = 1UL;
+    worker_ = score::cpp::jthread{[this]() noexcept {
+        Run();
+    }};
+    return {};
+}
+
+std::int32_t RotatingFile::GetFileDescriptor() const noexcept
+{
+    return current_segment_.file_descriptor;
+}
+
+bool RotatingFile::OnWritten(const std::size_t number_of_bytes) noexcept
+{
+    current_segment_.size += number_of_bytes;
+    if (current_segment_.size < settings_.segment_size)
+    {
+        return false;
+    }
+
+    bool switched{false};
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        if (next_segment_.has_value() && (!closed_segment_.has_value()))
+        {
+            closed_segment_ = current_segment_;
+            current_segment_ = next_segment_.value();
+            next_segment_.reset();
+            next_segment_requested_ = true;
+            next_segment_index_ = current_segment_.index + 1UL;
+            switched = true;
+        }
+        else if ((!next_segment_.has_value()) && (!next_segment_requested_))
+        {
+            //  Creating the next segment failed before, try again:
+            next_segment_requested_ = true;
+        }
+        else
+        {
+            //  Still in preparation, keep writing into the current segment and try again after the next write:
+            return false;
+        }
+    }
+    condition_.notify_one();
+    return switched;
+}
+
+std::string RotatingFile::GetSegmentPath(const RotatingFileSettings& settings, const std::size_t segment_index)
+{
+    const auto segment_count = std::max(settings.segment_count, kMinSegmentCount);
+    std::string path{settings.path_prefix};
+    path.append(".").append(std::to_string(segment_index % segment_count)).append(settings.extension);
+    return path;
+}
+
+score::cpp::optional<RotatingFile::Segment> RotatingFile::CreateSegment(const std::size_t segment_index) noexcept
+{
+    const auto path = GetSegmentPath(settings_, segment_index);
+    const auto open_flags = score::os::Fcntl::Open::kWriteOnly | score::os::Fcntl::Open::kCreate |
+                            score::os::Fcntl::Open::kTruncate | score::os::Fcntl::Open::kCloseOnExec;
+    const auto access_rights =
+        score::os::Stat::Mode::kReadUser | score::os::Stat::Mode::kWriteUser | score::os::Stat::Mode::kReadGroup;
+    const auto file_descriptor = fcntl_->open(path.c_str(), open_flags, access_rights);
+    if (!file_descriptor.has_value())
+    {
+        return {};
+    }
+
+    //  Reserve the blocks of the whole segment at once. This keeps the segment contiguous on disk and the writer does
+    //  not allocate blocks. Not all file systems support it, the segment then grows as usual:
+    std::ignore = fcntl_->posix_fallocate(file_descriptor.value(), 0, static_cast<off_t>(settings_.segment_size));
+
+    std::size_t written_header_bytes{0UL};
+    while (written_header_bytes < settings_.segment_header.size())
+    {
+        const auto written = unistd_->write(file_descriptor.value(),
+                                            &settings_.segment_header.at(written_header_bytes),
+                                            settings_.segment_header.size() - written_header_bytes);
+        if ((!written.has_value()) || (written.value() <= 0))
+        {
+            std::ignore = unistd_->close(file_descriptor.value());
+            return {};
+        }
+        written_header_bytes += static_cast<std::size_t>(written.value());
+    }
+    return Segment{file_descriptor.value(), segment_index, written_header_bytes};
+}
+
+void RotatingFile::CloseSegment(const Segment& segment) noexcept
+{
+    //  Cut off the preallocated space that was not written:
+    std::ignore = unistd_->ftruncate(segment.file_descriptor, static_cast<off_t>(segment.size));
+    if (settings_.sync_closed_segments)
+    {
+        std::ignore = unistd_->fsync(segment.file_descriptor);
+    }
+    std::ignore = unistd_->close(segment.file_descriptor);
+}
+
+void RotatingFile::Run() noexcept
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true)
+    {
+        condition_.wait(lock, [this]() noexcept {
+            return stop_requested_ || closed_segment_.has_value() || next_segment_requested_;
+        });
+        if (stop_requested_)
+        {
+            return;
+        }
+
+        const auto closed_segment = closed_segment_;
+        closed_segment_.reset();
+        const bool create_next_segment = next_segment_requested_;
+        const auto next_segment_index = next_segment_index_;
+        lock.unlock();
+
+        if (closed_segment.has_value())
+        {
+            CloseSegment(closed_segment.value());
+        }
+        score::cpp::optional<Segment> next_segment{};
+        if (create_next_segment)
+        {
+            next_segment = CreateSegment(next_segment_index);
+        }
+
+        lock.lock();
+        if (create_next_segment)
+        {
+            //  On failure, the writer requests the segment again after its next write:
+            next_segment_ = next_segment;
+            next_segment_requested_ = false;
+        }
+    }
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
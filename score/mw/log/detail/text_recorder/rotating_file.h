@@ -0,0 +1,152 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_TEXT_RECORDER_ROTATING_FILE_H
+#define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_ROTATING_FILE_H
+
+#include "score/mw/log/detail/error.h"
+
+#include "score/os/fcntl.h"
+#include "score/os/unistd.h"
+
+#include <score/expected.hpp>
+#include <score/jthread.hpp>
+#include <score/optional.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/*
+Deviation from Rule M11-0-1:
+- Member data in non-POD class types shall be private.
+Justification:
+- The type is a plain collection of settings without invariants.
+*/
+// coverity[autosar_cpp14_m11_0_1_violation]
+struct RotatingFileSettings
+{
+    /// \brief Segment i is named "<path_prefix>.<i % segment_count><extension>".
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::string path_prefix{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::string extension{};
+    /// \brief A segment is closed once this many bytes were written into it.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t segment_size{};
+    /// \brief Number of segments that are kept on disk, including the one prepared ahead of time. At least three.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t segment_count{};
+    /// \brief Whether a closed segment is synchronized to the storage device before it is closed.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    bool sync_closed_segments{};
+    /// \brief Data written at the beginning of every segment, e.g. a file header.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::vector<std::uint8_t> segment_header{};
+};
+
+/// \brief RotatingFile Class to spread a log file over a bounded number of preallocated segments.
+///
+/// \details The writer appends to the file descriptor of the current segment and reports the written bytes with
+/// OnWritten(). Once the segment size is reached, the writer switches to the next segment. The disk footprint is thus
+/// bounded by segment_count segments of segment_size bytes, plus the data of the last write that crossed the limit.
+///
+/// All work that may block on the file system is done by a background thread: it creates the next segment ahead of
+/// time, preallocates it with posix_fallocate and writes the segment header. A closed segment is truncated to the
+/// written size, optionally synchronized, and closed there as well. The writer only swaps file descriptors under a
+/// short lock. If the next segment is not ready in time, or could not be created, the writer stays in the current
+/// segment and tries to switch again after its next write.
+///
+/// Segment names are reused round-robin, so creating segment i replaces the oldest segment i - segment_count. Since
+/// the next segment is prepared ahead of time, segment_count - 2 closed segments are kept besides the current one.
+class RotatingFile final
+{
+  public:
+    RotatingFile(RotatingFileSettings settings,
+                 score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_instance,
+                 score::cpp::pmr::unique_ptr<score::os::Unistd> unistd) noexcept;
+
+    RotatingFile(RotatingFile&&) noexcept = delete;
+    RotatingFile(const RotatingFile&) noexcept = delete;
+    RotatingFile& operator=(RotatingFile&&) noexcept = delete;
+    RotatingFile& operator=(const RotatingFile&) noexcept = delete;
+
+    /// \brief Stops the background thread and closes all segments, the current one truncated to the written size.
+    ~RotatingFile();
+
+    /// \brief Creates the first segment and starts the background thread.
+    ///
+    /// \return An error if the first segment could not be created. The file must not be used then.
+    score::cpp::expected_blank<Error> Open() noexcept;
+
+    /// \brief Returns the file descriptor of the segment that is currently written.
+    std::int32_t GetFileDescriptor() const noexcept;
+
+    /// \brief Accounts number_of_bytes written into the current segment and switches to the next segment if the
+    /// current one is full.
+    ///
+    /// \details Must only be called by the single writer of the file, i.e. not concurrently to itself.
+    ///
+    /// \return True if the writer switched to another segment, i.e. GetFileDescriptor() changed.
+    bool OnWritten(const std::size_t number_of_bytes) noexcept;
+
+    /// \brief Returns the path of the segment with the given index.
+    static std::string GetSegmentPath(const RotatingFileSettings& settings, const std::size_t segment_index);
+
+  private:
+    struct Segment
+    {
+        std::int32_t file_descriptor;
+        std::size_t index;
+        std::size_t size;
+    };
+
+    score::cpp::optional<Segment> CreateSegment(const std::size_t segment_index) noexcept;
+    void CloseSegment(const Segment& segment) noexcept;
+    void Run() noexcept;
+
+    const RotatingFileSettings settings_;
+    score::cpp::pmr::unique_ptr<score::os::Fcntl> fcntl_;
+    score::cpp::pmr::unique_ptr<score::os::Unistd> unistd_;
+
+    //  Only accessed by the writer:
+    Segment current_segment_;
+
+    //  Handed over between the writer and the background thread:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    score::cpp::optional<Segment> next_segment_;
+    score::cpp::optional<Segment> closed_segment_;
+    bool next_segment_requested_;
+    std::size_t next_segment_index_;
+    bool stop_requested_;
+
+    score::cpp::jthread worker_;
+};
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_TEXT_RECORDER_ROTATING_FILE_H
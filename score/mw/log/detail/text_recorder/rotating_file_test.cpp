@@ -0,0 +1,278 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/text_recorder/rotating_file.h"
+
+#include "score/os/mocklib/fcntl_mock.h"
+#include "score/os/mocklib/unistdmock.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Return;
+
+constexpr std::string_view kHeader{"HEAD"};
+constexpr std::size_t kSegmentSize{32UL};
+
+class RotatingFileFixture : public ::testing::Test
+{
+  public:
+    void SetUp() override
+    {
+        settings_.path_prefix = ::testing::TempDir() + "/rotating_file_test";
+        settings_.extension = ".log";
+        settings_.segment_size = kSegmentSize;
+        settings_.segment_count = 3UL;
+        settings_.segment_header.assign(kHeader.begin(), kHeader.end());
+        for (std::size_t index = 0UL; index < settings_.segment_count; ++index)
+        {
+            std::ignore = ::unlink(RotatingFile::GetSegmentPath(settings_, index).c_str());
+        }
+    }
+
+    std::unique_ptr<RotatingFile> CreateFile() const
+    {
+        return std::make_unique<RotatingFile>(
+            settings_, score::os::Fcntl::Default(memory_resource_), score::os::Unistd::Default(memory_resource_));
+    }
+
+    std::string ReadSegment(const std::size_t index) const
+    {
+        std::ifstream file{RotatingFile::GetSegmentPath(settings_, index), std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    bool SegmentExists(const std::size_t index) const
+    {
+        //  Not using GetSegmentPath() since it maps indices beyond the segment count onto existing segments:
+        const auto path = settings_.path_prefix + "." + std::to_string(index) + settings_.extension;
+        return ::access(path.c_str(), F_OK) == 0;
+    }
+
+    /// Returns whether the writer switched to the next segment.
+    static bool Write(RotatingFile& file, const std::string_view data)
+    {
+        EXPECT_EQ(::write(file.GetFileDescriptor(), data.data(), data.size()), static_cast<ssize_t>(data.size()));
+        return file.OnWritten(data.size());
+    }
+
+    /// Fills the segment and retries the switch until the background thread prepared the next segment.
+    static bool WriteUntilSwitched(RotatingFile& file, const std::string_view data)
+    {
+        return Write(file, data) || WaitForSwitch(file);
+    }
+
+    static bool WaitForSwitch(RotatingFile& file)
+    {
+        for (std::size_t attempt = 0UL; attempt < 5000UL; ++attempt)
+        {
+            if (file.OnWritten(0UL))
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return false;
+    }
+
+  protected:
+    RotatingFileSettings settings_{};
+    score::cpp::pmr::memory_resource* memory_resource_{score::cpp::pmr::get_default_resource()};
+};
+
+TEST_F(RotatingFileFixture, SegmentPathShallContainTheSegmentIndexModuloTheSegmentCount)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Segment names shall be reused round-robin.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    settings_.path_prefix = "/var/log/APP1";
+    settings_.segment_count = 3UL;
+
+    EXPECT_EQ(RotatingFile::GetSegmentPath(settings_, 0UL), "/var/log/APP1.0.log");
+    EXPECT_EQ(RotatingFile::GetSegmentPath(settings_, 2UL), "/var/log/APP1.2.log");
+    EXPECT_EQ(RotatingFile::GetSegmentPath(settings_, 4UL), "/var/log/APP1.1.log");
+}
+
+TEST_F(RotatingFileFixture, SegmentCountShallBeAtLeastThree)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "The segment that is prepared shall neither replace the segment that is written nor the one that "
+                   "was closed last.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Boundary value analysis");
+
+    settings_.path_prefix = "/var/log/APP1";
+    settings_.segment_count = 1UL;
+
+    EXPECT_EQ(RotatingFile::GetSegmentPath(settings_, 2UL), "/var/log/APP1.2.log");
+}
+
+TEST_F(RotatingFileFixture, OpenShallFailIfFirstSegmentCannotBeCreated)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Open shall report an error if the first segment cannot be created.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    settings_.path_prefix = ::testing::TempDir() + "/not_existing_directory/rotating_file_test";
+    const auto file = CreateFile();
+
+    const auto result = file->Open();
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::kLogFileCreationFailed);
+}
+
+TEST_F(RotatingFileFixture, SegmentsShallStartWithHeaderAndBeTruncatedToWrittenSize)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Every segment shall start with the header and end with the last written byte, once the writer "
+                   "switched to the next segment because the size limit was reached.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    {
+        // Given an open file
+        const auto file = CreateFile();
+        ASSERT_TRUE(file->Open().has_value());
+        const auto first_file_descriptor = file->GetFileDescriptor();
+
+        // When writing below and then beyond the size limit of a segment
+        EXPECT_FALSE(Write(*file, "0123456789"));
+        EXPECT_EQ(file->GetFileDescriptor(), first_file_descriptor);
+        ASSERT_TRUE(WriteUntilSwitched(*file, "abcdefghijklmnopqrstuvwxyz"));
+
+        // Then the writer continues in another segment
+        EXPECT_NE(file->GetFileDescriptor(), first_file_descriptor);
+        EXPECT_FALSE(Write(*file, "next"));
+    }
+
+    EXPECT_EQ(ReadSegment(0UL), "HEAD0123456789abcdefghijklmnopqrstuvwxyz");
+    EXPECT_EQ(ReadSegment(1UL), "HEADnext");
+}
+
+TEST_F(RotatingFileFixture, OldestSegmentShallBeReplacedOnceSegmentCountIsReached)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "No more than the configured number of segments shall be kept on disk.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    {
+        // Given an open file with three segments
+        const auto file = CreateFile();
+        ASSERT_TRUE(file->Open().has_value());
+
+        // When filling four segments
+        ASSERT_TRUE(WriteUntilSwitched(*file, "first segment of the rotating file"));
+        ASSERT_TRUE(WriteUntilSwitched(*file, "second segment of the rotating file"));
+        ASSERT_TRUE(WriteUntilSwitched(*file, "third segment of the rotating file"));
+        EXPECT_FALSE(Write(*file, "fourth"));
+    }
+
+    // Then the fourth segment replaced the first one
+    EXPECT_EQ(ReadSegment(0UL), "HEADfourth");
+    EXPECT_EQ(ReadSegment(2UL), "HEADthird segment of the rotating file");
+    EXPECT_FALSE(SegmentExists(3UL));
+}
+
+TEST_F(RotatingFileFixture, PreparedSegmentShallBeRemovedIfNeverWritten)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "A segment that was prepared but never written shall not be left behind.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Error guessing based on knowledge or experience");
+
+    {
+        const auto file = CreateFile();
+        ASSERT_TRUE(file->Open().has_value());
+        EXPECT_FALSE(Write(*file, "data"));
+    }
+
+    EXPECT_EQ(ReadSegment(0UL), "HEADdata");
+    EXPECT_FALSE(SegmentExists(1UL));
+}
+
+TEST_F(RotatingFileFixture, SegmentsShallBePreallocatedAndSynchronizedIfConfigured)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Segments shall be preallocated to the segment size. Closed segments shall be truncated to the "
+                   "written size and synchronized if configured.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "Analysis of requirements");
+
+    constexpr std::int32_t kFirstFileDescriptor{10};
+    constexpr std::int32_t kSecondFileDescriptor{11};
+    constexpr std::int32_t kThirdFileDescriptor{12};
+    settings_.sync_closed_segments = true;
+
+    auto fcntl_mock = score::cpp::pmr::make_unique<score::os::FcntlMock>(memory_resource_);
+    auto unistd_mock = score::cpp::pmr::make_unique<score::os::UnistdMock>(memory_resource_);
+    EXPECT_CALL(*fcntl_mock, open(_, _, _))
+        .WillOnce(Return(kFirstFileDescriptor))
+        .WillOnce(Return(kSecondFileDescriptor))
+        .WillRepeatedly(Return(kThirdFileDescriptor));
+    EXPECT_CALL(*fcntl_mock, posix_fallocate(_, 0, static_cast<off_t>(kSegmentSize)))
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*unistd_mock, write(_, _, kHeader.size())).WillRepeatedly(Return(static_cast<ssize_t>(kHeader.size())));
+    EXPECT_CALL(*unistd_mock, ftruncate(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*unistd_mock, fsync(_)).Times(AnyNumber());
+    EXPECT_CALL(*unistd_mock, close(_)).Times(AnyNumber());
+    EXPECT_CALL(*unistd_mock, unlink(_)).Times(AnyNumber());
+
+    // Expecting both written segments to be truncated to their size and synchronized
+    constexpr std::size_t kWrittenBytes{40UL};
+    EXPECT_CALL(*unistd_mock, ftruncate(kFirstFileDescriptor, static_cast<off_t>(kHeader.size() + kWrittenBytes)));
+    EXPECT_CALL(*unistd_mock, fsync(kFirstFileDescriptor));
+    EXPECT_CALL(*unistd_mock, ftruncate(kSecondFileDescriptor, static_cast<off_t>(kHeader.size())));
+    EXPECT_CALL(*unistd_mock, fsync(kSecondFileDescriptor));
+
+    {
+        RotatingFile file{settings_, std::move(fcntl_mock), std::move(unistd_mock)};
+        ASSERT_TRUE(file.Open().has_value());
+        ASSERT_TRUE(file.OnWritten(kWrittenBytes) || WaitForSwitch(file));
+        EXPECT_EQ(file.GetFileDescriptor(), kSecondFileDescriptor);
+    }
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
@@ -13,6 +13,7 @@
 #include "score/mw/log/detail/text_recorder/slot_drainer.h"
 
 #include <algorithm>
+#include <functional>
 
 namespace score
 {
@@ -23,6 +24,27 @@ namespace log
 namespace detail
 {
 
+namespace
+{
+
+//  Expected number of bytes per slot that are not part of the LogRecord, e.g. the header of a text message:
+constexpr std::size_t kReservedStagingBytesPerSlot = 512UL;
+//  Expected number of spans per slot, e.g. header and payload of a text message:
+constexpr std::size_t kReservedIoVectorsPerSlot = 2UL;
+
+bool IsPartOfLogRecord(const score::cpp::span<const std::uint8_t> span, const LogRecord& log_record) noexcept
+{
+    const auto& buffer = log_record.GetLogEntry().payload;
+    const std::less<const void*> less{};
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) comparing the bounds of arrays
+    const auto* const buffer_end = buffer.data() + buffer.capacity();
+    const auto* const span_end = span.data() + span.size();
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic) comparing the bounds of arrays
+    return (!less(span.data(), buffer.data())) && (!less(buffer_end, span_end));
+}
+
+}  // namespace
+
 SlotDrainer::SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
                          std::shared_ptr<CircularAllocator<LogRecord>> allocator,
                          const std::int32_t file_descriptor,
@@ -30,9 +52,53 @@ SlotDrainer::SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
                          const std::size_t limit_slots_in_one_cycle)
     : allocator_(allocator),
       message_builder_(std::move(message_builder)),
-      non_blocking_writer_(file_descriptor, NonBlockingWriter::GetMaxChunkSize(), std::move(unistd)),
-      limit_slots_in_one_cycle_(limit_slots_in_one_cycle)
+      non_blocking_writer_(score::cpp::in_place,
+                           file_descriptor,
+                           NonBlockingWriter::GetMaxChunkSize(),
+                           std::move(unistd)),
+      vectored_writer_{},
+      limit_slots_in_one_cycle_(limit_slots_in_one_cycle),
+      max_slots_per_batch_{0UL},
+      batch_size_in_bytes_{0UL},
+      rotating_file_{}
+{
+}
+
+SlotDrainer::SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
+                         std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                         const std::int32_t file_descriptor,
+                         const std::size_t max_slots_per_batch,
+                         score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                         const std::size_t limit_slots_in_one_cycle)
+    : allocator_(allocator),
+      message_builder_(std::move(message_builder)),
+      non_blocking_writer_{},
+      vectored_writer_(score::cpp::in_place, file_descriptor, std::move(sys_uio)),
+      limit_slots_in_one_cycle_(limit_slots_in_one_cycle),
+      max_slots_per_batch_{std::clamp(max_slots_per_batch, 1UL, kMaxCircularBufferSize)},
+      batch_size_in_bytes_{0UL},
+      rotating_file_{}
+{
+    //  Allocate up front, so that the usual batch can be gathered without memory allocations:
+    batch_slots_.reserve(max_slots_per_batch_);
+    batch_io_vectors_.reserve(max_slots_per_batch_ * kReservedIoVectorsPerSlot);
+    batch_staging_buffer_.reserve(max_slots_per_batch_ * kReservedStagingBytesPerSlot);
+}
+
+SlotDrainer::SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
+                         std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                         std::shared_ptr<RotatingFile> rotating_file,
+                         const std::size_t max_slots_per_batch,
+                         score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                         const std::size_t limit_slots_in_one_cycle)
+    : SlotDrainer(std::move(message_builder),
+                  std::move(allocator),
+                  rotating_file->GetFileDescriptor(),
+                  max_slots_per_batch,
+                  std::move(sys_uio),
+                  limit_slots_in_one_cycle)
 {
+    rotating_file_ = std::move(rotating_file);
 }
 
 bool SlotDrainer::MoreSpansAvailableAndLoaded() noexcept
@@ -41,7 +107,7 @@ bool SlotDrainer::MoreSpansAvailableAndLoaded() noexcept
     const auto span = message_builder_->GetNextSpan();
     if (span.has_value())
     {
-        non_blocking_writer_.SetSpan(span.value());
+        non_blocking_writer_->SetSpan(span.value());
         return true;
     }
     return false;
@@ -52,7 +118,7 @@ score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> Sl
     do
     {
         //  First try to flush remaining data from previous cycle:
-        const auto status = non_blocking_writer_.FlushIntoFile();
+        const auto status = non_blocking_writer_->FlushIntoFile();
         if (status.has_value())
         {
             if (status.value() != NonBlockingWriter::Result::kDone)
@@ -115,6 +181,120 @@ score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> Sl
     return FlushResult::kAllDataProcessed;
 }
 
+void SlotDrainer::AddSpanToBatch(const score::cpp::span<const std::uint8_t> span, const LogRecord& log_record) noexcept
+{
+    if (span.size() == 0UL)
+    {
+        return;
+    }
+
+    struct iovec io_vector{};
+    io_vector.iov_len = static_cast<std::size_t>(span.size());
+    if (IsPartOfLogRecord(span, log_record))
+    {
+        //  The slot is only released after the batch was written, so the span stays valid until then:
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) writev does not modify the buffer
+        io_vector.iov_base = const_cast<std::uint8_t*>(span.data());
+    }
+    else
+    {
+        //  The span may be reused by the message builder for the next message, so keep a copy of it. iov_base is set
+        //  once the batch is complete, because the staging buffer may still grow until then:
+        io_vector.iov_base = nullptr;
+        batch_staging_buffer_.insert(batch_staging_buffer_.end(), span.begin(), span.end());
+    }
+    batch_io_vectors_.push_back(io_vector);
+}
+
+bool SlotDrainer::MoreBatchesAvailableAndLoaded() noexcept
+{
+    batch_slots_.clear();
+    batch_io_vectors_.clear();
+    batch_staging_buffer_.clear();
+    batch_size_in_bytes_ = 0UL;
+
+    while ((batch_slots_.size() < max_slots_per_batch_) && (!circular_buffer_.empty()))
+    {
+        const SlotHandle slot = circular_buffer_.front();
+        circular_buffer_.pop_front();
+        batch_slots_.push_back(slot);
+
+        //  Casting to more capable integer type:
+        auto& underlying_data =
+            allocator_->GetUnderlyingBufferFor(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+        message_builder_->SetNextMessage(underlying_data);
+        for (auto span = message_builder_->GetNextSpan(); span.has_value(); span = message_builder_->GetNextSpan())
+        {
+            AddSpanToBatch(span.value(), underlying_data);
+        }
+    }
+
+    if (batch_slots_.empty())
+    {
+        return false;
+    }
+
+    std::size_t staging_offset = 0UL;
+    for (auto& io_vector : batch_io_vectors_)
+    {
+        if (io_vector.iov_base == nullptr)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset within the staging buffer
+            io_vector.iov_base = batch_staging_buffer_.data() + staging_offset;
+            staging_offset += io_vector.iov_len;
+        }
+        batch_size_in_bytes_ += io_vector.iov_len;
+    }
+    using IoVectorSpan = score::cpp::span<struct iovec>;
+    vectored_writer_->SetIoVectors(
+        IoVectorSpan{batch_io_vectors_.data(), static_cast<IoVectorSpan::size_type>(batch_io_vectors_.size())});
+    return true;
+}
+
+score::cpp::expected<SlotDrainer::FlushResult, score::mw::log::detail::Error> SlotDrainer::TryFlushBatches() noexcept
+{
+    std::size_t number_of_processed_slots = 0U;
+    do
+    {
+        //  First try to flush remaining data from previous cycle:
+        const auto status = vectored_writer_->FlushIntoFile();
+        if (!status.has_value())
+        {
+            return score::cpp::make_unexpected(status.error());
+        }
+        if (status.value() != NonBlockingVectoredWriter::Result::kDone)
+        {
+            return FlushResult::kPartiallyProcessed;
+        }
+
+        //  batch is flushed, release its slots and try next one:
+        for (const auto& slot : batch_slots_)
+        {
+            //  Casting to more capable integer type:
+            allocator_->ReleaseSlot(static_cast<std::size_t>(slot.GetSlotOfSelectedRecorder()));
+        }
+        number_of_processed_slots += batch_slots_.size();
+        batch_slots_.clear();
+
+        //  A rotating file may only switch to the next segment between two batches:
+        if ((rotating_file_ != nullptr) && (batch_size_in_bytes_ > 0UL))
+        {
+            if (rotating_file_->OnWritten(batch_size_in_bytes_))
+            {
+                vectored_writer_->SetFileHandle(rotating_file_->GetFileDescriptor());
+            }
+            batch_size_in_bytes_ = 0UL;
+        }
+
+        if (number_of_processed_slots > limit_slots_in_one_cycle_)
+        {
+            return FlushResult::kNumberOfProcessedSlotsExceeded;
+        }
+    } while (MoreBatchesAvailableAndLoaded());
+
+    return FlushResult::kAllDataProcessed;
+}
+
 void SlotDrainer::PushBack(const SlotHandle& slot) noexcept
 {
     const std::lock_guard<std::mutex> lock(context_mutex_);
@@ -124,7 +304,14 @@ void SlotDrainer::PushBack(const SlotHandle& slot) noexcept
 void SlotDrainer::Flush() noexcept
 {
     const std::lock_guard<std::mutex> lock(context_mutex_);
-    std::ignore = TryFlushSlots();
+    if (vectored_writer_.has_value())
+    {
+        std::ignore = TryFlushBatches();
+    }
+    else
+    {
+        std::ignore = TryFlushSlots();
+    }
 }
 
 SlotDrainer::~SlotDrainer()
@@ -16,7 +16,9 @@
 #include "score/mw/log/detail/circular_allocator.h"
 #include "score/mw/log/detail/log_record.h"
 #include "score/mw/log/detail/text_recorder/imessage_builder.h"
+#include "score/mw/log/detail/text_recorder/non_blocking_vectored_writer.h"
 #include "score/mw/log/detail/text_recorder/non_blocking_writer.h"
+#include "score/mw/log/detail/text_recorder/rotating_file.h"
 #include "score/mw/log/slot_handle.h"
 
 #include <score/circular_buffer.hpp>
@@ -24,6 +26,7 @@
 
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace score
 {
@@ -49,6 +52,31 @@ class SlotDrainer
                 score::cpp::pmr::unique_ptr<score::os::Unistd> unistd,
                 const std::size_t limit_slots_in_one_cycle = 32UL);
 
+    /// \brief Creates a SlotDrainer in batched mode.
+    ///
+    /// \details Instead of writing every span of every slot with a separate write call, up to max_slots_per_batch
+    /// queued slots are gathered into an iovec array and written with a single writev call. Spans that point into the
+    /// LogRecord of a slot are referenced directly, all other spans (e.g. a header owned by the message builder) are
+    /// copied into a staging buffer of the drainer. The slots of a batch are released once the whole batch was
+    /// written, also if this takes several Flush() calls because the file only accepted parts of it.
+    SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
+                std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                const std::int32_t file_descriptor,
+                const std::size_t max_slots_per_batch,
+                score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                const std::size_t limit_slots_in_one_cycle = 32UL);
+
+    /// \brief Creates a SlotDrainer in batched mode that writes into a RotatingFile.
+    ///
+    /// \details The drainer reports every completely written batch to the file, thus a segment only contains complete
+    /// batches and the drainer switches to the next segment between two batches.
+    SlotDrainer(std::unique_ptr<IMessageBuilder> message_builder,
+                std::shared_ptr<CircularAllocator<LogRecord>> allocator,
+                std::shared_ptr<RotatingFile> rotating_file,
+                const std::size_t max_slots_per_batch,
+                score::cpp::pmr::unique_ptr<score::os::SysUio> sys_uio,
+                const std::size_t limit_slots_in_one_cycle = 32UL);
+
     SlotDrainer(SlotDrainer&&) noexcept = delete;
     SlotDrainer(const SlotDrainer&) noexcept = delete;
     SlotDrainer& operator=(SlotDrainer&&) noexcept = delete;
@@ -64,6 +92,9 @@ class SlotDrainer
     score::cpp::expected<FlushResult, score::mw::log::detail::Error> TryFlushSpans() noexcept;
     bool MoreSlotsAvailableAndLoaded() noexcept;
     bool MoreSpansAvailableAndLoaded() noexcept;
+    score::cpp::expected<FlushResult, score::mw::log::detail::Error> TryFlushBatches() noexcept;
+    bool MoreBatchesAvailableAndLoaded() noexcept;
+    void AddSpanToBatch(const score::cpp::span<const std::uint8_t> span, const LogRecord& log_record) noexcept;
 
     std::shared_ptr<CircularAllocator<LogRecord>> allocator_;
     std::unique_ptr<IMessageBuilder> message_builder_;
@@ -75,8 +106,20 @@ class SlotDrainer
     score::cpp::circular_buffer<SlotHandle, kMaxCircularBufferSize> circular_buffer_;
     //  To manually release resource and to set and reset access:
     score::cpp::optional<std::reference_wrapper<const SlotHandle>> current_slot_;
-    NonBlockingWriter non_blocking_writer_;
+    //  Only one of both writers is used, depending on whether the drainer runs in batched mode:
+    score::cpp::optional<NonBlockingWriter> non_blocking_writer_;
+    score::cpp::optional<NonBlockingVectoredWriter> vectored_writer_;
     const std::size_t limit_slots_in_one_cycle_;
+
+    //  State of the batch that is currently written in batched mode:
+    const std::size_t max_slots_per_batch_;
+    std::vector<SlotHandle> batch_slots_;
+    std::vector<struct iovec> batch_io_vectors_;
+    std::vector<std::uint8_t> batch_staging_buffer_;
+    std::size_t batch_size_in_bytes_;
+
+    //  Only set if the drainer writes into a RotatingFile:
+    std::shared_ptr<RotatingFile> rotating_file_;
 };
 
 }  // namespace detail
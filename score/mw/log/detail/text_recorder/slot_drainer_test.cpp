@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/log/detail/text_recorder/slot_drainer.h"
 
+#include "score/os/mocklib/sys_uio_mock.h"
 #include "score/os/mocklib/unistdmock.h"
 #include "score/mw/log/detail/error.h"
 #include "score/mw/log/detail/text_recorder/mock/message_builder_mock.h"
@@ -20,6 +21,9 @@
 
 #include <score/expected.hpp>
 
+#include <string>
+#include <vector>
+
 namespace score
 {
 namespace mw
@@ -33,6 +37,7 @@ namespace
 
 using ::testing::_;
 using ::testing::Exactly;
+using ::testing::Invoke;
 using ::testing::Return;
 
 using SpanData = score::cpp::span<const std::uint8_t>;
@@ -208,6 +213,178 @@ TEST_F(SlotDrainerFixture, TestTooManySlotsForSingleCallShallNotBeAbleToFlushAll
     EXPECT_EQ(allocator_->GetUsedCount(), kNumberOfUnflushedSlots);
 }
 
+class SlotDrainerBatchedFixture : public SlotDrainerFixture
+{
+  public:
+    void SetUp() override
+    {
+        SlotDrainerFixture::SetUp();
+        sys_uio_ptr_ = score::cpp::pmr::make_unique<score::os::SysUioMock>(score::cpp::pmr::get_default_resource());
+        sys_uio_mock_ = sys_uio_ptr_.get();
+
+        //  Let the builder behave like TextMessageBuilder: a header owned by the builder followed by the payload
+        //  of the slot.
+        ON_CALL(*raw_message_builder_mock_, SetNextMessage(_)).WillByDefault(Invoke([this](LogRecord& log_record) {
+            current_record_ = &log_record;
+            spans_left_ = 2U;
+        }));
+        ON_CALL(*raw_message_builder_mock_, GetNextSpan()).WillByDefault(Invoke([this]() -> OptionalSpan {
+            if (spans_left_ == 0U)
+            {
+                return {};
+            }
+            --spans_left_;
+            if (spans_left_ == 1U)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) text is written as bytes
+                return SpanData{reinterpret_cast<const std::uint8_t*>(header_.data()),
+                                static_cast<SpanData::size_type>(header_.size())};
+            }
+            return current_record_->GetVerbosePayload().GetSpan();
+        }));
+    }
+
+    void QueueSlot(SlotDrainer& unit, const std::string& payload)
+    {
+        const auto slot = allocator_->AcquireSlotToWrite();
+        ASSERT_TRUE(slot.has_value());
+        auto& log_record = allocator_->GetUnderlyingBufferFor(slot.value());
+        log_record.GetVerbosePayload().Reset();
+        log_record.GetVerbosePayload().Put(payload.data(), payload.size());
+        //  Cast is not harmful because CircullarAllocator object size is within range of uint8_t
+        unit.PushBack(SlotHandle{static_cast<SlotIndex>(slot.value())});
+    }
+
+    static std::string Gather(const struct iovec* io_vectors, const std::int32_t count)
+    {
+        std::string result{};
+        for (std::int32_t i = 0; i < count; ++i)
+        {
+            result.append(static_cast<const char*>(io_vectors[i].iov_base), io_vectors[i].iov_len);
+        }
+        return result;
+    }
+
+  protected:
+    score::cpp::pmr::unique_ptr<::score::os::SysUioMock> sys_uio_ptr_{};
+    ::score::os::SysUioMock* sys_uio_mock_{};
+    std::string header_{"header "};
+    LogRecord* current_record_{nullptr};
+    std::uint32_t spans_left_{0U};
+};
+
+TEST_F(SlotDrainerBatchedFixture, WritesAllQueuedSlotsWithOneWritev)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "In batched mode all queued slots are written with one writev call and released afterwards.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "equivalence-classes");
+
+    //  Given a batched SlotDrainer with three queued slots
+    SlotDrainer unit(std::move(message_builder_), allocator_, file_descriptor_, 8UL, std::move(sys_uio_ptr_));
+    QueueSlot(unit, "one\n");
+    QueueSlot(unit, "two\n");
+    QueueSlot(unit, "three\n");
+
+    //  Then header and payload of every slot are written with a single call, in order
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 6))
+        .WillOnce([this](const std::int32_t, const struct iovec* io_vectors, const std::int32_t count) {
+            const auto gathered = Gather(io_vectors, count);
+            EXPECT_EQ(gathered, "header one\nheader two\nheader three\n");
+            //  and the header that the builder reuses was copied
+            EXPECT_NE(io_vectors[0].iov_base, header_.data());
+            return static_cast<std::int64_t>(gathered.size());
+        });
+
+    unit.Flush();
+    EXPECT_EQ(allocator_->GetUsedCount(), 0UL);
+}
+
+TEST_F(SlotDrainerBatchedFixture, PartialWriteKeepsSlotsUntilBatchIsWritten)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "If writev writes only a part of a batch, the next Flush continues with the first byte that was "
+                   "not written and the slots are only released when the batch is complete.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    //  Given a batched SlotDrainer with two queued slots
+    SlotDrainer unit(std::move(message_builder_), allocator_, file_descriptor_, 8UL, std::move(sys_uio_ptr_));
+    QueueSlot(unit, "first\n");
+    QueueSlot(unit, "second\n");
+
+    //  When the file only accepts the data up to the middle of the second header ("hea|der")
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 4)).WillOnce(Return(16));
+    unit.Flush();
+
+    //  Then both slots are still in use
+    EXPECT_EQ(allocator_->GetUsedCount(), 2UL);
+
+    //  When flushing again, then the remaining data is written starting inside of the second header
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 2))
+        .WillOnce([](const std::int32_t, const struct iovec* io_vectors, const std::int32_t count) {
+            const auto gathered = Gather(io_vectors, count);
+            EXPECT_EQ(gathered, "der second\n");
+            return static_cast<std::int64_t>(gathered.size());
+        });
+    unit.Flush();
+
+    //  And the slots are released
+    EXPECT_EQ(allocator_->GetUsedCount(), 0UL);
+}
+
+TEST_F(SlotDrainerBatchedFixture, SplitsQueuedSlotsIntoBatchesOfLimitedSize)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "No more than max_slots_per_batch slots are written with one writev call.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    //  Given a batched SlotDrainer with a batch size of two and three queued slots
+    SlotDrainer unit(std::move(message_builder_), allocator_, file_descriptor_, 2UL, std::move(sys_uio_ptr_));
+    QueueSlot(unit, "1\n");
+    QueueSlot(unit, "2\n");
+    QueueSlot(unit, "3\n");
+
+    //  Then two calls are needed
+    std::vector<std::string> written{};
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, _))
+        .Times(2)
+        .WillRepeatedly([&written](const std::int32_t, const struct iovec* io_vectors, const std::int32_t count) {
+            written.push_back(Gather(io_vectors, count));
+            return static_cast<std::int64_t>(written.back().size());
+        });
+
+    unit.Flush();
+    ASSERT_EQ(written.size(), 2UL);
+    EXPECT_EQ(written.at(0), "header 1\nheader 2\n");
+    EXPECT_EQ(written.at(1), "header 3\n");
+    EXPECT_EQ(allocator_->GetUsedCount(), 0UL);
+}
+
+TEST_F(SlotDrainerBatchedFixture, WriteErrorKeepsBatchForNextFlush)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "If writev fails, the batch is retried with the next Flush.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("DerivationTechnique", "error-guessing");
+
+    SlotDrainer unit(std::move(message_builder_), allocator_, file_descriptor_, 8UL, std::move(sys_uio_ptr_));
+    QueueSlot(unit, "retry\n");
+
+    EXPECT_CALL(*sys_uio_mock_, writev(file_descriptor_, _, 2))
+        .WillOnce(Return(score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN))))
+        .WillOnce(Return(13));
+
+    unit.Flush();
+    EXPECT_EQ(allocator_->GetUsedCount(), 1UL);
+
+    unit.Flush();
+    EXPECT_EQ(allocator_->GetUsedCount(), 0UL);
+}
+
 }  // namespace
 }  // namespace detail
 }  // namespace log
@@ -13,7 +13,7 @@
 #include "score/mw/log/detail/text_recorder/text_format.h"
 
 #include <array>
-#include <iomanip>
+#include <ctime>
 
 namespace score
 {
@@ -38,6 +38,29 @@ std::size_t FormattingFunctionReturnCast(const std::int32_t i) noexcept
     return 0U;
 }
 
+std::string_view TextFormat::LogLevelToString(const LogLevel level) noexcept
+{
+    switch (level)
+    {
+        case LogLevel::kOff:
+            return "off";
+        case LogLevel::kFatal:
+            return "fatal";
+        case LogLevel::kError:
+            return "error";
+        case LogLevel::kWarn:
+            return "warn";
+        case LogLevel::kInfo:
+            return "info";
+        case LogLevel::kDebug:
+            return "debug";
+        case LogLevel::kVerbose:
+            return "verbose";
+        default:
+            return "undefined";
+    }
+}
+
 std::size_t TextFormat::PutLogStringViewData(const std::string_view data, score::cpp::span<Byte> buffer) noexcept
 {
     const std::size_t length = std::min(data.size(), GetSpanSizeCasted(buffer));
@@ -83,12 +106,14 @@ std::size_t TextFormat::PutLogRawBufferData(const LogRawBuffer& data, score::cpp
         data.begin(), data.end(), [&destination_iterator, destination_end_reference = buffer.end()](const auto input) {
             if (destination_iterator != destination_end_reference)
             {
-                std::array<char, 3> temporary_formatting_buffer{};
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) safe to use std::snprintf
-                std::ignore = std::snprintf(
-                    temporary_formatting_buffer.begin(), temporary_formatting_buffer.size(), "%02hhx", input);
-                //  Take first two characters from temporary formatting buffer:
-                destination_iterator = std::copy_n(temporary_formatting_buffer.begin(), 2, destination_iterator);
+                constexpr std::string_view kHexDigits{"0123456789abcdef"};
+                constexpr std::uint32_t kNibbleMask{0x0FU};
+                const auto byte = static_cast<std::uint8_t>(input);
+                const std::array<char, 2> formatted{kHexDigits[static_cast<std::size_t>(byte >> 4U)],
+                                                    kHexDigits[static_cast<std::size_t>(byte & kNibbleMask)]};
+                const auto remaining = std::distance(destination_iterator, destination_end_reference);
+                const auto length = std::min(static_cast<std::ptrdiff_t>(formatted.size()), remaining);
+                destination_iterator = std::copy_n(formatted.begin(), length, destination_iterator);
             }
         });
     if (destination_iterator != destination_end_reference)
@@ -101,26 +126,39 @@ std::size_t TextFormat::PutLogRawBufferData(const LogRawBuffer& data, score::cpp
 
 std::size_t TextFormat::PutFormattedTimeData(const std::time_t& time_point, score::cpp::span<Byte> buffer) noexcept
 {
-    std::size_t total = 0U;
-    struct tm time_structure_buffer{};
-    const struct tm* const time_structure =
-        localtime_r(&time_point, &time_structure_buffer);  // LCOV_EXCL_BR_LINE: there are no branches to be covered.
-
-    if (nullptr != time_structure)  // LCOV_EXCL_BR_LINE: "nullptr" condition can't be controlled via test case.
+    //  Converting to local time and formatting it is by far the most expensive part of a text log message, while the
+    //  result only changes once per second. Therefore each thread keeps the last formatted second.
+    struct FormattedSecond
     {
-        const std::size_t buffer_space = GetSpanSizeCasted(buffer);
+        std::time_t second{};
+        std::size_t length{0U};
+        std::array<Byte, 32U> text{};
+    };
+    thread_local FormattedSecond cache{};
 
-        std::stringstream ss_time_str;
-        ss_time_str << std::put_time(&time_structure_buffer, "%Y/%m/%d %H:%M:%S.");
-        const std::string& time_str = ss_time_str.str();
+    if ((cache.length == 0U) || (cache.second != time_point))
+    {
+        cache.length = 0U;
+        struct tm time_structure_buffer{};
+        // LCOV_EXCL_BR_START: there are no branches to be covered.
+        const struct tm* const time_structure = localtime_r(&time_point, &time_structure_buffer);
+        // LCOV_EXCL_BR_STOP
 
-        if (buffer_space > time_str.length())
+        if (nullptr != time_structure)  // LCOV_EXCL_BR_LINE: "nullptr" condition can't be controlled via test case.
         {
-            std::ignore = std::copy(time_str.begin(), time_str.end(), buffer.begin());
-            total = time_str.length();
+            cache.second = time_point;
+            cache.length = std::strftime(cache.text.data(), cache.text.size(), "%Y/%m/%d %H:%M:%S.", time_structure);
         }
     }
 
+    std::size_t total = 0U;
+    const std::size_t buffer_space = GetSpanSizeCasted(buffer);
+    if ((cache.length > 0U) && (buffer_space > cache.length))
+    {
+        std::ignore = std::copy_n(cache.text.begin(), cache.length, buffer.begin());
+        total = cache.length;
+    }
+
     return total;
 }
 
@@ -14,18 +14,23 @@
 #define SCORE_MW_LOG_DETAIL_TEXT_RECORDER_TEXT_FORMAT_H
 
 #include "score/mw/log/detail/integer_representation.h"
+#include "score/mw/log/detail/log_entry.h"
 #include "score/mw/log/log_types.h"
 
 #include "score/span.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
+#include <charconv>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 
 namespace score
@@ -75,109 +80,66 @@ struct GetFormatSpecifier<const double, IntegerRepresentation::kDecimal>
     static constexpr const char* kValue = "%f ";
 };
 
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kHex>
-{
-    static constexpr const char* kValue = "%hhx ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kOctal>
-{
-    static constexpr const char* kValue = "%hho ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint8_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%hhu ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%hu ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kHex>
-{
-    static constexpr const char* kValue = "%hx ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint16_t, IntegerRepresentation::kOctal>
-{
-    static constexpr const char* kValue = "%ho ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%u ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kHex>
-{
-    static constexpr const char* kValue = "%x ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint32_t, IntegerRepresentation::kOctal>
-{
-    static constexpr const char* kValue = "%o ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kDecimal>
+template <IntegerRepresentation i>
+struct GetNumberBase
 {
-    static constexpr const char* kValue = "%lu ";
+    static constexpr std::int32_t kValue = 10;
 };
 
 template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kHex>
+struct GetNumberBase<IntegerRepresentation::kHex>
 {
-    static constexpr const char* kValue = "%lx ";
+    static constexpr std::int32_t kValue = 16;
 };
 
 template <>
-struct GetFormatSpecifier<const std::uint64_t, IntegerRepresentation::kOctal>
+struct GetNumberBase<IntegerRepresentation::kOctal>
 {
-    static constexpr const char* kValue = "%lo ";
+    static constexpr std::int32_t kValue = 8;
 };
 
-template <>
-struct GetFormatSpecifier<const std::int8_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%hhi ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int16_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%hi ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int32_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%i ";
-};
-
-template <>
-struct GetFormatSpecifier<const std::int64_t, IntegerRepresentation::kDecimal>
-{
-    static constexpr const char* kValue = "%li ";
-};
+/// \brief Writes an integer followed by a space into the buffer, without going through a format string.
+///
+/// \details If the buffer is too small, the most significant digits are kept and the last character is replaced by
+/// the space, like it is done for all other types. The buffer must not be empty.
+/// \return Number of bytes that were placed in the buffer
+template <IntegerRepresentation i, typename T>
+std::size_t PutFormattedIntegerData(const T data, const score::cpp::span<Byte> buffer) noexcept
+{
+    constexpr auto kBase = GetNumberBase<i>::kValue;
+    const auto space_for_digits = GetSpanSizeCasted(buffer) - kReserveSpaceForSpace;
+    Byte* const first = buffer.data();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) end of the span which is an array
+    auto result = std::to_chars(first, first + space_for_digits, data, kBase);
+    if (result.ec != std::errc{})
+    {
+        //  Longest number is a 64 bit value in octal representation:
+        constexpr std::size_t kMaxNumberOfDigits = (std::numeric_limits<std::uint64_t>::digits / 3) + 2U;
+        std::array<Byte, kMaxNumberOfDigits> digits{};
+        const auto all_digits = std::to_chars(digits.begin(), digits.end(), data, kBase);
+        const auto number_of_digits =
+            std::min(static_cast<std::size_t>(std::distance(digits.begin(), all_digits.ptr)), space_for_digits);
+        result.ptr = std::copy_n(digits.begin(), number_of_digits, first);
+    }
+    *result.ptr = ' ';
+    return static_cast<std::size_t>(std::distance(first, result.ptr)) + kReserveSpaceForSpace;
+}
 
 template <IntegerRepresentation i, typename T, typename PT>
 void PutFormattedNumber(PT& payload, const T data) noexcept
 {
     std::ignore = payload.Put([&data](score::cpp::span<Byte> buffer) noexcept {
-        if (!buffer.empty())  // LCOV_EXCL_BR_LINE: lcov complains about lots of uncovered branches here, it is not
-                              // convenient/related to this condition.
+        if (buffer.empty())
         {
+            return 0UL;
+        }
+        if constexpr (std::is_integral_v<T>)
+        {
+            return PutFormattedIntegerData<i>(data, buffer);
+        }
+        else
+        {
+            //  std::to_chars for floating point types is not available in all supported standard libraries:
             constexpr const char* kFormat = GetFormatSpecifier<const T, i>::kValue;
             using FormatType = std::conditional_t<std::is_same_v<std::remove_reference_t<T>, float>, double, T>;
             const auto written =
@@ -189,10 +151,6 @@ void PutFormattedNumber(PT& payload, const T data) noexcept
             buffer.first(num_written + 1U).back() = ' ';
             return written;
         }
-        else
-        {
-            return 0UL;
-        }
     });
 }
 
@@ -514,10 +472,16 @@ class TextFormat
     template <typename PT>
     static void PutFormattedTime(PT& payload) noexcept
     {
-        const auto time_point = std::chrono::system_clock::now();
-        const auto now = std::chrono::system_clock::to_time_t(time_point);
-        std::ignore = payload.Put([now](const score::cpp::span<Byte> buffer) noexcept {
-            return PutFormattedTimeData(now, buffer);
+        PutFormattedTime(payload, std::chrono::system_clock::now());
+    }
+
+    /// \brief Puts the given time formatted like PutFormattedTime(payload) does for the current time.
+    template <typename PT>
+    static void PutFormattedTime(PT& payload, const std::chrono::system_clock::time_point time_point) noexcept
+    {
+        const auto seconds = std::chrono::system_clock::to_time_t(time_point);
+        std::ignore = payload.Put([seconds](const score::cpp::span<Byte> buffer) noexcept {
+            return PutFormattedTimeData(seconds, buffer);
         });
 
         const auto time_elapsed =
@@ -530,7 +494,31 @@ class TextFormat
         PutFormattedNumber<IntegerRepresentation::kDecimal>(payload, time_structure_elapsed);
     }
 
+    /// \brief Puts the header of a text log message
+    ///
+    /// \details E.g. "2021/03/17 15:19:20.4360057 551684554 000 ECU1 APP CTX log info verbose 2 ", which is the time
+    /// of the message, the steady clock in 0.1 ms, the ids, the log level and the number of arguments.
+    template <typename PT>
+    static void PutHeader(PT& payload,
+                          const LogEntry& log_entry,
+                          const std::string_view ecu_id,
+                          const std::chrono::system_clock::time_point time_point,
+                          const std::uint32_t time_stamp) noexcept
+    {
+        PutFormattedTime(payload, time_point);
+        Log(payload, time_stamp);
+        Log(payload, std::string_view{"000"});
+        Log(payload, ecu_id);
+        Log(payload, log_entry.app_id.GetStringView());
+        Log(payload, log_entry.ctx_id.GetStringView());
+        Log(payload, std::string_view{"log"});
+        Log(payload, LogLevelToString(log_entry.log_level));
+        Log(payload, std::string_view{"verbose"});
+        Log(payload, log_entry.num_of_args);
+    }
+
   private:
+    static std::string_view LogLevelToString(const LogLevel level) noexcept;
     //  Returns number of bytes that were placed in the buffer
     static std::size_t PutLogStringViewData(const std::string_view data, score::cpp::span<Byte> buffer) noexcept;
     //  Returns number of bytes that were placed in the buffer
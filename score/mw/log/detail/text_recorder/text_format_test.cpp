@@ -15,6 +15,9 @@
 
 #include "gtest/gtest.h"
 
+#include <regex>
+#include <string>
+
 namespace score
 {
 namespace mw
@@ -836,6 +839,78 @@ TEST(FormattingFunction, ShallReturnEmptyIfPayloadMaxSizeEqualToZero)
     ASSERT_TRUE(payload.GetSpan().empty());
 }
 
+TEST_F(TextFormatFixture, DecimalFormatInsufficientBufferKeepsMostSignificantDigits)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies a decimal number that does not fit is cut after the most significant digits and still "
+                   "terminated by a space.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    ByteVector small_buffer{};
+    VerbosePayload capacity_four_payload{4, small_buffer};
+    TextFormat::Log(capacity_four_payload, std::int64_t{-9223372036854775807LL});
+
+    ASSERT_EQ(small_buffer.size(), 4);
+    EXPECT_EQ(0, std::memcmp(small_buffer.data(), "-92 ", small_buffer.size()));
+}
+
+TEST_F(TextFormatFixture, NumbersFillTheBufferExactly)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies a number and its space fit into a buffer of exactly that size.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    ByteVector small_buffer{};
+    VerbosePayload capacity_four_payload{4, small_buffer};
+    TextFormat::Log(capacity_four_payload, std::uint16_t{0xABCU}, IntegerRepresentation::kHex);
+
+    ASSERT_EQ(small_buffer.size(), 4);
+    EXPECT_EQ(0, std::memcmp(small_buffer.data(), "abc ", small_buffer.size()));
+}
+
+TEST_F(TextFormatFixture, FormattedTimeShallHaveDateTimePrefixAndElapsedMilliseconds)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies the formatted time consists of the local date and time followed by the elapsed "
+                   "milliseconds, also if it is taken from the cache of the current second.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    for (std::int32_t i = 0; i < 2; ++i)
+    {
+        buffer.clear();
+        TextFormat::PutFormattedTime(payload);
+        const std::string formatted_time{buffer.data(), buffer.size()};
+        EXPECT_TRUE(std::regex_match(formatted_time,
+                                     std::regex{R"(\d{4}/\d{2}/\d{2} \d{2}:\d{2}:\d{2}\.\d{1,7} )"}))
+            << formatted_time;
+    }
+}
+
+TEST_F(TextFormatFixture, FormattedTimeIsSkippedIfBufferIsTooSmall)
+{
+    RecordProperty("ParentRequirement", "SCR-1633236");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies the date and time are left out if they do not fit, while the elapsed milliseconds are cut.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values");
+
+    ByteVector small_buffer{};
+    VerbosePayload capacity_four_payload{4, small_buffer};
+    TextFormat::PutFormattedTime(capacity_four_payload);
+
+    const std::string formatted_time{small_buffer.data(), small_buffer.size()};
+    EXPECT_TRUE(std::regex_match(formatted_time, std::regex{R"(\d{1,3} )"})) << formatted_time;
+}
+
 }  // namespace
 }  // namespace test
 }  // namespace detail
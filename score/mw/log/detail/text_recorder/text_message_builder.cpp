@@ -33,36 +33,6 @@ namespace
 
 constexpr std::size_t kMaxHeaderSize = 512UL;
 
-void LogLevelToString(VerbosePayload& payload, const LogLevel level) noexcept
-{
-    switch (level)
-    {
-        case LogLevel::kOff:
-            detail::TextFormat::Log(payload, std::string_view{"off"});
-            break;
-        case LogLevel::kFatal:
-            detail::TextFormat::Log(payload, std::string_view{"fatal"});
-            break;
-        case LogLevel::kError:
-            detail::TextFormat::Log(payload, std::string_view{"error"});
-            break;
-        case LogLevel::kWarn:
-            detail::TextFormat::Log(payload, std::string_view{"warn"});
-            break;
-        case LogLevel::kInfo:
-            detail::TextFormat::Log(payload, std::string_view{"info"});
-            break;
-        case LogLevel::kDebug:
-            detail::TextFormat::Log(payload, std::string_view{"debug"});
-            break;
-        case LogLevel::kVerbose:
-            detail::TextFormat::Log(payload, std::string_view{"verbose"});
-            break;
-        default:
-            detail::TextFormat::Log(payload, std::string_view{"undefined"});
-            break;
-    }
-}
 inline std::uint32_t TimeStamp() noexcept
 {
     const std::uint32_t timestamp = std::chrono::duration_cast<std::chrono::duration<uint32_t, std::ratio<1, 10000>>>(
@@ -86,16 +56,8 @@ void TextMessageBuilder::SetNextMessage(LogRecord& log_record) noexcept
     log_record_ = log_record;
 
     const auto& log_entry = log_record_.value().get().GetLogEntry();
-    detail::TextFormat::PutFormattedTime(header_payload_);
-    detail::TextFormat::Log(header_payload_, TimeStamp());
-    detail::TextFormat::Log(header_payload_, std::string_view{"000"});
-    detail::TextFormat::Log(header_payload_, ecu_id_.GetStringView());
-    detail::TextFormat::Log(header_payload_, log_entry.app_id.GetStringView());
-    detail::TextFormat::Log(header_payload_, log_entry.ctx_id.GetStringView());
-    detail::TextFormat::Log(header_payload_, std::string_view{"log"});
-    LogLevelToString(header_payload_, log_entry.log_level);
-    detail::TextFormat::Log(header_payload_, std::string_view{"verbose"});
-    detail::TextFormat::Log(header_payload_, log_entry.num_of_args);
+    detail::TextFormat::PutHeader(
+        header_payload_, log_entry, ecu_id_.GetStringView(), std::chrono::system_clock::now(), TimeStamp());
     parsing_phase_ = ParsingPhase::kHeader;
 }
 
@@ -121,9 +83,10 @@ score::cpp::optional<score::cpp::span<const std::uint8_t>> TextMessageBuilder::G
             return_result = log_record_.value().get().GetVerbosePayload().GetSpan();
             break;
         case ParsingPhase::kReinitialize:
+            //  The payload is not reset here: in batched mode the SlotDrainer still writes it from the slot after the
+            //  message was depleted. TextRecorder resets it when the slot is acquired again.
             parsing_phase_ = ParsingPhase::kHeader;
             header_payload_.Reset();
-            verbose_payload.Reset();
             log_record_.reset();
             break;
             // LCOV_EXCL_START
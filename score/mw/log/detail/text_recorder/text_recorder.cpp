@@ -112,6 +112,11 @@ bool TextRecorder::IsLogEnabled(const LogLevel& log_level, const std::string_vie
     return config_.IsLogLevelEnabled(log_level, context, check_log_level_for_console_);
 }
 
+score::cpp::optional<LogLevel> TextRecorder::GetLogLevelThreshold(const std::string_view context) const noexcept
+{
+    return config_.GetLogLevelThreshold(context, check_log_level_for_console_);
+}
+
 void TextRecorder::Log(const SlotHandle& slot, const bool data) noexcept
 {
     GenericLog(slot, *backend_, data);
@@ -68,6 +68,8 @@ class TextRecorder : public Recorder
 
     bool IsLogEnabled(const LogLevel&, const std::string_view) const noexcept override;
 
+    score::cpp::optional<LogLevel> GetLogLevelThreshold(const std::string_view context) const noexcept override;
+
   private:
     std::unique_ptr<detail::Backend> backend_;
 
@@ -0,0 +1,182 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_LOG_DETAIL_WAIT_FREE_STACK_WAIT_FREE_HASH_INDEX_H
+#define SCORE_MW_LOG_DETAIL_WAIT_FREE_STACK_WAIT_FREE_HASH_INDEX_H
+
+#include "score/mw/log/detail/logging_identifier.h"
+
+#include "score/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+
+/// \brief Wait- and lock-free, insert-only hash index from a LoggingIdentifier to an element stored elsewhere, e.g. in
+/// a WaitFreeStack.
+///
+/// \details Open addressing with linear probing over a fixed number of buckets that is allocated on construction. The
+/// number of buckets is at least twice the maximum number of elements, thus probe sequences stay short. Every bucket is
+/// claimed once by a compare-exchange of its key and published once by storing the element pointer. Both TryInsert()
+/// and Find() visit every bucket at most once, thus they finish in a bounded number of steps.
+template <typename Element>
+class WaitFreeHashIndex
+{
+  public:
+    explicit WaitFreeHashIndex(const std::size_t max_number_of_elements) noexcept;
+
+    /// \brief Adds the element for the key, if the key is not present yet and a bucket is left.
+    /// Returns the element that is indexed for the key, i.e. the element of another thread that inserted the same key
+    /// first. Returns the given element if the other thread did not publish its element yet. Returns an empty optional
+    /// if no bucket is left.
+    score::cpp::optional<std::reference_wrapper<Element>> TryInsert(const LoggingIdentifier& key,
+                                                               Element& element) noexcept;
+
+    /// \brief Returns the element for the key.
+    /// Returns an empty optional if the key is not present or its element is not published yet.
+    score::cpp::optional<std::reference_wrapper<Element>> Find(const LoggingIdentifier& key) const noexcept;
+
+    using AtomicKey = std::atomic<std::uint64_t>;
+    using AtomicElement = std::atomic<Element*>;
+
+  private:
+    /// \brief Distinguishes a claimed bucket from an empty one, as the identifier itself may consist of zeros only.
+    static constexpr std::uint64_t kClaimed{1UL << 32U};
+
+    struct Bucket
+    {
+        AtomicKey key{0UL};
+        AtomicElement element{nullptr};
+    };
+
+    static std::uint64_t ToKey(const LoggingIdentifier& identifier) noexcept;
+    std::size_t GetHomeBucket(const std::uint64_t key) const noexcept;
+    static std::size_t GetNumberOfBuckets(const std::size_t max_number_of_elements) noexcept;
+
+    std::vector<Bucket> buckets_;
+    std::size_t mask_;
+};
+
+template <typename Element>
+WaitFreeHashIndex<Element>::WaitFreeHashIndex(const std::size_t max_number_of_elements) noexcept
+    : buckets_(GetNumberOfBuckets(max_number_of_elements)), mask_{buckets_.size() - 1UL}
+{
+}
+
+template <typename Element>
+auto WaitFreeHashIndex<Element>::TryInsert(const LoggingIdentifier& key, Element& element) noexcept
+    -> score::cpp::optional<std::reference_wrapper<Element>>
+{
+    const auto claimed_key = ToKey(key);
+    auto index = GetHomeBucket(claimed_key);
+    for (std::size_t probe = 0UL; probe < buckets_.size(); ++probe)
+    {
+        auto& bucket = buckets_[index];
+        auto current_key = bucket.key.load(std::memory_order_acquire);
+        if ((current_key == 0UL) &&
+            bucket.key.compare_exchange_strong(current_key, claimed_key, std::memory_order_acq_rel))
+        {
+            bucket.element.store(&element, std::memory_order_release);
+            return element;
+        }
+        // A failed compare-exchange updated current_key to the key of the thread that claimed the bucket.
+        if (current_key == claimed_key)
+        {
+            Element* const indexed_element = bucket.element.load(std::memory_order_acquire);
+            if (indexed_element != nullptr)
+            {
+                return *indexed_element;
+            }
+            return element;
+        }
+        index = (index + 1UL) & mask_;
+    }
+    return score::cpp::nullopt;
+}
+
+template <typename Element>
+auto WaitFreeHashIndex<Element>::Find(const LoggingIdentifier& key) const noexcept
+    -> score::cpp::optional<std::reference_wrapper<Element>>
+{
+    const auto claimed_key = ToKey(key);
+    auto index = GetHomeBucket(claimed_key);
+    for (std::size_t probe = 0UL; probe < buckets_.size(); ++probe)
+    {
+        const auto& bucket = buckets_[index];
+        const auto current_key = bucket.key.load(std::memory_order_acquire);
+        if (current_key == 0UL)
+        {
+            // Keys are never removed, thus the key would have been stored here or before.
+            return score::cpp::nullopt;
+        }
+        if (current_key == claimed_key)
+        {
+            Element* const indexed_element = bucket.element.load(std::memory_order_acquire);
+            if (indexed_element == nullptr)
+            {
+                return score::cpp::nullopt;
+            }
+            return *indexed_element;
+        }
+        index = (index + 1UL) & mask_;
+    }
+    return score::cpp::nullopt;
+}
+
+template <typename Element>
+std::uint64_t WaitFreeHashIndex<Element>::ToKey(const LoggingIdentifier& identifier) noexcept
+{
+    std::uint32_t value{};
+    static_assert(sizeof(value) == sizeof(LoggingIdentifier::data), "The identifier must fit into the key");
+    // NOLINTNEXTLINE(score-banned-function) memcpy is needed
+    std::ignore = std::memcpy(&value, identifier.data.data(), identifier.data.size());
+    return kClaimed | static_cast<std::uint64_t>(value);
+}
+
+template <typename Element>
+std::size_t WaitFreeHashIndex<Element>::GetHomeBucket(const std::uint64_t key) const noexcept
+{
+    // Identifiers often only differ in their last characters, e.g. "CT01" and "CT02". Multiplying by the golden ratio
+    // spreads these differences over the upper bits, which are used as the bucket index.
+    constexpr std::uint64_t kGoldenRatio{0x9E3779B97F4A7C15UL};
+    return static_cast<std::size_t>((key * kGoldenRatio) >> 32U) & mask_;
+}
+
+template <typename Element>
+std::size_t WaitFreeHashIndex<Element>::GetNumberOfBuckets(const std::size_t max_number_of_elements) noexcept
+{
+    std::size_t number_of_buckets{2UL};
+    while (number_of_buckets < (2UL * max_number_of_elements))
+    {
+        number_of_buckets *= 2UL;
+    }
+    return number_of_buckets;
+}
+
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
+
+#endif  // SCORE_MW_LOG_DETAIL_WAIT_FREE_STACK_WAIT_FREE_HASH_INDEX_H
@@ -0,0 +1,178 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/log/detail/wait_free_stack/wait_free_hash_index.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace mw
+{
+namespace log
+{
+namespace detail
+{
+namespace
+{
+
+TEST(WaitFreeHashIndex, InsertedElementShallBeFound)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Elements inserted into the index shall be found by their identifier.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr auto kNumberOfElements = 100UL;
+    std::vector<std::string> elements(kNumberOfElements);
+    WaitFreeHashIndex<std::string> index{kNumberOfElements};
+
+    // Given identifiers that only differ in their last characters
+    for (auto i = 0UL; i < kNumberOfElements; ++i)
+    {
+        elements[i] = "C" + std::to_string(100UL + i);
+        const auto result = index.TryInsert(LoggingIdentifier{elements[i]}, elements[i]);
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(&result.value().get(), &elements[i]);
+    }
+
+    // Then every element is found by its identifier
+    for (const auto& element : elements)
+    {
+        const auto result = index.Find(LoggingIdentifier{element});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(&result.value().get(), &element);
+    }
+}
+
+TEST(WaitFreeHashIndex, UnknownIdentifierShallNotBeFound)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "An identifier that was not inserted shall not be found.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    std::string element{"CTX1"};
+    WaitFreeHashIndex<std::string> index{4UL};
+    ASSERT_TRUE(index.TryInsert(LoggingIdentifier{element}, element).has_value());
+
+    EXPECT_FALSE(index.Find(LoggingIdentifier{"CTX2"}).has_value());
+    // An identifier of zeros only is a valid key and differs from an empty bucket.
+    EXPECT_FALSE(index.Find(LoggingIdentifier{""}).has_value());
+}
+
+TEST(WaitFreeHashIndex, InsertingExistingIdentifierShallReturnTheFirstElement)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Inserting an identifier twice shall keep and return the first element.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    std::string first{"CTX1"};
+    std::string second{"CTX1"};
+    WaitFreeHashIndex<std::string> index{4UL};
+
+    ASSERT_TRUE(index.TryInsert(LoggingIdentifier{first}, first).has_value());
+    const auto result = index.TryInsert(LoggingIdentifier{second}, second);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(&result.value().get(), &first);
+    EXPECT_EQ(&index.Find(LoggingIdentifier{second}).value().get(), &first);
+}
+
+TEST(WaitFreeHashIndex, InsertingIntoFullIndexShallFail)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Inserting shall fail without blocking if no bucket is left.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "boundary-values"); // boundary values
+
+    // Given an index for one element, which has two buckets
+    std::array<std::string, 3UL> elements{"A", "B", "C"};
+    WaitFreeHashIndex<std::string> index{1UL};
+    ASSERT_TRUE(index.TryInsert(LoggingIdentifier{elements[0]}, elements[0]).has_value());
+    ASSERT_TRUE(index.TryInsert(LoggingIdentifier{elements[1]}, elements[1]).has_value());
+
+    // When inserting a third identifier
+    // Then it fails, while the inserted elements are still found
+    EXPECT_FALSE(index.TryInsert(LoggingIdentifier{elements[2]}, elements[2]).has_value());
+    EXPECT_FALSE(index.Find(LoggingIdentifier{elements[2]}).has_value());
+    EXPECT_TRUE(index.Find(LoggingIdentifier{elements[0]}).has_value());
+    EXPECT_TRUE(index.Find(LoggingIdentifier{elements[1]}).has_value());
+}
+
+TEST(WaitFreeHashIndex, AtomicShallBeLockFree)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Check atomic lock-free.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    ASSERT_TRUE(WaitFreeHashIndex<std::string>::AtomicKey::is_always_lock_free);
+    ASSERT_TRUE(WaitFreeHashIndex<std::string>::AtomicElement::is_always_lock_free);
+}
+
+TEST(WaitFreeHashIndex, ConcurrentInsertingOfSameIdentifiersShallIndexOneElementPerIdentifier)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Threads inserting the same identifiers concurrently shall agree on one element per identifier "
+                   "once all insertions completed.");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+
+    constexpr auto kNumberOfIdentifiers = 16UL;
+    constexpr auto kNumberOfThreads = 8UL;
+    std::vector<std::vector<std::string>> elements(kNumberOfThreads, std::vector<std::string>(kNumberOfIdentifiers));
+    WaitFreeHashIndex<std::string> index{kNumberOfIdentifiers};
+
+    // Given threads that insert their own element for the same identifiers
+    std::vector<std::thread> threads;
+    for (auto thread_index = 0UL; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([&index, &elements, thread_index]() {
+            for (auto i = 0UL; i < kNumberOfIdentifiers; ++i)
+            {
+                auto& element = elements[thread_index][i];
+                element = std::to_string(i);
+                const auto result = index.TryInsert(LoggingIdentifier{element}, element);
+                if ((result.has_value() == false) || (result.value().get() != std::to_string(i)))
+                {
+                    std::abort();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then every identifier is found and maps to an element with the same content
+    for (auto i = 0UL; i < kNumberOfIdentifiers; ++i)
+    {
+        const auto result = index.Find(LoggingIdentifier{std::to_string(i)});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(result.value().get(), std::to_string(i));
+    }
+}
+
+}  // namespace
+}  // namespace detail
+}  // namespace log
+}  // namespace mw
+}  // namespace score
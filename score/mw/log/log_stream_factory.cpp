@@ -33,3 +33,14 @@ score::mw::log::LogStream score::mw::log::detail::LogStreamFactory::GetStream(co
             Runtime::GetFallbackRecorder(), Runtime::GetFallbackRecorder(), log_level, context_id};
     }
 }
+
+score::mw::log::LogStream score::mw::log::detail::LogStreamFactory::GetDisabledStream(
+    const LogLevel log_level,
+    const std::string_view context_id) noexcept
+{
+    // The fallback recorder is an EmptyRecorder, thus neither a slot is reserved nor a Flush() can log the message.
+    // Unnamed object ok, since it will be moved out of this function
+    // NOLINTNEXTLINE(score-no-unnamed-temporary-objects): See above
+    return score::mw::log::LogStream{
+        Runtime::GetFallbackRecorder(), Runtime::GetFallbackRecorder(), log_level, context_id};
+}
@@ -40,6 +40,10 @@ class LogStreamFactory
     /// \param context_id The context id the created stream shall use
     /// \return A newly created LogStream which can be used to LogData
     static LogStream GetStream(const LogLevel, const std::string_view context_id = "DFLT") noexcept;
+
+    /// \brief Will create a `LogStream` that discards everything streamed into it, like a stream of a log level that
+    ///        the recorder does not accept. Used if the log level is known to be disabled, see Logger.
+    static LogStream GetDisabledStream(const LogLevel, const std::string_view context_id) noexcept;
 };
 
 }  // namespace detail
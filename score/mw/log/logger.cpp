@@ -41,37 +41,94 @@ Logger::Logger(const std::string_view context) noexcept
 
 log::LogStream Logger::LogFatal() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kFatal, context_.GetStringView());
+    return WithLevel(LogLevel::kFatal);
 }
 
 log::LogStream Logger::LogError() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kError, context_.GetStringView());
+    return WithLevel(LogLevel::kError);
 }
 
 log::LogStream Logger::LogWarn() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kWarn, context_.GetStringView());
+    return WithLevel(LogLevel::kWarn);
 }
 
 log::LogStream Logger::LogInfo() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kInfo, context_.GetStringView());
+    return WithLevel(LogLevel::kInfo);
 }
 
 log::LogStream Logger::LogDebug() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kDebug, context_.GetStringView());
+    return WithLevel(LogLevel::kDebug);
 }
 
 log::LogStream Logger::LogVerbose() const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(LogLevel::kVerbose, context_.GetStringView());
+    return WithLevel(LogLevel::kVerbose);
 }
 
 log::LogStream Logger::WithLevel(const LogLevel log_level) const noexcept
 {
-    return score::mw::log::detail::LogStreamFactory::GetStream(log_level, context_.GetStringView());
+    if (context_.IsFilteredOut(log_level))
+    {
+        return score::mw::log::detail::LogStreamFactory::GetDisabledStream(log_level, context_.GetContext());
+    }
+    return score::mw::log::detail::LogStreamFactory::GetStream(log_level, context_.GetContext());
+}
+
+log::LogStream Logger::LogFatal(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kFatal, limiter);
+}
+
+log::LogStream Logger::LogError(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kError, limiter);
+}
+
+log::LogStream Logger::LogWarn(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kWarn, limiter);
+}
+
+log::LogStream Logger::LogInfo(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kInfo, limiter);
+}
+
+log::LogStream Logger::LogDebug(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kDebug, limiter);
+}
+
+log::LogStream Logger::LogVerbose(CallSiteLimiter& limiter) const noexcept
+{
+    return WithLevel(LogLevel::kVerbose, limiter);
+}
+
+log::LogStream Logger::WithLevel(const LogLevel log_level, CallSiteLimiter& limiter) const noexcept
+{
+    //  Messages below the threshold are not counted as suppressed by the limiter:
+    if (context_.IsFilteredOut(log_level))
+    {
+        return score::mw::log::detail::LogStreamFactory::GetDisabledStream(log_level, context_.GetContext());
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (!limiter.TryAcquire(now))
+    {
+        return score::mw::log::detail::LogStreamFactory::GetDisabledStream(log_level, context_.GetContext());
+    }
+
+    const auto suppressed_count = limiter.TakeSuppressedCount(now);
+    if (suppressed_count > 0UL)
+    {
+        auto summary = score::mw::log::detail::LogStreamFactory::GetStream(log_level, context_.GetContext());
+        summary << "Suppressed" << suppressed_count << "messages of the following log statement";
+    }
+    return score::mw::log::detail::LogStreamFactory::GetStream(log_level, context_.GetContext());
 }
 
 bool Logger::IsLogEnabled(const LogLevel log_level) const noexcept
@@ -81,12 +138,17 @@ bool Logger::IsLogEnabled(const LogLevel log_level) const noexcept
 
 bool Logger::IsEnabled(const LogLevel log_level) const noexcept
 {
-    return score::mw::log::detail::Runtime::GetRecorder().IsLogEnabled(log_level, context_.GetStringView());
+    const auto threshold = context_.GetLogLevelThreshold();
+    if (threshold.has_value())
+    {
+        return log_level <= threshold.value();
+    }
+    return score::mw::log::detail::Runtime::GetRecorder().IsLogEnabled(log_level, context_.GetContext());
 }
 
 std::string_view Logger::GetContext() const noexcept
 {
-    return context_.GetStringView();
+    return context_.GetContext();
 }
 
 score::mw::log::Logger& CreateLogger(const std::string_view context) noexcept
@@ -13,12 +13,12 @@
 #ifndef SCORE_MW_LOG_LOGGER_H
 #define SCORE_MW_LOG_LOGGER_H
 
+#include "score/mw/log/call_site_limiter.h"
+#include "score/mw/log/context_handle.h"
 #include "score/mw/log/log_stream.h"
 
 #include <string_view>
 
-#include "score/mw/log/detail/logging_identifier.h"
-
 namespace score
 {
 namespace mw
@@ -28,6 +28,9 @@ namespace log
 
 /// \brief The logger creates LogStreams with a user-defined context.
 /// Implicitly generated assignment operators are NOT thread-safe.
+///
+/// \details The log level threshold of the context is resolved once per recorder, thus a log statement below the
+/// threshold neither looks up the context in the configuration nor reserves a slot.
 class Logger final
 {
   public:
@@ -100,6 +103,22 @@ class Logger final
     /// \details See also AUTOSAR_SWS_LogAndTrace R20-11, Section 8.3.2.8
     log::LogStream WithLevel(const LogLevel log_level) const noexcept;
 
+    /// \brief Creates LogStreams like the overloads without a limiter, but only for the messages that pass the limiter
+    /// of the call site. The other messages are discarded without reserving a slot.
+    /// \public
+    /// \thread-safe
+    ///
+    /// \details The number of discarded messages is logged at most once per CallSiteLimiter::kSummaryInterval before a
+    /// message that passes. Discarded messages that are not followed by a passing one are not reported, see
+    /// CallSiteLimiter.
+    log::LogStream LogFatal(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream LogError(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream LogWarn(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream LogInfo(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream LogDebug(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream LogVerbose(CallSiteLimiter& limiter) const noexcept;
+    log::LogStream WithLevel(const LogLevel log_level, CallSiteLimiter& limiter) const noexcept;
+
     /// \brief Check if the log level is enabled for the current context.
     /// \public
     /// \thread-safe
@@ -115,7 +134,7 @@ class Logger final
     std::string_view GetContext() const noexcept;
 
   private:
-    detail::LoggingIdentifier context_;
+    detail::ContextHandle context_;
 };
 
 score::mw::log::Logger& CreateLogger(const std::string_view context) noexcept;
@@ -24,11 +24,19 @@ namespace
 constexpr std::size_t kMaxLoggersSize{32U};
 }
 
-LoggerContainer::LoggerContainer() : stack_{kMaxLoggersSize}, default_logger_{score::mw::log::GetDefaultContextId()} {}
+LoggerContainer::LoggerContainer() : LoggerContainer(kMaxLoggersSize) {}
+
+LoggerContainer::LoggerContainer(const std::size_t max_number_of_loggers)
+    : capacity_{max_number_of_loggers},
+      stack_{max_number_of_loggers},
+      index_{max_number_of_loggers},
+      default_logger_{score::mw::log::GetDefaultContextId()}
+{
+}
 
 Logger& LoggerContainer::GetLogger(const std::string_view context) noexcept
 {
-    auto logger = FindExistingLogger(context);
+    auto logger = index_.Find(detail::LoggingIdentifier{context});
 
     if (logger.has_value())
     {
@@ -42,6 +50,12 @@ Logger& LoggerContainer::InsertNewLogger(const std::string_view context) noexcep
     const auto result = stack_.TryPush(Logger{context});
     if (result.has_value())
     {
+        // If another thread inserted a logger for the same context first, its logger is returned by all threads.
+        const auto indexed_logger = index_.TryInsert(detail::LoggingIdentifier{context}, result.value());
+        if (indexed_logger.has_value())
+        {
+            return indexed_logger.value();
+        }
         return result.value();
     }
     // Returning address of non-static private class member is justified by
@@ -51,17 +65,9 @@ Logger& LoggerContainer::InsertNewLogger(const std::string_view context) noexcep
     return default_logger_;
 }
 
-score::cpp::optional<std::reference_wrapper<Logger>> LoggerContainer::FindExistingLogger(
-    const std::string_view context) noexcept
-{
-    return stack_.Find([context](const Logger& logger) noexcept {
-        return logger.GetContext() == context;
-    });
-}
-
 size_t LoggerContainer::GetCapacity() const noexcept
 {
-    return kMaxLoggersSize;
+    return capacity_;
 }
 
 Logger& LoggerContainer::GetDefaultLogger() noexcept
@@ -13,6 +13,7 @@
 #ifndef SCORE_MW_LOG_LOGGER_CONTAINER_H
 #define SCORE_MW_LOG_LOGGER_CONTAINER_H
 
+#include "score/mw/log/detail/wait_free_stack/wait_free_hash_index.h"
 #include "score/mw/log/detail/wait_free_stack/wait_free_stack.h"
 #include "score/mw/log/logger.h"
 #include "score/mw/log/slot_handle.h"
@@ -28,6 +29,7 @@ class LoggerContainer final
 {
   public:
     explicit LoggerContainer();
+    explicit LoggerContainer(const std::size_t max_number_of_loggers);
 
     Logger& GetLogger(const std::string_view context) noexcept;
 
@@ -38,8 +40,10 @@ class LoggerContainer final
   private:
     Logger& InsertNewLogger(const std::string_view context) noexcept;
 
-    score::cpp::optional<std::reference_wrapper<Logger>> FindExistingLogger(const std::string_view context) noexcept;
+    std::size_t capacity_;
     detail::WaitFreeStack<Logger, memory::shared::AtomicIndirectorReal> stack_;
+    /// Finds a logger of the stack in constant time, instead of comparing the context of every logger.
+    detail::WaitFreeHashIndex<Logger> index_;
     Logger default_logger_;
 };
 
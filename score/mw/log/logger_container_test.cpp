@@ -102,6 +102,45 @@ TEST(LoggerContainerTests, WhenLoggerContainerIsFullShallGetDefaultContextWhenNe
     EXPECT_EQ(unit.GetLogger(inserted_context).GetContext(), inserted_context);
 }
 
+TEST(LoggerContainerTests, WhenRequestingExistingLoggerShallReturnSameInstance)
+{
+    RecordProperty("ParentRequirement", "SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verifies that requesting a logger again returns the same instance, also for contexts that are "
+                   "cropped to the same identifier.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("DerivationTechnique", "requirements-analysis"); // requirements
+    LoggerContainer unit;
+    Logger& logger = unit.GetLogger(kContext1);
+    EXPECT_EQ(&unit.GetLogger(kContext1), &logger);
+    EXPECT_EQ(&unit.GetLogger("MYCTX_LONG"), &logger);
+}
+
+TEST(LoggerContainerTests, WhenCreatedWithCapacityShallHoldThatManyLoggers)
+{
+    RecordProperty("ParentRequirement", "SCR-1016719");
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verifies that a logger container holds as many loggers as requested on creation.");
+    RecordProperty("TestType", "requirements-based"); // requirements test
+    RecordProperty("DerivationTechnique", "boundary-values"); // boundary values
+    constexpr std::size_t kCapacity{200U};
+    LoggerContainer unit{kCapacity};
+    EXPECT_EQ(unit.GetCapacity(), kCapacity);
+
+    for (std::size_t i = 0; i < kCapacity; i++)
+    {
+        const auto context = std::to_string(i);
+        EXPECT_EQ(unit.GetLogger(context).GetContext(), std::string_view{context});
+    }
+    EXPECT_EQ(unit.GetLogger(kContext1).GetContext(), kDefaultContext);
+    for (std::size_t i = 0; i < kCapacity; i++)
+    {
+        const auto context = std::to_string(i);
+        EXPECT_EQ(unit.GetLogger(context).GetContext(), std::string_view{context});
+    }
+}
+
 void LoggerRequester1(LoggerContainer& logger_container)
 {
     EXPECT_EQ(logger_container.GetLogger(kContext1).GetContext(), kContext1);
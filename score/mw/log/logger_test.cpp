@@ -15,7 +15,12 @@
 #include "score/mw/log/logging.h"
 #include "score/mw/log/recorder_mock.h"
 
+#include <score/utility.hpp>
+
+#include <atomic>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -183,6 +188,269 @@ TEST_F(BasicLoggerFixture, CheckThatIsLogEnabledReturnsCorrectValue)
     EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kWarn));
 }
 
+class ThresholdRecorderMock : public RecorderMock
+{
+  public:
+    MOCK_METHOD(score::cpp::optional<LogLevel>,
+                GetLogLevelThreshold,
+                (const std::string_view context),
+                (const, noexcept, override));
+};
+
+class ThresholdLoggerFixture : public ::testing::Test
+{
+  public:
+    ThresholdLoggerFixture()
+    {
+        score::mw::log::SetLogRecorder(&recorder_mock);
+    }
+
+    Logger unit{kContext};
+    ThresholdRecorderMock recorder_mock{};
+};
+
+TEST_F(ThresholdLoggerFixture, LogStatementsBelowThresholdShallNotReachTheRecorder)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that log statements below the threshold of the context are dropped without calling the "
+                   "recorder and that the threshold is only resolved once.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a recorder with a threshold of info for the context
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kInfo));
+
+    // Expecting that no log record is started
+    EXPECT_CALL(recorder_mock, StartRecord(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(recorder_mock, LogInt32(::testing::_, ::testing::_)).Times(0);
+
+    // When logging below the threshold several times
+    unit.LogDebug() << 42;
+    unit.LogVerbose() << 42;
+    unit.WithLevel(LogLevel::kDebug) << 42;
+}
+
+TEST_F(ThresholdLoggerFixture, LogStatementsAtThresholdShallReachTheRecorder)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that log statements at the threshold of the context are recorded.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "boundary-values"); // boundary values
+
+    // Given a recorder with a threshold of info for the context
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kInfo));
+
+    // Expecting a log record of level info
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kInfo)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogInt32(kHandle, 42));
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle));
+
+    // When logging at the threshold
+    unit.LogInfo() << 42;
+}
+
+TEST_F(ThresholdLoggerFixture, IsLogEnabledShallUseTheResolvedThreshold)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that IsLogEnabled is answered from the resolved threshold without asking the recorder.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a recorder with a threshold of warn for the context
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kWarn));
+
+    // Expecting that the recorder is not asked per call
+    EXPECT_CALL(recorder_mock, IsLogEnabled(::testing::_, ::testing::_)).Times(0);
+
+    // Expect that the correct values are returned
+    EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kError));
+    EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kWarn));
+    EXPECT_FALSE(unit.IsLogEnabled(LogLevel::kInfo));
+    EXPECT_TRUE(unit.IsEnabled(LogLevel::kFatal));
+}
+
+TEST_F(ThresholdLoggerFixture, ThresholdShallBeResolvedAgainAfterTheRecorderChanged)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description", "Verify that a resolved threshold is not used anymore once the recorder changed.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a threshold of error that was resolved from the first recorder
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kError));
+    EXPECT_FALSE(unit.IsLogEnabled(LogLevel::kInfo));
+
+    // When another recorder with a threshold of verbose is set
+    ThresholdRecorderMock other_recorder_mock{};
+    EXPECT_CALL(other_recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kVerbose));
+    score::mw::log::SetLogRecorder(&other_recorder_mock);
+
+    // Then the threshold of the new recorder is used
+    EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kInfo));
+
+    score::mw::log::SetLogRecorder(&recorder_mock);
+}
+
+TEST_F(ThresholdLoggerFixture, ThresholdShallNotStayOutdatedWhenTheRecorderChangesWhileResolving)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that the threshold of the current recorder is used once the recorder stopped changing, even "
+                   "if other threads resolved the threshold while the recorder changed.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "error-guessing"); // error guessing
+
+    // Given two recorders with a threshold of error and verbose for the context
+    ThresholdRecorderMock other_recorder_mock{};
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillRepeatedly(Return(LogLevel::kError));
+    EXPECT_CALL(other_recorder_mock, GetLogLevelThreshold(kContext)).WillRepeatedly(Return(LogLevel::kVerbose));
+
+    // And threads that keep resolving the threshold of the same logger
+    constexpr std::size_t kNumberOfThreads{3U};
+    std::atomic<std::size_t> started{0U};
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads{};
+    for (std::size_t i{0U}; i < kNumberOfThreads; ++i)
+    {
+        threads.emplace_back([this, &started, &stop]() {
+            score::cpp::ignore = unit.IsLogEnabled(LogLevel::kInfo);
+            started.fetch_add(1U);
+            while (!stop.load())
+            {
+                score::cpp::ignore = unit.IsLogEnabled(LogLevel::kInfo);
+            }
+        });
+    }
+    while (started.load() < kNumberOfThreads)
+    {
+        std::this_thread::yield();
+    }
+
+    // When the recorder is switched back and forth, ending with the recorder with threshold verbose
+    for (std::size_t i{0U}; i < 100U; ++i)
+    {
+        score::mw::log::SetLogRecorder(&other_recorder_mock);
+        std::this_thread::yield();
+        score::mw::log::SetLogRecorder(&recorder_mock);
+        std::this_thread::yield();
+    }
+    score::mw::log::SetLogRecorder(&other_recorder_mock);
+    stop = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then the threshold of the last recorder is used
+    EXPECT_TRUE(unit.IsLogEnabled(LogLevel::kInfo));
+
+    score::mw::log::SetLogRecorder(&recorder_mock);
+}
+
+TEST_F(BasicLoggerFixture, RecorderWithoutThresholdShallBeAskedForEveryLogStatement)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that log statements are passed to a recorder which does not provide a threshold.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a recorder without threshold
+    // Expecting that every log statement starts a log record
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kVerbose)).Times(2).WillRepeatedly(Return(kHandle));
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle)).Times(2);
+
+    // When logging twice
+    unit.LogVerbose() << 42;
+    unit.LogVerbose() << 42;
+}
+
+TEST_F(BasicLoggerFixture, MessagesRejectedByTheLimiterShallNotReserveASlot)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that a log statement with a call site limiter only starts a log record for the messages "
+                   "that pass the limiter.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a limiter that lets a single message per second pass
+    CallSiteLimiter limiter{CallSiteLimiter::RateLimit{1U, 1U}};
+
+    // Expecting a single log record with a single argument
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kWarn)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogInt32(kHandle, 42)).Times(1);
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle)).Times(1);
+
+    // When logging three times in a row
+    unit.LogWarn(limiter) << 42;
+    unit.LogWarn(limiter) << 42;
+    unit.WithLevel(LogLevel::kWarn, limiter) << 42;
+}
+
+TEST_F(BasicLoggerFixture, MessagesRejectedByTheLimiterShallBeSummarized)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that the number of messages rejected by a call site limiter is logged before the next "
+                   "message that passes.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a limiter that lets every second message pass
+    CallSiteLimiter limiter{CallSiteLimiter::Sampling{2U}};
+
+    // Expecting the first message, then the summary of one suppressed message and the third message
+    ::testing::InSequence sequence{};
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kInfo)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogInt32(kHandle, 1));
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle));
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kInfo)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogUint64(kHandle, 1UL));
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle));
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kInfo)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogInt32(kHandle, 3));
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle));
+
+    // When logging three messages
+    unit.LogInfo(limiter) << 1;
+    unit.LogInfo(limiter) << 2;
+    unit.LogInfo(limiter) << 3;
+}
+
+TEST_F(ThresholdLoggerFixture, MessagesBelowThresholdShallNotBeCountedByTheLimiter)
+{
+    RecordProperty("ASIL", "B");
+    RecordProperty("Description",
+                   "Verify that log statements below the threshold do not use up the call site limiter.");
+    RecordProperty("TestType", "interface-test");
+    RecordProperty("Verifies", "::score::mw::log::Logger");
+    RecordProperty("DerivationTechnique", "equivalence-classes"); // equivalence classes
+
+    // Given a recorder with a threshold of info and a limiter that lets a single message pass
+    EXPECT_CALL(recorder_mock, GetLogLevelThreshold(kContext)).WillOnce(Return(LogLevel::kInfo));
+    CallSiteLimiter limiter{CallSiteLimiter::RateLimit{1U, 1U}};
+
+    // Expecting a single log record without summary
+    EXPECT_CALL(recorder_mock, StartRecord(kContext, LogLevel::kInfo)).WillOnce(Return(kHandle));
+    EXPECT_CALL(recorder_mock, LogUint64(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(recorder_mock, StopRecord(kHandle));
+
+    // When logging below the threshold and then at the threshold
+    unit.LogDebug(limiter) << 42;
+    unit.LogInfo(limiter) << 42;
+}
+
 TEST(CreateLoggerGetContext, CreateLoggerWithNeededContext)
 {
     RecordProperty("ParentRequirement", "SCR-1016719");
@@ -21,6 +21,11 @@ namespace log
 
 Recorder::~Recorder() = default;
 
+score::cpp::optional<LogLevel> Recorder::GetLogLevelThreshold(const std::string_view) const noexcept
+{
+    return {};
+}
+
 }  // namespace log
 }  // namespace mw
 }  // namespace score
@@ -111,6 +111,13 @@ class Recorder
     virtual void Log(const SlotHandle&, const LogSlog2Message) noexcept = 0;
 
     virtual bool IsLogEnabled(const LogLevel&, const std::string_view context) const noexcept = 0;
+
+    /// \brief Returns the most verbose log level for which IsLogEnabled() returns true for the context, if that does
+    /// not change during the lifetime of the recorder.
+    ///
+    /// \details Enables callers to resolve the threshold of a context once instead of calling IsLogEnabled() for every
+    /// message, see Logger. The default returns an empty optional, i.e. IsLogEnabled() has to be asked every time.
+    virtual score::cpp::optional<LogLevel> GetLogLevelThreshold(const std::string_view context) const noexcept;
 };
 
 }  // namespace log
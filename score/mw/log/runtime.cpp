@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/log/runtime.h"
 
+#include "score/mw/log/context_handle.h"
 #include "score/mw/log/detail/empty_recorder.h"
 #include "score/mw/log/detail/irecorder_factory.h"
 #include "score/mw/log/detail/thread_local_guard.h"
@@ -81,6 +82,8 @@ score::mw::log::LoggerContainer& Runtime::GetLoggerContainer() noexcept
 void Runtime::SetRecorder(Recorder* const recorder, score::cpp::pmr::memory_resource* memory_resource) noexcept
 {
     Instance(recorder, memory_resource).recorder_instance_ = recorder;
+    //  Thresholds resolved from the previous recorder are outdated:
+    ContextHandle::InvalidateAll();
 }
 
 }  // namespace detail
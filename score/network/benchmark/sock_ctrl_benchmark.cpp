@@ -0,0 +1,228 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite comparing the poll and epoll backends of score::os::SocketCtrl.
+///
+/// UDP sockets bound to the loopback interface are armed for reading through SocketCtrl::RequestOperation() and
+/// receive datagrams from a plain sender socket:
+///   * ReadAllSockets     -> every socket is armed and receives one datagram per iteration (registration + dispatch)
+///   * ReadOneOfManySockets -> one socket receives a datagram while all others stay armed but idle (wakeup cost)
+///
+/// Both benchmarks are run with 10, 100 and 1000 sockets. The poll backend supports at most 20 sockets, thus the
+/// larger configurations are skipped for it.
+
+#include "score/network/sock_async/sock_ctrl.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace os
+{
+namespace
+{
+
+constexpr std::int64_t kPollBackend{0};
+constexpr std::int64_t kEpollBackend{1};
+
+sockaddr_in LoopbackAddress()
+{
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0U;
+    return address;
+}
+
+/// UDP socket bound to an ephemeral port of the loopback interface.
+class LoopbackUdpSocket final : public SocketAsync
+{
+  public:
+    LoopbackUdpSocket() noexcept : SocketAsync(Endpoint{}), address_{LoopbackAddress()}
+    {
+        socket_fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        socklen_t length = sizeof(address_);
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast): required by the socket API
+        static_cast<void>(::bind(socket_fd_, reinterpret_cast<const sockaddr*>(&address_), sizeof(address_)));
+        static_cast<void>(::getsockname(socket_fd_, reinterpret_cast<sockaddr*>(&address_), &length));
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    LoopbackUdpSocket(LoopbackUdpSocket&&) noexcept = delete;
+    LoopbackUdpSocket(const LoopbackUdpSocket&) = delete;
+    LoopbackUdpSocket& operator=(LoopbackUdpSocket&&) & noexcept = delete;
+    LoopbackUdpSocket& operator=(const LoopbackUdpSocket&) & noexcept = delete;
+
+    ~LoopbackUdpSocket() override
+    {
+        ::close(socket_fd_);
+    }
+
+    std::int32_t GetSockFD() const noexcept override
+    {
+        return socket_fd_;
+    }
+
+    const sockaddr_in& Address() const noexcept
+    {
+        return address_;
+    }
+
+  private:
+    sockaddr_in address_;
+};
+
+class LoopbackSetup
+{
+  public:
+    explicit LoopbackSetup(const std::size_t socket_count) : sender_fd_{::socket(AF_INET, SOCK_DGRAM, 0)}
+    {
+        for (std::size_t i = 0U; i < socket_count; i++)
+        {
+            sockets_.push_back(std::make_shared<LoopbackUdpSocket>());
+        }
+    }
+
+    LoopbackSetup(LoopbackSetup&&) noexcept = delete;
+    LoopbackSetup(const LoopbackSetup&) = delete;
+    LoopbackSetup& operator=(LoopbackSetup&&) & noexcept = delete;
+    LoopbackSetup& operator=(const LoopbackSetup&) & noexcept = delete;
+
+    ~LoopbackSetup()
+    {
+        ::close(sender_fd_);
+    }
+
+    bool Arm(SocketCtrl& ctrl, const std::size_t index)
+    {
+        const auto& socket = sockets_[index];
+        auto buffer = std::make_shared<std::vector<score::cpp::span<std::uint8_t>>>(
+            1U, score::cpp::span<std::uint8_t>{payload_.data(), payload_.size()});
+        static_cast<void>(socket->ReadAsync(std::move(buffer), [this](auto, const ssize_t) {
+            reads_.fetch_add(1U, std::memory_order_release);
+        }));
+        return ctrl.RequestOperation(socket, SockReq::READ) == kExitSuccess;
+    }
+
+    void Send(const std::size_t index) const
+    {
+        const auto& address = sockets_[index]->Address();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): required by the socket API
+        const auto* const destination = reinterpret_cast<const sockaddr*>(&address);
+        static_cast<void>(::sendto(sender_fd_, payload_.data(), payload_.size(), 0, destination, sizeof(address)));
+    }
+
+    void WaitForReads(const std::uint64_t expected) const
+    {
+        while (reads_.load(std::memory_order_acquire) < expected)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return sockets_.size();
+    }
+
+  private:
+    std::int32_t sender_fd_;
+    std::array<std::uint8_t, 64> payload_{};
+    std::vector<std::shared_ptr<LoopbackUdpSocket>> sockets_{};
+    std::atomic<std::uint64_t> reads_{0U};
+};
+
+SocketCtrlBackend ToBackend(const std::int64_t argument)
+{
+    return (argument == kEpollBackend) ? SocketCtrlBackend::kEpoll : SocketCtrlBackend::kPoll;
+}
+
+void BM_SocketCtrl_ReadAllSockets(benchmark::State& state)
+{
+    LoopbackSetup setup{static_cast<std::size_t>(state.range(1))};
+    // Declared after the sockets, so the polling thread is stopped before they are closed
+    SocketCtrl ctrl{ToBackend(state.range(0))};
+    std::uint64_t expected_reads{0U};
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0U; i < setup.Size(); i++)
+        {
+            if (!setup.Arm(ctrl, i))
+            {
+                state.SkipWithError("Number of sockets not supported by backend");
+                return;
+            }
+        }
+        for (std::size_t i = 0U; i < setup.Size(); i++)
+        {
+            setup.Send(i);
+        }
+        expected_reads += setup.Size();
+        setup.WaitForReads(expected_reads);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(1));
+}
+
+void BM_SocketCtrl_ReadOneOfManySockets(benchmark::State& state)
+{
+    LoopbackSetup setup{static_cast<std::size_t>(state.range(1))};
+    SocketCtrl ctrl{ToBackend(state.range(0))};
+    for (std::size_t i = 1U; i < setup.Size(); i++)
+    {
+        if (!setup.Arm(ctrl, i))
+        {
+            state.SkipWithError("Number of sockets not supported by backend");
+            return;
+        }
+    }
+    std::uint64_t expected_reads{0U};
+
+    for (auto _ : state)
+    {
+        if (!setup.Arm(ctrl, 0U))
+        {
+            state.SkipWithError("Number of sockets not supported by backend");
+            return;
+        }
+        setup.Send(0U);
+        setup.WaitForReads(++expected_reads);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_SocketCtrl_ReadAllSockets)
+    ->ArgNames({"epoll", "sockets"})
+    ->ArgsProduct({{kPollBackend, kEpollBackend}, {10, 100, 1000}})
+    ->UseRealTime();
+BENCHMARK(BM_SocketCtrl_ReadOneOfManySockets)
+    ->ArgNames({"epoll", "sockets"})
+    ->ArgsProduct({{kPollBackend, kEpollBackend}, {10, 100, 1000}})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace os
+}  // namespace score
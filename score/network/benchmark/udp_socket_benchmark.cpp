@@ -0,0 +1,277 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/// @file
+/// @brief Google Benchmark suite for the datagram paths of score::os::UdpSocket over the loopback interface.
+///
+/// Every iteration transfers a burst of kBurstSize datagrams from a sender to a receiver socket:
+///   * SendToReceiveWithAddress -> one system call per datagram on both sides (TrySendTo / TryReceiveWithAddress)
+///   * MultipleMessages         -> batched system calls (TrySendMultipleMessages / TryReceiveMultipleMessages)
+///   * SegmentedWithOffload     -> one segmented send (UDP GSO) and coalesced receive (UDP GRO), Linux only
+///
+/// All benchmarks scale the datagram payload via state.range(0) and report bytes/s and datagrams/s.
+
+#include "score/network/ipv4_address.h"
+#include "score/network/udp_socket.h"
+
+#include <benchmark/benchmark.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <vector>
+
+namespace score
+{
+namespace os
+{
+namespace
+{
+
+// Below the kernel limit of 64 segments per GSO send, and small enough that a burst of the largest payload stays
+// below 64 KiB.
+constexpr std::size_t kBurstSize{32U};
+// Receive slot of a coalesced GRO message, which never exceeds the maximum IP packet size.
+constexpr std::size_t kMaxMessageSize{64U * 1024U};
+
+const Ipv4Address kLoopback{127U, 0U, 0U, 1U};
+
+class LoopbackPair
+{
+  public:
+    explicit LoopbackPair(const std::size_t payload_size)
+        : sender_{UdpSocket::Make()}, receiver_{UdpSocket::Make()}, payload_(payload_size * kBurstSize, 0xA5U)
+    {
+        if (!sender_.has_value() || !receiver_.has_value() || !receiver_->Bind(kLoopback, 0U).has_value())
+        {
+            return;
+        }
+        sockaddr_in address{};
+        socklen_t length = sizeof(address);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): required by the socket API
+        if (::getsockname(receiver_->GetFileDescriptor(), reinterpret_cast<sockaddr*>(&address), &length) != 0)
+        {
+            return;
+        }
+        port_ = ntohs(address.sin_port);
+        for (std::size_t i = 0U; i < kBurstSize; ++i)
+        {
+            messages_.push_back(UdpSendMessage{&payload_[i * payload_size], payload_size, address});
+        }
+    }
+
+    bool IsValid() const noexcept
+    {
+        return port_ != 0U;
+    }
+
+    UdpSocket& Sender() noexcept
+    {
+        return sender_.value();
+    }
+
+    UdpSocket& Receiver() noexcept
+    {
+        return receiver_.value();
+    }
+
+    std::uint16_t Port() const noexcept
+    {
+        return port_;
+    }
+
+    const std::vector<unsigned char>& Payload() const noexcept
+    {
+        return payload_;
+    }
+
+    score::cpp::span<const UdpSendMessage> Messages() const noexcept
+    {
+        return {messages_.data(), messages_.size()};
+    }
+
+  private:
+    score::cpp::expected<UdpSocket, Error> sender_;
+    score::cpp::expected<UdpSocket, Error> receiver_;
+    std::vector<unsigned char> payload_;
+    std::vector<UdpSendMessage> messages_{};
+    std::uint16_t port_{0U};
+};
+
+bool IsWouldBlock(const Error& error) noexcept
+{
+    return (error == Error::createFromErrno(EAGAIN)) || (error == Error::createFromErrno(EWOULDBLOCK));
+}
+
+void SetCounters(benchmark::State& state)
+{
+    const auto datagrams = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(kBurstSize);
+    state.SetItemsProcessed(datagrams);
+    state.SetBytesProcessed(datagrams * state.range(0));
+}
+
+void BM_UdpSocket_SendToReceiveWithAddress(benchmark::State& state)
+{
+    const auto payload_size = static_cast<std::size_t>(state.range(0));
+    LoopbackPair pair{payload_size};
+    if (!pair.IsValid())
+    {
+        state.SkipWithError("Creating the loopback sockets failed");
+        return;
+    }
+    std::vector<unsigned char> receive_buffer(payload_size);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0U; i < kBurstSize; ++i)
+        {
+            if (!pair.Sender()
+                     .TrySendTo(kLoopback, pair.Port(), &pair.Payload()[i * payload_size], payload_size)
+                     .has_value())
+            {
+                state.SkipWithError("TrySendTo failed");
+                return;
+            }
+        }
+        std::size_t received{0U};
+        while (received < kBurstSize)
+        {
+            const auto result = pair.Receiver().TryReceiveWithAddress(receive_buffer.data(), receive_buffer.size());
+            if (result.has_value())
+            {
+                ++received;
+            }
+            else if (!IsWouldBlock(result.error()))
+            {
+                state.SkipWithError("TryReceiveWithAddress failed");
+                return;
+            }
+        }
+    }
+    SetCounters(state);
+}
+
+void BM_UdpSocket_MultipleMessages(benchmark::State& state)
+{
+    const auto payload_size = static_cast<std::size_t>(state.range(0));
+    LoopbackPair pair{payload_size};
+    if (!pair.IsValid())
+    {
+        state.SkipWithError("Creating the loopback sockets failed");
+        return;
+    }
+    std::vector<unsigned char> receive_buffer(payload_size * kBurstSize);
+    std::array<UdpReceiveResult, kBurstSize> results{};
+
+    for (auto _ : state)
+    {
+        std::size_t sent{0U};
+        while (sent < kBurstSize)
+        {
+            const auto result = pair.Sender().TrySendMultipleMessages(pair.Messages().subspan(sent));
+            if (!result.has_value())
+            {
+                state.SkipWithError("TrySendMultipleMessages failed");
+                return;
+            }
+            sent += result.value();
+        }
+        std::size_t received{0U};
+        while (received < kBurstSize)
+        {
+            const auto result = pair.Receiver().TryReceiveMultipleMessages(
+                receive_buffer.data(),
+                receive_buffer.size(),
+                payload_size,
+                score::cpp::span<UdpReceiveResult>{results.data(), kBurstSize - received});
+            if (result.has_value())
+            {
+                received += result.value();
+            }
+            else if (!IsWouldBlock(result.error()))
+            {
+                state.SkipWithError("TryReceiveMultipleMessages failed");
+                return;
+            }
+        }
+    }
+    SetCounters(state);
+}
+
+void BM_UdpSocket_SegmentedWithOffload(benchmark::State& state)
+{
+    const auto payload_size = static_cast<std::size_t>(state.range(0));
+    LoopbackPair pair{payload_size};
+    if (!pair.IsValid())
+    {
+        state.SkipWithError("Creating the loopback sockets failed");
+        return;
+    }
+    if (!pair.Receiver().EnableReceiveOffload().has_value())
+    {
+        state.SkipWithError("UDP receive offload is not supported");
+        return;
+    }
+    constexpr std::size_t kReceiveSlots{4U};
+    std::vector<unsigned char> receive_buffer(kMaxMessageSize * kReceiveSlots);
+    std::array<UdpReceiveResult, kReceiveSlots> results{};
+    const std::size_t burst_bytes = pair.Payload().size();
+
+    for (auto _ : state)
+    {
+        const auto sent = pair.Sender().TrySendToSegmented(kLoopback,
+                                                           pair.Port(),
+                                                           pair.Payload().data(),
+                                                           burst_bytes,
+                                                           static_cast<std::uint16_t>(payload_size));
+        if (!sent.has_value())
+        {
+            state.SkipWithError("TrySendToSegmented failed");
+            return;
+        }
+        std::size_t received_bytes{0U};
+        while (received_bytes < burst_bytes)
+        {
+            const auto result =
+                pair.Receiver().TryReceiveMultipleMessages(receive_buffer.data(),
+                                                           receive_buffer.size(),
+                                                           kMaxMessageSize,
+                                                           score::cpp::span<UdpReceiveResult>{results});
+            if (result.has_value())
+            {
+                for (std::size_t i = 0U; i < result.value(); ++i)
+                {
+                    received_bytes += static_cast<std::size_t>(results[i].length);
+                }
+            }
+            else if (!IsWouldBlock(result.error()))
+            {
+                state.SkipWithError("TryReceiveMultipleMessages failed");
+                return;
+            }
+        }
+    }
+    SetCounters(state);
+}
+
+BENCHMARK(BM_UdpSocket_SendToReceiveWithAddress)->ArgName("payload")->Arg(64)->Arg(512)->Arg(1400);
+BENCHMARK(BM_UdpSocket_MultipleMessages)->ArgName("payload")->Arg(64)->Arg(512)->Arg(1400);
+BENCHMARK(BM_UdpSocket_SegmentedWithOffload)->ArgName("payload")->Arg(64)->Arg(512)->Arg(1400);
+
+}  // namespace
+}  // namespace os
+}  // namespace score
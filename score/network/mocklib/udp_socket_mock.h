@@ -51,11 +51,31 @@ class UdpSocketMock : public UdpSocket
          const std::size_t msg_length),
         (noexcept, override));
 
+    MOCK_METHOD((score::cpp::expected<std::size_t, score::os::Error>),
+                TryReceiveMultipleMessages,
+                (unsigned char* const recv_bufs,
+                 const std::size_t recv_buffer_size,
+                 const std::size_t msg_length,
+                 const score::cpp::span<UdpReceiveResult> results),
+                (noexcept, override));
+
     MOCK_METHOD((score::cpp::expected<ssize_t, Error>),
                 TrySendTo,
                 (const Ipv4Address&, const std::uint16_t, const unsigned char*, std::size_t),
                 (noexcept, override));
 
+    MOCK_METHOD((score::cpp::expected<std::size_t, score::os::Error>),
+                TrySendMultipleMessages,
+                (const score::cpp::span<const UdpSendMessage>),
+                (noexcept, override));
+
+    MOCK_METHOD((score::cpp::expected<ssize_t, Error>),
+                TrySendToSegmented,
+                (const Ipv4Address&, const std::uint16_t, const unsigned char*, std::size_t, const std::uint16_t),
+                (noexcept, override));
+
+    MOCK_METHOD((score::cpp::expected_blank<score::os::Error>), EnableReceiveOffload, (), (noexcept, override));
+
     MOCK_METHOD((score::cpp::expected_blank<score::os::Error>),
                 SetSocketOption,
                 (const std::int32_t, const std::int32_t, const void*, const socklen_t),
@@ -12,6 +12,14 @@
  ********************************************************************************/
 #include "score/network/sock_async/sock_ctrl.h"
 
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif  // __linux__
+
+#include <array>
+#include <cerrno>
+#include <limits>
+
 namespace score
 {
 namespace os
@@ -27,16 +35,72 @@ constexpr const std::int32_t CTRL_R_SOCK = 0;
 /* control sockets for data writing*/
 constexpr const std::int32_t CTRL_W_SOCK = 1;
 constexpr const std::uint8_t kExecMaxTime = 2;
+constexpr const std::int32_t INVALID_FD = -1;
+
+#if defined(__linux__)
+/* Maximum number of events handled per epoll_wait() call*/
+constexpr const std::int32_t MAX_EPOLL_EVENTS = 64;
+/* epoll event data of the control socket, never a valid socket slot since generations start at 1*/
+constexpr const std::uint64_t EPOLL_CTRL_EVENT = 0U;
+/* One-shot edge-triggered read readiness, re-armed with EPOLL_CTL_MOD by the next read request*/
+constexpr const std::uint32_t EPOLL_SOCKET_EVENTS = static_cast<std::uint32_t>(EPOLLIN) |
+                                                    static_cast<std::uint32_t>(EPOLLET) |
+                                                    static_cast<std::uint32_t>(EPOLLONESHOT);
+
+std::uint64_t MakeEpollEventData(const std::int32_t socket_fd, const std::uint32_t generation) noexcept
+{
+    return (static_cast<std::uint64_t>(generation) << 32U) | static_cast<std::uint32_t>(socket_fd);
+}
+#endif  // __linux__
+
+SocketCtrlBackend SelectBackend(const SocketCtrlBackend backend) noexcept
+{
+#if defined(__linux__)
+    return backend;
+#else
+    static_cast<void>(backend);
+    return SocketCtrlBackend::kPoll;
+#endif  // __linux__
+}
 
 }  // namespace
 
-SocketCtrl::SocketCtrl() noexcept : closeCtrl_{false}, read_pool_{1}, write_pool_{1}
+SocketCtrl::SocketCtrl(const SocketCtrlBackend backend) noexcept
+    : closeCtrl_{false}, backend_{SelectBackend(backend)}, epoll_fd_{INVALID_FD}, read_pool_{1}, write_pool_{1}
 {
     monitored_sockets_num_ = 0;
     if (socketpair(AF_UNIX, SOCK_STREAM, 0, ctrl_sockets_.data()) < 0)
     {
         mw::log::LogError(kLogContext) << "Socketpair create error";
     }
+
+#if defined(__linux__)
+    if (backend_ == SocketCtrlBackend::kEpoll)
+    {
+        epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+        struct epoll_event ctrl_event{};
+        ctrl_event.events = static_cast<std::uint32_t>(EPOLLIN);
+        ctrl_event.data.u64 = EPOLL_CTRL_EVENT;
+        if ((epoll_fd_ < 0) || (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, ctrl_sockets_[CTRL_R_SOCK], &ctrl_event) < 0))
+        {
+            mw::log::LogError(kLogContext) << "Epoll create error, falling back to poll";
+            if (epoll_fd_ >= 0)
+            {
+                close(epoll_fd_);
+                epoll_fd_ = INVALID_FD;
+            }
+            backend_ = SocketCtrlBackend::kPoll;
+        }
+        else
+        {
+            read_pool_.Post([this](const score::cpp::stop_token& token) mutable {
+                this->HandleEpoll(token);
+            });
+            return;
+        }
+    }
+#endif  // __linux__
+
     struct pollfd fds;
     fds.fd = ctrl_sockets_[CTRL_R_SOCK];
     fds.events = POLLIN;
@@ -50,12 +114,23 @@ SocketCtrl::SocketCtrl() noexcept : closeCtrl_{false}, read_pool_{1}, write_pool
 
 SocketCtrl::~SocketCtrl()
 {
+    // The polling thread accesses the members, thus it has to be stopped even if no SocketFactory did.
+    StopPoll(CtrlMsg(CtrlMsg::OprType::STOP_OPR, 0));
     std::unique_lock<std::mutex> lock(mtx_);
     cv_.wait_for(lock, std::chrono::seconds(kExecMaxTime), [this]() -> bool {
         return (this->closeCtrl_.load() == true);
     });
     close(ctrl_sockets_[CTRL_R_SOCK]);
     close(ctrl_sockets_[CTRL_W_SOCK]);
+    if (epoll_fd_ != INVALID_FD)
+    {
+        close(epoll_fd_);
+    }
+}
+
+SocketCtrlBackend SocketCtrl::GetBackend() const noexcept
+{
+    return backend_;
 }
 
 std::int32_t SocketCtrl::RequestOperation(std::shared_ptr<SocketAsync> sock, const SockReq sock_req) noexcept
@@ -68,6 +143,10 @@ std::int32_t SocketCtrl::RequestOperation(std::shared_ptr<SocketAsync> sock, con
     switch (sock_req)
     {
         case SockReq::READ:
+            if (backend_ == SocketCtrlBackend::kEpoll)
+            {
+                return ArmEpollSlot(std::move(sock));
+            }
             if (monitored_sockets_num_ >= MAX_SOCKETS)
             {
                 mw::log::LogError(kLogContext) << "Supported sockets number exceeded";
@@ -92,7 +171,11 @@ std::int32_t SocketCtrl::RequestOperation(std::shared_ptr<SocketAsync> sock, con
             /* KW_SUPPRESS_END:AUTOSAR.STYLE.SINGLE_STMT_PER_LINE: False Positive */
             break;
         case SockReq::DELETE:
-            if (monitored_sockets_num_)
+            if (backend_ == SocketCtrlBackend::kEpoll)
+            {
+                DisarmEpollSlot(sock->GetSockFD());
+            }
+            else if (monitored_sockets_num_)
             {
                 ctrl_msg = CtrlMsg(CtrlMsg::OprType::DEL_OPR, sock->GetSockFD());
                 StopPoll(ctrl_msg);
@@ -230,5 +313,178 @@ void SocketCtrl::RemoveSocket(std::int32_t socket_fd)
     }
 }
 
+void SocketCtrl::HandleEpoll(const score::cpp::stop_token token)
+{
+#if defined(__linux__)
+    score::cpp::stop_callback callback(token, [this]() noexcept {
+        if (!closeCtrl_.load())
+        {
+            CtrlMsg ctrl_msg;
+            ctrl_msg = CtrlMsg(CtrlMsg::OprType::STOP_OPR, 0);
+            StopPoll(ctrl_msg);
+        }
+    });
+
+    std::array<struct epoll_event, MAX_EPOLL_EVENTS> events{};
+    while (true)
+    {
+        const std::int32_t ready = epoll_wait(epoll_fd_, events.data(), MAX_EPOLL_EVENTS, -1);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            mw::log::LogError(kLogContext) << "Epoll wait failed";
+            std::lock_guard<std::mutex> lock(mtx_);
+            closeCtrl_.store(true);
+            cv_.notify_all();
+            return;
+        }
+
+        for (std::size_t i = 0U; i < static_cast<std::size_t>(ready); i++)
+        {
+            if (events[i].data.u64 == EPOLL_CTRL_EVENT)
+            {
+                if (!HandleEpollCtrlMessage())
+                {
+                    return;
+                }
+                continue;
+            }
+            // Only sockets with a pending read request are visited, events of a former registration are dropped.
+            const auto socket = TakeEpollSlot(events[i].data.u64);
+            if (socket)
+            {
+                socket->Read(socket->GetReadBuffer(), socket->GetReadCb());
+            }
+        }
+    }
+#else
+    static_cast<void>(token);
+#endif  // __linux__
+}
+
+bool SocketCtrl::HandleEpollCtrlMessage()
+{
+    CtrlMsg ctrl_msg;
+    const ssize_t bytes_received = read(ctrl_sockets_[CTRL_R_SOCK], &ctrl_msg, sizeof(CtrlMsg));
+    if (bytes_received == -1)
+    {
+        mw::log::LogError(kLogContext) << "Data shall be available at ctrl socket!!!";
+        return false;
+    }
+    switch (ctrl_msg.type_)
+    {
+        case CtrlMsg::OprType::ADD_OPR:
+        // Intentional fall-through
+        case CtrlMsg::OprType::DEL_OPR:
+            // Sockets are armed and disarmed by RequestOperation() directly
+            mw::log::LogError(kLogContext) << "Control message ignored by epoll backend";
+            return true;
+        case CtrlMsg::OprType::STOP_OPR:
+        {
+            std::lock_guard<std::mutex> lock(mtx_);
+            closeCtrl_.store(true);
+            cv_.notify_all();
+        }
+            return false;
+        case CtrlMsg::OprType::NONE:
+        // Intentional fall-through
+        default:
+            mw::log::LogError(kLogContext) << "Unsupported operation!!!";
+            {
+                std::lock_guard<std::mutex> lock(mtx_);
+                closeCtrl_.store(true);
+            }
+            return false;
+    }
+}
+
+std::int32_t SocketCtrl::ArmEpollSlot(std::shared_ptr<SocketAsync> sock)
+{
+#if defined(__linux__)
+    const std::int32_t socket_fd = sock->GetSockFD();
+    if (socket_fd < 0)
+    {
+        mw::log::LogError(kLogContext) << "Invalid socket";
+        return kExitFailure;
+    }
+
+    std::lock_guard<std::mutex> lock(epoll_slots_mtx_);
+    const auto index = static_cast<std::size_t>(socket_fd);
+    if (index >= epoll_slots_.size())
+    {
+        epoll_slots_.resize(index + 1U);
+    }
+    EpollSlot& slot = epoll_slots_[index];
+    slot.generation = (slot.generation == std::numeric_limits<std::uint32_t>::max()) ? 1U : (slot.generation + 1U);
+
+    struct epoll_event event{};
+    event.events = EPOLL_SOCKET_EVENTS;
+    event.data.u64 = MakeEpollEventData(socket_fd, slot.generation);
+
+    // Modifying re-arms the one-shot registration and reports data that arrived in between. A descriptor that was
+    // closed since its last registration was removed from the epoll instance by the kernel and has to be added again.
+    std::int32_t ret = INVALID_FD;
+    if (slot.registered)
+    {
+        ret = epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, socket_fd, &event);
+        slot.registered = (ret == 0) || (errno != ENOENT);
+    }
+    if (!slot.registered)
+    {
+        ret = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, socket_fd, &event);
+    }
+    if (ret < 0)
+    {
+        mw::log::LogError(kLogContext) << "Failed to arm socket";
+        return kExitFailure;
+    }
+    slot.registered = true;
+    slot.socket = std::move(sock);
+    return kExitSuccess;
+#else
+    static_cast<void>(sock);
+    return kExitNotSupported;
+#endif  // __linux__
+}
+
+void SocketCtrl::DisarmEpollSlot(const std::int32_t socket_fd)
+{
+#if defined(__linux__)
+    std::lock_guard<std::mutex> lock(epoll_slots_mtx_);
+    if ((socket_fd < 0) || (static_cast<std::size_t>(socket_fd) >= epoll_slots_.size()))
+    {
+        mw::log::LogInfo(kLogContext) << "Nothing to delete. Socket was not armed";
+        return;
+    }
+    EpollSlot& slot = epoll_slots_[static_cast<std::size_t>(socket_fd)];
+    slot.socket.reset();
+    // Invalidates events that are already queued for the former registration
+    slot.generation = (slot.generation == std::numeric_limits<std::uint32_t>::max()) ? 1U : (slot.generation + 1U);
+    if (slot.registered)
+    {
+        static_cast<void>(epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, socket_fd, nullptr));
+        slot.registered = false;
+    }
+#else
+    static_cast<void>(socket_fd);
+#endif  // __linux__
+}
+
+std::shared_ptr<SocketAsync> SocketCtrl::TakeEpollSlot(const std::uint64_t event_data)
+{
+    const auto index = static_cast<std::size_t>(event_data & std::numeric_limits<std::uint32_t>::max());
+    const auto generation = static_cast<std::uint32_t>(event_data >> 32U);
+
+    std::lock_guard<std::mutex> lock(epoll_slots_mtx_);
+    if ((index >= epoll_slots_.size()) || (epoll_slots_[index].generation != generation))
+    {
+        return nullptr;
+    }
+    return std::move(epoll_slots_[index].socket);
+}
+
 }  // namespace os
 }  // namespace score
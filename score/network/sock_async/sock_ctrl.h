@@ -22,7 +22,9 @@
 #include "score/mw/log/logging.h"
 
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <vector>
 namespace score
 {
 namespace os
@@ -53,10 +55,22 @@ enum class SockReq : std::uint8_t
     DELETE = 3
 };
 
+/// @brief Readiness notification mechanism used by SocketCtrl to wait for readable sockets.
+enum class SocketCtrlBackend : std::uint8_t
+{
+    /// poll() on a list of file descriptors that is rescanned on every wakeup. Sockets are added and removed through
+    /// the control socket, i.e. by the polling thread. Limited to 20 sockets.
+    kPoll = 0,
+    /// Edge-triggered epoll with a slot table indexed by file descriptor. Sockets are (re-)armed and removed by the
+    /// requesting thread in O(1), only ready sockets are visited on wakeup. Not limited in the number of sockets.
+    /// Only available on Linux, falls back to kPoll on other operating systems.
+    kEpoll = 1
+};
+
 class SocketCtrl final
 {
   public:
-    SocketCtrl() noexcept;
+    explicit SocketCtrl(const SocketCtrlBackend backend = SocketCtrlBackend::kPoll) noexcept;
 
     SocketCtrl(SocketCtrl&&) noexcept = delete;
     SocketCtrl(const SocketCtrl&) = delete;
@@ -65,12 +79,34 @@ class SocketCtrl final
     ~SocketCtrl();
     std::int32_t RequestOperation(std::shared_ptr<SocketAsync> sock, const SockReq sock_req) noexcept;
     void StopPoll(const CtrlMsg ctrl_msg);
+    SocketCtrlBackend GetBackend() const noexcept;
     std::atomic_bool closeCtrl_;
 
   protected:
   private:
+    /// @brief Entry of the epoll slot table, indexed by the file descriptor of the socket.
+    struct EpollSlot
+    {
+        /// Socket waiting for readability, empty if no read is requested.
+        std::shared_ptr<SocketAsync> socket;
+        /// Incremented on every (re-)arm, carried in the epoll event to detect events of a former registration.
+        std::uint32_t generation{0U};
+        /// Whether the file descriptor was added to the epoll instance.
+        bool registered{false};
+    };
+
     void HandlePoll(const score::cpp::stop_token token);
     void RemoveSocket(std::int32_t socket_fd);
+    void HandleEpoll(const score::cpp::stop_token token);
+    bool HandleEpollCtrlMessage();
+    std::int32_t ArmEpollSlot(std::shared_ptr<SocketAsync> sock);
+    void DisarmEpollSlot(const std::int32_t socket_fd);
+    std::shared_ptr<SocketAsync> TakeEpollSlot(const std::uint64_t event_data);
+
+    SocketCtrlBackend backend_;
+    std::int32_t epoll_fd_;
+    std::vector<EpollSlot> epoll_slots_;
+    std::mutex epoll_slots_mtx_;
     concurrency::ThreadPool read_pool_;
     concurrency::ThreadPool write_pool_;
     std::array<std::int32_t, 2> ctrl_sockets_;
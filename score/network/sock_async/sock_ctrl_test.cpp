@@ -0,0 +1,222 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/network/sock_async/sock_ctrl.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace score
+{
+namespace os
+{
+namespace
+{
+
+constexpr std::chrono::milliseconds kTestExecMaxTime{2000};
+constexpr std::chrono::milliseconds kTestExecShortMaxTime{100};
+
+/// Datagram socket connected to a peer within the same process, used to drive SocketCtrl with real readiness events.
+class LocalDatagramSocket final : public SocketAsync
+{
+  public:
+    LocalDatagramSocket() noexcept : SocketAsync(Endpoint{}), peer_fd_{-1}
+    {
+        std::array<std::int32_t, 2> fds{-1, -1};
+        if (socketpair(AF_UNIX, SOCK_DGRAM, 0, fds.data()) == 0)
+        {
+            socket_fd_ = fds[0];
+            peer_fd_ = fds[1];
+        }
+    }
+
+    LocalDatagramSocket(LocalDatagramSocket&&) noexcept = delete;
+    LocalDatagramSocket(const LocalDatagramSocket&) = delete;
+    LocalDatagramSocket& operator=(LocalDatagramSocket&&) & noexcept = delete;
+    LocalDatagramSocket& operator=(const LocalDatagramSocket&) & noexcept = delete;
+
+    ~LocalDatagramSocket() override
+    {
+        close(socket_fd_);
+        close(peer_fd_);
+    }
+
+    std::int32_t GetSockFD() const noexcept override
+    {
+        return socket_fd_;
+    }
+
+    void SendFromPeer(const std::uint8_t value) const noexcept
+    {
+        static_cast<void>(send(peer_fd_, &value, sizeof(value), 0));
+    }
+
+  private:
+    std::int32_t peer_fd_;
+};
+
+class SocketCtrlTest : public testing::TestWithParam<SocketCtrlBackend>
+{
+  public:
+    std::shared_ptr<std::vector<score::cpp::span<std::uint8_t>>> MakeBuffer()
+    {
+        return std::make_shared<std::vector<score::cpp::span<std::uint8_t>>>(
+            1U, score::cpp::span<std::uint8_t>{buffer_.data(), buffer_.size()});
+    }
+
+    std::int32_t RequestRead(SocketCtrl& ctrl, const std::shared_ptr<LocalDatagramSocket>& socket)
+    {
+        static_cast<void>(socket->ReadAsync(MakeBuffer(), [this](auto, const ssize_t size) {
+            last_size_.store(size);
+            reads_.fetch_add(1);
+        }));
+        return ctrl.RequestOperation(socket, SockReq::READ);
+    }
+
+    bool WaitForReads(const std::int32_t expected,
+                      const std::chrono::milliseconds max_time = kTestExecMaxTime) const
+    {
+        const auto deadline = std::chrono::steady_clock::now() + max_time;
+        while ((reads_.load() < expected) && (std::chrono::steady_clock::now() < deadline))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return reads_.load() == expected;
+    }
+
+    std::array<std::uint8_t, 16> buffer_{};
+    std::atomic<std::int32_t> reads_{0};
+    std::atomic<ssize_t> last_size_{0};
+};
+
+TEST_P(SocketCtrlTest, ReadsDataArrivingAfterRequest)
+{
+    RecordProperty("Description", "Verifies that a read request is served once data arrives at the socket");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    SocketCtrl ctrl{GetParam()};
+    const auto socket = std::make_shared<LocalDatagramSocket>();
+
+    ASSERT_EQ(RequestRead(ctrl, socket), kExitSuccess);
+    socket->SendFromPeer(42U);
+
+    ASSERT_TRUE(WaitForReads(1));
+    EXPECT_EQ(last_size_.load(), 1);
+    EXPECT_EQ(buffer_[0], 42U);
+}
+
+TEST_P(SocketCtrlTest, ReadsDataPendingBeforeRequest)
+{
+    RecordProperty("Description", "Verifies that data received before the read request is reported");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    SocketCtrl ctrl{GetParam()};
+    const auto socket = std::make_shared<LocalDatagramSocket>();
+    socket->SendFromPeer(7U);
+
+    ASSERT_EQ(RequestRead(ctrl, socket), kExitSuccess);
+
+    ASSERT_TRUE(WaitForReads(1));
+    EXPECT_EQ(buffer_[0], 7U);
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends,
+                         SocketCtrlTest,
+                         testing::Values(SocketCtrlBackend::kPoll, SocketCtrlBackend::kEpoll));
+
+#if defined(__linux__)
+
+using SocketCtrlEpollTest = SocketCtrlTest;
+
+TEST_F(SocketCtrlEpollTest, ReportsSelectedBackend)
+{
+    RecordProperty("Description", "Verifies that the epoll backend is used when selected on Linux");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    const SocketCtrl ctrl{SocketCtrlBackend::kEpoll};
+    EXPECT_EQ(ctrl.GetBackend(), SocketCtrlBackend::kEpoll);
+    const SocketCtrl default_ctrl{};
+    EXPECT_EQ(default_ctrl.GetBackend(), SocketCtrlBackend::kPoll);
+}
+
+TEST_F(SocketCtrlEpollTest, ServesEveryRequestOfRearmedSocket)
+{
+    RecordProperty("Description", "Verifies that a socket can be re-armed for each datagram it receives");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    SocketCtrl ctrl{SocketCtrlBackend::kEpoll};
+    const auto socket = std::make_shared<LocalDatagramSocket>();
+
+    for (std::int32_t i = 1; i <= 3; i++)
+    {
+        ASSERT_EQ(RequestRead(ctrl, socket), kExitSuccess);
+        socket->SendFromPeer(static_cast<std::uint8_t>(i));
+        ASSERT_TRUE(WaitForReads(i));
+        EXPECT_EQ(buffer_[0], static_cast<std::uint8_t>(i));
+    }
+}
+
+TEST_F(SocketCtrlEpollTest, DeletedRequestIsNotServed)
+{
+    RecordProperty("Description", "Verifies that a deleted read request does not invoke its callback");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    SocketCtrl ctrl{SocketCtrlBackend::kEpoll};
+    const auto socket = std::make_shared<LocalDatagramSocket>();
+    ASSERT_EQ(RequestRead(ctrl, socket), kExitSuccess);
+
+    ASSERT_EQ(ctrl.RequestOperation(socket, SockReq::DELETE), kExitSuccess);
+    socket->SendFromPeer(1U);
+
+    EXPECT_FALSE(WaitForReads(1, kTestExecShortMaxTime));
+}
+
+TEST_F(SocketCtrlEpollTest, IsNotLimitedToTwentySockets)
+{
+    RecordProperty("Description", "Verifies that the epoll backend serves more sockets than the poll backend");
+    RecordProperty("TestingTechnique", "Requirements-based test");
+    RecordProperty("DerivationTechnique", "requirements-analysis");
+
+    constexpr std::int32_t kSocketCount{100};
+    SocketCtrl ctrl{SocketCtrlBackend::kEpoll};
+    std::vector<std::shared_ptr<LocalDatagramSocket>> sockets{};
+    for (std::int32_t i = 0; i < kSocketCount; i++)
+    {
+        sockets.push_back(std::make_shared<LocalDatagramSocket>());
+        ASSERT_EQ(RequestRead(ctrl, sockets.back()), kExitSuccess);
+    }
+
+    for (const auto& socket : sockets)
+    {
+        socket->SendFromPeer(1U);
+    }
+
+    EXPECT_TRUE(WaitForReads(kSocketCount));
+}
+
+#endif  // __linux__
+
+}  // namespace
+}  // namespace os
+}  // namespace score
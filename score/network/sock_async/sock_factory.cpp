@@ -16,7 +16,10 @@ namespace score
 {
 namespace os
 {
-SocketFactory::SocketFactory() noexcept : sock_ctrl_(std::make_shared<SocketCtrl>()) {}
+SocketFactory::SocketFactory(const SocketCtrlBackend backend) noexcept
+    : sock_ctrl_(std::make_shared<SocketCtrl>(backend))
+{
+}
 
 SocketFactory::~SocketFactory()
 {
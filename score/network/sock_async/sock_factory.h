@@ -33,7 +33,8 @@ enum class SockType : std::uint8_t
 class SocketFactory final
 {
   public:
-    SocketFactory() noexcept;
+    /// @param backend Readiness notification mechanism of the SocketCtrl shared by all created sockets.
+    explicit SocketFactory(const SocketCtrlBackend backend = SocketCtrlBackend::kPoll) noexcept;
 
     SocketFactory(SocketFactory&&) noexcept = delete;
     SocketFactory(const SocketFactory&) = delete;
@@ -22,6 +22,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif  // __linux__
+
+#include <array>
+#include <cstring>
+#include <vector>
+
 namespace score
 {
 namespace os
@@ -529,6 +537,263 @@ TEST_F(AUdpSocketWithMockedPosix, HandlesTheReturnedErrorFromSetSockOptWhenCalli
     ASSERT_THAT(status.error(), Eq(ERROR));
 }
 
+TEST_F(AUdpSocketWithMockedPosix, TryReceiveMultipleMessagesWritesResultsToCallerOwnedSpan)
+{
+    constexpr auto kVlen = 3U;
+    constexpr auto kMaxMsgSize = sizeof(std::uint32_t);
+    constexpr std::int32_t kSegmentSize{2};
+
+    std::array<std::array<unsigned char, kMaxMsgSize>, kVlen> buffer{};
+    std::array<UdpReceiveResult, kVlen> results{};
+
+    sockaddr_in source_address{};
+    source_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    // Given two pending messages, the second one holding coalesced datagrams
+    EXPECT_CALL(*socket_mock, recvmmsg(_, _, kVlen, _, _))
+        .WillOnce([source_address](const std::int32_t /*sockfd*/,
+                                   mmsghdr* msgvec,
+                                   const unsigned int /*vlen*/,
+                                   const Socket::MessageFlag /*flags*/,
+                                   timespec*) {
+            for (auto i = 0U; i < 2U; ++i)
+            {
+                mmsghdr& msg = msgvec[i];
+                msg.msg_len = kMaxMsgSize;
+                const std::uint32_t payload{i + 1U};
+                ::memcpy(msg.msg_hdr.msg_iov->iov_base, &payload, sizeof(payload));
+                ::memcpy(msg.msg_hdr.msg_name, &source_address, sizeof(source_address));
+                msg.msg_hdr.msg_controllen = 0U;
+            }
+#if defined(UDP_GRO)
+            msghdr& coalesced = msgvec[1].msg_hdr;
+            coalesced.msg_controllen = CMSG_SPACE(sizeof(kSegmentSize));
+            cmsghdr* const control = CMSG_FIRSTHDR(&coalesced);
+            control->cmsg_level = SOL_UDP;
+            control->cmsg_type = UDP_GRO;
+            control->cmsg_len = CMSG_LEN(sizeof(kSegmentSize));
+            const std::int32_t segment_size{kSegmentSize};
+            ::memcpy(CMSG_DATA(control), &segment_size, sizeof(segment_size));
+#endif
+            return 2;
+        });
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    // When receiving into the caller owned results
+    const auto ret = socket.TryReceiveMultipleMessages(
+        buffer.at(0).begin(), sizeof(buffer), kMaxMsgSize, score::cpp::span<UdpReceiveResult>{results});
+
+    // Then only the received messages are reported
+    ASSERT_TRUE(ret.has_value());
+    ASSERT_EQ(ret.value(), 2U);
+    for (auto i = 0U; i < 2U; ++i)
+    {
+        std::uint32_t payload{};
+        ::memcpy(&payload, &buffer[i], sizeof(payload));
+        EXPECT_EQ(payload, i + 1U);
+        EXPECT_EQ(results[i].length, kMaxMsgSize);
+        EXPECT_EQ(results[i].sender.ToString(), "127.0.0.1");
+    }
+    EXPECT_EQ(results[0].segment_size, 0U);
+#if defined(UDP_GRO)
+    EXPECT_EQ(results[1].segment_size, kSegmentSize);
+#endif
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TryReceiveMultipleMessagesContinuesWithNextBatchWhileBatchesAreFull)
+{
+    constexpr auto kVlen = 100U;
+    constexpr auto kMaxMsgSize = 1U;
+
+    std::array<unsigned char, kVlen * kMaxMsgSize> buffer{};
+    std::array<UdpReceiveResult, kVlen> results{};
+
+    // Expecting that the first batch is full and the second one is only partially filled
+    testing::InSequence sequence{};
+    EXPECT_CALL(*socket_mock, recvmmsg(_, _, 64U, _, _)).WillOnce(Return(64));
+    EXPECT_CALL(*socket_mock, recvmmsg(_, _, kVlen - 64U, _, _)).WillOnce(Return(10));
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret = socket.TryReceiveMultipleMessages(
+        buffer.data(), buffer.size(), kMaxMsgSize, score::cpp::span<UdpReceiveResult>{results});
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(ret.value(), 74U);
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TryReceiveMultipleMessagesFailsWhenRecvmmsgErrors)
+{
+    std::array<unsigned char, 8U> buffer{};
+    std::array<UdpReceiveResult, 2U> results{};
+
+    EXPECT_CALL(*socket_mock, recvmmsg).WillOnce(Return(kAcessUnExpectedError));
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret = socket.TryReceiveMultipleMessages(
+        buffer.data(), buffer.size(), 4U, score::cpp::span<UdpReceiveResult>{results});
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(ret.error(), kAcessUnExpectedError.error());
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TryReceiveMultipleMessagesAssertsWhenProvidedResultsExceedBuffer)
+{
+    std::array<unsigned char, 4U> buffer{};
+    std::array<UdpReceiveResult, 2U> results{};
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    EXPECT_DEATH(socket.TryReceiveMultipleMessages(
+                     buffer.data(), buffer.size(), 4U, score::cpp::span<UdpReceiveResult>{results}),
+                 "");
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TrySendMultipleMessagesPassesAllMessagesToSendmmsg)
+{
+    std::array<unsigned char, 4U> payload{1U, 2U, 3U, 4U};
+    const auto destination = GetSockAddrInFromIpAndPort(Ipv4Address{"1.12.123.13"}, 42U).value();
+    const std::array<UdpSendMessage, 2U> messages{UdpSendMessage{payload.data(), 4U, destination},
+                                                  UdpSendMessage{payload.data(), 2U, destination}};
+
+    EXPECT_CALL(*socket_mock, sendmmsg(_, _, 2U, _))
+        .WillOnce([&payload, &destination](const std::int32_t /*sockfd*/,
+                                           const mmsghdr* msgvec,
+                                           const std::uint32_t vlen,
+                                           const Socket::MessageFlag /*flags*/) {
+            EXPECT_EQ(msgvec[0].msg_hdr.msg_iov->iov_base, payload.data());
+            EXPECT_EQ(msgvec[0].msg_hdr.msg_iov->iov_len, 4U);
+            EXPECT_EQ(msgvec[1].msg_hdr.msg_iov->iov_len, 2U);
+            EXPECT_EQ(msgvec[1].msg_hdr.msg_namelen, sizeof(sockaddr_in));
+            EXPECT_EQ(::memcmp(msgvec[1].msg_hdr.msg_name, &destination, sizeof(destination)), 0);
+            return static_cast<std::int32_t>(vlen);
+        });
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret = socket.TrySendMultipleMessages(score::cpp::span<const UdpSendMessage>{messages});
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(ret.value(), 2U);
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TrySendMultipleMessagesSplitsLargeBatchesAndStopsWhenSocketBufferIsFull)
+{
+    constexpr auto kMessageCount = 200U;
+    std::array<unsigned char, 1U> payload{};
+    std::vector<UdpSendMessage> messages(kMessageCount, UdpSendMessage{payload.data(), payload.size(), {}});
+
+    // Expecting that the second batch is only partially sent, thus the remaining messages are not tried
+    testing::InSequence sequence{};
+    EXPECT_CALL(*socket_mock, sendmmsg(_, _, 64U, _)).WillOnce(Return(64)).WillOnce(Return(3));
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret =
+        socket.TrySendMultipleMessages(score::cpp::span<const UdpSendMessage>{messages.data(), messages.size()});
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(ret.value(), 67U);
+}
+
+TEST_F(AUdpSocketWithMockedPosix, TrySendMultipleMessagesFailsOnlyWhenNoMessageWasSent)
+{
+    std::array<unsigned char, 1U> payload{};
+    std::vector<UdpSendMessage> messages(70U, UdpSendMessage{payload.data(), payload.size(), {}});
+
+    testing::InSequence sequence{};
+    EXPECT_CALL(*socket_mock, sendmmsg(_, _, _, _)).WillOnce(Return(kAcessUnExpectedError));
+    EXPECT_CALL(*socket_mock, sendmmsg(_, _, _, _)).WillOnce(Return(64)).WillOnce(Return(kAcessUnExpectedError));
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+    const score::cpp::span<const UdpSendMessage> span{messages.data(), messages.size()};
+
+    const auto failed = socket.TrySendMultipleMessages(span);
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.error(), kAcessUnExpectedError.error());
+
+    const auto partially_sent = socket.TrySendMultipleMessages(span);
+    ASSERT_TRUE(partially_sent.has_value());
+    EXPECT_EQ(partially_sent.value(), 64U);
+}
+
+#if defined(UDP_SEGMENT)
+TEST_F(AUdpSocketWithMockedPosix, TrySendToSegmentedPassesSegmentSizeAsControlMessage)
+{
+    constexpr std::uint16_t kSegmentSize{100U};
+    std::array<unsigned char, 1000U> buffer{};
+
+    EXPECT_CALL(*socket_mock, sendmsg(_, _, _))
+        .WillOnce([&buffer, kSegmentSize](
+                      const std::int32_t /*sockfd*/, const msghdr* message, const Socket::MessageFlag /*flags*/) {
+            EXPECT_EQ(message->msg_iov->iov_base, buffer.data());
+            EXPECT_EQ(message->msg_iov->iov_len, buffer.size());
+            cmsghdr* const control = CMSG_FIRSTHDR(message);
+            EXPECT_NE(control, nullptr);
+            EXPECT_EQ(control->cmsg_level, SOL_UDP);
+            EXPECT_EQ(control->cmsg_type, UDP_SEGMENT);
+            std::uint16_t segment_size{};
+            ::memcpy(&segment_size, CMSG_DATA(control), sizeof(segment_size));
+            EXPECT_EQ(segment_size, kSegmentSize);
+            return static_cast<ssize_t>(message->msg_iov->iov_len);
+        });
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret =
+        socket.TrySendToSegmented(Ipv4Address{"1.12.123.13"}, 42U, buffer.data(), buffer.size(), kSegmentSize);
+    ASSERT_TRUE(ret.has_value());
+    EXPECT_EQ(ret.value(), buffer.size());
+}
+#endif  // UDP_SEGMENT
+
+TEST_F(AUdpSocketWithMockedPosix, TrySendToSegmentedRejectsZeroSegmentSize)
+{
+    std::array<unsigned char, 10U> buffer{};
+    EXPECT_CALL(*socket_mock, sendmsg(_, _, _)).Times(0);
+    EXPECT_CALL(*socket_mock, sendto(_, _, _, _, _, _)).Times(0);
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto ret = socket.TrySendToSegmented(Ipv4Address{"1.12.123.13"}, 42U, buffer.data(), buffer.size(), 0U);
+    ASSERT_FALSE(ret.has_value());
+    EXPECT_EQ(ret.error(), score::os::Error::createFromErrno(EINVAL));
+}
+
+TEST_F(AUdpSocketWithMockedPosix, EnableReceiveOffloadSetsUdpGroSocketOption)
+{
+#if defined(UDP_GRO)
+    EXPECT_CALL(*socket_mock, setsockopt(_, SOL_UDP, UDP_GRO, _, sizeof(std::int32_t)));
+#endif
+
+    auto socket_expected = UdpSocket::Make();
+    ASSERT_TRUE(socket_expected.has_value());
+    UdpSocket socket = std::move(socket_expected.value());
+
+    const auto status = socket.EnableReceiveOffload();
+#if defined(UDP_GRO)
+    EXPECT_TRUE(status.has_value());
+#else
+    ASSERT_FALSE(status.has_value());
+    EXPECT_EQ(status.error(), score::os::Error::createFromErrno(ENOPROTOOPT));
+#endif
+}
+
 }  // namespace
 
 }  // namespace os
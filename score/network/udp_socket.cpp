@@ -19,6 +19,13 @@
 #include <score/assert.hpp>
 #include <score/vector.hpp>
 
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif  // __linux__
+
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <tuple>
 
 // Note 1
@@ -29,6 +36,36 @@ namespace
 {
 constexpr std::int32_t INVALID_SOCKET_ID = -1;
 
+// Number of message headers kept on the stack by the batch operations, larger batches take several system calls.
+constexpr std::size_t kMaxBatchSize{64U};
+
+// Control message buffer large enough for the segment size reported by UDP generic receive offload (an int).
+union SegmentSizeControlBuffer
+{
+    cmsghdr alignment;
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays) buffer layout is given by the POSIX CMSG_* macros
+    unsigned char buffer[CMSG_SPACE(sizeof(std::int32_t))];
+};
+
+std::uint16_t GetReceivedSegmentSize(msghdr& message) noexcept
+{
+#if defined(UDP_GRO)
+    for (cmsghdr* control = CMSG_FIRSTHDR(&message); control != nullptr; control = CMSG_NXTHDR(&message, control))
+    {
+        if ((control->cmsg_level == SOL_UDP) && (control->cmsg_type == UDP_GRO))
+        {
+            std::int32_t segment_size{0};
+            // NOLINTNEXTLINE(score-banned-function) control message data is not necessarily aligned
+            std::memcpy(&segment_size, CMSG_DATA(control), sizeof(segment_size));
+            return static_cast<std::uint16_t>(segment_size);
+        }
+    }
+#else
+    static_cast<void>(message);
+#endif  // UDP_GRO
+    return 0U;
+}
+
 void CloseFileDescriptorIfValidAndIgnoreError(
     const score::cpp::expected<std::int32_t, score::os::Error>& file_descriptor)
 {
@@ -261,6 +298,70 @@ score::os::UdpSocket::TryReceiveMultipleMessagesWithAddress(unsigned char* const
     }
 }
 
+score::cpp::expected<std::size_t, score::os::Error> score::os::UdpSocket::TryReceiveMultipleMessages(
+    unsigned char* const recv_bufs,
+    const std::size_t recv_buffer_size,
+    const std::size_t msg_length,
+    const score::cpp::span<UdpReceiveResult> results) noexcept
+{
+    const auto result_count = static_cast<std::size_t>(results.size());
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(!((result_count * msg_length) > recv_buffer_size));
+    std::array<struct mmsghdr, kMaxBatchSize> msgs{};
+    std::array<struct iovec, kMaxBatchSize> iovecs{};
+    std::array<struct sockaddr_in, kMaxBatchSize> sock_from{};
+    std::array<SegmentSizeControlBuffer, kMaxBatchSize> controls{};
+    constexpr struct timespec* const timeout = nullptr;
+
+    std::size_t received{0U};
+    while (received < result_count)
+    {
+        const std::size_t batch = std::min(kMaxBatchSize, result_count - received);
+        for (auto i = 0U; i < batch; ++i)
+        {
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            // iovec and the control message buffer are given by the POSIX standard
+            // coverity[autosar_cpp14_m5_0_15_violation] : safe use of pointer arithmetic
+            iovecs[i].iov_base = static_cast<void*>(&recv_bufs[(received + i) * msg_length]);
+            iovecs[i].iov_len = msg_length;
+            msgs[i] = mmsghdr{};
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1U;
+            msgs[i].msg_hdr.msg_name = &sock_from[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            msgs[i].msg_hdr.msg_control = controls[i].buffer;
+            msgs[i].msg_hdr.msg_controllen = sizeof(controls[i].buffer);
+            // NOLINTEND(cppcoreguidelines-pro-type-union-access, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        const auto response_result = Socket::instance().recvmmsg(
+            file_descriptor_, msgs.data(), static_cast<unsigned int>(batch), Socket::MessageFlag::kNone, timeout);
+        if (!response_result.has_value())
+        {
+            // Messages of former batches were already consumed from the socket, thus they have to be reported
+            if (received == 0U)
+            {
+                return score::cpp::make_unexpected(response_result.error());
+            }
+            break;
+        }
+
+        const auto n_msgs = static_cast<std::size_t>(response_result.value());
+        for (auto i = 0U; i < n_msgs; ++i)
+        {
+            results[received + i] =
+                UdpReceiveResult{static_cast<ssize_t>(msgs[i].msg_len),
+                                 Ipv4Address::CreateFromUint32NetOrder(sock_from[i].sin_addr.s_addr),
+                                 GetReceivedSegmentSize(msgs[i].msg_hdr)};
+        }
+        received += n_msgs;
+        if (n_msgs < batch)
+        {
+            break;
+        }
+    }
+    return received;
+}
+
 score::cpp::expected<ssize_t, score::os::Error> score::os::UdpSocket::TrySendTo(const Ipv4Address& recipient,
                                                                                 const std::uint16_t port,
                                                                                 const unsigned char* const buffer,
@@ -292,6 +393,129 @@ score::cpp::expected<ssize_t, score::os::Error> score::os::UdpSocket::TrySendTo(
         file_descriptor_, buffer, length, Socket::MessageFlag::kNone, recipient_sockaddr, sizeof(*recipient_sockaddr));
 }
 
+score::cpp::expected<std::size_t, score::os::Error> score::os::UdpSocket::TrySendMultipleMessages(
+    const score::cpp::span<const UdpSendMessage> messages) noexcept
+{
+    const auto message_count = static_cast<std::size_t>(messages.size());
+    std::array<struct mmsghdr, kMaxBatchSize> msgs{};
+    std::array<struct iovec, kMaxBatchSize> iovecs{};
+
+    std::size_t sent{0U};
+    while (sent < message_count)
+    {
+        const std::size_t batch = std::min(kMaxBatchSize, message_count - sent);
+        for (auto i = 0U; i < batch; ++i)
+        {
+            const UdpSendMessage& message = messages[sent + i];
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast) the POSIX message header is used for sending and
+            // receiving, the data is not modified by sendmmsg()
+            // coverity[autosar_cpp14_a5_2_3_violation] : see above justification
+            iovecs[i].iov_base = const_cast<unsigned char*>(message.buffer);
+            iovecs[i].iov_len = message.length;
+            msgs[i] = mmsghdr{};
+            // coverity[autosar_cpp14_a5_2_3_violation] : see above justification
+            msgs[i].msg_hdr.msg_name = const_cast<sockaddr_in*>(&message.destination);
+            // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+            msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1U;
+        }
+
+        const auto send_result = Socket::instance().sendmmsg(
+            file_descriptor_, msgs.data(), static_cast<std::uint32_t>(batch), Socket::MessageFlag::kNone);
+        if (!send_result.has_value())
+        {
+            if (sent == 0U)
+            {
+                return score::cpp::make_unexpected(send_result.error());
+            }
+            break;
+        }
+
+        const auto n_msgs = static_cast<std::size_t>(send_result.value());
+        sent += n_msgs;
+        if (n_msgs < batch)
+        {
+            break;
+        }
+    }
+    return sent;
+}
+
+score::cpp::expected<ssize_t, score::os::Error> score::os::UdpSocket::TrySendToSegmented(
+    const Ipv4Address& recipient,
+    const std::uint16_t port,
+    const unsigned char* const buffer,
+    const std::size_t length,
+    const std::uint16_t segment_size) noexcept
+{
+    if (segment_size == 0U)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EINVAL));
+    }
+
+#if defined(UDP_SEGMENT)
+    auto recipient_sockaddr_in_expected = GetSockAddrInFromIpAndPort(recipient, port);
+    if (!recipient_sockaddr_in_expected.has_value())  // LCOV_EXCL_BR_LINE: see TrySendTo()
+    {
+        return score::cpp::make_unexpected(recipient_sockaddr_in_expected.error());  // LCOV_EXCL_LINE
+    }
+    sockaddr_in recipient_sockaddr_in = recipient_sockaddr_in_expected.value();
+
+    struct iovec iov{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) the data is not modified by sendmsg()
+    iov.iov_base = const_cast<unsigned char*>(buffer);
+    iov.iov_len = length;
+
+    SegmentSizeControlBuffer control{};
+    struct msghdr message{};
+    message.msg_name = &recipient_sockaddr_in;
+    message.msg_namelen = sizeof(recipient_sockaddr_in);
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1U;
+    message.msg_control = control.buffer;
+    message.msg_controllen = CMSG_SPACE(sizeof(segment_size));
+
+    // The segment size is passed per call, so datagrams of other sizes can be sent on the same socket.
+    cmsghdr* const control_message = CMSG_FIRSTHDR(&message);
+    control_message->cmsg_level = SOL_UDP;
+    control_message->cmsg_type = UDP_SEGMENT;
+    control_message->cmsg_len = CMSG_LEN(sizeof(segment_size));
+    // NOLINTNEXTLINE(score-banned-function) control message data is not necessarily aligned
+    std::memcpy(CMSG_DATA(control_message), &segment_size, sizeof(segment_size));
+
+    return Socket::instance().sendmsg(file_descriptor_, &message, Socket::MessageFlag::kNone);
+#else
+    std::size_t offset{0U};
+    while (offset < length)
+    {
+        const std::size_t segment_length = std::min(static_cast<std::size_t>(segment_size), length - offset);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is checked against length
+        const auto send_result = TrySendTo(recipient, port, &buffer[offset], segment_length);
+        if (!send_result.has_value())
+        {
+            if (offset == 0U)
+            {
+                return send_result;
+            }
+            break;
+        }
+        offset += segment_length;
+    }
+    return static_cast<ssize_t>(offset);
+#endif  // UDP_SEGMENT
+}
+
+score::cpp::expected_blank<score::os::Error> score::os::UdpSocket::EnableReceiveOffload() noexcept
+{
+#if defined(UDP_GRO)
+    constexpr std::int32_t enable{1};
+    return SetSocketOption(SOL_UDP, UDP_GRO, &enable, sizeof(enable));
+#else
+    return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOPROTOOPT));
+#endif  // UDP_GRO
+}
+
 score::cpp::expected_blank<score::os::Error> score::os::UdpSocket::SetSocketOption(const std::int32_t level,
                                                                                    const std::int32_t optname,
                                                                                    const void* optval,
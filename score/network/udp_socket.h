@@ -18,6 +18,7 @@
 #include "score/os/socket.h"
 
 #include <score/expected.hpp>
+#include <score/span.hpp>
 #include <score/vector.hpp>
 
 #include <arpa/inet.h>
@@ -35,6 +36,26 @@ score::cpp::expected<sockaddr_in, score::os::Error> GetSockAddrInFromIpAndPort(c
 
 class Ipv4Address;
 
+/// @brief One datagram of a batch send. Payload and destination are owned by the caller and can be prepared once and
+/// reused for every send, e.g. by means of GetSockAddrInFromIpAndPort().
+struct UdpSendMessage
+{
+    const unsigned char* buffer;
+    std::size_t length;
+    sockaddr_in destination;
+};
+
+/// @brief Result of one received message of a batch receive.
+struct UdpReceiveResult
+{
+    /// Number of bytes written to the receive slot of this message.
+    ssize_t length;
+    Ipv4Address sender;
+    /// Size of the datagrams the kernel coalesced into this message, if receive offload is enabled. Zero if the
+    /// message holds a single datagram, i.e. the length is the datagram size.
+    std::uint16_t segment_size;
+};
+
 class UdpSocket
 {
   protected:
@@ -68,11 +89,51 @@ class UdpSocket
                                           const std::size_t vlen,
                                           const std::size_t msg_length) noexcept;
 
+    /// @brief Receives up to results.size() messages with as few system calls as possible (recvmmsg()).
+    ///
+    /// @details Message i is written to recv_bufs[i * msg_length] and its result to results[i]. Neither the results
+    /// nor any temporary message headers are allocated on the heap.
+    ///
+    /// @return The number of received messages, an error if not even a single message could be received (EAGAIN if
+    ///         none is pending).
+    virtual score::cpp::expected<std::size_t, score::os::Error> TryReceiveMultipleMessages(
+        unsigned char* const recv_bufs,
+        const std::size_t recv_buffer_size,
+        const std::size_t msg_length,
+        const score::cpp::span<UdpReceiveResult> results) noexcept;
+
     virtual score::cpp::expected<ssize_t, Error> TrySendTo(const Ipv4Address& recipient,
                                                            const std::uint16_t port,
                                                            const unsigned char* const buffer,
                                                            const std::size_t length) noexcept;
 
+    /// @brief Sends all messages with as few system calls as possible (sendmmsg()).
+    ///
+    /// @return The number of sent messages, which is less than messages.size() if the socket buffer is full, or an
+    ///         error if not even the first message could be sent.
+    virtual score::cpp::expected<std::size_t, score::os::Error> TrySendMultipleMessages(
+        const score::cpp::span<const UdpSendMessage> messages) noexcept;
+
+    /// @brief Sends the buffer as consecutive datagrams of segment_size bytes (the last one may be shorter) to the
+    /// recipient.
+    ///
+    /// @details On Linux the buffer is passed to the kernel at once and segmented by the network stack or the NIC
+    /// (UDP generic segmentation offload). The kernel limits a buffer to 64 segments and 64 KiB. On other operating
+    /// systems each datagram is sent separately.
+    ///
+    /// @return The number of sent bytes.
+    virtual score::cpp::expected<ssize_t, Error> TrySendToSegmented(const Ipv4Address& recipient,
+                                                                    const std::uint16_t port,
+                                                                    const unsigned char* const buffer,
+                                                                    const std::size_t length,
+                                                                    const std::uint16_t segment_size) noexcept;
+
+    /// @brief Allows the kernel to coalesce consecutive datagrams of the same flow into one received message (UDP
+    /// generic receive offload). The size of the original datagrams is reported by TryReceiveMultipleMessages().
+    ///
+    /// @return ENOPROTOOPT if the operating system does not support receive offload.
+    virtual score::cpp::expected_blank<score::os::Error> EnableReceiveOffload() noexcept;
+
     virtual score::cpp::expected_blank<score::os::Error> SetSocketOption(const std::int32_t level,
                                                                          const std::int32_t optname,
                                                                          const void* optval,